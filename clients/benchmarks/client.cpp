@@ -339,6 +339,19 @@ try
             "                           Used in partial SVD functions.\n"
             "                           ")
 
+        ("p",
+         value<rocblas_int>()->default_value(0),
+            "Oversampling parameter.\n"
+            "                           The number of extra columns sampled beyond rank.\n"
+            "                           Used in randomized SVD functions.\n"
+            "                           ")
+
+        ("niters",
+         value<rocblas_int>()->default_value(2),
+            "Number of power iterations.\n"
+            "                           Used in randomized SVD functions.\n"
+            "                           ")
+
         ("vl",
          value<double>(),
             "Lower bound of half-open interval (vl, vu].\n"
@@ -404,17 +417,31 @@ try
         //     "                           The order in which a series of transformations are applied.\n"
         //     "                           ")
 
-        // ("fast_alg",
-        //  value<char>()->default_value('O'),
-        //     "O = out-of-place, I = in-place.\n"
-        //     "                           Enables out-of-place computations.\n"
-        //     "                           ")
+        ("diag",
+         value<char>()->default_value('N'),
+            "N = non-unit, U = unit.\n"
+            "                           Indicates whether a triangular matrix has an implicit unit diagonal.\n"
+            "                           ")
+
+        ("fast_alg",
+         value<char>()->default_value('I'),
+            "O = out-of-place, I = in-place.\n"
+            "                           Enables out-of-place computations.\n"
+            "                           Only applicable to getri and potri batched.\n"
+            "                           ")
 
         // ("incx",
         //  value<rocblas_int>()->default_value(1),
         //     "Increment between values in vector x.\n"
         //     "                           ")
 
+        ("alg",
+         value<rocblas_int>()->default_value(0),
+            "0 = HIPSOLVER_ALG_0, 1 = HIPSOLVER_ALG_1.\n"
+            "                           Algorithm selected with hipsolverDnSetAdvOptions.\n"
+            "                           Used in functions of the 64-bit API.\n"
+            "                           ")
+
         ("itype",
          value<char>()->default_value('1'),
             "1 = Ax, 2 = ABx, 3 = BAx.\n"
@@ -479,11 +506,12 @@ try
     argus.validate_operation("trans");
     argus.validate_side("side");
     argus.validate_fill("uplo");
+    argus.validate_diag("diag");
     // argus.validate_direct("direct");
     // argus.validate_storev("storev");
     argus.validate_svect("jobu");
     argus.validate_svect("jobv");
-    // argus.validate_workmode("fast_alg");
+    argus.validate_workmode("fast_alg");
     argus.validate_itype("itype");
     argus.validate_evect("jobz");
     argus.validate_erange("range");
@@ -0,0 +1,263 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <hipsolver/hipsolver.h>
+#include <vector>
+
+// Benchmark: rank-k singular value decomposition computed with the randomized gesvdr
+// versus gesvda with the same rank. The test matrix A(i, j) = 1 / (i + j + 1) has
+// rapidly decaying singular values. Reports the time of each method and the largest
+// difference between the computed singular values, relative to the largest one.
+
+#define CHECK(STATUS)                                                            \
+    do                                                                           \
+    {                                                                            \
+        int _status = (int)(STATUS);                                             \
+        if(_status != 0)                                                         \
+        {                                                                        \
+            fprintf(stderr, "error %d at %s:%d\n", _status, __FILE__, __LINE__); \
+            exit(EXIT_FAILURE);                                                  \
+        }                                                                        \
+    } while(0)
+
+static double time_us()
+{
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int main(int argc, char* argv[])
+{
+    const int iters  = argc > 1 ? atoi(argv[1]) : 10;
+    const int k      = argc > 2 ? atoi(argv[2]) : 16;
+    const int p      = argc > 3 ? atoi(argv[3]) : 8;
+    const int niters = argc > 4 ? atoi(argv[4]) : 2;
+
+    const int sizes[] = {256, 512, 1024, 2048, 4096};
+
+    hipsolverDnHandle_t handle;
+    hipsolverDnParams_t params;
+    CHECK(hipsolverDnCreate(&handle));
+    CHECK(hipsolverDnCreateParams(&params));
+
+    printf("k = %d, p = %d, niters = %d\n", k, p, niters);
+    printf("%8s %8s %14s %14s %10s %14s\n",
+           "m",
+           "n",
+           "gesvdr_us",
+           "gesvda_us",
+           "speedup",
+           "max_rel_diff");
+    for(int n : sizes)
+    {
+        const int m   = 2 * n;
+        const int lda = m;
+
+        std::vector<double> hA(size_t(lda) * n);
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < m; i++)
+                hA[i + size_t(j) * lda] = 1.0 / (i + j + 1);
+
+        double* dA;
+        double* dSr;
+        double* dUr;
+        double* dVr;
+        double* dSa;
+        double* dUa;
+        double* dVa;
+        int*    dInfo;
+        CHECK(hipMalloc(&dA, sizeof(double) * lda * n));
+        CHECK(hipMalloc(&dSr, sizeof(double) * k));
+        CHECK(hipMalloc(&dUr, sizeof(double) * m * k));
+        CHECK(hipMalloc(&dVr, sizeof(double) * n * k));
+        CHECK(hipMalloc(&dSa, sizeof(double) * k));
+        CHECK(hipMalloc(&dUa, sizeof(double) * m * k));
+        CHECK(hipMalloc(&dVa, sizeof(double) * n * k));
+        CHECK(hipMalloc(&dInfo, sizeof(int)));
+        CHECK(hipMemcpy(dA, hA.data(), sizeof(double) * lda * n, hipMemcpyHostToDevice));
+
+        // gesvdr
+        size_t lworkOnDevice, lworkOnHost;
+        void*  dWorkR;
+        void*  hWorkR;
+        CHECK(hipsolverDnXgesvdr_bufferSize(handle,
+                                            params,
+                                            'S',
+                                            'S',
+                                            m,
+                                            n,
+                                            k,
+                                            p,
+                                            niters,
+                                            HIP_R_64F,
+                                            dA,
+                                            lda,
+                                            HIP_R_64F,
+                                            dSr,
+                                            HIP_R_64F,
+                                            dUr,
+                                            m,
+                                            HIP_R_64F,
+                                            dVr,
+                                            n,
+                                            HIP_R_64F,
+                                            &lworkOnDevice,
+                                            &lworkOnHost));
+        CHECK(hipMalloc(&dWorkR, std::max(lworkOnDevice, size_t(1))));
+        hWorkR = malloc(std::max(lworkOnHost, size_t(1)));
+
+        double start = 0;
+        for(int i = -1; i < iters; i++)
+        {
+            // the first call is a warm-up
+            if(i == 0)
+            {
+                CHECK(hipDeviceSynchronize());
+                start = time_us();
+            }
+            CHECK(hipsolverDnXgesvdr(handle,
+                                     params,
+                                     'S',
+                                     'S',
+                                     m,
+                                     n,
+                                     k,
+                                     p,
+                                     niters,
+                                     HIP_R_64F,
+                                     dA,
+                                     lda,
+                                     HIP_R_64F,
+                                     dSr,
+                                     HIP_R_64F,
+                                     dUr,
+                                     m,
+                                     HIP_R_64F,
+                                     dVr,
+                                     n,
+                                     HIP_R_64F,
+                                     dWorkR,
+                                     lworkOnDevice,
+                                     hWorkR,
+                                     lworkOnHost,
+                                     dInfo));
+        }
+        CHECK(hipDeviceSynchronize());
+        double gesvdr_us = (time_us() - start) / iters;
+
+        // gesvda
+        int     lwork;
+        double  hRnrmF;
+        double* dWorkA;
+        CHECK(hipsolverDnDgesvdaStridedBatched_bufferSize(handle,
+                                                          HIPSOLVER_EIG_MODE_VECTOR,
+                                                          k,
+                                                          m,
+                                                          n,
+                                                          dA,
+                                                          lda,
+                                                          lda * n,
+                                                          dSa,
+                                                          k,
+                                                          dUa,
+                                                          m,
+                                                          m * k,
+                                                          dVa,
+                                                          n,
+                                                          n * k,
+                                                          &lwork,
+                                                          1));
+        CHECK(hipMalloc(&dWorkA, sizeof(double) * std::max(lwork, 1)));
+
+        for(int i = -1; i < iters; i++)
+        {
+            if(i == 0)
+            {
+                CHECK(hipDeviceSynchronize());
+                start = time_us();
+            }
+            CHECK(hipsolverDnDgesvdaStridedBatched(handle,
+                                                   HIPSOLVER_EIG_MODE_VECTOR,
+                                                   k,
+                                                   m,
+                                                   n,
+                                                   dA,
+                                                   lda,
+                                                   lda * n,
+                                                   dSa,
+                                                   k,
+                                                   dUa,
+                                                   m,
+                                                   m * k,
+                                                   dVa,
+                                                   n,
+                                                   n * k,
+                                                   dWorkA,
+                                                   lwork,
+                                                   dInfo,
+                                                   &hRnrmF,
+                                                   1));
+        }
+        CHECK(hipDeviceSynchronize());
+        double gesvda_us = (time_us() - start) / iters;
+
+        std::vector<double> hSr(k), hSa(k);
+        CHECK(hipMemcpy(hSr.data(), dSr, sizeof(double) * k, hipMemcpyDeviceToHost));
+        CHECK(hipMemcpy(hSa.data(), dSa, sizeof(double) * k, hipMemcpyDeviceToHost));
+
+        double max_diff = 0;
+        for(int i = 0; i < k; i++)
+            max_diff = std::max(max_diff, std::abs(hSr[i] - hSa[i]) / hSa[0]);
+
+        printf("%8d %8d %14.1f %14.1f %9.2fx %14.3e\n",
+               m,
+               n,
+               gesvdr_us,
+               gesvda_us,
+               gesvda_us / gesvdr_us,
+               max_diff);
+
+        CHECK(hipFree(dA));
+        CHECK(hipFree(dSr));
+        CHECK(hipFree(dUr));
+        CHECK(hipFree(dVr));
+        CHECK(hipFree(dSa));
+        CHECK(hipFree(dUa));
+        CHECK(hipFree(dVa));
+        CHECK(hipFree(dInfo));
+        CHECK(hipFree(dWorkR));
+        CHECK(hipFree(dWorkA));
+        free(hWorkR);
+    }
+
+    CHECK(hipsolverDnDestroyParams(params));
+    CHECK(hipsolverDnDestroy(handle));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,207 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <hipsolver/hipsolver.h>
+#include <vector>
+
+// Benchmark: QR factorization with hipsolverDnXgeqrf using the regular algorithm
+// (HIPSOLVER_ALG_0) versus the tall-skinny QR factorization (HIPSOLVER_ALG_1, requested
+// with HIPSOLVERDN_EXT_GEQRF) over a range of aspect ratios m / n. Reports the time of
+// each algorithm and the largest difference between the magnitudes of the entries of the
+// two R factors, relative to the largest one. Only the rocSOLVER backend provides TSQR.
+
+#define CHECK(STATUS)                                                            \
+    do                                                                           \
+    {                                                                            \
+        int _status = (int)(STATUS);                                             \
+        if(_status != 0)                                                         \
+        {                                                                        \
+            fprintf(stderr, "error %d at %s:%d\n", _status, __FILE__, __LINE__); \
+            exit(EXIT_FAILURE);                                                  \
+        }                                                                        \
+    } while(0)
+
+static double time_us()
+{
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+// Returns the average time of iters calls to hipsolverDnXgeqrf on a copy of hA, after one
+// warm-up call, and copies the resulting R factor to hR
+static double time_geqrf(hipsolverDnHandle_t        handle,
+                         hipsolverDnParams_t        params,
+                         int                        iters,
+                         int                        m,
+                         int                        n,
+                         const std::vector<double>& hA,
+                         std::vector<double>&       hR)
+{
+    double* dA;
+    double* dTau;
+    int*    dInfo;
+    CHECK(hipMalloc(&dA, sizeof(double) * m * n));
+    CHECK(hipMalloc(&dTau, sizeof(double) * n));
+    CHECK(hipMalloc(&dInfo, sizeof(int)));
+
+    size_t lworkOnDevice, lworkOnHost;
+    void*  dWork;
+    void*  hWork;
+    CHECK(hipsolverDnXgeqrf_bufferSize(handle,
+                                       params,
+                                       m,
+                                       n,
+                                       HIP_R_64F,
+                                       dA,
+                                       m,
+                                       HIP_R_64F,
+                                       dTau,
+                                       HIP_R_64F,
+                                       &lworkOnDevice,
+                                       &lworkOnHost));
+    CHECK(hipMalloc(&dWork, std::max(lworkOnDevice, size_t(1))));
+    hWork = malloc(std::max(lworkOnHost, size_t(1)));
+
+    // each call factorizes a fresh copy of A, and the copies are excluded from the time
+    double total = 0;
+    for(int i = -1; i < iters; i++)
+    {
+        CHECK(hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+        CHECK(hipDeviceSynchronize());
+
+        double start = time_us();
+        CHECK(hipsolverDnXgeqrf(handle,
+                                params,
+                                m,
+                                n,
+                                HIP_R_64F,
+                                dA,
+                                m,
+                                HIP_R_64F,
+                                dTau,
+                                HIP_R_64F,
+                                dWork,
+                                lworkOnDevice,
+                                hWork,
+                                lworkOnHost,
+                                dInfo));
+        CHECK(hipDeviceSynchronize());
+
+        // the first call is a warm-up
+        if(i >= 0)
+            total += time_us() - start;
+    }
+
+    hR.resize(size_t(n) * n);
+    CHECK(hipMemcpy2D(hR.data(),
+                      sizeof(double) * n,
+                      dA,
+                      sizeof(double) * m,
+                      sizeof(double) * n,
+                      n,
+                      hipMemcpyDeviceToHost));
+
+    CHECK(hipFree(dA));
+    CHECK(hipFree(dTau));
+    CHECK(hipFree(dInfo));
+    CHECK(hipFree(dWork));
+    free(hWork);
+
+    return total / iters;
+}
+
+int main(int argc, char* argv[])
+{
+    const int    iters = argc > 1 ? atoi(argv[1]) : 10;
+    const size_t max_m = argc > 2 ? atol(argv[2]) : 1 << 20;
+
+    const int cols[]   = {8, 32, 128, 256};
+    const int ratios[] = {2, 8, 32, 128, 512, 2048};
+
+    hipsolverDnHandle_t handle;
+    hipsolverDnParams_t params_qr, params_tsqr;
+    CHECK(hipsolverDnCreate(&handle));
+    CHECK(hipsolverDnCreateParams(&params_qr));
+    CHECK(hipsolverDnCreateParams(&params_tsqr));
+    CHECK(hipsolverDnSetAdvOptions(params_qr, HIPSOLVERDN_EXT_GEQRF, HIPSOLVER_ALG_0));
+    CHECK(hipsolverDnSetAdvOptions(params_tsqr, HIPSOLVERDN_EXT_GEQRF, HIPSOLVER_ALG_1));
+
+    printf("%8s %6s %8s %14s %14s %10s %14s\n",
+           "m",
+           "n",
+           "m/n",
+           "geqrf_us",
+           "tsqr_us",
+           "speedup",
+           "max_rel_diff");
+    for(int n : cols)
+    {
+        for(int ratio : ratios)
+        {
+            const size_t m = size_t(ratio) * n;
+            if(m > max_m)
+                continue;
+
+            std::vector<double> hA(m * n);
+            srand(1);
+            for(double& a : hA)
+                a = double(rand()) / RAND_MAX - 0.5;
+
+            std::vector<double> hR_qr, hR_tsqr;
+            double qr_us   = time_geqrf(handle, params_qr, iters, m, n, hA, hR_qr);
+            double tsqr_us = time_geqrf(handle, params_tsqr, iters, m, n, hA, hR_tsqr);
+
+            // the rows of R are only defined up to their sign
+            double max_r = 0, max_diff = 0;
+            for(int j = 0; j < n; j++)
+                for(int i = 0; i <= j; i++)
+                {
+                    double r      = std::abs(hR_qr[i + size_t(j) * n]);
+                    double r_tsqr = std::abs(hR_tsqr[i + size_t(j) * n]);
+                    max_r         = std::max(max_r, r);
+                    max_diff      = std::max(max_diff, std::abs(r - r_tsqr));
+                }
+
+            printf("%8zu %6d %8d %14.1f %14.1f %9.2fx %14.3e\n",
+                   m,
+                   n,
+                   ratio,
+                   qr_us,
+                   tsqr_us,
+                   qr_us / tsqr_us,
+                   max_diff / max_r);
+        }
+    }
+
+    CHECK(hipsolverDnDestroyParams(params_qr));
+    CHECK(hipsolverDnDestroyParams(params_tsqr));
+    CHECK(hipsolverDnDestroy(handle));
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <hip/hip_runtime_api.h>
+#include <hipsolver/hipsolver.h>
+
+// Microbenchmark of the compatibility gesvd workspace query. The baseline is the probe
+// that the query used to run on every call: hipsolverDgesvd_bufferSize for each of the
+// 15 jobu/jobv combinations, with the cache invalidated before each probe by switching
+// streams, as no sizes were cached then. It is compared with the current query, both
+// when its result has to be computed (cold) and when it is served from the per-handle
+// workspace cache.
+
+#define CHECK(STATUS)                                                            \
+    do                                                                           \
+    {                                                                            \
+        int _status = (int)(STATUS);                                             \
+        if(_status != 0)                                                         \
+        {                                                                        \
+            fprintf(stderr, "error %d at %s:%d\n", _status, __FILE__, __LINE__); \
+            exit(EXIT_FAILURE);                                                  \
+        }                                                                        \
+    } while(0)
+
+static const signed char gesvd_jobs[15][2] = {{'N', 'N'},
+                                              {'N', 'A'},
+                                              {'N', 'S'},
+                                              {'N', 'O'},
+                                              {'A', 'N'},
+                                              {'A', 'A'},
+                                              {'A', 'S'},
+                                              {'A', 'O'},
+                                              {'S', 'N'},
+                                              {'S', 'A'},
+                                              {'S', 'S'},
+                                              {'S', 'O'},
+                                              {'O', 'N'},
+                                              {'O', 'A'},
+                                              {'O', 'S'}};
+
+static double time_us()
+{
+    return std::chrono::duration<double, std::micro>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+int main(int argc, char* argv[])
+{
+    const int iters = argc > 1 ? atoi(argv[1]) : 1000;
+    const int sizes[] = {8, 16, 32, 64, 128, 512};
+
+    hipsolverDnHandle_t handle;
+    hipStream_t         streams[2];
+    CHECK(hipsolverDnCreate(&handle));
+    CHECK(hipStreamCreate(&streams[0]));
+    CHECK(hipStreamCreate(&streams[1]));
+
+    printf("%8s %14s %14s %14s %10s %12s\n",
+           "n",
+           "baseline_us",
+           "cold_us",
+           "cached_us",
+           "speedup",
+           "lwork");
+    for(int n : sizes)
+    {
+        int    lwork_baseline, lwork_cold, lwork_cached;
+        double start, baseline_us, cold_us, cached_us;
+
+        start = time_us();
+        for(int i = 0; i < iters; i++)
+        {
+            CHECK(hipsolverDnSetStream(handle, streams[i % 2]));
+
+            int temp;
+            lwork_baseline = 0;
+            for(const auto& jobs : gesvd_jobs)
+            {
+                CHECK(hipsolverDgesvd_bufferSize(handle, jobs[0], jobs[1], n, n, &temp));
+                lwork_baseline = temp > lwork_baseline ? temp : lwork_baseline;
+            }
+        }
+        baseline_us = (time_us() - start) / iters;
+
+        start = time_us();
+        for(int i = 0; i < iters; i++)
+        {
+            CHECK(hipsolverDnSetStream(handle, streams[i % 2]));
+            CHECK(hipsolverDnDgesvd_bufferSize(handle, n, n, &lwork_cold));
+        }
+        cold_us = (time_us() - start) / iters;
+
+        start = time_us();
+        for(int i = 0; i < iters; i++)
+            CHECK(hipsolverDnDgesvd_bufferSize(handle, n, n, &lwork_cached));
+        cached_us = (time_us() - start) / iters;
+
+        if(lwork_baseline != lwork_cold || lwork_baseline != lwork_cached)
+        {
+            fprintf(stderr,
+                    "lwork mismatch for n = %d: %d, %d, %d\n",
+                    n,
+                    lwork_baseline,
+                    lwork_cold,
+                    lwork_cached);
+            return EXIT_FAILURE;
+        }
+
+        printf("%8d %14.3f %14.3f %14.3f %9.1fx %12d\n",
+               n,
+               baseline_us,
+               cold_us,
+               cached_us,
+               baseline_us / cached_us,
+               lwork_cached);
+    }
+
+    CHECK(hipsolverDnSetStream(handle, 0));
+    CHECK(hipStreamDestroy(streams[0]));
+    CHECK(hipStreamDestroy(streams[1]));
+    CHECK(hipsolverDnDestroy(handle));
+    return EXIT_SUCCESS;
+}
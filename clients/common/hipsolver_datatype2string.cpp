@@ -110,6 +110,19 @@ char hipsolver2char_erange(hipsolverEigRange_t value)
     }
 }
 
+char hipsolver2char_diag(hipblasDiagType_t value)
+{
+    switch(value)
+    {
+    case HIPBLAS_DIAG_NON_UNIT:
+        return 'N';
+    case HIPBLAS_DIAG_UNIT:
+        return 'U';
+    default:
+        throw std::invalid_argument("Invalid enum");
+    }
+}
+
 /* ============================================================================================ */
 /*  Convert lapack char constants to hipsolver type. */
 
@@ -222,3 +235,18 @@ hipsolverEigRange_t char2hipsolver_erange(char value)
         throw std::invalid_argument("Invalid character");
     }
 }
+
+hipblasDiagType_t char2hipblas_diag(char value)
+{
+    switch(value)
+    {
+    case 'n':
+    case 'N':
+        return HIPBLAS_DIAG_NON_UNIT;
+    case 'u':
+    case 'U':
+        return HIPBLAS_DIAG_UNIT;
+    default:
+        throw std::invalid_argument("Invalid character");
+    }
+}
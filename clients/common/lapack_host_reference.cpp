@@ -774,6 +774,23 @@ void dgetrf_(int* m, int* n, double* A, int* lda, int* ipiv, int* info);
 void cgetrf_(int* m, int* n, hipsolverComplex* A, int* lda, int* ipiv, int* info);
 void zgetrf_(int* m, int* n, hipsolverDoubleComplex* A, int* lda, int* ipiv, int* info);
 
+void sgetri_(int* n, float* A, int* lda, int* ipiv, float* work, int* lwork, int* info);
+void dgetri_(int* n, double* A, int* lda, int* ipiv, double* work, int* lwork, int* info);
+void cgetri_(int*              n,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              ipiv,
+             hipsolverComplex* work,
+             int*              lwork,
+             int*              info);
+void zgetri_(int*                    n,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    ipiv,
+             hipsolverDoubleComplex* work,
+             int*                    lwork,
+             int*                    info);
+
 void sgetrs_(
     char* trans, int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
 void dgetrs_(
@@ -1175,6 +1192,34 @@ void zsytrf_(char*                   uplo,
              int*                    lwork,
              int*                    info);
 
+void ssytrs_(
+    char* uplo, int* n, int* nrhs, float* A, int* lda, int* ipiv, float* B, int* ldb, int* info);
+void dsytrs_(
+    char* uplo, int* n, int* nrhs, double* A, int* lda, int* ipiv, double* B, int* ldb, int* info);
+void csytrs_(char*             uplo,
+             int*              n,
+             int*              nrhs,
+             hipsolverComplex* A,
+             int*              lda,
+             int*              ipiv,
+             hipsolverComplex* B,
+             int*              ldb,
+             int*              info);
+void zsytrs_(char*                   uplo,
+             int*                    n,
+             int*                    nrhs,
+             hipsolverDoubleComplex* A,
+             int*                    lda,
+             int*                    ipiv,
+             hipsolverDoubleComplex* B,
+             int*                    ldb,
+             int*                    info);
+
+void strtri_(char* uplo, char* diag, int* n, float* A, int* lda, int* info);
+void dtrtri_(char* uplo, char* diag, int* n, double* A, int* lda, int* info);
+void ctrtri_(char* uplo, char* diag, int* n, hipsolverComplex* A, int* lda, int* info);
+void ztrtri_(char* uplo, char* diag, int* n, hipsolverDoubleComplex* A, int* lda, int* info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -2512,6 +2557,38 @@ void cpu_getrf<hipsolverDoubleComplex>(
     zgetrf_(&m, &n, A, &lda, ipiv, info);
 }
 
+// getri
+template <>
+void cpu_getri<float>(int n, float* A, int lda, int* ipiv, float* work, int lwork, int* info)
+{
+    sgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_getri<double>(int n, double* A, int lda, int* ipiv, double* work, int lwork, int* info)
+{
+    dgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_getri<hipsolverComplex>(
+    int n, hipsolverComplex* A, int lda, int* ipiv, hipsolverComplex* work, int lwork, int* info)
+{
+    cgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
+template <>
+void cpu_getri<hipsolverDoubleComplex>(int                     n,
+                                       hipsolverDoubleComplex* A,
+                                       int                     lda,
+                                       int*                    ipiv,
+                                       hipsolverDoubleComplex* work,
+                                       int                     lwork,
+                                       int*                    info)
+{
+    zgetri_(&n, A, &lda, ipiv, work, &lwork, info);
+}
+
 // getrs
 template <>
 void cpu_getrs<float>(hipsolverOperation_t trans,
@@ -3427,3 +3504,109 @@ void cpu_sytrf<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
     char uploC = hipsolver2char_fill(uplo);
     zsytrf_(&uploC, &n, A, &lda, ipiv, work, &lwork, info);
 }
+
+// sytrs
+template <>
+void cpu_sytrs<float>(hipsolverFillMode_t uplo,
+                      int                 n,
+                      int                 nrhs,
+                      float*              A,
+                      int                 lda,
+                      int*                ipiv,
+                      float*              B,
+                      int                 ldb,
+                      int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    ssytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_sytrs<double>(hipsolverFillMode_t uplo,
+                       int                 n,
+                       int                 nrhs,
+                       double*             A,
+                       int                 lda,
+                       int*                ipiv,
+                       double*             B,
+                       int                 ldb,
+                       int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    dsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_sytrs<hipsolverComplex>(hipsolverFillMode_t uplo,
+                                 int                 n,
+                                 int                 nrhs,
+                                 hipsolverComplex*   A,
+                                 int                 lda,
+                                 int*                ipiv,
+                                 hipsolverComplex*   B,
+                                 int                 ldb,
+                                 int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    csytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+template <>
+void cpu_sytrs<hipsolverDoubleComplex>(hipsolverFillMode_t     uplo,
+                                       int                     n,
+                                       int                     nrhs,
+                                       hipsolverDoubleComplex* A,
+                                       int                     lda,
+                                       int*                    ipiv,
+                                       hipsolverDoubleComplex* B,
+                                       int                     ldb,
+                                       int*                    info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    zsytrs_(&uploC, &n, &nrhs, A, &lda, ipiv, B, &ldb, info);
+}
+
+// trtri
+template <>
+void cpu_trtri(
+    hipsolverFillMode_t uplo, hipblasDiagType_t diag, int n, float* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    char diagC = hipsolver2char_diag(diag);
+    strtri_(&uploC, &diagC, &n, A, &lda, info);
+}
+
+template <>
+void cpu_trtri(
+    hipsolverFillMode_t uplo, hipblasDiagType_t diag, int n, double* A, int lda, int* info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    char diagC = hipsolver2char_diag(diag);
+    dtrtri_(&uploC, &diagC, &n, A, &lda, info);
+}
+
+template <>
+void cpu_trtri(hipsolverFillMode_t uplo,
+               hipblasDiagType_t   diag,
+               int                 n,
+               hipsolverComplex*   A,
+               int                 lda,
+               int*                info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    char diagC = hipsolver2char_diag(diag);
+    ctrtri_(&uploC, &diagC, &n, A, &lda, info);
+}
+
+template <>
+void cpu_trtri(hipsolverFillMode_t     uplo,
+               hipblasDiagType_t       diag,
+               int                     n,
+               hipsolverDoubleComplex* A,
+               int                     lda,
+               int*                    info)
+{
+    char uploC = hipsolver2char_fill(uplo);
+    char diagC = hipsolver2char_diag(diag);
+    ztrtri_(&uploC, &diagC, &n, A, &lda, info);
+}
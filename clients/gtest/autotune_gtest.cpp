@@ -0,0 +1,173 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_AUTOTUNE : public ::testing::Test
+{
+protected:
+    checkin_misc_AUTOTUNE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+
+    // Solves for the eigenvalues il to iu of the second-difference matrix, whose
+    // eigenvalues are known in closed form, and compares against them.
+    void run_tridiagonal(hipsolverHandle_t handle, hipsolverEigRange_t range, int il, int iu)
+    {
+        const int           n = 40;
+        std::vector<double> hA(n * n, 0.0);
+        for(int i = 0; i < n; i++)
+        {
+            hA[i + i * n] = 2.0;
+            if(i + 1 < n)
+                hA[i + (i + 1) * n] = hA[(i + 1) + i * n] = -1.0;
+        }
+
+        double* A;
+        double* W;
+        double* work;
+        int*    devInfo;
+        int     lwork, nev;
+        CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+        CHECK_HIP_ERROR(hipMalloc(&W, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevAuto_bufferSize(handle,
+                                                            HIPSOLVER_EIG_MODE_VECTOR,
+                                                            range,
+                                                            HIPSOLVER_FILL_MODE_UPPER,
+                                                            n,
+                                                            A,
+                                                            n,
+                                                            0.0,
+                                                            0.0,
+                                                            il,
+                                                            iu,
+                                                            &nev,
+                                                            W,
+                                                            &lwork),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipMalloc(&work, sizeof(double) * std::max(lwork, 1)));
+
+        // the second call uses the solver selected by the first one
+        for(int i = 0; i < 2; i++)
+        {
+            CHECK_HIP_ERROR(
+                hipMemcpy(A, hA.data(), sizeof(double) * n * n, hipMemcpyHostToDevice));
+            EXPECT_ROCBLAS_STATUS(hipsolverDsyevAuto(handle,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     range,
+                                                     HIPSOLVER_FILL_MODE_UPPER,
+                                                     n,
+                                                     A,
+                                                     n,
+                                                     0.0,
+                                                     0.0,
+                                                     il,
+                                                     iu,
+                                                     &nev,
+                                                     W,
+                                                     work,
+                                                     lwork,
+                                                     devInfo),
+                                  HIPSOLVER_STATUS_SUCCESS);
+
+            int                 hInfo;
+            std::vector<double> hW(n);
+            CHECK_HIP_ERROR(hipMemcpy(&hInfo, devInfo, sizeof(int), hipMemcpyDeviceToHost));
+            CHECK_HIP_ERROR(hipMemcpy(hW.data(), W, sizeof(double) * n, hipMemcpyDeviceToHost));
+            EXPECT_EQ(hInfo, 0);
+
+            int first = range == HIPSOLVER_EIG_RANGE_I ? il : 1;
+            int last  = range == HIPSOLVER_EIG_RANGE_I ? iu : n;
+            EXPECT_EQ(nev, last - first + 1);
+            for(int k = first; k <= last; k++)
+            {
+                double expected = 2.0 - 2.0 * std::cos(k * M_PI / (n + 1));
+                EXPECT_NEAR(hW[k - first], expected, 1e-10);
+            }
+        }
+
+        CHECK_HIP_ERROR(hipFree(A));
+        CHECK_HIP_ERROR(hipFree(W));
+        CHECK_HIP_ERROR(hipFree(work));
+        CHECK_HIP_ERROR(hipFree(devInfo));
+    }
+};
+
+TEST_F(checkin_misc_AUTOTUNE, set_get_mode)
+{
+    hipsolver_local_handle  handle;
+    hipsolverAutotuneMode_t mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_AUTOTUNE_DISABLED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(handle, HIPSOLVER_AUTOTUNE_ENABLED),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_AUTOTUNE_ENABLED);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(handle, HIPSOLVER_AUTOTUNE_DISABLED),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(mode, HIPSOLVER_AUTOTUNE_DISABLED);
+}
+
+TEST_F(checkin_misc_AUTOTUNE, bad_arguments)
+{
+    hipsolver_local_handle  handle;
+    hipsolverAutotuneMode_t mode;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(nullptr, HIPSOLVER_AUTOTUNE_ENABLED),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(nullptr, &mode),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(handle, hipsolverAutotuneMode_t(-1)),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetAutotuneMode(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST_F(checkin_misc_AUTOTUNE, disabled)
+{
+    hipsolver_local_handle handle;
+
+    run_tridiagonal(handle, HIPSOLVER_EIG_RANGE_ALL, 0, 0);
+    run_tridiagonal(handle, HIPSOLVER_EIG_RANGE_I, 3, 12);
+}
+
+TEST_F(checkin_misc_AUTOTUNE, enabled)
+{
+    hipsolver_local_handle handle;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetAutotuneMode(handle, HIPSOLVER_AUTOTUNE_ENABLED),
+                          HIPSOLVER_STATUS_SUCCESS);
+    run_tridiagonal(handle, HIPSOLVER_EIG_RANGE_ALL, 0, 0);
+    run_tridiagonal(handle, HIPSOLVER_EIG_RANGE_I, 3, 12);
+    run_tridiagonal(handle, HIPSOLVER_EIG_RANGE_I, 1, 1);
+}
@@ -0,0 +1,240 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+#include <vector>
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_BATCH_STREAMS : public ::testing::Test
+{
+protected:
+    checkin_misc_BATCH_STREAMS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// Symmetric positive definite test matrices, different for each batch instance
+static std::vector<double> spd_matrices(int n, int batch_count)
+{
+    std::vector<double> A(size_t(n) * n * batch_count);
+    for(int b = 0; b < batch_count; b++)
+        for(int j = 0; j < n; j++)
+            for(int i = 0; i < n; i++)
+                A[size_t(b) * n * n + i + size_t(j) * n]
+                    = (i == j) ? n + b : 1.0 / (1 + i + j + b);
+    return A;
+}
+
+// Runs potrfBatched and returns the factors followed by devInfo
+static void
+    run_potrf_batched(hipsolverHandle_t handle, int n, int batch_count, std::vector<double>& hA)
+{
+    hA = spd_matrices(n, batch_count);
+    std::vector<int>    hInfo(batch_count);
+
+    double*              dA;
+    int*                 dInfo;
+    double**             dAarray;
+    std::vector<double*> hAarray(batch_count);
+    CHECK_HIP_ERROR(hipMalloc(&dA, sizeof(double) * hA.size()));
+    CHECK_HIP_ERROR(hipMalloc(&dInfo, sizeof(int) * batch_count));
+    CHECK_HIP_ERROR(hipMalloc(&dAarray, sizeof(double*) * batch_count));
+    for(int b = 0; b < batch_count; b++)
+        hAarray[b] = dA + size_t(b) * n * n;
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * hA.size(), hipMemcpyHostToDevice));
+    CHECK_HIP_ERROR(hipMemcpy(
+        dAarray, hAarray.data(), sizeof(double*) * batch_count, hipMemcpyHostToDevice));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDpotrfBatched(handle,
+                                                 HIPSOLVER_FILL_MODE_UPPER,
+                                                 n,
+                                                 dAarray,
+                                                 n,
+                                                 nullptr,
+                                                 0,
+                                                 dInfo,
+                                                 batch_count),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(double) * hA.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+    for(int b = 0; b < batch_count; b++)
+        hA.push_back(hInfo[b]);
+
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dInfo));
+    CHECK_HIP_ERROR(hipFree(dAarray));
+}
+
+// Runs syevjBatched and returns the eigenvectors, eigenvalues, and devInfo, followed by
+// the residual and number of sweeps of each instance when the backend reports them
+static void run_syevj_batched(hipsolverHandle_t    handle,
+                              int                  n,
+                              int                  batch_count,
+                              bool                 user_workspace,
+                              std::vector<double>& hA)
+{
+    hA = spd_matrices(n, batch_count);
+    std::vector<double> hW(size_t(n) * batch_count);
+    std::vector<int>    hInfo(batch_count);
+
+    hipsolverSyevjInfo_t params;
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateSyevjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+
+    double* dA;
+    double* dW;
+    double* dWork = nullptr;
+    int*    dInfo;
+    int     lwork = 0;
+    CHECK_HIP_ERROR(hipMalloc(&dA, sizeof(double) * hA.size()));
+    CHECK_HIP_ERROR(hipMalloc(&dW, sizeof(double) * hW.size()));
+    CHECK_HIP_ERROR(hipMalloc(&dInfo, sizeof(int) * batch_count));
+    CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * hA.size(), hipMemcpyHostToDevice));
+
+    if(user_workspace)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevjBatched_bufferSize(handle,
+                                                                HIPSOLVER_EIG_MODE_VECTOR,
+                                                                HIPSOLVER_FILL_MODE_UPPER,
+                                                                n,
+                                                                dA,
+                                                                n,
+                                                                dW,
+                                                                &lwork,
+                                                                params,
+                                                                batch_count),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipMalloc(&dWork, sizeof(double) * std::max(lwork, 1)));
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevjBatched(handle,
+                                                 HIPSOLVER_EIG_MODE_VECTOR,
+                                                 HIPSOLVER_FILL_MODE_UPPER,
+                                                 n,
+                                                 dA,
+                                                 n,
+                                                 dW,
+                                                 dWork,
+                                                 lwork,
+                                                 dInfo,
+                                                 params,
+                                                 batch_count),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    CHECK_HIP_ERROR(hipMemcpy(hA.data(), dA, sizeof(double) * hA.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(hipMemcpy(hW.data(), dW, sizeof(double) * hW.size(), hipMemcpyDeviceToHost));
+    CHECK_HIP_ERROR(
+        hipMemcpy(hInfo.data(), dInfo, sizeof(int) * batch_count, hipMemcpyDeviceToHost));
+    hA.insert(hA.end(), hW.begin(), hW.end());
+    hA.insert(hA.end(), hInfo.begin(), hInfo.end());
+
+    std::vector<double> residual(batch_count);
+    std::vector<int>    sweeps(batch_count);
+    if(hipsolverXsyevjGetResidualBatched(handle, params, residual.data(), batch_count)
+           == HIPSOLVER_STATUS_SUCCESS
+       && hipsolverXsyevjGetSweepsBatched(handle, params, sweeps.data(), batch_count)
+              == HIPSOLVER_STATUS_SUCCESS)
+    {
+        hA.insert(hA.end(), residual.begin(), residual.end());
+        hA.insert(hA.end(), sweeps.begin(), sweeps.end());
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroySyevjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipFree(dA));
+    CHECK_HIP_ERROR(hipFree(dW));
+    CHECK_HIP_ERROR(hipFree(dWork));
+    CHECK_HIP_ERROR(hipFree(dInfo));
+}
+
+TEST_F(checkin_misc_BATCH_STREAMS, potrf_batched)
+{
+    const int n           = 20;
+    const int batch_count = 7;
+
+    hipsolver_local_handle handle;
+    hipsolver_local_handle split_handle;
+    int                    num_streams;
+
+    hipsolverStatus_t stat = hipsolverSetBatchStreams(split_handle, 3);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchStreams(split_handle, &num_streams),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(num_streams, 3);
+
+    // splitting the batch does not change the results
+    std::vector<double> expected, result;
+    run_potrf_batched(handle, n, batch_count, expected);
+    run_potrf_batched(split_handle, n, batch_count, result);
+    EXPECT_EQ(result, expected);
+}
+
+TEST_F(checkin_misc_BATCH_STREAMS, syevj_batched)
+{
+    const int n           = 20;
+    const int batch_count = 5;
+
+    hipsolver_local_handle handle;
+    hipsolver_local_handle split_handle;
+
+    if(hipsolverSetBatchStreams(split_handle, 2) == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    // splitting the batch does not change the results, with or without a user-provided
+    // workspace
+    std::vector<double> expected, result;
+    run_syevj_batched(handle, n, batch_count, false, expected);
+    run_syevj_batched(split_handle, n, batch_count, false, result);
+    EXPECT_EQ(result, expected);
+    run_syevj_batched(split_handle, n, batch_count, true, result);
+    EXPECT_EQ(result, expected);
+
+    // more streams than instances
+    EXPECT_ROCBLAS_STATUS(hipsolverSetBatchStreams(split_handle, 8), HIPSOLVER_STATUS_SUCCESS);
+    run_syevj_batched(split_handle, n, batch_count, true, result);
+    EXPECT_EQ(result, expected);
+}
+
+TEST_F(checkin_misc_BATCH_STREAMS, invalid_arguments)
+{
+    hipsolver_local_handle handle;
+    int                    num_streams;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetBatchStreams(nullptr, 1), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchStreams(nullptr, &num_streams),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetBatchStreams(handle, 0), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchStreams(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // a single stream is the default on all backends
+    EXPECT_ROCBLAS_STATUS(hipsolverGetBatchStreams(handle, &num_streams), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(num_streams, 1);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetBatchStreams(handle, 1), HIPSOLVER_STATUS_SUCCESS);
+}
@@ -94,7 +94,7 @@ Arguments gels_setup_arguments(gels_tuple tup)
     return arg;
 }
 
-template <testAPI_t API, bool INPLACE>
+template <testAPI_t API, bool INPLACE, bool MIXED>
 class GELS_BASE : public ::TestWithParam<gels_tuple>
 {
 protected:
@@ -109,26 +109,34 @@ protected:
         Arguments arg = gels_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
-            testing_gels_bad_arg<API, BATCHED, STRIDED, T>();
+            testing_gels_bad_arg<API, BATCHED, STRIDED, MIXED, T>();
 
         arg.batch_count = 1;
-        testing_gels<API, BATCHED, STRIDED, INPLACE, T>(arg);
+        testing_gels<API, BATCHED, STRIDED, INPLACE, MIXED, T>(arg);
     }
 };
 
-class GELS : public GELS_BASE<API_NORMAL, false>
+class GELS : public GELS_BASE<API_NORMAL, false, false>
 {
 };
 
-class GELS_FORTRAN : public GELS_BASE<API_FORTRAN, false>
+class GELS_FORTRAN : public GELS_BASE<API_FORTRAN, false, false>
 {
 };
 
-class GELS_COMPAT : public GELS_BASE<API_COMPAT, false>
+class GELS_COMPAT : public GELS_BASE<API_COMPAT, false, false>
 {
 };
 
-class GELS_INPLACE : public GELS_BASE<API_NORMAL, true>
+class GELS_INPLACE : public GELS_BASE<API_NORMAL, true, false>
+{
+};
+
+class GELS_MIXED : public GELS_BASE<API_NORMAL, false, true>
+{
+};
+
+class GELS_MIXED_COMPAT : public GELS_BASE<API_COMPAT, false, true>
 {
 };
 
@@ -214,6 +222,28 @@ TEST_P(GELS_INPLACE, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// mixed precision tests
+
+TEST_P(GELS_MIXED, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS_MIXED, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GELS_MIXED_COMPAT, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GELS_MIXED_COMPAT, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GELS,
 //                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -249,3 +279,21 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GELS_INPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GELS_MIXED,
+//                          Combine(ValuesIn(large_matrix_sizeA_range),
+//                                  ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_MIXED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GELS_MIXED_COMPAT,
+//                          Combine(ValuesIn(large_matrix_sizeA_range),
+//                                  ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GELS_MIXED_COMPAT,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
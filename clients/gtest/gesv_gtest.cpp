@@ -89,7 +89,7 @@ Arguments gesv_setup_arguments(gesv_tuple tup)
     return arg;
 }
 
-template <testAPI_t API, bool INPLACE>
+template <testAPI_t API, bool INPLACE, bool MIXED>
 class GESV_BASE : public ::TestWithParam<gesv_tuple>
 {
 protected:
@@ -104,26 +104,34 @@ protected:
         Arguments arg = gesv_setup_arguments(GetParam());
 
         if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
-            testing_gesv_bad_arg<API, BATCHED, STRIDED, T>();
+            testing_gesv_bad_arg<API, BATCHED, STRIDED, MIXED, T>();
 
         arg.batch_count = 1;
-        testing_gesv<API, BATCHED, STRIDED, INPLACE, T>(arg);
+        testing_gesv<API, BATCHED, STRIDED, INPLACE, MIXED, T>(arg);
     }
 };
 
-class GESV : public GESV_BASE<API_NORMAL, false>
+class GESV : public GESV_BASE<API_NORMAL, false, false>
 {
 };
 
-class GESV_FORTRAN : public GESV_BASE<API_FORTRAN, false>
+class GESV_FORTRAN : public GESV_BASE<API_FORTRAN, false, false>
 {
 };
 
-class GESV_COMPAT : public GESV_BASE<API_COMPAT, false>
+class GESV_COMPAT : public GESV_BASE<API_COMPAT, false, false>
 {
 };
 
-class GESV_INPLACE : public GESV_BASE<API_NORMAL, true>
+class GESV_INPLACE : public GESV_BASE<API_NORMAL, true, false>
+{
+};
+
+class GESV_MIXED : public GESV_BASE<API_NORMAL, false, true>
+{
+};
+
+class GESV_MIXED_COMPAT : public GESV_BASE<API_COMPAT, false, true>
 {
 };
 
@@ -211,6 +219,28 @@ TEST_P(GESV_INPLACE, __double_complex)
 }
 #endif
 
+// mixed precision tests
+
+TEST_P(GESV_MIXED, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESV_MIXED, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+TEST_P(GESV_MIXED_COMPAT, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESV_MIXED_COMPAT, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GESV,
 //                          Combine(ValuesIn(large_matrix_sizeA_range),
@@ -248,3 +278,21 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GESV_INPLACE,
                          Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
 #endif
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GESV_MIXED,
+//                          Combine(ValuesIn(large_matrix_sizeA_range),
+//                                  ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_MIXED,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GESV_MIXED_COMPAT,
+//                          Combine(ValuesIn(large_matrix_sizeA_range),
+//                                  ValuesIn(large_matrix_sizeB_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESV_MIXED_COMPAT,
+                         Combine(ValuesIn(matrix_sizeA_range), ValuesIn(matrix_sizeB_range)));
@@ -145,7 +145,7 @@ Arguments gesvd_setup_arguments(gesvd_tuple tup)
     return arg;
 }
 
-template <testAPI_t API, bool NRWK>
+template <testAPI_t API, bool NRWK, typename I, typename SIZE>
 class GESVD_BASE : public ::TestWithParam<gesvd_tuple>
 {
 protected:
@@ -161,26 +161,30 @@ protected:
 
         if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == 1
            && arg.peek<char>("jobu") == 'N' && arg.peek<char>("jobv") == 'N')
-            testing_gesvd_bad_arg<API, BATCHED, STRIDED, T>();
+            testing_gesvd_bad_arg<API, BATCHED, STRIDED, T, I, SIZE>();
 
         arg.batch_count = 1;
-        testing_gesvd<API, BATCHED, STRIDED, NRWK, T>(arg);
+        testing_gesvd<API, BATCHED, STRIDED, NRWK, T, I, SIZE>(arg);
     }
 };
 
-class GESVD : public GESVD_BASE<API_NORMAL, false>
+class GESVD : public GESVD_BASE<API_NORMAL, false, int, int>
 {
 };
 
-class GESVD_FORTRAN : public GESVD_BASE<API_FORTRAN, false>
+class GESVD_FORTRAN : public GESVD_BASE<API_FORTRAN, false, int, int>
 {
 };
 
-class GESVD_COMPAT : public GESVD_BASE<API_COMPAT, false>
+class GESVD_COMPAT : public GESVD_BASE<API_COMPAT, false, int, int>
 {
 };
 
-class GESVD_NRWK : public GESVD_BASE<API_NORMAL, true>
+class GESVD_COMPAT_64 : public GESVD_BASE<API_COMPAT, false, int64_t, size_t>
+{
+};
+
+class GESVD_NRWK : public GESVD_BASE<API_NORMAL, true, int, int>
 {
 };
 
@@ -246,6 +250,26 @@ TEST_P(GESVD_COMPAT, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(GESVD_COMPAT_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(GESVD_COMPAT_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(GESVD_COMPAT_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(GESVD_COMPAT_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
 TEST_P(GESVD_NRWK, __float)
 {
     run_tests<false, false, float>();
@@ -288,6 +312,14 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          GESVD_COMPAT,
                          Combine(ValuesIn(size_range), ValuesIn(opt_range)));
 
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GESVD_COMPAT_64,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVD_COMPAT_64,
+                         Combine(ValuesIn(size_range), ValuesIn(opt_range)));
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GESVD_NRWK,
 //                          Combine(ValuesIn(large_size_range), ValuesIn(large_opt_range)));
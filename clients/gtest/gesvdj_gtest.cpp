@@ -126,10 +126,11 @@ protected:
     template <bool BATCHED, bool STRIDED, typename T>
     void run_tests()
     {
-        Arguments arg = gesvdj_setup_arguments<T>(GetParam(), STRIDED);
+        Arguments arg = gesvdj_setup_arguments<T>(GetParam(), BATCHED || STRIDED);
 
         if(arg.peek<rocblas_int>("m") == 1 && arg.peek<rocblas_int>("n") == 1
-           && arg.peek<char>("jobz") == 'N' && (STRIDED || arg.peek<rocblas_int>("econ") == 0))
+           && arg.peek<char>("jobz") == 'N'
+           && (BATCHED || STRIDED || arg.peek<rocblas_int>("econ") == 0))
             testing_gesvdj_bad_arg<API, BATCHED, STRIDED, T>();
 
         arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
@@ -187,6 +188,28 @@ TEST_P(GESVDJ_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// batched tests
+
+TEST_P(GESVDJ, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GESVDJ, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GESVDJ, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GESVDJ, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(GESVDJ, strided_batched__float)
@@ -0,0 +1,152 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "testing_gesvdr.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, vector<int>, vector<char>> gesvdr_tuple;
+
+// each size_range vector is a {m, n, lda, ldu, ldv}
+
+// each rank_range vector is a {k, p, niters}
+
+// each opt_range vector is a {jobu, jobv}
+
+// case when m = -1, k = 5, jobu = N and jobv = N will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<vector<char>> opt_range = {{'N', 'N'}, {'S', 'N'}, {'N', 'S'}, {'S', 'S'}};
+
+const vector<vector<int>> rank_range = {
+    // normal (valid) samples
+    {5, 5, 2},
+    {10, 0, 1},
+    {16, 8, 0},
+    // invalid for all but the largest sizes (k + p > min(m, n))
+    {45, 10, 1}};
+
+// for checkin_lapack tests
+const vector<vector<int>> size_range = {
+    // invalid
+    {-1, 1, 1, 1, 1},
+    {20, 20, 10, 20, 20},
+    {20, 20, 20, 10, 20},
+    // normal (valid) samples
+    {50, 50, 50, 50, 50},
+    {100, 40, 100, 100, 40},
+    {40, 120, 40, 40, 120},
+    {150, 150, 160, 155, 170}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_size_range
+//     = {{400, 400, 400, 400, 400}, {1000, 300, 1000, 1000, 300}, {600, 1200, 600, 600, 1200}};
+
+Arguments gesvdr_setup_arguments(gesvdr_tuple tup)
+{
+    vector<int>  size = std::get<0>(tup);
+    vector<int>  rank = std::get<1>(tup);
+    vector<char> opt  = std::get<2>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("m", size[0]);
+    arg.set<rocblas_int>("n", size[1]);
+    arg.set<rocblas_int>("lda", size[2]);
+    arg.set<rocblas_int>("ldu", size[3]);
+    arg.set<rocblas_int>("ldv", size[4]);
+
+    arg.set<rocblas_int>("rank", rank[0]);
+    arg.set<rocblas_int>("p", rank[1]);
+    arg.set<rocblas_int>("niters", rank[2]);
+
+    arg.set<char>("jobu", opt[0]);
+    arg.set<char>("jobv", opt[1]);
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API, typename I, typename SIZE>
+class GESVDR_BASE : public ::TestWithParam<gesvdr_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <typename T>
+    void run_tests()
+    {
+        Arguments arg = gesvdr_setup_arguments(GetParam());
+
+        if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("rank") == 5
+           && arg.peek<char>("jobu") == 'N' && arg.peek<char>("jobv") == 'N')
+            testing_gesvdr_bad_arg<API, T, I, SIZE>();
+
+        testing_gesvdr<API, T, I, SIZE>(arg);
+    }
+};
+
+class GESVDR_COMPAT_64 : public GESVDR_BASE<API_COMPAT, int64_t, size_t>
+{
+};
+
+// non-batch tests
+
+TEST_P(GESVDR_COMPAT_64, __float)
+{
+    run_tests<float>();
+}
+
+TEST_P(GESVDR_COMPAT_64, __double)
+{
+    run_tests<double>();
+}
+
+TEST_P(GESVDR_COMPAT_64, __float_complex)
+{
+    run_tests<rocblas_float_complex>();
+}
+
+TEST_P(GESVDR_COMPAT_64, __double_complex)
+{
+    run_tests<rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GESVDR_COMPAT_64,
+//                          Combine(ValuesIn(large_size_range),
+//                                  ValuesIn(rank_range),
+//                                  ValuesIn(opt_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GESVDR_COMPAT_64,
+                         Combine(ValuesIn(size_range), ValuesIn(rank_range), ValuesIn(opt_range)));
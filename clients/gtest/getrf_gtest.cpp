@@ -108,7 +108,7 @@ protected:
         if(arg.peek<rocblas_int>("m") == -1 && arg.peek<rocblas_int>("n") == -1)
             testing_getrf_bad_arg<API, BATCHED, STRIDED, T, I, SIZE>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
         testing_getrf<API, BATCHED, STRIDED, NPVT, T, I, SIZE>(arg);
     }
 };
@@ -259,6 +259,90 @@ TEST_P(GETRF_COMPAT_NPVT_64, __double_complex)
     run_tests<false, false, hipsolverDoubleComplex>();
 }
 
+// batched tests
+
+TEST_P(GETRF, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF, batched__float_complex)
+{
+    run_tests<true, false, hipsolverComplex>();
+}
+
+TEST_P(GETRF, batched__double_complex)
+{
+    run_tests<true, false, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_NPVT, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRF_NPVT, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRF_NPVT, batched__float_complex)
+{
+    run_tests<true, false, hipsolverComplex>();
+}
+
+TEST_P(GETRF_NPVT, batched__double_complex)
+{
+    run_tests<true, false, hipsolverDoubleComplex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETRF, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF, strided_batched__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>();
+}
+
+TEST_P(GETRF, strided_batched__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>();
+}
+
+TEST_P(GETRF_NPVT, strided_batched__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GETRF,
 //                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(large_n_size_range)));
@@ -0,0 +1,157 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "testing_getri.hpp"
+
+using ::testing::Combine;
+using ::testing::TestWithParam;
+using ::testing::Values;
+using ::testing::ValuesIn;
+using namespace std;
+
+typedef std::tuple<vector<int>, char> getri_tuple;
+
+// each matrix_size_range vector is a {n, lda, ldc}
+
+// each fast_alg_range is a {fast_alg}
+// if fast_alg = I the inverse overwrites the factor
+// if fast_alg = O the inverse is written to C and the factor is left intact
+
+// case when n = -1 and fast_alg = I will also execute the bad arguments test
+// (null handle, null pointers and invalid values)
+
+const vector<char> fast_alg_range = {'I', 'O'};
+
+// for checkin_lapack tests
+const vector<vector<int>> matrix_size_range = {
+    // invalid
+    {-1, 1, 1},
+    {20, 5, 20},
+    {20, 20, 5},
+    // normal (valid) samples
+    {32, 32, 32},
+    {50, 50, 60},
+    {70, 100, 70},
+    {100, 150, 120}};
+
+// // for daily_lapack tests
+// const vector<vector<int>> large_matrix_size_range
+//     = {{192, 192, 192}, {500, 600, 500}, {640, 640, 700}, {1000, 1024, 1000}};
+
+Arguments getri_setup_arguments(getri_tuple tup)
+{
+    vector<int> matrix_size = std::get<0>(tup);
+    char        fast_alg    = std::get<1>(tup);
+
+    Arguments arg;
+
+    arg.set<rocblas_int>("n", matrix_size[0]);
+    arg.set<rocblas_int>("lda", matrix_size[1]);
+    arg.set<rocblas_int>("ldc", matrix_size[2]);
+
+    arg.set<char>("fast_alg", fast_alg);
+
+    // only testing standard use case/defaults for strides
+
+    arg.timing = 0;
+
+    return arg;
+}
+
+template <testAPI_t API>
+class GETRI_BASE : public ::TestWithParam<getri_tuple>
+{
+protected:
+    void TearDown() override
+    {
+        EXPECT_EQ(hipGetLastError(), hipSuccess);
+    }
+
+    template <bool BATCHED, bool STRIDED, typename T>
+    void run_tests()
+    {
+        Arguments arg = getri_setup_arguments(GetParam());
+
+        if(arg.peek<char>("fast_alg") == 'I' && arg.peek<rocblas_int>("n") == -1)
+            testing_getri_bad_arg<API, BATCHED, STRIDED, T>();
+
+        arg.batch_count = 3;
+        testing_getri<API, BATCHED, STRIDED, T>(arg);
+    }
+};
+
+class GETRI : public GETRI_BASE<API_NORMAL>
+{
+};
+
+// batched tests
+
+TEST_P(GETRI, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRI, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRI, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(GETRI, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETRI, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRI, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRI, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(GETRI, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          GETRI,
+//                          Combine(ValuesIn(large_matrix_size_range), ValuesIn(fast_alg_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         GETRI,
+                         Combine(ValuesIn(matrix_size_range), ValuesIn(fast_alg_range)));
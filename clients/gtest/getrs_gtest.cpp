@@ -117,7 +117,7 @@ protected:
         if(arg.peek<rocblas_int>("n") == -1 && arg.peek<rocblas_int>("nrhs") == -1)
             testing_getrs_bad_arg<API, BATCHED, STRIDED, T, I, SIZE>();
 
-        arg.batch_count = 1;
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
         testing_getrs<API, BATCHED, STRIDED, T, I, SIZE>(arg);
     }
 };
@@ -220,6 +220,50 @@ TEST_P(GETRS_COMPAT_64, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// batched tests
+
+TEST_P(GETRS, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(GETRS, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(GETRS, batched__float_complex)
+{
+    run_tests<true, false, hipsolverComplex>();
+}
+
+TEST_P(GETRS, batched__double_complex)
+{
+    run_tests<true, false, hipsolverDoubleComplex>();
+}
+
+// strided_batched tests
+
+TEST_P(GETRS, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(GETRS, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(GETRS, strided_batched__float_complex)
+{
+    run_tests<false, true, hipsolverComplex>();
+}
+
+TEST_P(GETRS, strided_batched__double_complex)
+{
+    run_tests<false, true, hipsolverDoubleComplex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          GETRS,
 //                          Combine(ValuesIn(large_matrix_sizeA_range),
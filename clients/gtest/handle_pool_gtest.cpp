@@ -0,0 +1,308 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_HANDLE_POOL : public ::testing::Test
+{
+protected:
+    checkin_misc_HANDLE_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_HANDLE_POOL, normal_execution)
+{
+    const int num_handles = 2;
+    const int num_threads = 8;
+    const int iters       = 10;
+    const int n           = 20;
+
+    hipsolverHandlePool_t     pool;
+    hipsolverHandlePoolInfo_t info;
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(&pool, num_handles, 0),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    // each thread checks out a handle, runs a factorization on its stream, and returns it
+    std::vector<hipsolverStatus_t> status(num_threads, HIPSOLVER_STATUS_SUCCESS);
+    std::vector<std::thread>       threads;
+    for(int t = 0; t < num_threads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            double* A;
+            int*    devInfo;
+            if(hipMalloc(&A, sizeof(double) * n * n) != hipSuccess
+               || hipMalloc(&devInfo, sizeof(int)) != hipSuccess)
+            {
+                status[t] = HIPSOLVER_STATUS_ALLOC_FAILED;
+                return;
+            }
+
+            for(int i = 0; i < iters && status[t] == HIPSOLVER_STATUS_SUCCESS; i++)
+            {
+                hipsolverHandle_t handle;
+                hipStream_t       stream;
+                if((status[t] = hipsolverHandlePoolAcquire(pool, &handle))
+                   != HIPSOLVER_STATUS_SUCCESS)
+                    break;
+
+                hipsolverGetStream(handle, &stream);
+                hipMemsetAsync(A, 0, sizeof(double) * n * n, stream);
+                status[t] = hipsolverDpotrf(
+                    handle, HIPSOLVER_FILL_MODE_UPPER, n, A, n, nullptr, 0, devInfo);
+                hipStreamSynchronize(stream);
+
+                hipsolverStatus_t release = hipsolverHandlePoolRelease(pool, handle);
+                if(status[t] == HIPSOLVER_STATUS_SUCCESS)
+                    status[t] = release;
+            }
+
+            hipFree(A);
+            hipFree(devInfo);
+        });
+    }
+    for(std::thread& thread : threads)
+        thread.join();
+
+    for(int t = 0; t < num_threads; t++)
+        EXPECT_ROCBLAS_STATUS(status[t], HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetInfo(pool, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info.num_handles, size_t(num_handles));
+    EXPECT_EQ(info.handles_in_use, 0u);
+    EXPECT_LE(info.peak_handles_in_use, size_t(num_handles));
+    EXPECT_GE(info.peak_handles_in_use, 1u);
+    EXPECT_EQ(info.num_acquires, size_t(num_threads * iters));
+    EXPECT_LE(info.num_contended_acquires, info.num_acquires);
+    EXPECT_EQ(info.workspace_budget, 0u);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(pool), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, distinct_streams)
+{
+    hipsolverHandlePool_t pool;
+    hipsolverHandle_t     handle1, handle2;
+    hipStream_t           stream1, stream2;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(&pool, 2, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, &handle1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, &handle2), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_NE(handle1, handle2);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStream(handle1, &stream1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetStream(handle2, &stream2), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_NE(stream1, stream2);
+    EXPECT_NE(stream1, (hipStream_t)0);
+
+    // the pool cannot be destroyed while handles are checked out, and a handle cannot
+    // be returned twice
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(pool), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle2), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(pool), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, workspace_budget)
+{
+    hipsolverHandlePool_t     pool;
+    hipsolverHandlePoolInfo_t info;
+    hipsolverHandle_t         handle;
+    hipsolverMemoryPoolInfo_t pool_info;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(&pool, 1, 1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, &handle), HIPSOLVER_STATUS_SUCCESS);
+
+    // only the rocSOLVER backend manages workspace internally
+    if(hipsolverGetMemoryPoolInfo(handle, &pool_info) != HIPSOLVER_STATUS_NOT_SUPPORTED)
+    {
+        const int n = 100;
+        double*   A;
+        double*   D;
+        int*      devInfo;
+        CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+        CHECK_HIP_ERROR(hipMalloc(&D, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+        CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+
+        // the workspace needed by syevd does not fit in a budget of one byte
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              HIPSOLVER_FILL_MODE_UPPER,
+                                              n,
+                                              A,
+                                              n,
+                                              D,
+                                              nullptr,
+                                              0,
+                                              devInfo),
+                              HIPSOLVER_STATUS_ALLOC_FAILED);
+
+        EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetInfo(pool, &info), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(info.workspace_budget, 1u);
+        EXPECT_LE(info.workspace_used_bytes, 1u);
+        EXPECT_GE(info.num_workspace_failures, 1u);
+
+        CHECK_HIP_ERROR(hipFree(A));
+        CHECK_HIP_ERROR(hipFree(D));
+        CHECK_HIP_ERROR(hipFree(devInfo));
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(pool), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, memory_pool_budget)
+{
+    hipsolverHandlePool_t     pool;
+    hipsolverHandlePoolInfo_t info;
+    hipsolverHandle_t         handle;
+    hipsolverMemoryPoolInfo_t pool_info;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(&pool, 1, 1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, &handle), HIPSOLVER_STATUS_SUCCESS);
+
+    if(hipsolverGetMemoryPoolInfo(handle, &pool_info) != HIPSOLVER_STATUS_NOT_SUPPORTED)
+    {
+        const int            n = 20;
+        double*              A;
+        double*              W;
+        double*              work;
+        int*                 devInfo;
+        int                  lwork;
+        hipsolverSyevjInfo_t params;
+        EXPECT_ROCBLAS_STATUS(hipsolverCreateSyevjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevj_bufferSize(handle,
+                                                         HIPSOLVER_EIG_MODE_VECTOR,
+                                                         HIPSOLVER_FILL_MODE_UPPER,
+                                                         n,
+                                                         nullptr,
+                                                         n,
+                                                         nullptr,
+                                                         &lwork,
+                                                         params),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+        CHECK_HIP_ERROR(hipMalloc(&W, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&work, std::max(lwork, 1)));
+        CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+        CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+
+        // with a user-provided workspace, the only device memory taken by syevj is the
+        // storage of its results in the memory pool, which is charged to the budget
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevj(handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              HIPSOLVER_FILL_MODE_UPPER,
+                                              n,
+                                              A,
+                                              n,
+                                              W,
+                                              work,
+                                              lwork,
+                                              devInfo,
+                                              params),
+                              HIPSOLVER_STATUS_ALLOC_FAILED);
+
+        EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, &pool_info),
+                              HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_EQ(pool_info.reserved_bytes, 0u);
+
+        EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetInfo(pool, &info), HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_LE(info.workspace_used_bytes, 1u);
+        EXPECT_GE(info.num_workspace_failures, 1u);
+
+        EXPECT_ROCBLAS_STATUS(hipsolverDestroySyevjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipFree(A));
+        CHECK_HIP_ERROR(hipFree(W));
+        CHECK_HIP_ERROR(hipFree(work));
+        CHECK_HIP_ERROR(hipFree(devInfo));
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(pool), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, blocking_acquire)
+{
+    hipsolverHandlePool_t     pool;
+    hipsolverHandlePoolInfo_t info;
+    hipsolverHandle_t         handle1, handle2;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(&pool, 1, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, &handle1), HIPSOLVER_STATUS_SUCCESS);
+
+    // a second thread waits for the only handle until it is returned
+    hipsolverStatus_t status = HIPSOLVER_STATUS_INTERNAL_ERROR;
+    std::thread       waiter([&]() { status = hipsolverHandlePoolAcquire(pool, &handle2); });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle1), HIPSOLVER_STATUS_SUCCESS);
+    waiter.join();
+
+    EXPECT_ROCBLAS_STATUS(status, HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(handle1, handle2);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetInfo(pool, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info.num_acquires, 2u);
+    EXPECT_EQ(info.handles_in_use, 1u);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, handle2), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(pool), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_HANDLE_POOL, invalid_arguments)
+{
+    hipsolverHandlePool_t     pool;
+    hipsolverHandle_t         handle;
+    hipsolverHandlePoolInfo_t info;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(nullptr, 1, 0),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(&pool, 0, 0), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(nullptr), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(nullptr, &handle),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetInfo(nullptr, &info),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // handles that do not belong to the pool are rejected
+    hipsolver_local_handle other;
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolCreate(&pool, 1, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolAcquire(pool, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolRelease(pool, other), HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolGetInfo(pool, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverHandlePoolDestroy(pool), HIPSOLVER_STATUS_SUCCESS);
+}
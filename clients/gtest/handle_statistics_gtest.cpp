@@ -0,0 +1,201 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_HANDLE_STATISTICS : public ::testing::Test
+{
+protected:
+    checkin_misc_HANDLE_STATISTICS() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_HANDLE_STATISTICS, normal_execution)
+{
+    hipsolver_local_handle      handle;
+    hipsolverHandleStatistics_t stats;
+
+    hipsolverStatus_t stat = hipsolverGetHandleStatistics(handle, &stats);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(stats.num_calls, 0u);
+    EXPECT_EQ(stats.num_routines, 0u);
+    EXPECT_EQ(stats.num_workspace_grows, 0u);
+    EXPECT_EQ(stats.num_internal_allocations, 0u);
+
+    const int n = 20;
+    double*   A;
+    double*   D;
+    int*      devInfo;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&D, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+
+    // without a user-provided workspace, the first call queries the size and grows the
+    // workspace, and each call takes the off-diagonal array from the memory pool
+    for(int i = 0; i < 2; i++)
+    {
+        CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              HIPSOLVER_FILL_MODE_UPPER,
+                                              n,
+                                              A,
+                                              n,
+                                              D,
+                                              nullptr,
+                                              0,
+                                              devInfo),
+                              HIPSOLVER_STATUS_SUCCESS);
+    }
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleStatistics(handle, &stats), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stats.num_calls, 2u);
+    EXPECT_EQ(stats.num_routines, 1u);
+    EXPECT_EQ(stats.num_workspace_grows, 1u);
+    EXPECT_GT(stats.peak_workspace_bytes, 0u);
+    EXPECT_EQ(stats.num_workspace_queries, 1u);
+    EXPECT_EQ(stats.num_workspace_query_hits, 1u);
+    EXPECT_EQ(stats.num_internal_allocations, 2u);
+    EXPECT_GE(stats.internal_allocation_ms, 0.0);
+
+    const char* names[2];
+    size_t      counts[2];
+    int         num_routines;
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleCallCounts(handle, 2, names, counts, &num_routines),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(num_routines, 1);
+    EXPECT_STREQ(names[0], "hipsolverDsyevd");
+    EXPECT_EQ(counts[0], 2u);
+
+    // after a reset, only the workspace already held is reported
+    size_t peak = stats.peak_workspace_bytes;
+    EXPECT_ROCBLAS_STATUS(hipsolverResetHandleStatistics(handle), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleStatistics(handle, &stats), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stats.num_calls, 0u);
+    EXPECT_EQ(stats.num_routines, 0u);
+    EXPECT_EQ(stats.num_workspace_grows, 0u);
+    EXPECT_EQ(stats.peak_workspace_bytes, peak);
+    EXPECT_EQ(stats.num_workspace_queries, 0u);
+    EXPECT_EQ(stats.num_workspace_query_hits, 0u);
+    EXPECT_EQ(stats.num_internal_allocations, 0u);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(D));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+
+TEST_F(checkin_misc_HANDLE_STATISTICS, nested_calls)
+{
+    hipsolver_local_handle      handle;
+    hipsolverHandleStatistics_t stats;
+
+    if(hipsolverGetHandleStatistics(handle, &stats) == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    const int n = 10;
+    double*   A;
+    double*   B;
+    double*   X;
+    int*      ipiv;
+    int*      devInfo;
+    int       niters;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&B, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&X, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&ipiv, sizeof(int) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMemset(B, 0, sizeof(double) * n));
+
+    // hipsolverDSgesv is implemented with hipsolverDDgesv, but is counted once
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDSgesv(handle, n, 1, A, n, ipiv, B, n, X, n, nullptr, 0, &niters, devInfo),
+        HIPSOLVER_STATUS_SUCCESS);
+
+    const char* names[2];
+    size_t      counts[2];
+    int         num_routines;
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleCallCounts(handle, 2, names, counts, &num_routines),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(num_routines, 1);
+    EXPECT_STREQ(names[0], "hipsolverDSgesv");
+    EXPECT_EQ(counts[0], 1u);
+
+    // the total is returned even when no entries are requested
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverGetHandleCallCounts(handle, 0, nullptr, nullptr, &num_routines),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(num_routines, 1);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(B));
+    CHECK_HIP_ERROR(hipFree(X));
+    CHECK_HIP_ERROR(hipFree(ipiv));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+
+TEST_F(checkin_misc_HANDLE_STATISTICS, null_handle)
+{
+    hipsolverHandleStatistics_t stats;
+    int                         num_routines;
+
+    hipsolverStatus_t stat = hipsolverGetHandleStatistics(nullptr, &stats);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleCallCounts(nullptr, 0, nullptr, nullptr, &num_routines),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverResetHandleStatistics(nullptr),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(checkin_misc_HANDLE_STATISTICS, invalid_arguments)
+{
+    hipsolver_local_handle      handle;
+    hipsolverHandleStatistics_t stats;
+    const char*                 names[1];
+    size_t                      counts[1];
+    int                         num_routines;
+
+    if(hipsolverGetHandleStatistics(handle, &stats) == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleStatistics(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleCallCounts(handle, -1, names, counts, &num_routines),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleCallCounts(handle, 1, nullptr, counts, &num_routines),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleCallCounts(handle, 1, names, counts, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
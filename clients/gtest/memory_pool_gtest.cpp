@@ -0,0 +1,229 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_MEMORY_POOL : public ::testing::Test
+{
+protected:
+    checkin_misc_MEMORY_POOL() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_MEMORY_POOL, normal_execution)
+{
+    hipsolver_local_handle    handle;
+    hipsolverMemoryPoolInfo_t info;
+
+    hipsolverStatus_t stat = hipsolverGetMemoryPoolInfo(handle, &info);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(info.reserved_bytes, 0u);
+    EXPECT_EQ(info.used_bytes, 0u);
+    EXPECT_EQ(info.num_allocations, 0u);
+
+    const int n = 20;
+    double*   A;
+    double*   D;
+    int*      devInfo;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&D, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+
+    // without a user-provided workspace, the off-diagonal array is taken from the pool
+    for(int i = 0; i < 3; i++)
+    {
+        CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              HIPSOLVER_FILL_MODE_UPPER,
+                                              n,
+                                              A,
+                                              n,
+                                              D,
+                                              nullptr,
+                                              0,
+                                              devInfo),
+                              HIPSOLVER_STATUS_SUCCESS);
+    }
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_GE(info.reserved_bytes, sizeof(double) * n);
+    EXPECT_EQ(info.used_bytes, 0u);
+    EXPECT_GE(info.peak_used_bytes, sizeof(double) * n);
+    EXPECT_EQ(info.peak_reserved_bytes, info.reserved_bytes);
+    EXPECT_EQ(info.num_allocations, 1u);
+    EXPECT_EQ(info.num_reuses, 2u);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(D));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+
+TEST_F(checkin_misc_MEMORY_POOL, jacobi_info)
+{
+    hipsolver_local_handle    handle;
+    hipsolverMemoryPoolInfo_t info;
+    hipsolverSyevjInfo_t      params;
+
+    if(hipsolverGetMemoryPoolInfo(handle, &info) == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    const int n = 20;
+    int       lwork;
+    double*   A;
+    double*   D;
+    double*   work;
+    int*      devInfo;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&D, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateSyevjInfo(&params), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevj_bufferSize(handle,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_UPPER,
+                                                     n,
+                                                     A,
+                                                     n,
+                                                     D,
+                                                     &lwork,
+                                                     params),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipMalloc(&work, sizeof(double) * std::max(lwork, 1)));
+
+    // the jacobi results are held in the pool until the info object is destroyed
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevj(handle,
+                                          HIPSOLVER_EIG_MODE_VECTOR,
+                                          HIPSOLVER_FILL_MODE_UPPER,
+                                          n,
+                                          A,
+                                          n,
+                                          D,
+                                          work,
+                                          lwork,
+                                          devInfo,
+                                          params),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_GT(info.used_bytes, 0u);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroySyevjInfo(params), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info.used_bytes, 0u);
+    EXPECT_EQ(info.num_allocations, 1u);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(D));
+    CHECK_HIP_ERROR(hipFree(work));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+
+TEST_F(checkin_misc_MEMORY_POOL, trim_and_limit)
+{
+    hipsolver_local_handle    handle;
+    hipsolverMemoryPoolInfo_t info;
+    size_t                    limit;
+
+    hipsolverStatus_t stat = hipsolverGetMemoryPoolLimit(handle, &limit);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_GT(limit, 0u);
+
+    const int n = 20;
+    double*   A;
+    double*   D;
+    int*      devInfo;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&D, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+
+    auto run = [&]() {
+        EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                              HIPSOLVER_EIG_MODE_VECTOR,
+                                              HIPSOLVER_FILL_MODE_UPPER,
+                                              n,
+                                              A,
+                                              n,
+                                              D,
+                                              nullptr,
+                                              0,
+                                              devInfo),
+                              HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipDeviceSynchronize());
+    };
+
+    // the released block is kept until the pool is trimmed
+    run();
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_GT(info.reserved_bytes, 0u);
+    EXPECT_EQ(info.num_releases, 0u);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverTrimMemoryPool(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info.reserved_bytes, 0u);
+    EXPECT_EQ(info.num_releases, 1u);
+
+    // with a limit smaller than the block, it is returned to the device by the next call
+    EXPECT_ROCBLAS_STATUS(hipsolverSetMemoryPoolLimit(handle, 1), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolLimit(handle, &limit), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(limit, 1u);
+    run();
+    run();
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, &info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(info.num_allocations, 3u);
+    EXPECT_GE(info.num_releases, 2u);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(D));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+
+TEST_F(checkin_misc_MEMORY_POOL, null_handle)
+{
+    hipsolverMemoryPoolInfo_t info;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(nullptr, &info),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverTrimMemoryPool(nullptr, 0), HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverSetMemoryPoolLimit(nullptr, 0),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(checkin_misc_MEMORY_POOL, null_info)
+{
+    hipsolver_local_handle handle;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetMemoryPoolInfo(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
@@ -48,6 +48,32 @@ TEST_F(checkin_misc_PARAMS, normal_execution)
     EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params), HIPSOLVER_STATUS_SUCCESS);
 }
 
+TEST_F(checkin_misc_PARAMS, setoptions_all_functions)
+{
+    hipsolverDnParams_t params = hipsolverDnParams_t();
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreateParams(&params), HIPSOLVER_STATUS_SUCCESS);
+
+    // rocSOLVER provides a single LU factorization, and cuSOLVER has no equivalent of the
+    // hipSOLVER extension functions
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    hipsolverStatus_t getrf_status = HIPSOLVER_STATUS_NOT_SUPPORTED;
+    hipsolverStatus_t ext_status   = HIPSOLVER_STATUS_SUCCESS;
+#else
+    hipsolverStatus_t getrf_status = HIPSOLVER_STATUS_SUCCESS;
+    hipsolverStatus_t ext_status   = HIPSOLVER_STATUS_NOT_SUPPORTED;
+#endif
+    EXPECT_EQ(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_GETRF, HIPSOLVER_ALG_1), getrf_status);
+    EXPECT_EQ(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_EXT_SYEVD, HIPSOLVER_ALG_1),
+              ext_status);
+    EXPECT_EQ(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_EXT_GESVD, HIPSOLVER_ALG_1),
+              ext_status);
+    EXPECT_EQ(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_EXT_GEQRF, HIPSOLVER_ALG_1),
+              ext_status);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyParams(params), HIPSOLVER_STATUS_SUCCESS);
+}
+
 TEST_F(checkin_misc_PARAMS, create_nullptr)
 {
     EXPECT_ROCBLAS_STATUS(hipsolverDnCreateParams(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
@@ -0,0 +1,190 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_PLAN : public ::testing::Test
+{
+protected:
+    checkin_misc_PLAN() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+static hipsolverWorkspaceOp_t plan_desc(hipsolverRoutine_t routine, int n)
+{
+    hipsolverWorkspaceOp_t desc = {};
+    desc.routine                = routine;
+    desc.precision              = HIP_R_64F;
+    desc.m                      = n;
+    desc.n                      = n;
+    desc.nrhs                   = 1;
+    desc.lda                    = n;
+    desc.ldb                    = n;
+    desc.batch_count            = 1;
+    desc.trans                  = HIPSOLVER_OP_N;
+    desc.uplo                   = HIPSOLVER_FILL_MODE_UPPER;
+    desc.jobz                   = HIPSOLVER_EIG_MODE_VECTOR;
+    return desc;
+}
+
+TEST_F(checkin_misc_PLAN, normal_execution)
+{
+    hipsolver_local_handle handle;
+
+    const int              n          = 32;
+    hipsolverWorkspaceOp_t desc_getrf = plan_desc(HIPSOLVER_ROUTINE_GETRF, n);
+    hipsolverWorkspaceOp_t desc_getrs = plan_desc(HIPSOLVER_ROUTINE_GETRS, n);
+
+    hipsolverDnPlan_t plan_getrf, plan_getrs;
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreatePlan(handle, &desc_getrf, &plan_getrf),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreatePlan(handle, &desc_getrs, &plan_getrs),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    // A = 2I and B = ones, so that X = 0.5
+    std::vector<double> hA(n * n, 0.0), hB(n, 1.0);
+    for(int i = 0; i < n; i++)
+        hA[i + i * n] = 2.0;
+
+    double* A;
+    double* B;
+    int*    ipiv;
+    int*    devInfo;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&B, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&ipiv, sizeof(int) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+
+    // plans are reusable
+    for(int iter = 0; iter < 3; iter++)
+    {
+        CHECK_HIP_ERROR(hipMemcpy(A, hA.data(), sizeof(double) * n * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(B, hB.data(), sizeof(double) * n, hipMemcpyHostToDevice));
+
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDnExecutePlan(plan_getrf, A, nullptr, nullptr, ipiv, devInfo),
+            HIPSOLVER_STATUS_SUCCESS);
+        EXPECT_ROCBLAS_STATUS(hipsolverDnExecutePlan(plan_getrs, A, B, nullptr, ipiv, devInfo),
+                              HIPSOLVER_STATUS_SUCCESS);
+
+        int                 info;
+        std::vector<double> hX(n);
+        CHECK_HIP_ERROR(hipMemcpy(&info, devInfo, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hX.data(), B, sizeof(double) * n, hipMemcpyDeviceToHost));
+
+        EXPECT_EQ(info, 0);
+        for(int i = 0; i < n; i++)
+            EXPECT_DOUBLE_EQ(hX[i], 0.5);
+    }
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyPlan(plan_getrf), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyPlan(plan_getrs), HIPSOLVER_STATUS_SUCCESS);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(B));
+    CHECK_HIP_ERROR(hipFree(ipiv));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+TEST_F(checkin_misc_PLAN, workspace_restored)
+{
+    hipsolver_local_handle handle;
+
+    const int              n    = 32;
+    hipsolverWorkspaceOp_t desc = plan_desc(HIPSOLVER_ROUTINE_GETRF, n);
+
+    std::vector<double> hA(n * n, 0.0);
+    for(int i = 0; i < n; i++)
+        hA[i + i * n] = 2.0;
+
+    double* A;
+    int*    ipiv;
+    int*    devInfo;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&ipiv, sizeof(int) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+
+    // regular functions that manage their own workspace may run between executions
+    // of a plan and after it is destroyed
+    hipsolverDnPlan_t plan;
+    EXPECT_EQ(hipsolverDnCreatePlan(handle, &desc, &plan), HIPSOLVER_STATUS_SUCCESS);
+    for(int iter = 0; iter < 3; iter++)
+    {
+        int info;
+
+        CHECK_HIP_ERROR(hipMemcpy(A, hA.data(), sizeof(double) * n * n, hipMemcpyHostToDevice));
+        EXPECT_EQ(hipsolverDnExecutePlan(plan, A, nullptr, nullptr, ipiv, devInfo),
+                  HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipMemcpy(&info, devInfo, sizeof(int), hipMemcpyDeviceToHost));
+        EXPECT_EQ(info, 0);
+
+        if(iter == 2)
+            EXPECT_EQ(hipsolverDnDestroyPlan(plan), HIPSOLVER_STATUS_SUCCESS);
+
+        CHECK_HIP_ERROR(hipMemcpy(A, hA.data(), sizeof(double) * n * n, hipMemcpyHostToDevice));
+        EXPECT_EQ(hipsolverDgetrf(handle, n, n, A, n, nullptr, 0, ipiv, devInfo),
+                  HIPSOLVER_STATUS_SUCCESS);
+        CHECK_HIP_ERROR(hipMemcpy(&info, devInfo, sizeof(int), hipMemcpyDeviceToHost));
+        EXPECT_EQ(info, 0);
+    }
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(ipiv));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+#endif
+
+TEST_F(checkin_misc_PLAN, bad_arguments)
+{
+    hipsolver_local_handle handle;
+    hipsolverWorkspaceOp_t desc = plan_desc(HIPSOLVER_ROUTINE_POTRF, 10);
+    hipsolverDnPlan_t      plan;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreatePlan(nullptr, &desc, &plan),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreatePlan(handle, nullptr, &plan),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreatePlan(handle, &desc, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverDnExecutePlan(nullptr, nullptr, nullptr, nullptr, nullptr, nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDestroyPlan(nullptr), HIPSOLVER_STATUS_INVALID_VALUE);
+
+    desc.precision = HIP_R_16F;
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreatePlan(handle, &desc, &plan),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    // routines without plan support
+    desc = plan_desc(HIPSOLVER_ROUTINE_SYTRF, 10);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnCreatePlan(handle, &desc, &plan),
+                          HIPSOLVER_STATUS_NOT_SUPPORTED);
+}
@@ -0,0 +1,87 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_REFINEMENT : public ::testing::Test
+{
+protected:
+    checkin_misc_REFINEMENT() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_REFINEMENT, normal_execution)
+{
+    hipsolver_local_handle handle;
+    int                    max_iters;
+
+    // the backend default is selected until a value is set
+    EXPECT_ROCBLAS_STATUS(hipsolverGetRefinementMaxIters(handle, &max_iters),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(max_iters, 0);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetRefinementMaxIters(handle, 10), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetRefinementMaxIters(handle, &max_iters),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(max_iters, 10);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetRefinementMaxIters(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetRefinementMaxIters(handle, &max_iters),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(max_iters, 0);
+}
+
+TEST_F(checkin_misc_REFINEMENT, get_null_handle)
+{
+    int max_iters;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetRefinementMaxIters(nullptr, &max_iters),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(checkin_misc_REFINEMENT, get_null_max_iters)
+{
+    hipsolver_local_handle handle;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetRefinementMaxIters(handle, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST_F(checkin_misc_REFINEMENT, set_null_handle)
+{
+    EXPECT_ROCBLAS_STATUS(hipsolverSetRefinementMaxIters(nullptr, 10),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(checkin_misc_REFINEMENT, set_invalid_value)
+{
+    hipsolver_local_handle handle;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetRefinementMaxIters(handle, -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
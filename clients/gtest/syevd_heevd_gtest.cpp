@@ -75,7 +75,7 @@ Arguments syevd_heevd_setup_arguments(syevd_heevd_tuple tup)
     return arg;
 }
 
-template <testAPI_t API>
+template <testAPI_t API, typename I, typename SIZE, int ALG = 0>
 class SYEVD_HEEVD : public ::TestWithParam<syevd_heevd_tuple>
 {
 protected:
@@ -91,26 +91,44 @@ protected:
 
         if(arg.peek<rocblas_int>("n") == -1 && arg.peek<char>("jobz") == 'N'
            && arg.peek<char>("uplo") == 'L')
-            testing_syevd_heevd_bad_arg<API, BATCHED, STRIDED, T>();
+            testing_syevd_heevd_bad_arg<API, BATCHED, STRIDED, T, I, SIZE>();
 
-        arg.batch_count = 1;
-        testing_syevd_heevd<API, BATCHED, STRIDED, T>(arg);
+        arg.set<rocblas_int>("alg", ALG);
+
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_syevd_heevd<API, BATCHED, STRIDED, T, I, SIZE>(arg);
     }
 };
 
-class SYEVD : public SYEVD_HEEVD<API_NORMAL>
+class SYEVD : public SYEVD_HEEVD<API_NORMAL, int, int>
+{
+};
+
+class HEEVD : public SYEVD_HEEVD<API_NORMAL, int, int>
+{
+};
+
+class SYEVD_FORTRAN : public SYEVD_HEEVD<API_FORTRAN, int, int>
+{
+};
+
+class HEEVD_FORTRAN : public SYEVD_HEEVD<API_FORTRAN, int, int>
 {
 };
 
-class HEEVD : public SYEVD_HEEVD<API_NORMAL>
+class SYEVD_COMPAT_64 : public SYEVD_HEEVD<API_COMPAT, int64_t, size_t>
 {
 };
 
-class SYEVD_FORTRAN : public SYEVD_HEEVD<API_FORTRAN>
+class HEEVD_COMPAT_64 : public SYEVD_HEEVD<API_COMPAT, int64_t, size_t>
 {
 };
 
-class HEEVD_FORTRAN : public SYEVD_HEEVD<API_FORTRAN>
+class SYEVD_COMPAT_64_ALG1 : public SYEVD_HEEVD<API_COMPAT, int64_t, size_t, 1>
+{
+};
+
+class HEEVD_COMPAT_64_ALG1 : public SYEVD_HEEVD<API_COMPAT, int64_t, size_t, 1>
 {
 };
 
@@ -156,6 +174,70 @@ TEST_P(HEEVD_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(SYEVD_COMPAT_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYEVD_COMPAT_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HEEVD_COMPAT_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVD_COMPAT_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYEVD, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYEVD, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEEVD, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVD, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+TEST_P(SYEVD_COMPAT_64_ALG1, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYEVD_COMPAT_64_ALG1, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HEEVD_COMPAT_64_ALG1, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVD_COMPAT_64_ALG1, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+#endif
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          SYEVD,
 //                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
@@ -183,3 +265,29 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack,
 INSTANTIATE_TEST_SUITE_P(checkin_lapack,
                          HEEVD_FORTRAN,
                          Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SYEVD_COMPAT_64,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYEVD_COMPAT_64,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          HEEVD_COMPAT_64,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HEEVD_COMPAT_64,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYEVD_COMPAT_64_ALG1,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HEEVD_COMPAT_64_ALG1,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+#endif
@@ -85,7 +85,7 @@ Arguments syevdx_heevdx_setup_arguments(syevdx_heevdx_tuple tup)
     return arg;
 }
 
-template <testAPI_t API>
+template <testAPI_t API, typename I, typename SIZE>
 class SYEVDX_HEEVDX : public ::TestWithParam<syevdx_heevdx_tuple>
 {
 protected:
@@ -101,18 +101,26 @@ protected:
 
         if(arg.peek<rocblas_int>("n") == 1 && arg.peek<char>("jobz") == 'N'
            && arg.peek<char>("range") == 'V' && arg.peek<char>("uplo") == 'L')
-            testing_syevdx_heevdx_bad_arg<API, BATCHED, STRIDED, T>();
+            testing_syevdx_heevdx_bad_arg<API, BATCHED, STRIDED, T, I, SIZE>();
 
-        arg.batch_count = 1;
-        testing_syevdx_heevdx<API, BATCHED, STRIDED, T>(arg);
+        arg.batch_count = (BATCHED || STRIDED ? 3 : 1);
+        testing_syevdx_heevdx<API, BATCHED, STRIDED, T, I, SIZE>(arg);
     }
 };
 
-class SYEVDX : public SYEVDX_HEEVDX<API_NORMAL>
+class SYEVDX : public SYEVDX_HEEVDX<API_NORMAL, int, int>
 {
 };
 
-class HEEVDX : public SYEVDX_HEEVDX<API_NORMAL>
+class HEEVDX : public SYEVDX_HEEVDX<API_NORMAL, int, int>
+{
+};
+
+class SYEVDX_COMPAT_64 : public SYEVDX_HEEVDX<API_COMPAT, int64_t, size_t>
+{
+};
+
+class HEEVDX_COMPAT_64 : public SYEVDX_HEEVDX<API_COMPAT, int64_t, size_t>
 {
 };
 
@@ -138,6 +146,48 @@ TEST_P(HEEVDX, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+TEST_P(SYEVDX_COMPAT_64, __float)
+{
+    run_tests<false, false, float>();
+}
+
+TEST_P(SYEVDX_COMPAT_64, __double)
+{
+    run_tests<false, false, double>();
+}
+
+TEST_P(HEEVDX_COMPAT_64, __float_complex)
+{
+    run_tests<false, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVDX_COMPAT_64, __double_complex)
+{
+    run_tests<false, false, rocblas_double_complex>();
+}
+
+// strided_batched tests
+
+TEST_P(SYEVDX, strided_batched__float)
+{
+    run_tests<false, true, float>();
+}
+
+TEST_P(SYEVDX, strided_batched__double)
+{
+    run_tests<false, true, double>();
+}
+
+TEST_P(HEEVDX, strided_batched__float_complex)
+{
+    run_tests<false, true, rocblas_float_complex>();
+}
+
+TEST_P(HEEVDX, strided_batched__double_complex)
+{
+    run_tests<false, true, rocblas_double_complex>();
+}
+
 // INSTANTIATE_TEST_SUITE_P(daily_lapack,
 //                          SYEVDX,
 //                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
@@ -149,3 +199,19 @@ INSTANTIATE_TEST_SUITE_P(checkin_lapack, SYEVDX, Combine(ValuesIn(size_range), V
 //                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
 
 INSTANTIATE_TEST_SUITE_P(checkin_lapack, HEEVDX, Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          SYEVDX_COMPAT_64,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         SYEVDX_COMPAT_64,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
+
+// INSTANTIATE_TEST_SUITE_P(daily_lapack,
+//                          HEEVDX_COMPAT_64,
+//                          Combine(ValuesIn(large_size_range), ValuesIn(op_range)));
+
+INSTANTIATE_TEST_SUITE_P(checkin_lapack,
+                         HEEVDX_COMPAT_64,
+                         Combine(ValuesIn(size_range), ValuesIn(op_range)));
@@ -158,6 +158,28 @@ TEST_P(HEEVJ_FORTRAN, __double_complex)
     run_tests<false, false, rocblas_double_complex>();
 }
 
+// batched tests
+
+TEST_P(SYEVJ, batched__float)
+{
+    run_tests<true, false, float>();
+}
+
+TEST_P(SYEVJ, batched__double)
+{
+    run_tests<true, false, double>();
+}
+
+TEST_P(HEEVJ, batched__float_complex)
+{
+    run_tests<true, false, rocblas_float_complex>();
+}
+
+TEST_P(HEEVJ, batched__double_complex)
+{
+    run_tests<true, false, rocblas_double_complex>();
+}
+
 // strided_batched tests
 
 TEST_P(SYEVJ, strided_batched__float)
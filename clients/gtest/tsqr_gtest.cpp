@@ -0,0 +1,425 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_TSQR : public ::testing::Test
+{
+protected:
+    checkin_misc_TSQR() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+// The tall-skinny QR factorization is only provided by the rocSOLVER backend
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+// tall-skinny sizes m-by-n
+static const std::vector<std::pair<int, int>> tsqr_sizes = {{4096, 8}, {8192, 32}, {20000, 64}};
+
+static const double tsqr_tol = 1e-10;
+
+static std::vector<double> tsqr_matrix(int m, int n)
+{
+    std::vector<double> hA(size_t(m) * n);
+    for(auto& a : hA)
+        a = random_generator<double>() - 5.5;
+    return hA;
+}
+
+static double max_abs(const std::vector<double>& x)
+{
+    double r = 0;
+    for(double v : x)
+        r = std::max(r, std::abs(v));
+    return r;
+}
+
+// Factorizes the m-by-n matrix dA with hipsolverDnXgeqrf, using the algorithm alg for
+// HIPSOLVERDN_EXT_GEQRF
+static void tsqr_xgeqrf(hipsolverHandle_t  handle,
+                        hipsolverAlgMode_t alg,
+                        int                m,
+                        int                n,
+                        double*            dA,
+                        double*            dTau,
+                        int*               dInfo)
+{
+    hipsolver_local_params params;
+    ASSERT_EQ(hipsolverDnSetAdvOptions(params, HIPSOLVERDN_EXT_GEQRF, alg),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    size_t lworkOnDevice, lworkOnHost;
+    ASSERT_EQ(hipsolverDnXgeqrf_bufferSize(handle,
+                                           params,
+                                           m,
+                                           n,
+                                           HIP_R_64F,
+                                           dA,
+                                           m,
+                                           HIP_R_64F,
+                                           dTau,
+                                           HIP_R_64F,
+                                           &lworkOnDevice,
+                                           &lworkOnHost),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    void*             dWork;
+    std::vector<char> hWork(std::max(lworkOnHost, size_t(1)));
+    CHECK_HIP_ERROR(hipMalloc(&dWork, std::max(lworkOnDevice, size_t(1))));
+
+    EXPECT_EQ(hipsolverDnXgeqrf(handle,
+                                params,
+                                m,
+                                n,
+                                HIP_R_64F,
+                                dA,
+                                m,
+                                HIP_R_64F,
+                                dTau,
+                                HIP_R_64F,
+                                dWork,
+                                lworkOnDevice,
+                                hWork.data(),
+                                lworkOnHost,
+                                dInfo),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    int info;
+    CHECK_HIP_ERROR(hipMemcpy(&info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(info, 0);
+
+    CHECK_HIP_ERROR(hipFree(dWork));
+}
+
+// Overwrites the m-by-nrhs matrix dC with Q^T * C, where Q is the orthogonal factor held by
+// the factorization dA, dTau
+static void tsqr_ormqr(hipsolverHandle_t handle,
+                       int               m,
+                       int               n,
+                       int               nrhs,
+                       double*           dA,
+                       double*           dTau,
+                       double*           dC,
+                       int*              dInfo)
+{
+    int lwork;
+    ASSERT_EQ(hipsolverDormqr_bufferSize(handle,
+                                         HIPSOLVER_SIDE_LEFT,
+                                         HIPSOLVER_OP_T,
+                                         m,
+                                         nrhs,
+                                         n,
+                                         dA,
+                                         m,
+                                         dTau,
+                                         dC,
+                                         m,
+                                         &lwork),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    double* dWork;
+    CHECK_HIP_ERROR(hipMalloc(&dWork, sizeof(double) * std::max(lwork, 1)));
+
+    EXPECT_EQ(hipsolverDormqr(handle,
+                              HIPSOLVER_SIDE_LEFT,
+                              HIPSOLVER_OP_T,
+                              m,
+                              nrhs,
+                              n,
+                              dA,
+                              m,
+                              dTau,
+                              dC,
+                              m,
+                              dWork,
+                              lwork,
+                              dInfo),
+              HIPSOLVER_STATUS_SUCCESS);
+
+    int info;
+    CHECK_HIP_ERROR(hipMemcpy(&info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+    EXPECT_EQ(info, 0);
+
+    CHECK_HIP_ERROR(hipFree(dWork));
+}
+
+TEST_F(checkin_misc_TSQR, geqrf)
+{
+    hipsolver_local_handle handle;
+    hipsolver_seedrand();
+
+    for(const auto& size : tsqr_sizes)
+    {
+        int m = size.first;
+        int n = size.second;
+        SCOPED_TRACE(testing::Message() << "m = " << m << ", n = " << n);
+        std::vector<double> hA = tsqr_matrix(m, n);
+
+        double* dA_qr;
+        double* dA_tsqr;
+        double* dTau;
+        int*    dInfo;
+        CHECK_HIP_ERROR(hipMalloc(&dA_qr, sizeof(double) * m * n));
+        CHECK_HIP_ERROR(hipMalloc(&dA_tsqr, sizeof(double) * m * n));
+        CHECK_HIP_ERROR(hipMalloc(&dTau, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&dInfo, sizeof(int)));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dA_qr, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(
+            hipMemcpy(dA_tsqr, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+
+        tsqr_xgeqrf(handle, HIPSOLVER_ALG_0, m, n, dA_qr, dTau, dInfo);
+        tsqr_xgeqrf(handle, HIPSOLVER_ALG_1, m, n, dA_tsqr, dTau, dInfo);
+
+        std::vector<double> hR_qr(size_t(m) * n), hR_tsqr(size_t(m) * n);
+        CHECK_HIP_ERROR(
+            hipMemcpy(hR_qr.data(), dA_qr, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(
+            hipMemcpy(hR_tsqr.data(), dA_tsqr, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+
+        // R is unique up to the signs of its rows
+        double max_r = 0, max_diff = 0;
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i <= j; i++)
+            {
+                double r      = std::abs(hR_qr[i + size_t(j) * m]);
+                double r_tsqr = std::abs(hR_tsqr[i + size_t(j) * m]);
+                max_r         = std::max(max_r, r);
+                max_diff      = std::max(max_diff, std::abs(r - r_tsqr));
+            }
+        }
+        EXPECT_LE(max_diff, tsqr_tol * max_r);
+
+        CHECK_HIP_ERROR(hipFree(dA_qr));
+        CHECK_HIP_ERROR(hipFree(dA_tsqr));
+        CHECK_HIP_ERROR(hipFree(dTau));
+        CHECK_HIP_ERROR(hipFree(dInfo));
+    }
+}
+
+TEST_F(checkin_misc_TSQR, orgqr)
+{
+    hipsolver_local_handle handle;
+    hipsolver_seedrand();
+
+    for(const auto& size : tsqr_sizes)
+    {
+        int m = size.first;
+        int n = size.second;
+        SCOPED_TRACE(testing::Message() << "m = " << m << ", n = " << n);
+        std::vector<double> hA = tsqr_matrix(m, n);
+
+        double* dA;
+        double* dTau;
+        int*    dInfo;
+        CHECK_HIP_ERROR(hipMalloc(&dA, sizeof(double) * m * n));
+        CHECK_HIP_ERROR(hipMalloc(&dTau, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&dInfo, sizeof(int)));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+
+        tsqr_xgeqrf(handle, HIPSOLVER_ALG_1, m, n, dA, dTau, dInfo);
+
+        std::vector<double> hR(size_t(m) * n), hQ(size_t(m) * n);
+        CHECK_HIP_ERROR(hipMemcpy(hR.data(), dA, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+
+        // the Householder vectors of the tall-skinny factorization build Q with orgqr
+        int lwork;
+        ASSERT_EQ(hipsolverDorgqr_bufferSize(handle, m, n, n, dA, m, dTau, &lwork),
+                  HIPSOLVER_STATUS_SUCCESS);
+
+        double* dWork;
+        CHECK_HIP_ERROR(hipMalloc(&dWork, sizeof(double) * std::max(lwork, 1)));
+        EXPECT_EQ(hipsolverDorgqr(handle, m, n, n, dA, m, dTau, dWork, lwork, dInfo),
+                  HIPSOLVER_STATUS_SUCCESS);
+
+        int info;
+        CHECK_HIP_ERROR(hipMemcpy(&info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hQ.data(), dA, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+        EXPECT_EQ(info, 0);
+
+        // Q^T * Q = I
+        double max_orth = 0;
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < n; i++)
+            {
+                double s = 0;
+                for(int k = 0; k < m; k++)
+                    s += hQ[k + size_t(i) * m] * hQ[k + size_t(j) * m];
+                max_orth = std::max(max_orth, std::abs(s - (i == j ? 1.0 : 0.0)));
+            }
+        }
+        EXPECT_LE(max_orth, tsqr_tol);
+
+        // Q * R = A
+        double max_diff = 0;
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < m; i++)
+            {
+                double s = 0;
+                for(int k = 0; k <= j; k++)
+                    s += hQ[i + size_t(k) * m] * hR[k + size_t(j) * m];
+                max_diff = std::max(max_diff, std::abs(s - hA[i + size_t(j) * m]));
+            }
+        }
+        EXPECT_LE(max_diff, tsqr_tol * max_abs(hA));
+
+        CHECK_HIP_ERROR(hipFree(dA));
+        CHECK_HIP_ERROR(hipFree(dTau));
+        CHECK_HIP_ERROR(hipFree(dInfo));
+        CHECK_HIP_ERROR(hipFree(dWork));
+    }
+}
+
+TEST_F(checkin_misc_TSQR, ormqr)
+{
+    hipsolver_local_handle handle;
+    hipsolver_seedrand();
+
+    for(const auto& size : tsqr_sizes)
+    {
+        int m = size.first;
+        int n = size.second;
+        SCOPED_TRACE(testing::Message() << "m = " << m << ", n = " << n);
+        std::vector<double> hA = tsqr_matrix(m, n);
+
+        double* dA;
+        double* dC;
+        double* dTau;
+        int*    dInfo;
+        CHECK_HIP_ERROR(hipMalloc(&dA, sizeof(double) * m * n));
+        CHECK_HIP_ERROR(hipMalloc(&dC, sizeof(double) * m * n));
+        CHECK_HIP_ERROR(hipMalloc(&dTau, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&dInfo, sizeof(int)));
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dC, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+
+        tsqr_xgeqrf(handle, HIPSOLVER_ALG_1, m, n, dA, dTau, dInfo);
+        tsqr_ormqr(handle, m, n, n, dA, dTau, dC, dInfo);
+
+        std::vector<double> hR(size_t(m) * n), hC(size_t(m) * n);
+        CHECK_HIP_ERROR(hipMemcpy(hR.data(), dA, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hC.data(), dC, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+
+        // Q^T * A = [R; 0]
+        double max_diff = 0;
+        for(int j = 0; j < n; j++)
+        {
+            for(int i = 0; i < m; i++)
+            {
+                double r = i <= j ? hR[i + size_t(j) * m] : 0.0;
+                max_diff = std::max(max_diff, std::abs(hC[i + size_t(j) * m] - r));
+            }
+        }
+        EXPECT_LE(max_diff, tsqr_tol * max_abs(hA));
+
+        CHECK_HIP_ERROR(hipFree(dA));
+        CHECK_HIP_ERROR(hipFree(dC));
+        CHECK_HIP_ERROR(hipFree(dTau));
+        CHECK_HIP_ERROR(hipFree(dInfo));
+    }
+}
+
+TEST_F(checkin_misc_TSQR, gels)
+{
+    hipsolver_local_handle handle;
+    hipsolver_seedrand();
+
+    for(const auto& size : tsqr_sizes)
+    {
+        int m = size.first;
+        int n = size.second;
+        SCOPED_TRACE(testing::Message() << "m = " << m << ", n = " << n);
+        std::vector<double> hA = tsqr_matrix(m, n);
+        std::vector<double> hB = tsqr_matrix(m, 1);
+
+        double* dA;
+        double* dB;
+        double* dX;
+        double* dTau;
+        int*    dInfo;
+        CHECK_HIP_ERROR(hipMalloc(&dA, sizeof(double) * m * n));
+        CHECK_HIP_ERROR(hipMalloc(&dB, sizeof(double) * m));
+        CHECK_HIP_ERROR(hipMalloc(&dX, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&dTau, sizeof(double) * n));
+        CHECK_HIP_ERROR(hipMalloc(&dInfo, sizeof(int)));
+
+        // reference least squares solution
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(double) * m, hipMemcpyHostToDevice));
+
+        size_t lwork;
+        ASSERT_EQ(hipsolverDDgels_bufferSize(handle, m, n, 1, dA, m, dB, m, dX, n, &lwork),
+                  HIPSOLVER_STATUS_SUCCESS);
+
+        void* dWork;
+        int   niters, info;
+        CHECK_HIP_ERROR(hipMalloc(&dWork, std::max(lwork, size_t(1))));
+        EXPECT_EQ(
+            hipsolverDDgels(handle, m, n, 1, dA, m, dB, m, dX, n, dWork, lwork, &niters, dInfo),
+            HIPSOLVER_STATUS_SUCCESS);
+
+        std::vector<double> hX(n);
+        CHECK_HIP_ERROR(hipMemcpy(&info, dInfo, sizeof(int), hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hX.data(), dX, sizeof(double) * n, hipMemcpyDeviceToHost));
+        EXPECT_EQ(info, 0);
+
+        // tall-skinny solution: R * x = (Q^T * b)(0:n-1)
+        CHECK_HIP_ERROR(hipMemcpy(dA, hA.data(), sizeof(double) * m * n, hipMemcpyHostToDevice));
+        CHECK_HIP_ERROR(hipMemcpy(dB, hB.data(), sizeof(double) * m, hipMemcpyHostToDevice));
+
+        tsqr_xgeqrf(handle, HIPSOLVER_ALG_1, m, n, dA, dTau, dInfo);
+        tsqr_ormqr(handle, m, n, 1, dA, dTau, dB, dInfo);
+
+        std::vector<double> hR(size_t(m) * n), hY(m);
+        CHECK_HIP_ERROR(hipMemcpy(hR.data(), dA, sizeof(double) * m * n, hipMemcpyDeviceToHost));
+        CHECK_HIP_ERROR(hipMemcpy(hY.data(), dB, sizeof(double) * m, hipMemcpyDeviceToHost));
+
+        for(int i = n - 1; i >= 0; i--)
+        {
+            for(int k = i + 1; k < n; k++)
+                hY[i] -= hR[i + size_t(k) * m] * hY[k];
+            hY[i] /= hR[i + size_t(i) * m];
+        }
+
+        double max_diff = 0;
+        for(int i = 0; i < n; i++)
+            max_diff = std::max(max_diff, std::abs(hY[i] - hX[i]));
+        EXPECT_LE(max_diff, 1e-8 * max_abs(hX));
+
+        CHECK_HIP_ERROR(hipFree(dA));
+        CHECK_HIP_ERROR(hipFree(dB));
+        CHECK_HIP_ERROR(hipFree(dX));
+        CHECK_HIP_ERROR(hipFree(dTau));
+        CHECK_HIP_ERROR(hipFree(dInfo));
+        CHECK_HIP_ERROR(hipFree(dWork));
+    }
+}
+#endif
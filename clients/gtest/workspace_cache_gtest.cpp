@@ -0,0 +1,385 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#include "clientcommon.hpp"
+
+#include <thread>
+#include <vector>
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_WORKSPACE_CACHE : public ::testing::Test
+{
+protected:
+    checkin_misc_WORKSPACE_CACHE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+TEST_F(checkin_misc_WORKSPACE_CACHE, normal_execution)
+{
+    hipsolver_local_handle handle;
+    size_t                 hits, misses;
+    int                    lwork1, lwork2;
+
+    hipsolverStatus_t stat = hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses);
+    EXPECT_ROCBLAS_STATUS(stat, HIPSOLVER_STATUS_SUCCESS);
+    if(stat == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(misses, 0u);
+
+    // first query is computed, second one is served from the cache
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, 50, 50, nullptr, 50, &lwork1),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, 50, 50, nullptr, 50, &lwork2),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork1, lwork2);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 1u);
+    EXPECT_EQ(misses, 1u);
+
+    // different arguments are a different entry
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf_bufferSize(handle, 50, 50, nullptr, 60, &lwork2),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 1u);
+    EXPECT_EQ(misses, 2u);
+}
+
+TEST_F(checkin_misc_WORKSPACE_CACHE, invalidation)
+{
+    hipsolver_local_handle handle;
+    size_t                 hits, misses;
+    int                    lwork;
+    hipStream_t            stream;
+
+    if(hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses) == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSpotrf_bufferSize(
+                              handle, HIPSOLVER_FILL_MODE_LOWER, 40, nullptr, 40, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    // changing the stream invalidates the cache
+    CHECK_HIP_ERROR(hipStreamCreate(&stream));
+    EXPECT_ROCBLAS_STATUS(hipsolverSetStream(handle, stream), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpotrf_bufferSize(
+                              handle, HIPSOLVER_FILL_MODE_LOWER, 40, nullptr, 40, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(misses, 2u);
+
+    // changing the deterministic mode invalidates the cache
+    hipsolverDeterministicMode_t mode;
+    EXPECT_ROCBLAS_STATUS(hipsolverGetDeterministicMode(handle, &mode), HIPSOLVER_STATUS_SUCCESS);
+    mode = (mode == HIPSOLVER_DETERMINISTIC_RESULTS) ? HIPSOLVER_ALLOW_NON_DETERMINISTIC_RESULTS
+                                                     : HIPSOLVER_DETERMINISTIC_RESULTS;
+    EXPECT_ROCBLAS_STATUS(hipsolverSetDeterministicMode(handle, mode), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSpotrf_bufferSize(
+                              handle, HIPSOLVER_FILL_MODE_LOWER, 40, nullptr, 40, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 0u);
+    EXPECT_EQ(misses, 3u);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSetStream(handle, 0), HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipStreamDestroy(stream));
+}
+
+TEST_F(checkin_misc_WORKSPACE_CACHE, compat_gesvd_probe)
+{
+    hipsolver_local_handle handle;
+    size_t                 hits, misses;
+    int                    lwork1, lwork2;
+
+    if(hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses) == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+
+    // the probe over all job combinations is a single miss, and the next query a hit
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDgesvd_bufferSize(handle, 40, 30, &lwork1),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDnDgesvd_bufferSize(handle, 40, 30, &lwork2),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork1, lwork2);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheInfo(handle, &hits, &misses),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(hits, 1u);
+    EXPECT_EQ(misses, 1u);
+}
+
+TEST_F(checkin_misc_WORKSPACE_CACHE, concurrent_handles)
+{
+    constexpr int num_threads = 4;
+    constexpr int num_queries = 100;
+
+    std::vector<size_t>      hits(num_threads), misses(num_threads);
+    std::vector<std::thread> threads;
+
+    // each thread only sees the queries made on its own handle
+    for(int t = 0; t < num_threads; t++)
+        threads.emplace_back([&, t]() {
+            hipsolver_local_handle handle;
+            int                    lwork;
+
+            for(int i = 0; i < num_queries; i++)
+                hipsolverDgetrf_bufferSize(handle, 30 + t, 30, nullptr, 30 + t, &lwork);
+            hipsolverGetWorkspaceCacheInfo(handle, &hits[t], &misses[t]);
+        });
+    for(auto& thread : threads)
+        thread.join();
+
+    for(int t = 0; t < num_threads; t++)
+    {
+        if(hits[t] == 0 && misses[t] == 0)
+            return; // not supported by the backend
+        EXPECT_EQ(hits[t], size_t(num_queries - 1));
+        EXPECT_EQ(misses[t], 1u);
+    }
+}
+
+TEST_F(checkin_misc_WORKSPACE_CACHE, null_handle)
+{
+    size_t hits, misses;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheInfo(nullptr, &hits, &misses),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+}
+
+TEST_F(checkin_misc_WORKSPACE_CACHE, null_counters)
+{
+    hipsolver_local_handle handle;
+    size_t                 hits;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetWorkspaceCacheInfo(handle, &hits, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
+
+TEST_F(checkin_misc_WORKSPACE_CACHE, size_t_queries)
+{
+    hipsolver_local_handle handle;
+    int                    lwork;
+    size_t                 lwork_ext;
+
+    // the size_t queries agree with the int ones when the size fits
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd_bufferSize(handle,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_LOWER,
+                                                     50,
+                                                     nullptr,
+                                                     50,
+                                                     nullptr,
+                                                     &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevdExt_bufferSize(handle,
+                                                        HIPSOLVER_EIG_MODE_VECTOR,
+                                                        HIPSOLVER_FILL_MODE_LOWER,
+                                                        50,
+                                                        nullptr,
+                                                        50,
+                                                        nullptr,
+                                                        &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverZgesvd_bufferSize(handle, 'A', 'A', 60, 40, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverZgesvdExt_bufferSize(handle, 'A', 'A', 60, 40, &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverZgesvdExt_bufferSize(handle, 'A', 'A', 60, 40, nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrf_bufferSize(handle, 50, 40, nullptr, 50, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSgetrfExt_bufferSize(handle, 50, 40, nullptr, 50, &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+
+    EXPECT_ROCBLAS_STATUS(
+        hipsolverCpotrf_bufferSize(handle, HIPSOLVER_FILL_MODE_UPPER, 50, nullptr, 50, &lwork),
+        HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverCpotrfExt_bufferSize(
+                              handle, HIPSOLVER_FILL_MODE_UPPER, 50, nullptr, 50, &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqrf_bufferSize(handle, 60, 40, nullptr, 60, &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDgeqrfExt_bufferSize(handle, 60, 40, nullptr, 60, &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+
+    EXPECT_ROCBLAS_STATUS(hipsolverZhegvd_bufferSize(handle,
+                                                     HIPSOLVER_EIG_TYPE_1,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_LOWER,
+                                                     50,
+                                                     nullptr,
+                                                     50,
+                                                     nullptr,
+                                                     50,
+                                                     nullptr,
+                                                     &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverZhegvdExt_bufferSize(handle,
+                                                        HIPSOLVER_EIG_TYPE_1,
+                                                        HIPSOLVER_EIG_MODE_VECTOR,
+                                                        HIPSOLVER_FILL_MODE_LOWER,
+                                                        50,
+                                                        nullptr,
+                                                        50,
+                                                        nullptr,
+                                                        50,
+                                                        nullptr,
+                                                        &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+
+    hipsolverSyevjInfo_t syevj_info;
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateSyevjInfo(&syevj_info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevj_bufferSize(handle,
+                                                     HIPSOLVER_EIG_MODE_VECTOR,
+                                                     HIPSOLVER_FILL_MODE_LOWER,
+                                                     50,
+                                                     nullptr,
+                                                     50,
+                                                     nullptr,
+                                                     &lwork,
+                                                     syevj_info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevjExt_bufferSize(handle,
+                                                        HIPSOLVER_EIG_MODE_VECTOR,
+                                                        HIPSOLVER_FILL_MODE_LOWER,
+                                                        50,
+                                                        nullptr,
+                                                        50,
+                                                        nullptr,
+                                                        &lwork_ext,
+                                                        syevj_info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroySyevjInfo(syevj_info), HIPSOLVER_STATUS_SUCCESS);
+
+    hipsolverGesvdjInfo_t gesvdj_info;
+    EXPECT_ROCBLAS_STATUS(hipsolverCreateGesvdjInfo(&gesvdj_info), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSgesvdj_bufferSize(handle,
+                                                      HIPSOLVER_EIG_MODE_VECTOR,
+                                                      0,
+                                                      60,
+                                                      40,
+                                                      nullptr,
+                                                      60,
+                                                      nullptr,
+                                                      nullptr,
+                                                      60,
+                                                      nullptr,
+                                                      40,
+                                                      &lwork,
+                                                      gesvdj_info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSgesvdjExt_bufferSize(handle,
+                                                         HIPSOLVER_EIG_MODE_VECTOR,
+                                                         0,
+                                                         60,
+                                                         40,
+                                                         nullptr,
+                                                         60,
+                                                         nullptr,
+                                                         nullptr,
+                                                         60,
+                                                         nullptr,
+                                                         40,
+                                                         &lwork_ext,
+                                                         gesvdj_info),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+    EXPECT_ROCBLAS_STATUS(hipsolverDestroyGesvdjInfo(gesvdj_info), HIPSOLVER_STATUS_SUCCESS);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverDposv_bufferSize(handle,
+                                                    HIPSOLVER_FILL_MODE_UPPER,
+                                                    50,
+                                                    10,
+                                                    nullptr,
+                                                    50,
+                                                    nullptr,
+                                                    50,
+                                                    &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDposvExt_bufferSize(handle,
+                                                       HIPSOLVER_FILL_MODE_UPPER,
+                                                       50,
+                                                       10,
+                                                       nullptr,
+                                                       50,
+                                                       nullptr,
+                                                       50,
+                                                       &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+
+    int nev;
+    EXPECT_ROCBLAS_STATUS(hipsolverSsyevdx_bufferSize(handle,
+                                                      HIPSOLVER_EIG_MODE_VECTOR,
+                                                      HIPSOLVER_EIG_RANGE_I,
+                                                      HIPSOLVER_FILL_MODE_LOWER,
+                                                      50,
+                                                      nullptr,
+                                                      50,
+                                                      0,
+                                                      0,
+                                                      1,
+                                                      10,
+                                                      &nev,
+                                                      nullptr,
+                                                      &lwork),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverSsyevdxExt_bufferSize(handle,
+                                                         HIPSOLVER_EIG_MODE_VECTOR,
+                                                         HIPSOLVER_EIG_RANGE_I,
+                                                         HIPSOLVER_FILL_MODE_LOWER,
+                                                         50,
+                                                         nullptr,
+                                                         50,
+                                                         0,
+                                                         0,
+                                                         1,
+                                                         10,
+                                                         &nev,
+                                                         nullptr,
+                                                         &lwork_ext),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(lwork_ext, size_t(lwork));
+}
@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#include "clientcommon.hpp"
+
+using ::testing::Matcher;
+using ::testing::MatchesRegex;
+using ::testing::UnitTest;
+
+class checkin_misc_WORKSPACE_RESERVE : public ::testing::Test
+{
+protected:
+    checkin_misc_WORKSPACE_RESERVE() {}
+    virtual void SetUp() {}
+    virtual void TearDown() {}
+};
+
+static hipsolverWorkspaceOp_t reserve_op(hipsolverRoutine_t routine, int n)
+{
+    hipsolverWorkspaceOp_t op = {};
+    op.routine                = routine;
+    op.precision              = HIP_R_64F;
+    op.m                      = n;
+    op.n                      = n;
+    op.nrhs                   = 1;
+    op.lda                    = n;
+    op.ldb                    = n;
+    op.batch_count            = 1;
+    op.trans                  = HIPSOLVER_OP_N;
+    op.uplo                   = HIPSOLVER_FILL_MODE_UPPER;
+    op.jobz                   = HIPSOLVER_EIG_MODE_VECTOR;
+    op.itype                  = HIPSOLVER_EIG_TYPE_1;
+    op.jobu                   = 'N';
+    op.jobv                   = 'N';
+    return op;
+}
+
+TEST_F(checkin_misc_WORKSPACE_RESERVE, normal_execution)
+{
+    hipsolver_local_handle handle;
+
+    const int              n     = 50;
+    hipsolverWorkspaceOp_t ops[] = {reserve_op(HIPSOLVER_ROUTINE_GETRF, n),
+                                    reserve_op(HIPSOLVER_ROUTINE_GETRS, n),
+                                    reserve_op(HIPSOLVER_ROUTINE_SYEVD, n)};
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, ops, 3), HIPSOLVER_STATUS_SUCCESS);
+
+    hipsolverHandleStatistics_t stats;
+    if(hipsolverGetHandleStatistics(handle, &stats) == HIPSOLVER_STATUS_NOT_SUPPORTED)
+        return;
+    EXPECT_ROCBLAS_STATUS(hipsolverResetHandleStatistics(handle), HIPSOLVER_STATUS_SUCCESS);
+
+    double* A;
+    double* D;
+    int*    ipiv;
+    int*    devInfo;
+    CHECK_HIP_ERROR(hipMalloc(&A, sizeof(double) * n * n));
+    CHECK_HIP_ERROR(hipMalloc(&D, sizeof(double) * n));
+    CHECK_HIP_ERROR(hipMalloc(&ipiv, sizeof(int) * n));
+    CHECK_HIP_ERROR(hipMalloc(&devInfo, sizeof(int)));
+    CHECK_HIP_ERROR(hipMemset(A, 0, sizeof(double) * n * n));
+
+    // the declared calls run in the reserved workspace
+    EXPECT_ROCBLAS_STATUS(hipsolverDgetrf(handle, n, n, A, n, nullptr, 0, ipiv, devInfo),
+                          HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_ROCBLAS_STATUS(hipsolverDsyevd(handle,
+                                          HIPSOLVER_EIG_MODE_VECTOR,
+                                          HIPSOLVER_FILL_MODE_UPPER,
+                                          n,
+                                          A,
+                                          n,
+                                          D,
+                                          nullptr,
+                                          0,
+                                          devInfo),
+                          HIPSOLVER_STATUS_SUCCESS);
+    CHECK_HIP_ERROR(hipDeviceSynchronize());
+
+    EXPECT_ROCBLAS_STATUS(hipsolverGetHandleStatistics(handle, &stats), HIPSOLVER_STATUS_SUCCESS);
+    EXPECT_EQ(stats.num_calls, 2u);
+    EXPECT_EQ(stats.num_workspace_grows, 0u);
+    EXPECT_GT(stats.peak_workspace_bytes, 0u);
+
+    CHECK_HIP_ERROR(hipFree(A));
+    CHECK_HIP_ERROR(hipFree(D));
+    CHECK_HIP_ERROR(hipFree(ipiv));
+    CHECK_HIP_ERROR(hipFree(devInfo));
+}
+
+TEST_F(checkin_misc_WORKSPACE_RESERVE, empty_list)
+{
+    hipsolver_local_handle handle;
+
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, nullptr, 0), HIPSOLVER_STATUS_SUCCESS);
+}
+
+TEST_F(checkin_misc_WORKSPACE_RESERVE, bad_arguments)
+{
+    hipsolver_local_handle handle;
+    hipsolverWorkspaceOp_t op = reserve_op(HIPSOLVER_ROUTINE_POTRF, 10);
+
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(nullptr, &op, 1),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, nullptr, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, &op, -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    op.precision = HIP_R_16F;
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, &op, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+    op         = reserve_op(HIPSOLVER_ROUTINE_POTRF, 10);
+    op.routine = (hipsolverRoutine_t)0;
+    EXPECT_ROCBLAS_STATUS(hipsolverReserveWorkspace(handle, &op, 1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+}
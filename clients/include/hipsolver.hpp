@@ -1601,6 +1601,7 @@ inline hipsolverStatus_t hipsolver_gebrd(testAPI_t               API,
 /******************** GEQRF ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
+                                                   bool              MIXED,
                                                    hipsolverHandle_t handle,
                                                    int               m,
                                                    int               n,
@@ -1613,6 +1614,9 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
                                                    int               ldx,
                                                    size_t*           lwork)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(API)
     {
     case API_NORMAL:
@@ -1629,6 +1633,7 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
+                                                   bool              MIXED,
                                                    hipsolverHandle_t handle,
                                                    int               m,
                                                    int               n,
@@ -1641,6 +1646,21 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
                                                    int               ldx,
                                                    size_t*           lwork)
 {
+    if(MIXED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverDSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+        case API_COMPAT:
+            return hipsolverDnDSgels_bufferSize(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, nullptr, lwork);
+        default:
+            *lwork = 0;
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(API)
     {
     case API_NORMAL:
@@ -1657,6 +1677,7 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
+                                                   bool              MIXED,
                                                    hipsolverHandle_t handle,
                                                    int               m,
                                                    int               n,
@@ -1669,6 +1690,9 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
                                                    int               ldx,
                                                    size_t*           lwork)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(API)
     {
     case API_NORMAL:
@@ -1715,6 +1739,7 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t               API,
+                                                   bool                    MIXED,
                                                    hipsolverHandle_t       handle,
                                                    int                     m,
                                                    int                     n,
@@ -1727,6 +1752,41 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t               API,
                                                    int                     ldx,
                                                    size_t*                 lwork)
 {
+    if(MIXED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverZCgels_bufferSize(handle,
+                                              m,
+                                              n,
+                                              nrhs,
+                                              (hipDoubleComplex*)A,
+                                              lda,
+                                              (hipDoubleComplex*)B,
+                                              ldb,
+                                              (hipDoubleComplex*)X,
+                                              ldx,
+                                              lwork);
+        case API_COMPAT:
+            return hipsolverDnZCgels_bufferSize(handle,
+                                                m,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex*)A,
+                                                lda,
+                                                (hipDoubleComplex*)B,
+                                                ldb,
+                                                (hipDoubleComplex*)X,
+                                                ldx,
+                                                nullptr,
+                                                lwork);
+        default:
+            *lwork = 0;
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(API)
     {
     case API_NORMAL:
@@ -1774,6 +1834,7 @@ inline hipsolverStatus_t hipsolver_gels_bufferSize(testAPI_t               API,
 
 inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
                                         bool              INPLACE,
+                                        bool              MIXED,
                                         hipsolverHandle_t handle,
                                         int               m,
                                         int               n,
@@ -1793,6 +1854,9 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
                                         int*              info,
                                         int               bc)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -1814,6 +1878,7 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
                                         bool              INPLACE,
+                                        bool              MIXED,
                                         hipsolverHandle_t handle,
                                         int               m,
                                         int               n,
@@ -1833,6 +1898,24 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
                                         int*              info,
                                         int               bc)
 {
+    if(MIXED)
+    {
+        switch(api2marshal(API, INPLACE))
+        {
+        case C_NORMAL:
+            return hipsolverDSgels(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+        case C_NORMAL_ALT:
+            return hipsolverDSgels(
+                handle, m, n, nrhs, A, lda, B, ldb, B, ldb, work, lwork, niters, info);
+        case COMPAT_NORMAL:
+            return hipsolverDnDSgels(
+                handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, info);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -1854,6 +1937,7 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
                                         bool              INPLACE,
+                                        bool              MIXED,
                                         hipsolverHandle_t handle,
                                         int               m,
                                         int               n,
@@ -1873,6 +1957,9 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
                                         int*              info,
                                         int               bc)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -1942,6 +2029,7 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gels(testAPI_t               API,
                                         bool                    INPLACE,
+                                        bool                    MIXED,
                                         hipsolverHandle_t       handle,
                                         int                     m,
                                         int                     n,
@@ -1961,6 +2049,60 @@ inline hipsolverStatus_t hipsolver_gels(testAPI_t               API,
                                         int*                    info,
                                         int                     bc)
 {
+    if(MIXED)
+    {
+        switch(api2marshal(API, INPLACE))
+        {
+        case C_NORMAL:
+            return hipsolverZCgels(handle,
+                                   m,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   (hipDoubleComplex*)X,
+                                   ldx,
+                                   work,
+                                   lwork,
+                                   niters,
+                                   info);
+        case C_NORMAL_ALT:
+            return hipsolverZCgels(handle,
+                                   m,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   work,
+                                   lwork,
+                                   niters,
+                                   info);
+        case COMPAT_NORMAL:
+            return hipsolverDnZCgels(handle,
+                                     m,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex*)A,
+                                     lda,
+                                     (hipDoubleComplex*)B,
+                                     ldb,
+                                     (hipDoubleComplex*)X,
+                                     ldx,
+                                     work,
+                                     lwork,
+                                     niters,
+                                     info);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -2601,6 +2743,7 @@ inline hipsolverStatus_t hipsolver_geqrf(testAPI_t               API,
 /******************** GESV ********************/
 // normal and strided_batched
 inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
+                                                   bool              MIXED,
                                                    hipsolverHandle_t handle,
                                                    int               n,
                                                    int               nrhs,
@@ -2613,6 +2756,9 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
                                                    int               ldx,
                                                    size_t*           lwork)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(API)
     {
     case API_NORMAL:
@@ -2630,6 +2776,7 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
+                                                   bool              MIXED,
                                                    hipsolverHandle_t handle,
                                                    int               n,
                                                    int               nrhs,
@@ -2642,6 +2789,21 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
                                                    int               ldx,
                                                    size_t*           lwork)
 {
+    if(MIXED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverDSgesv_bufferSize(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, lwork);
+        case API_COMPAT:
+            return hipsolverDnDSgesv_bufferSize(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, nullptr, lwork);
+        default:
+            *lwork;
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(API)
     {
     case API_NORMAL:
@@ -2659,6 +2821,7 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
+                                                   bool              MIXED,
                                                    hipsolverHandle_t handle,
                                                    int               n,
                                                    int               nrhs,
@@ -2671,6 +2834,9 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
                                                    int               ldx,
                                                    size_t*           lwork)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(API)
     {
     case API_NORMAL:
@@ -2717,6 +2883,7 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t         API,
 }
 
 inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t               API,
+                                                   bool                    MIXED,
                                                    hipsolverHandle_t       handle,
                                                    int                     n,
                                                    int                     nrhs,
@@ -2729,6 +2896,41 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t               API,
                                                    int                     ldx,
                                                    size_t*                 lwork)
 {
+    if(MIXED)
+    {
+        switch(API)
+        {
+        case API_NORMAL:
+            return hipsolverZCgesv_bufferSize(handle,
+                                              n,
+                                              nrhs,
+                                              (hipDoubleComplex*)A,
+                                              lda,
+                                              ipiv,
+                                              (hipDoubleComplex*)B,
+                                              ldb,
+                                              (hipDoubleComplex*)X,
+                                              ldx,
+                                              lwork);
+        case API_COMPAT:
+            return hipsolverDnZCgesv_bufferSize(handle,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex*)A,
+                                                lda,
+                                                ipiv,
+                                                (hipDoubleComplex*)B,
+                                                ldb,
+                                                (hipDoubleComplex*)X,
+                                                ldx,
+                                                nullptr,
+                                                lwork);
+        default:
+            *lwork;
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(API)
     {
     case API_NORMAL:
@@ -2776,6 +2978,7 @@ inline hipsolverStatus_t hipsolver_gesv_bufferSize(testAPI_t               API,
 
 inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
                                         bool              INPLACE,
+                                        bool              MIXED,
                                         hipsolverHandle_t handle,
                                         int               n,
                                         int               nrhs,
@@ -2796,6 +2999,9 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
                                         int*              info,
                                         int               bc)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -2817,6 +3023,7 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
                                         bool              INPLACE,
+                                        bool              MIXED,
                                         hipsolverHandle_t handle,
                                         int               n,
                                         int               nrhs,
@@ -2837,6 +3044,24 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
                                         int*              info,
                                         int               bc)
 {
+    if(MIXED)
+    {
+        switch(api2marshal(API, INPLACE))
+        {
+        case C_NORMAL:
+            return hipsolverDSgesv(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+        case C_NORMAL_ALT:
+            return hipsolverDSgesv(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, B, ldb, work, lwork, niters, info);
+        case COMPAT_NORMAL:
+            return hipsolverDnDSgesv(
+                handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, work, lwork, niters, info);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -2858,6 +3083,7 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
                                         bool              INPLACE,
+                                        bool              MIXED,
                                         hipsolverHandle_t handle,
                                         int               n,
                                         int               nrhs,
@@ -2878,6 +3104,9 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
                                         int*              info,
                                         int               bc)
 {
+    if(MIXED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -2947,6 +3176,7 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t         API,
 
 inline hipsolverStatus_t hipsolver_gesv(testAPI_t               API,
                                         bool                    INPLACE,
+                                        bool                    MIXED,
                                         hipsolverHandle_t       handle,
                                         int                     n,
                                         int                     nrhs,
@@ -2967,6 +3197,60 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t               API,
                                         int*                    info,
                                         int                     bc)
 {
+    if(MIXED)
+    {
+        switch(api2marshal(API, INPLACE))
+        {
+        case C_NORMAL:
+            return hipsolverZCgesv(handle,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   ipiv,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   (hipDoubleComplex*)X,
+                                   ldx,
+                                   work,
+                                   lwork,
+                                   niters,
+                                   info);
+        case C_NORMAL_ALT:
+            return hipsolverZCgesv(handle,
+                                   n,
+                                   nrhs,
+                                   (hipDoubleComplex*)A,
+                                   lda,
+                                   ipiv,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   (hipDoubleComplex*)B,
+                                   ldb,
+                                   work,
+                                   lwork,
+                                   niters,
+                                   info);
+        case COMPAT_NORMAL:
+            return hipsolverDnZCgesv(handle,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex*)A,
+                                     lda,
+                                     ipiv,
+                                     (hipDoubleComplex*)B,
+                                     ldb,
+                                     (hipDoubleComplex*)X,
+                                     ldx,
+                                     work,
+                                     lwork,
+                                     niters,
+                                     info);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, INPLACE))
     {
     case C_NORMAL:
@@ -3037,126 +3321,349 @@ inline hipsolverStatus_t hipsolver_gesv(testAPI_t               API,
 
 /******************** GESVD ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    float*            A,
-                                                    int               lda,
-                                                    int*              lwork)
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    signed char         jobu,
+                                                    signed char         jobv,
+                                                    int                 m,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              S,
+                                                    float*              U,
+                                                    int                 ldu,
+                                                    float*              V,
+                                                    int                 ldv,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+        return hipsolverSgesvd_bufferSize(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_FORTRAN:
-        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverSgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_COMPAT:
-        return hipsolverDnSgesvd_bufferSize(handle, m, n, lwork);
+        return hipsolverDnSgesvd_bufferSize(handle, m, n, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    double*           A,
-                                                    int               lda,
-                                                    int*              lwork)
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    signed char         jobu,
+                                                    signed char         jobv,
+                                                    int                 m,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             S,
+                                                    double*             U,
+                                                    int                 ldu,
+                                                    double*             V,
+                                                    int                 ldv,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+        return hipsolverDgesvd_bufferSize(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_FORTRAN:
-        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverDgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_COMPAT:
-        return hipsolverDnDgesvd_bufferSize(handle, m, n, lwork);
+        return hipsolverDnDgesvd_bufferSize(handle, m, n, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t         API,
-                                                    hipsolverHandle_t handle,
-                                                    signed char       jobu,
-                                                    signed char       jobv,
-                                                    int               m,
-                                                    int               n,
-                                                    hipsolverComplex* A,
-                                                    int               lda,
-                                                    int*              lwork)
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    signed char         jobu,
+                                                    signed char         jobv,
+                                                    int                 m,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    float*              S,
+                                                    hipsolverComplex*   U,
+                                                    int                 ldu,
+                                                    hipsolverComplex*   V,
+                                                    int                 ldv,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+        return hipsolverCgesvd_bufferSize(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_FORTRAN:
-        return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverCgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_COMPAT:
-        return hipsolverDnCgesvd_bufferSize(handle, m, n, lwork);
+        return hipsolverDnCgesvd_bufferSize(handle, m, n, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
 inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
                                                     hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
                                                     signed char             jobu,
                                                     signed char             jobv,
                                                     int                     m,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
-                                                    int*                    lwork)
+                                                    double*                 S,
+                                                    hipsolverDoubleComplex* U,
+                                                    int                     ldu,
+                                                    hipsolverDoubleComplex* V,
+                                                    int                     ldv,
+                                                    int*                    lworkOnDevice,
+                                                    int*                    lworkOnHost)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lwork);
+        return hipsolverZgesvd_bufferSize(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_FORTRAN:
-        return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lwork);
+        return hipsolverZgesvd_bufferSizeFortran(handle, jobu, jobv, m, n, lworkOnDevice);
     case API_COMPAT:
-        return hipsolverDnZgesvd_bufferSize(handle, m, n, lwork);
+        return hipsolverDnZgesvd_bufferSize(handle, m, n, lworkOnDevice);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
-                                         bool              NRWK,
-                                         hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
-                                         int               m,
-                                         int               n,
-                                         float*            A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            S,
-                                         int               stS,
-                                         float*            U,
-                                         int               ldu,
-                                         int               stU,
-                                         float*            V,
-                                         int               ldv,
-                                         int               stV,
-                                         float*            work,
-                                         int               lwork,
-                                         float*            rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    signed char         jobu,
+                                                    signed char         jobv,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    float*              A,
+                                                    int64_t             lda,
+                                                    float*              S,
+                                                    float*              U,
+                                                    int64_t             ldu,
+                                                    float*              V,
+                                                    int64_t             ldv,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost)
+{
+    switch(API)
+    {
+    case API_COMPAT:
+        return hipsolverDnXgesvd_bufferSize(handle,
+                                            params,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            HIP_R_32F,
+                                            A,
+                                            lda,
+                                            HIP_R_32F,
+                                            S,
+                                            HIP_R_32F,
+                                            U,
+                                            ldu,
+                                            HIP_R_32F,
+                                            V,
+                                            ldv,
+                                            HIP_R_32F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    signed char         jobu,
+                                                    signed char         jobv,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    double*             A,
+                                                    int64_t             lda,
+                                                    double*             S,
+                                                    double*             U,
+                                                    int64_t             ldu,
+                                                    double*             V,
+                                                    int64_t             ldv,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost)
+{
+    switch(API)
+    {
+    case API_COMPAT:
+        return hipsolverDnXgesvd_bufferSize(handle,
+                                            params,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            HIP_R_64F,
+                                            A,
+                                            lda,
+                                            HIP_R_64F,
+                                            S,
+                                            HIP_R_64F,
+                                            U,
+                                            ldu,
+                                            HIP_R_64F,
+                                            V,
+                                            ldv,
+                                            HIP_R_64F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    signed char         jobu,
+                                                    signed char         jobv,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    hipsolverComplex*   A,
+                                                    int64_t             lda,
+                                                    float*              S,
+                                                    hipsolverComplex*   U,
+                                                    int64_t             ldu,
+                                                    hipsolverComplex*   V,
+                                                    int64_t             ldv,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost)
+{
+    switch(API)
+    {
+    case API_COMPAT:
+        return hipsolverDnXgesvd_bufferSize(handle,
+                                            params,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            HIP_C_32F,
+                                            A,
+                                            lda,
+                                            HIP_R_32F,
+                                            S,
+                                            HIP_C_32F,
+                                            U,
+                                            ldu,
+                                            HIP_C_32F,
+                                            V,
+                                            ldv,
+                                            HIP_C_32F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
+                                                    signed char             jobu,
+                                                    signed char             jobv,
+                                                    int64_t                 m,
+                                                    int64_t                 n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    double*                 S,
+                                                    hipsolverDoubleComplex* U,
+                                                    int64_t                 ldu,
+                                                    hipsolverDoubleComplex* V,
+                                                    int64_t                 ldv,
+                                                    size_t*                 lworkOnDevice,
+                                                    size_t*                 lworkOnHost)
+{
+    switch(API)
+    {
+    case API_COMPAT:
+        return hipsolverDnXgesvd_bufferSize(handle,
+                                            params,
+                                            jobu,
+                                            jobv,
+                                            m,
+                                            n,
+                                            HIP_C_64F,
+                                            A,
+                                            lda,
+                                            HIP_R_64F,
+                                            S,
+                                            HIP_C_64F,
+                                            U,
+                                            ldu,
+                                            HIP_C_64F,
+                                            V,
+                                            ldv,
+                                            HIP_C_64F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(testAPI_t           API,
+                                         bool                NRWK,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         signed char         jobu,
+                                         signed char         jobv,
+                                         int                 m,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              S,
+                                         int                 stS,
+                                         float*              U,
+                                         int                 ldu,
+                                         int                 stU,
+                                         float*              V,
+                                         int                 ldv,
+                                         int                 stV,
+                                         float*              work,
+                                         int                 lwork,
+                                         float*              workOnHost,
+                                         int                 lworkOnHost,
+                                         float*              rwork,
+                                         int                 stRW,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(api2marshal(API, NRWK))
     {
@@ -3177,30 +3684,33 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
-                                         bool              NRWK,
-                                         hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
-                                         int               m,
-                                         int               n,
-                                         double*           A,
-                                         int               lda,
-                                         int               stA,
-                                         double*           S,
-                                         int               stS,
-                                         double*           U,
-                                         int               ldu,
-                                         int               stU,
-                                         double*           V,
-                                         int               ldv,
-                                         int               stV,
-                                         double*           work,
-                                         int               lwork,
-                                         double*           rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_gesvd(testAPI_t           API,
+                                         bool                NRWK,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         signed char         jobu,
+                                         signed char         jobv,
+                                         int                 m,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             S,
+                                         int                 stS,
+                                         double*             U,
+                                         int                 ldu,
+                                         int                 stU,
+                                         double*             V,
+                                         int                 ldv,
+                                         int                 stV,
+                                         double*             work,
+                                         int                 lwork,
+                                         double*             workOnHost,
+                                         int                 lworkOnHost,
+                                         double*             rwork,
+                                         int                 stRW,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(api2marshal(API, NRWK))
     {
@@ -3221,30 +3731,33 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
-                                         bool              NRWK,
-                                         hipsolverHandle_t handle,
-                                         signed char       jobu,
-                                         signed char       jobv,
-                                         int               m,
-                                         int               n,
-                                         hipsolverComplex* A,
-                                         int               lda,
-                                         int               stA,
-                                         float*            S,
-                                         int               stS,
-                                         hipsolverComplex* U,
-                                         int               ldu,
-                                         int               stU,
-                                         hipsolverComplex* V,
-                                         int               ldv,
-                                         int               stV,
-                                         hipsolverComplex* work,
-                                         int               lwork,
-                                         float*            rwork,
-                                         int               stRW,
-                                         int*              info,
-                                         int               bc)
+inline hipsolverStatus_t hipsolver_gesvd(testAPI_t           API,
+                                         bool                NRWK,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         signed char         jobu,
+                                         signed char         jobv,
+                                         int                 m,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              S,
+                                         int                 stS,
+                                         hipsolverComplex*   U,
+                                         int                 ldu,
+                                         int                 stU,
+                                         hipsolverComplex*   V,
+                                         int                 ldv,
+                                         int                 stV,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         hipsolverComplex*   workOnHost,
+                                         int                 lworkOnHost,
+                                         float*              rwork,
+                                         int                 stRW,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(api2marshal(API, NRWK))
     {
@@ -3324,6 +3837,7 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t         API,
 inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                          bool                    NRWK,
                                          hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
                                          signed char             jobu,
                                          signed char             jobv,
                                          int                     m,
@@ -3341,6 +3855,8 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
                                          int                     stV,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         int                     lworkOnHost,
                                          double*                 rwork,
                                          int                     stRW,
                                          int*                    info,
@@ -3420,6 +3936,242 @@ inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+
+inline hipsolverStatus_t hipsolver_gesvd(testAPI_t           API,
+                                         bool                NRWK,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         signed char         jobu,
+                                         signed char         jobv,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         float*              A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         float*              S,
+                                         int64_t             stS,
+                                         float*              U,
+                                         int64_t             ldu,
+                                         int64_t             stU,
+                                         float*              V,
+                                         int64_t             ldv,
+                                         int64_t             stV,
+                                         float*              work,
+                                         size_t              lwork,
+                                         float*              workOnHost,
+                                         size_t              lworkOnHost,
+                                         float*              rwork,
+                                         int64_t             stRW,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, NRWK))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvd(handle,
+                                 params,
+                                 jobu,
+                                 jobv,
+                                 m,
+                                 n,
+                                 HIP_R_32F,
+                                 A,
+                                 lda,
+                                 HIP_R_32F,
+                                 S,
+                                 HIP_R_32F,
+                                 U,
+                                 ldu,
+                                 HIP_R_32F,
+                                 V,
+                                 ldv,
+                                 HIP_R_32F,
+                                 work,
+                                 lwork,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(testAPI_t           API,
+                                         bool                NRWK,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         signed char         jobu,
+                                         signed char         jobv,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         double*             A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         double*             S,
+                                         int64_t             stS,
+                                         double*             U,
+                                         int64_t             ldu,
+                                         int64_t             stU,
+                                         double*             V,
+                                         int64_t             ldv,
+                                         int64_t             stV,
+                                         double*             work,
+                                         size_t              lwork,
+                                         double*             workOnHost,
+                                         size_t              lworkOnHost,
+                                         double*             rwork,
+                                         int64_t             stRW,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, NRWK))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvd(handle,
+                                 params,
+                                 jobu,
+                                 jobv,
+                                 m,
+                                 n,
+                                 HIP_R_64F,
+                                 A,
+                                 lda,
+                                 HIP_R_64F,
+                                 S,
+                                 HIP_R_64F,
+                                 U,
+                                 ldu,
+                                 HIP_R_64F,
+                                 V,
+                                 ldv,
+                                 HIP_R_64F,
+                                 work,
+                                 lwork,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(testAPI_t           API,
+                                         bool                NRWK,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         signed char         jobu,
+                                         signed char         jobv,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         hipsolverComplex*   A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         float*              S,
+                                         int64_t             stS,
+                                         hipsolverComplex*   U,
+                                         int64_t             ldu,
+                                         int64_t             stU,
+                                         hipsolverComplex*   V,
+                                         int64_t             ldv,
+                                         int64_t             stV,
+                                         hipsolverComplex*   work,
+                                         size_t              lwork,
+                                         hipsolverComplex*   workOnHost,
+                                         size_t              lworkOnHost,
+                                         float*              rwork,
+                                         int64_t             stRW,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, NRWK))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvd(handle,
+                                 params,
+                                 jobu,
+                                 jobv,
+                                 m,
+                                 n,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 HIP_R_32F,
+                                 S,
+                                 HIP_C_32F,
+                                 U,
+                                 ldu,
+                                 HIP_C_32F,
+                                 V,
+                                 ldv,
+                                 HIP_C_32F,
+                                 work,
+                                 lwork,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvd(testAPI_t               API,
+                                         bool                    NRWK,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
+                                         signed char             jobu,
+                                         signed char             jobv,
+                                         int64_t                 m,
+                                         int64_t                 n,
+                                         hipsolverDoubleComplex* A,
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         double*                 S,
+                                         int64_t                 stS,
+                                         hipsolverDoubleComplex* U,
+                                         int64_t                 ldu,
+                                         int64_t                 stU,
+                                         hipsolverDoubleComplex* V,
+                                         int64_t                 ldv,
+                                         int64_t                 stV,
+                                         hipsolverDoubleComplex* work,
+                                         size_t                  lwork,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         size_t                  lworkOnHost,
+                                         double*                 rwork,
+                                         int64_t                 stRW,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(api2marshal(API, NRWK))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvd(handle,
+                                 params,
+                                 jobu,
+                                 jobv,
+                                 m,
+                                 n,
+                                 HIP_C_64F,
+                                 A,
+                                 lda,
+                                 HIP_R_64F,
+                                 S,
+                                 HIP_C_64F,
+                                 U,
+                                 ldu,
+                                 HIP_C_64F,
+                                 V,
+                                 ldv,
+                                 HIP_C_64F,
+                                 work,
+                                 lwork,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
 /********************************************************/
 
 /******************** GESVDJ ********************/
@@ -4102,332 +4854,345 @@ inline hipsolverStatus_t hipsolver_gesvdj(testAPI_t               API,
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
-
-/******************** GESVDA ********************/
-inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t          API,
-                                                     bool               STRIDED,
-                                                     hipsolverHandle_t  handle,
-                                                     hipsolverEigMode_t jobz,
-                                                     int                rank,
-                                                     int                m,
-                                                     int                n,
-                                                     float*             A,
-                                                     int                lda,
-                                                     long long int      stA,
-                                                     float*             S,
-                                                     long long int      stS,
-                                                     float*             U,
-                                                     int                ldu,
-                                                     long long int      stU,
-                                                     float*             V,
-                                                     int                ldv,
-                                                     long long int      stV,
-                                                     int*               lwork,
-                                                     int                bc)
-{
-    switch(api2marshal(API, STRIDED))
-    {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnSgesvdaStridedBatched_bufferSize(
-            handle, jobz, rank, m, n, A, lda, stA, S, stS, U, ldu, stU, V, ldv, stV, lwork, bc);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
 
-inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t          API,
-                                                     bool               STRIDED,
-                                                     hipsolverHandle_t  handle,
-                                                     hipsolverEigMode_t jobz,
-                                                     int                rank,
-                                                     int                m,
-                                                     int                n,
-                                                     double*            A,
-                                                     int                lda,
-                                                     long long int      stA,
-                                                     double*            S,
-                                                     long long int      stS,
-                                                     double*            U,
-                                                     int                ldu,
-                                                     long long int      stU,
-                                                     double*            V,
-                                                     int                ldv,
-                                                     long long int      stV,
-                                                     int*               lwork,
-                                                     int                bc)
+// batched
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(testAPI_t             API,
+                                                     bool                  STRIDED,
+                                                     hipsolverHandle_t     handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   econ,
+                                                     int                   m,
+                                                     int                   n,
+                                                     float*                A[],
+                                                     int                   lda,
+                                                     float*                S,
+                                                     float*                U,
+                                                     int                   ldu,
+                                                     float*                V,
+                                                     int                   ldv,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t params,
+                                                     int                   bc)
 {
-    switch(api2marshal(API, STRIDED))
+    // the workspace size does not depend on the strides
+    switch(API)
     {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnDgesvdaStridedBatched_bufferSize(
-            handle, jobz, rank, m, n, A, lda, stA, S, stS, U, ldu, stU, V, ldv, stV, lwork, bc);
+    case API_NORMAL:
+        return hipsolverSgesvdjPtrBatched_bufferSize(handle,
+                                                     jobz,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     S,
+                                                     std::min(m, n),
+                                                     U,
+                                                     ldu,
+                                                     ldu * m,
+                                                     V,
+                                                     ldv,
+                                                     ldv * n,
+                                                     lwork,
+                                                     params,
+                                                     bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t          API,
-                                                     bool               STRIDED,
-                                                     hipsolverHandle_t  handle,
-                                                     hipsolverEigMode_t jobz,
-                                                     int                rank,
-                                                     int                m,
-                                                     int                n,
-                                                     hipsolverComplex*  A,
-                                                     int                lda,
-                                                     long long int      stA,
-                                                     float*             S,
-                                                     long long int      stS,
-                                                     hipsolverComplex*  U,
-                                                     int                ldu,
-                                                     long long int      stU,
-                                                     hipsolverComplex*  V,
-                                                     int                ldv,
-                                                     long long int      stV,
-                                                     int*               lwork,
-                                                     int                bc)
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(testAPI_t             API,
+                                                     bool                  STRIDED,
+                                                     hipsolverHandle_t     handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   econ,
+                                                     int                   m,
+                                                     int                   n,
+                                                     double*               A[],
+                                                     int                   lda,
+                                                     double*               S,
+                                                     double*               U,
+                                                     int                   ldu,
+                                                     double*               V,
+                                                     int                   ldv,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t params,
+                                                     int                   bc)
 {
-    switch(api2marshal(API, STRIDED))
+    // the workspace size does not depend on the strides
+    switch(API)
     {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnCgesvdaStridedBatched_bufferSize(handle,
-                                                           jobz,
-                                                           rank,
-                                                           m,
-                                                           n,
-                                                           (hipFloatComplex*)A,
-                                                           lda,
-                                                           stA,
-                                                           S,
-                                                           stS,
-                                                           (hipFloatComplex*)U,
-                                                           ldu,
-                                                           stU,
-                                                           (hipFloatComplex*)V,
-                                                           ldv,
-                                                           stV,
-                                                           lwork,
-                                                           bc);
+    case API_NORMAL:
+        return hipsolverDgesvdjPtrBatched_bufferSize(handle,
+                                                     jobz,
+                                                     m,
+                                                     n,
+                                                     A,
+                                                     lda,
+                                                     S,
+                                                     std::min(m, n),
+                                                     U,
+                                                     ldu,
+                                                     ldu * m,
+                                                     V,
+                                                     ldv,
+                                                     ldv * n,
+                                                     lwork,
+                                                     params,
+                                                     bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(testAPI_t             API,
+                                                     bool                  STRIDED,
+                                                     hipsolverHandle_t     handle,
+                                                     hipsolverEigMode_t    jobz,
+                                                     int                   econ,
+                                                     int                   m,
+                                                     int                   n,
+                                                     hipsolverComplex*     A[],
+                                                     int                   lda,
+                                                     float*                S,
+                                                     hipsolverComplex*     U,
+                                                     int                   ldu,
+                                                     hipsolverComplex*     V,
+                                                     int                   ldv,
+                                                     int*                  lwork,
+                                                     hipsolverGesvdjInfo_t params,
+                                                     int                   bc)
+{
+    // the workspace size does not depend on the strides
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCgesvdjPtrBatched_bufferSize(handle,
+                                                     jobz,
+                                                     m,
+                                                     n,
+                                                     (hipFloatComplex**)A,
+                                                     lda,
+                                                     S,
+                                                     std::min(m, n),
+                                                     (hipFloatComplex*)U,
+                                                     ldu,
+                                                     ldu * m,
+                                                     (hipFloatComplex*)V,
+                                                     ldv,
+                                                     ldv * n,
+                                                     lwork,
+                                                     params,
+                                                     bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_gesvdj_bufferSize(testAPI_t               API,
                                                      bool                    STRIDED,
                                                      hipsolverHandle_t       handle,
                                                      hipsolverEigMode_t      jobz,
-                                                     int                     rank,
+                                                     int                     econ,
                                                      int                     m,
                                                      int                     n,
-                                                     hipsolverDoubleComplex* A,
+                                                     hipsolverDoubleComplex* A[],
                                                      int                     lda,
-                                                     long long int           stA,
                                                      double*                 S,
-                                                     long long int           stS,
                                                      hipsolverDoubleComplex* U,
                                                      int                     ldu,
-                                                     long long int           stU,
                                                      hipsolverDoubleComplex* V,
                                                      int                     ldv,
-                                                     long long int           stV,
                                                      int*                    lwork,
+                                                     hipsolverGesvdjInfo_t   params,
                                                      int                     bc)
 {
-    switch(api2marshal(API, STRIDED))
+    // the workspace size does not depend on the strides
+    switch(API)
     {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnZgesvdaStridedBatched_bufferSize(handle,
-                                                           jobz,
-                                                           rank,
-                                                           m,
-                                                           n,
-                                                           (hipDoubleComplex*)A,
-                                                           lda,
-                                                           stA,
-                                                           S,
-                                                           stS,
-                                                           (hipDoubleComplex*)U,
-                                                           ldu,
-                                                           stU,
-                                                           (hipDoubleComplex*)V,
-                                                           ldv,
-                                                           stV,
-                                                           lwork,
-                                                           bc);
+    case API_NORMAL:
+        return hipsolverZgesvdjPtrBatched_bufferSize(handle,
+                                                     jobz,
+                                                     m,
+                                                     n,
+                                                     (hipDoubleComplex**)A,
+                                                     lda,
+                                                     S,
+                                                     std::min(m, n),
+                                                     (hipDoubleComplex*)U,
+                                                     ldu,
+                                                     ldu * m,
+                                                     (hipDoubleComplex*)V,
+                                                     ldv,
+                                                     ldv * n,
+                                                     lwork,
+                                                     params,
+                                                     bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvda(testAPI_t          API,
-                                          bool               STRIDED,
-                                          hipsolverHandle_t  handle,
-                                          hipsolverEigMode_t jobz,
-                                          int                rank,
-                                          int                m,
-                                          int                n,
-                                          float*             A,
-                                          int                lda,
-                                          int                stA,
-                                          float*             S,
-                                          int                stS,
-                                          float*             U,
-                                          int                ldu,
-                                          int                stU,
-                                          float*             V,
-                                          int                ldv,
-                                          int                stV,
-                                          float*             work,
-                                          int                lwork,
-                                          int*               info,
-                                          double*            hRnrmF,
-                                          int                bc)
+inline hipsolverStatus_t hipsolver_gesvdj(testAPI_t             API,
+                                          bool                  STRIDED,
+                                          hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   econ,
+                                          int                   m,
+                                          int                   n,
+                                          float*                A[],
+                                          int                   lda,
+                                          int                   stA,
+                                          float*                S,
+                                          int                   stS,
+                                          float*                U,
+                                          int                   ldu,
+                                          int                   stU,
+                                          float*                V,
+                                          int                   ldv,
+                                          int                   stV,
+                                          float*                work,
+                                          int                   lwork,
+                                          int*                  info,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnSgesvdaStridedBatched(handle,
-                                                jobz,
-                                                rank,
-                                                m,
-                                                n,
-                                                A,
-                                                lda,
-                                                stA,
-                                                S,
-                                                stS,
-                                                U,
-                                                ldu,
-                                                stU,
-                                                V,
-                                                ldv,
-                                                stV,
-                                                work,
-                                                lwork,
-                                                info,
-                                                hRnrmF,
-                                                bc);
+    case API_NORMAL:
+        return hipsolverSgesvdjPtrBatched(handle,
+                                          jobz,
+                                          m,
+                                          n,
+                                          A,
+                                          lda,
+                                          S,
+                                          stS,
+                                          U,
+                                          ldu,
+                                          stU,
+                                          V,
+                                          ldv,
+                                          stV,
+                                          work,
+                                          lwork,
+                                          info,
+                                          params,
+                                          bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvda(testAPI_t          API,
-                                          bool               STRIDED,
-                                          hipsolverHandle_t  handle,
-                                          hipsolverEigMode_t jobz,
-                                          int                rank,
-                                          int                m,
-                                          int                n,
-                                          double*            A,
-                                          int                lda,
-                                          int                stA,
-                                          double*            S,
-                                          int                stS,
-                                          double*            U,
-                                          int                ldu,
-                                          int                stU,
-                                          double*            V,
-                                          int                ldv,
-                                          int                stV,
-                                          double*            work,
-                                          int                lwork,
-                                          int*               info,
-                                          double*            hRnrmF,
-                                          int                bc)
-{
-    switch(api2marshal(API, STRIDED))
-    {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnDgesvdaStridedBatched(handle,
-                                                jobz,
-                                                rank,
-                                                m,
-                                                n,
-                                                A,
-                                                lda,
-                                                stA,
-                                                S,
-                                                stS,
-                                                U,
-                                                ldu,
-                                                stU,
-                                                V,
-                                                ldv,
-                                                stV,
-                                                work,
-                                                lwork,
-                                                info,
-                                                hRnrmF,
-                                                bc);
+inline hipsolverStatus_t hipsolver_gesvdj(testAPI_t             API,
+                                          bool                  STRIDED,
+                                          hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   econ,
+                                          int                   m,
+                                          int                   n,
+                                          double*               A[],
+                                          int                   lda,
+                                          int                   stA,
+                                          double*               S,
+                                          int                   stS,
+                                          double*               U,
+                                          int                   ldu,
+                                          int                   stU,
+                                          double*               V,
+                                          int                   ldv,
+                                          int                   stV,
+                                          double*               work,
+                                          int                   lwork,
+                                          int*                  info,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDgesvdjPtrBatched(handle,
+                                          jobz,
+                                          m,
+                                          n,
+                                          A,
+                                          lda,
+                                          S,
+                                          stS,
+                                          U,
+                                          ldu,
+                                          stU,
+                                          V,
+                                          ldv,
+                                          stV,
+                                          work,
+                                          lwork,
+                                          info,
+                                          params,
+                                          bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvda(testAPI_t          API,
-                                          bool               STRIDED,
-                                          hipsolverHandle_t  handle,
-                                          hipsolverEigMode_t jobz,
-                                          int                rank,
-                                          int                m,
-                                          int                n,
-                                          hipsolverComplex*  A,
-                                          int                lda,
-                                          int                stA,
-                                          float*             S,
-                                          int                stS,
-                                          hipsolverComplex*  U,
-                                          int                ldu,
-                                          int                stU,
-                                          hipsolverComplex*  V,
-                                          int                ldv,
-                                          int                stV,
-                                          hipsolverComplex*  work,
-                                          int                lwork,
-                                          int*               info,
-                                          double*            hRnrmF,
-                                          int                bc)
+inline hipsolverStatus_t hipsolver_gesvdj(testAPI_t             API,
+                                          bool                  STRIDED,
+                                          hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   econ,
+                                          int                   m,
+                                          int                   n,
+                                          hipsolverComplex*     A[],
+                                          int                   lda,
+                                          int                   stA,
+                                          float*                S,
+                                          int                   stS,
+                                          hipsolverComplex*     U,
+                                          int                   ldu,
+                                          int                   stU,
+                                          hipsolverComplex*     V,
+                                          int                   ldv,
+                                          int                   stV,
+                                          hipsolverComplex*     work,
+                                          int                   lwork,
+                                          int*                  info,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnCgesvdaStridedBatched(handle,
-                                                jobz,
-                                                rank,
-                                                m,
-                                                n,
-                                                (hipFloatComplex*)A,
-                                                lda,
-                                                stA,
-                                                S,
-                                                stS,
-                                                (hipFloatComplex*)U,
-                                                ldu,
-                                                stU,
-                                                (hipFloatComplex*)V,
-                                                ldv,
-                                                stV,
-                                                (hipFloatComplex*)work,
-                                                lwork,
-                                                info,
-                                                hRnrmF,
-                                                bc);
+    case API_NORMAL:
+        return hipsolverCgesvdjPtrBatched(handle,
+                                          jobz,
+                                          m,
+                                          n,
+                                          (hipFloatComplex**)A,
+                                          lda,
+                                          S,
+                                          stS,
+                                          (hipFloatComplex*)U,
+                                          ldu,
+                                          stU,
+                                          (hipFloatComplex*)V,
+                                          ldv,
+                                          stV,
+                                          (hipFloatComplex*)work,
+                                          lwork,
+                                          info,
+                                          params,
+                                          bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_gesvda(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_gesvdj(testAPI_t               API,
                                           bool                    STRIDED,
                                           hipsolverHandle_t       handle,
                                           hipsolverEigMode_t      jobz,
-                                          int                     rank,
+                                          int                     econ,
                                           int                     m,
                                           int                     n,
-                                          hipsolverDoubleComplex* A,
+                                          hipsolverDoubleComplex* A[],
                                           int                     lda,
                                           int                     stA,
                                           double*                 S,
@@ -4441,465 +5206,680 @@ inline hipsolverStatus_t hipsolver_gesvda(testAPI_t               API,
                                           hipsolverDoubleComplex* work,
                                           int                     lwork,
                                           int*                    info,
-                                          double*                 hRnrmF,
+                                          hipsolverGesvdjInfo_t   params,
                                           int                     bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnZgesvdaStridedBatched(handle,
-                                                jobz,
-                                                rank,
-                                                m,
-                                                n,
-                                                (hipDoubleComplex*)A,
-                                                lda,
-                                                stA,
-                                                S,
-                                                stS,
-                                                (hipDoubleComplex*)U,
-                                                ldu,
-                                                stU,
-                                                (hipDoubleComplex*)V,
-                                                ldv,
-                                                stV,
-                                                (hipDoubleComplex*)work,
-                                                lwork,
-                                                info,
-                                                hRnrmF,
-                                                bc);
+    case API_NORMAL:
+        return hipsolverZgesvdjPtrBatched(handle,
+                                          jobz,
+                                          m,
+                                          n,
+                                          (hipDoubleComplex**)A,
+                                          lda,
+                                          S,
+                                          stS,
+                                          (hipDoubleComplex*)U,
+                                          ldu,
+                                          stU,
+                                          (hipDoubleComplex*)V,
+                                          ldv,
+                                          stV,
+                                          (hipDoubleComplex*)work,
+                                          lwork,
+                                          info,
+                                          params,
+                                          bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** GETRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int                 m,
-                                                    int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+/******************** GESVDA ********************/
+inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t          API,
+                                                     bool               STRIDED,
+                                                     hipsolverHandle_t  handle,
+                                                     hipsolverEigMode_t jobz,
+                                                     int                rank,
+                                                     int                m,
+                                                     int                n,
+                                                     float*             A,
+                                                     int                lda,
+                                                     long long int      stA,
+                                                     float*             S,
+                                                     long long int      stS,
+                                                     float*             U,
+                                                     int                ldu,
+                                                     long long int      stU,
+                                                     float*             V,
+                                                     int                ldv,
+                                                     long long int      stV,
+                                                     int*               lwork,
+                                                     int                bc)
 {
-    *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnSgesvdaStridedBatched_bufferSize(
+            handle, jobz, rank, m, n, A, lda, stA, S, stS, U, ldu, stU, V, ldv, stV, lwork, bc);
     default:
-        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int                 m,
-                                                    int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t          API,
+                                                     bool               STRIDED,
+                                                     hipsolverHandle_t  handle,
+                                                     hipsolverEigMode_t jobz,
+                                                     int                rank,
+                                                     int                m,
+                                                     int                n,
+                                                     double*            A,
+                                                     int                lda,
+                                                     long long int      stA,
+                                                     double*            S,
+                                                     long long int      stS,
+                                                     double*            U,
+                                                     int                ldu,
+                                                     long long int      stU,
+                                                     double*            V,
+                                                     int                ldv,
+                                                     long long int      stV,
+                                                     int*               lwork,
+                                                     int                bc)
 {
-    *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnDgesvdaStridedBatched_bufferSize(
+            handle, jobz, rank, m, n, A, lda, stA, S, stS, U, ldu, stU, V, ldv, stV, lwork, bc);
     default:
-        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int                 m,
-                                                    int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lworkOnDevice,
-                                                    int*                lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t          API,
+                                                     bool               STRIDED,
+                                                     hipsolverHandle_t  handle,
+                                                     hipsolverEigMode_t jobz,
+                                                     int                rank,
+                                                     int                m,
+                                                     int                n,
+                                                     hipsolverComplex*  A,
+                                                     int                lda,
+                                                     long long int      stA,
+                                                     float*             S,
+                                                     long long int      stS,
+                                                     hipsolverComplex*  U,
+                                                     int                ldu,
+                                                     long long int      stU,
+                                                     hipsolverComplex*  V,
+                                                     int                ldv,
+                                                     long long int      stV,
+                                                     int*               lwork,
+                                                     int                bc)
 {
-    *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverCgetrf_bufferSizeFortran(
-            handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnCgesvdaStridedBatched_bufferSize(handle,
+                                                           jobz,
+                                                           rank,
+                                                           m,
+                                                           n,
+                                                           (hipFloatComplex*)A,
+                                                           lda,
+                                                           stA,
+                                                           S,
+                                                           stS,
+                                                           (hipFloatComplex*)U,
+                                                           ldu,
+                                                           stU,
+                                                           (hipFloatComplex*)V,
+                                                           ldv,
+                                                           stV,
+                                                           lwork,
+                                                           bc);
     default:
-        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverDnParams_t     params,
-                                                    int                     m,
-                                                    int                     n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    lworkOnDevice,
-                                                    int*                    lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvda_bufferSize(testAPI_t               API,
+                                                     bool                    STRIDED,
+                                                     hipsolverHandle_t       handle,
+                                                     hipsolverEigMode_t      jobz,
+                                                     int                     rank,
+                                                     int                     m,
+                                                     int                     n,
+                                                     hipsolverDoubleComplex* A,
+                                                     int                     lda,
+                                                     long long int           stA,
+                                                     double*                 S,
+                                                     long long int           stS,
+                                                     hipsolverDoubleComplex* U,
+                                                     int                     ldu,
+                                                     long long int           stU,
+                                                     hipsolverDoubleComplex* V,
+                                                     int                     ldv,
+                                                     long long int           stV,
+                                                     int*                    lwork,
+                                                     int                     bc)
 {
-    *lworkOnHost = 0;
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
-    case API_FORTRAN:
-        return hipsolverZgetrf_bufferSizeFortran(
-            handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
-    case API_COMPAT:
-        return hipsolverDnZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnZgesvdaStridedBatched_bufferSize(handle,
+                                                           jobz,
+                                                           rank,
+                                                           m,
+                                                           n,
+                                                           (hipDoubleComplex*)A,
+                                                           lda,
+                                                           stA,
+                                                           S,
+                                                           stS,
+                                                           (hipDoubleComplex*)U,
+                                                           ldu,
+                                                           stU,
+                                                           (hipDoubleComplex*)V,
+                                                           ldv,
+                                                           stV,
+                                                           lwork,
+                                                           bc);
     default:
-        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int64_t             m,
-                                                    int64_t             n,
-                                                    float*              A,
-                                                    int64_t             lda,
-                                                    size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvda(testAPI_t          API,
+                                          bool               STRIDED,
+                                          hipsolverHandle_t  handle,
+                                          hipsolverEigMode_t jobz,
+                                          int                rank,
+                                          int                m,
+                                          int                n,
+                                          float*             A,
+                                          int                lda,
+                                          int                stA,
+                                          float*             S,
+                                          int                stS,
+                                          float*             U,
+                                          int                ldu,
+                                          int                stU,
+                                          float*             V,
+                                          int                ldv,
+                                          int                stV,
+                                          float*             work,
+                                          int                lwork,
+                                          int*               info,
+                                          double*            hRnrmF,
+                                          int                bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_R_32F, A, lda, HIP_R_32F, lworkOnDevice, lworkOnHost);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnSgesvdaStridedBatched(handle,
+                                                jobz,
+                                                rank,
+                                                m,
+                                                n,
+                                                A,
+                                                lda,
+                                                stA,
+                                                S,
+                                                stS,
+                                                U,
+                                                ldu,
+                                                stU,
+                                                V,
+                                                ldv,
+                                                stV,
+                                                work,
+                                                lwork,
+                                                info,
+                                                hRnrmF,
+                                                bc);
     default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int64_t             m,
-                                                    int64_t             n,
-                                                    double*             A,
-                                                    int64_t             lda,
-                                                    size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvda(testAPI_t          API,
+                                          bool               STRIDED,
+                                          hipsolverHandle_t  handle,
+                                          hipsolverEigMode_t jobz,
+                                          int                rank,
+                                          int                m,
+                                          int                n,
+                                          double*            A,
+                                          int                lda,
+                                          int                stA,
+                                          double*            S,
+                                          int                stS,
+                                          double*            U,
+                                          int                ldu,
+                                          int                stU,
+                                          double*            V,
+                                          int                ldv,
+                                          int                stV,
+                                          double*            work,
+                                          int                lwork,
+                                          int*               info,
+                                          double*            hRnrmF,
+                                          int                bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_R_64F, A, lda, HIP_R_64F, lworkOnDevice, lworkOnHost);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnDgesvdaStridedBatched(handle,
+                                                jobz,
+                                                rank,
+                                                m,
+                                                n,
+                                                A,
+                                                lda,
+                                                stA,
+                                                S,
+                                                stS,
+                                                U,
+                                                ldu,
+                                                stU,
+                                                V,
+                                                ldv,
+                                                stV,
+                                                work,
+                                                lwork,
+                                                info,
+                                                hRnrmF,
+                                                bc);
     default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverDnParams_t params,
-                                                    int64_t             m,
-                                                    int64_t             n,
-                                                    hipsolverComplex*   A,
-                                                    int64_t             lda,
-                                                    size_t*             lworkOnDevice,
-                                                    size_t*             lworkOnHost)
-{
-    switch(API)
-    {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_C_32F, A, lda, HIP_C_32F, lworkOnDevice, lworkOnHost);
-    default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
+inline hipsolverStatus_t hipsolver_gesvda(testAPI_t          API,
+                                          bool               STRIDED,
+                                          hipsolverHandle_t  handle,
+                                          hipsolverEigMode_t jobz,
+                                          int                rank,
+                                          int                m,
+                                          int                n,
+                                          hipsolverComplex*  A,
+                                          int                lda,
+                                          int                stA,
+                                          float*             S,
+                                          int                stS,
+                                          hipsolverComplex*  U,
+                                          int                ldu,
+                                          int                stU,
+                                          hipsolverComplex*  V,
+                                          int                ldv,
+                                          int                stV,
+                                          hipsolverComplex*  work,
+                                          int                lwork,
+                                          int*               info,
+                                          double*            hRnrmF,
+                                          int                bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnCgesvdaStridedBatched(handle,
+                                                jobz,
+                                                rank,
+                                                m,
+                                                n,
+                                                (hipFloatComplex*)A,
+                                                lda,
+                                                stA,
+                                                S,
+                                                stS,
+                                                (hipFloatComplex*)U,
+                                                ldu,
+                                                stU,
+                                                (hipFloatComplex*)V,
+                                                ldv,
+                                                stV,
+                                                (hipFloatComplex*)work,
+                                                lwork,
+                                                info,
+                                                hRnrmF,
+                                                bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
 }
 
-inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverDnParams_t     params,
-                                                    int64_t                 m,
-                                                    int64_t                 n,
-                                                    hipsolverDoubleComplex* A,
-                                                    int64_t                 lda,
-                                                    size_t*                 lworkOnDevice,
-                                                    size_t*                 lworkOnHost)
+inline hipsolverStatus_t hipsolver_gesvda(testAPI_t               API,
+                                          bool                    STRIDED,
+                                          hipsolverHandle_t       handle,
+                                          hipsolverEigMode_t      jobz,
+                                          int                     rank,
+                                          int                     m,
+                                          int                     n,
+                                          hipsolverDoubleComplex* A,
+                                          int                     lda,
+                                          int                     stA,
+                                          double*                 S,
+                                          int                     stS,
+                                          hipsolverDoubleComplex* U,
+                                          int                     ldu,
+                                          int                     stU,
+                                          hipsolverDoubleComplex* V,
+                                          int                     ldv,
+                                          int                     stV,
+                                          hipsolverDoubleComplex* work,
+                                          int                     lwork,
+                                          int*                    info,
+                                          double*                 hRnrmF,
+                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrf_bufferSize(
-            handle, params, m, n, HIP_C_64F, A, lda, HIP_C_64F, lworkOnDevice, lworkOnHost);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnZgesvdaStridedBatched(handle,
+                                                jobz,
+                                                rank,
+                                                m,
+                                                n,
+                                                (hipDoubleComplex*)A,
+                                                lda,
+                                                stA,
+                                                S,
+                                                stS,
+                                                (hipDoubleComplex*)U,
+                                                ldu,
+                                                stU,
+                                                (hipDoubleComplex*)V,
+                                                ldv,
+                                                stV,
+                                                (hipDoubleComplex*)work,
+                                                lwork,
+                                                info,
+                                                hRnrmF,
+                                                bc);
     default:
-        *lworkOnDevice = 0;
-        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+/********************************************************/
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int                 m,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         float*              workOnDevice,
-                                         int                 lworkOnDevice,
-                                         float*              workOnHost,
-                                         int                 lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+/******************** GETRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+        return hipsolverSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     case C_NORMAL_ALT:
-        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
+        return hipsolverSgetrfStridedBatched_bufferSize(
+            handle, m, n, A, lda, stA, lworkOnDevice, bc);
     case FORTRAN_NORMAL:
-        return hipsolverSgetrfFortran(
-            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+        return hipsolverSgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
     case COMPAT_NORMAL:
-        return hipsolverDnSgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
+        return hipsolverDnSgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     default:
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int                 m,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         double*             workOnDevice,
-                                         int                 lworkOnDevice,
-                                         double*             workOnHost,
-                                         int                 lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+        return hipsolverDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     case C_NORMAL_ALT:
-        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
+        return hipsolverDgetrfStridedBatched_bufferSize(
+            handle, m, n, A, lda, stA, lworkOnDevice, bc);
     case FORTRAN_NORMAL:
-        return hipsolverDgetrfFortran(
-            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+        return hipsolverDgetrf_bufferSizeFortran(handle, m, n, A, lda, lworkOnDevice);
     case COMPAT_NORMAL:
-        return hipsolverDnDgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
+        return hipsolverDnDgetrf_bufferSize(handle, m, n, A, lda, lworkOnDevice);
     default:
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
-                                         bool                NPVT,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverDnParams_t params,
-                                         int                 m,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         hipsolverComplex*   workOnDevice,
-                                         int                 lworkOnDevice,
-                                         hipsolverComplex*   workOnHost,
-                                         int                 lworkOnHost,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverCgetrf(handle,
-                               m,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)workOnDevice,
-                               lworkOnDevice,
-                               ipiv,
-                               info);
+        return hipsolverCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
     case C_NORMAL_ALT:
-        return hipsolverCgetrf(handle,
-                               m,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)workOnDevice,
-                               lworkOnDevice,
-                               nullptr,
-                               info);
+        return hipsolverCgetrfStridedBatched_bufferSize(
+            handle, m, n, (hipFloatComplex*)A, lda, stA, lworkOnDevice, bc);
     case FORTRAN_NORMAL:
-        return hipsolverCgetrfFortran(handle,
-                                      m,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)workOnDevice,
-                                      lworkOnDevice,
-                                      ipiv,
-                                      info);
+        return hipsolverCgetrf_bufferSizeFortran(
+            handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
     case COMPAT_NORMAL:
-        return hipsolverDnCgetrf(
-            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)workOnDevice, ipiv, info);
+        return hipsolverDnCgetrf_bufferSize(handle, m, n, (hipFloatComplex*)A, lda, lworkOnDevice);
     default:
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
-                                         bool                    NPVT,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverDnParams_t     params,
-                                         int                     m,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         int*                    ipiv,
-                                         int                     stP,
-                                         hipsolverDoubleComplex* workOnDevice,
-                                         int                     lworkOnDevice,
-                                         hipsolverDoubleComplex* workOnHost,
-                                         int                     lworkOnHost,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    lworkOnDevice,
+                                                    int*                    lworkOnHost,
+                                                    int                     bc)
 {
-    switch(api2marshal(API, NPVT))
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
     {
     case C_NORMAL:
-        return hipsolverZgetrf(handle,
-                               m,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)workOnDevice,
-                               lworkOnDevice,
-                               ipiv,
-                               info);
+        return hipsolverZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
     case C_NORMAL_ALT:
-        return hipsolverZgetrf(handle,
-                               m,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)workOnDevice,
-                               lworkOnDevice,
-                               nullptr,
-                               info);
+        return hipsolverZgetrfStridedBatched_bufferSize(
+            handle, m, n, (hipDoubleComplex*)A, lda, stA, lworkOnDevice, bc);
     case FORTRAN_NORMAL:
-        return hipsolverZgetrfFortran(handle,
-                                      m,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      (hipDoubleComplex*)workOnDevice,
-                                      lworkOnDevice,
-                                      ipiv,
-                                      info);
+        return hipsolverZgetrf_bufferSizeFortran(
+            handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
     case COMPAT_NORMAL:
-        return hipsolverDnZgetrf(
-            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)workOnDevice, ipiv, info);
+        return hipsolverDnZgetrf_bufferSize(handle, m, n, (hipDoubleComplex*)A, lda, lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    float*              A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_R_32F, A, lda, HIP_R_32F, lworkOnDevice, lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    double*             A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_R_64F, A, lda, HIP_R_64F, lworkOnDevice, lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    hipsolverComplex*   A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_C_32F, A, lda, HIP_C_32F, lworkOnDevice, lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
+                                                    int64_t                 m,
+                                                    int64_t                 n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    int64_t                 stA,
+                                                    size_t*                 lworkOnDevice,
+                                                    size_t*                 lworkOnHost,
+                                                    int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf_bufferSize(
+            handle, params, m, n, HIP_C_64F, A, lda, HIP_C_64F, lworkOnDevice, lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
 inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
                                          bool                NPVT,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
-                                         int64_t             m,
-                                         int64_t             n,
+                                         int                 m,
+                                         int                 n,
                                          float*              A,
-                                         int64_t             lda,
-                                         int64_t             stA,
-                                         int64_t*            ipiv,
-                                         int64_t             stP,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
                                          float*              workOnDevice,
-                                         size_t              lworkOnDevice,
+                                         int                 lworkOnDevice,
                                          float*              workOnHost,
-                                         size_t              lworkOnHost,
+                                         int                 lworkOnHost,
                                          int*                info,
                                          int                 bc)
 {
+    if(STRIDED)
+    {
+        switch(api2marshal(API, NPVT))
+        {
+        case C_NORMAL:
+            return hipsolverSgetrfStridedBatched(
+                handle, m, n, A, lda, stA, workOnDevice, lworkOnDevice, ipiv, stP, info, bc);
+        case C_NORMAL_ALT:
+            return hipsolverSgetrfStridedBatched(
+                handle, m, n, A, lda, stA, workOnDevice, lworkOnDevice, nullptr, stP, info, bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
     switch(api2marshal(API, NPVT))
     {
+    case C_NORMAL:
+        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrfFortran(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
     case COMPAT_NORMAL:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_32F,
-                                 A,
-                                 lda,
-                                 ipiv,
-                                 HIP_R_32F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_32F,
-                                 A,
-                                 lda,
-                                 nullptr,
-                                 HIP_R_32F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
+        return hipsolverDnSgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
@@ -4907,77 +5887,264 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
 
 inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
                                          bool                NPVT,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
-                                         int64_t             m,
-                                         int64_t             n,
+                                         int                 m,
+                                         int                 n,
                                          double*             A,
-                                         int64_t             lda,
-                                         int64_t             stA,
-                                         int64_t*            ipiv,
-                                         int64_t             stP,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
                                          double*             workOnDevice,
-                                         size_t              lworkOnDevice,
+                                         int                 lworkOnDevice,
                                          double*             workOnHost,
-                                         size_t              lworkOnHost,
+                                         int                 lworkOnHost,
                                          int*                info,
                                          int                 bc)
 {
-    switch(api2marshal(API, NPVT))
+    if(STRIDED)
     {
-    case COMPAT_NORMAL:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_64F,
-                                 A,
-                                 lda,
-                                 ipiv,
-                                 HIP_R_64F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnXgetrf(handle,
-                                 params,
-                                 m,
-                                 n,
-                                 HIP_R_64F,
-                                 A,
-                                 lda,
-                                 nullptr,
-                                 HIP_R_64F,
-                                 workOnDevice,
-                                 lworkOnDevice,
-                                 workOnHost,
-                                 lworkOnHost,
-                                 info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        switch(api2marshal(API, NPVT))
+        {
+        case C_NORMAL:
+            return hipsolverDgetrfStridedBatched(
+                handle, m, n, A, lda, stA, workOnDevice, lworkOnDevice, ipiv, stP, info, bc);
+        case C_NORMAL_ALT:
+            return hipsolverDgetrfStridedBatched(
+                handle, m, n, A, lda, stA, workOnDevice, lworkOnDevice, nullptr, stP, info, bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
     }
-}
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+    switch(api2marshal(API, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrf(handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, info);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrfFortran(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnDgetrf(handle, m, n, A, lda, workOnDevice, ipiv, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int                 m,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   workOnDevice,
+                                         int                 lworkOnDevice,
+                                         hipsolverComplex*   workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    if(STRIDED)
+    {
+        switch(api2marshal(API, NPVT))
+        {
+        case C_NORMAL:
+            return hipsolverCgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 (hipFloatComplex*)workOnDevice,
+                                                 lworkOnDevice,
+                                                 ipiv,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        case C_NORMAL_ALT:
+            return hipsolverCgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 (hipFloatComplex*)workOnDevice,
+                                                 lworkOnDevice,
+                                                 nullptr,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    switch(api2marshal(API, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverCgetrf(handle,
+                               m,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)workOnDevice,
+                               lworkOnDevice,
+                               ipiv,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrf(handle,
+                               m,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)workOnDevice,
+                               lworkOnDevice,
+                               nullptr,
+                               info);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrfFortran(handle,
+                                      m,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)workOnDevice,
+                                      lworkOnDevice,
+                                      ipiv,
+                                      info);
+    case COMPAT_NORMAL:
+        return hipsolverDnCgetrf(
+            handle, m, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)workOnDevice, ipiv, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
+                                         bool                    NPVT,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
+                                         int                     m,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* workOnDevice,
+                                         int                     lworkOnDevice,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         int                     lworkOnHost,
+                                         int*                    info,
+                                         int                     bc)
+{
+    if(STRIDED)
+    {
+        switch(api2marshal(API, NPVT))
+        {
+        case C_NORMAL:
+            return hipsolverZgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 (hipDoubleComplex*)workOnDevice,
+                                                 lworkOnDevice,
+                                                 ipiv,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        case C_NORMAL_ALT:
+            return hipsolverZgetrfStridedBatched(handle,
+                                                 m,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 stA,
+                                                 (hipDoubleComplex*)workOnDevice,
+                                                 lworkOnDevice,
+                                                 nullptr,
+                                                 stP,
+                                                 info,
+                                                 bc);
+        default:
+            return HIPSOLVER_STATUS_NOT_SUPPORTED;
+        }
+    }
+
+    switch(api2marshal(API, NPVT))
+    {
+    case C_NORMAL:
+        return hipsolverZgetrf(handle,
+                               m,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)workOnDevice,
+                               lworkOnDevice,
+                               ipiv,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrf(handle,
+                               m,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)workOnDevice,
+                               lworkOnDevice,
+                               nullptr,
+                               info);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrfFortran(handle,
+                                      m,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)workOnDevice,
+                                      lworkOnDevice,
+                                      ipiv,
+                                      info);
+    case COMPAT_NORMAL:
+        return hipsolverDnZgetrf(
+            handle, m, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)workOnDevice, ipiv, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
                                          bool                NPVT,
+                                         bool                STRIDED,
                                          hipsolverHandle_t   handle,
                                          hipsolverDnParams_t params,
                                          int64_t             m,
                                          int64_t             n,
-                                         hipsolverComplex*   A,
+                                         float*              A,
                                          int64_t             lda,
                                          int64_t             stA,
                                          int64_t*            ipiv,
                                          int64_t             stP,
-                                         hipsolverComplex*   workOnDevice,
+                                         float*              workOnDevice,
                                          size_t              lworkOnDevice,
-                                         hipsolverComplex*   workOnHost,
+                                         float*              workOnHost,
                                          size_t              lworkOnHost,
                                          int*                info,
                                          int                 bc)
 {
+    if(STRIDED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(api2marshal(API, NPVT))
     {
     case COMPAT_NORMAL:
@@ -4985,11 +6152,11 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
                                  params,
                                  m,
                                  n,
-                                 HIP_C_32F,
+                                 HIP_R_32F,
                                  A,
                                  lda,
                                  ipiv,
-                                 HIP_C_32F,
+                                 HIP_R_32F,
                                  workOnDevice,
                                  lworkOnDevice,
                                  workOnHost,
@@ -5000,11 +6167,11 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
                                  params,
                                  m,
                                  n,
-                                 HIP_C_32F,
+                                 HIP_R_32F,
                                  A,
                                  lda,
                                  nullptr,
-                                 HIP_C_32F,
+                                 HIP_R_32F,
                                  workOnDevice,
                                  lworkOnDevice,
                                  workOnHost,
@@ -5015,24 +6182,28 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
-                                         bool                    NPVT,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverDnParams_t     params,
-                                         int64_t                 m,
-                                         int64_t                 n,
-                                         hipsolverDoubleComplex* A,
-                                         int64_t                 lda,
-                                         int64_t                 stA,
-                                         int64_t*                ipiv,
-                                         int64_t                 stP,
-                                         hipsolverDoubleComplex* workOnDevice,
-                                         size_t                  lworkOnDevice,
-                                         hipsolverDoubleComplex* workOnHost,
-                                         size_t                  lworkOnHost,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         double*             A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         double*             workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         double*             workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
+    if(STRIDED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     switch(api2marshal(API, NPVT))
     {
     case COMPAT_NORMAL:
@@ -5040,11 +6211,11 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
                                  params,
                                  m,
                                  n,
-                                 HIP_C_64F,
+                                 HIP_R_64F,
                                  A,
                                  lda,
                                  ipiv,
-                                 HIP_C_64F,
+                                 HIP_R_64F,
                                  workOnDevice,
                                  lworkOnDevice,
                                  workOnHost,
@@ -5055,11 +6226,11 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
                                  params,
                                  m,
                                  n,
-                                 HIP_C_64F,
+                                 HIP_R_64F,
                                  A,
                                  lda,
                                  nullptr,
-                                 HIP_C_64F,
+                                 HIP_R_64F,
                                  workOnDevice,
                                  lworkOnDevice,
                                  workOnHost,
@@ -5069,712 +6240,805 @@ inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** GETRS ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    float*               A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    float*               B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         hipsolverComplex*   A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         hipsolverComplex*   workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         hipsolverComplex*   workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    if(STRIDED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    switch(api2marshal(API, NPVT))
     {
-    case API_NORMAL:
-        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverSgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_C_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 nullptr,
+                                 HIP_C_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    double*              A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    double*              B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
+                                         bool                    NPVT,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
+                                         int64_t                 m,
+                                         int64_t                 n,
+                                         hipsolverDoubleComplex* A,
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         int64_t*                ipiv,
+                                         int64_t                 stP,
+                                         hipsolverDoubleComplex* workOnDevice,
+                                         size_t                  lworkOnDevice,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         size_t                  lworkOnHost,
+                                         int*                    info,
+                                         int                     bc)
 {
-    switch(API)
+    if(STRIDED)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    switch(api2marshal(API, NPVT))
     {
-    case API_NORMAL:
-        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverDgetrs_bufferSizeFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_64F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_C_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnXgetrf(handle,
+                                 params,
+                                 m,
+                                 n,
+                                 HIP_C_64F,
+                                 A,
+                                 lda,
+                                 nullptr,
+                                 HIP_C_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int                  n,
-                                                    int                  nrhs,
-                                                    hipsolverComplex*    A,
-                                                    int                  lda,
-                                                    int*                 ipiv,
-                                                    hipsolverComplex*    B,
-                                                    int                  ldb,
-                                                    int*                 lwork)
+// batched
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCgetrs_bufferSize(handle,
-                                          trans,
-                                          n,
-                                          nrhs,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          ipiv,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          lwork);
-    case API_FORTRAN:
-        return hipsolverCgetrs_bufferSizeFortran(handle,
-                                                 trans,
-                                                 n,
-                                                 nrhs,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 ipiv,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 lwork);
+        return hipsolverSgetrfBatched_bufferSize(handle, m, n, A, lda, lworkOnDevice, bc);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverDnParams_t     params,
-                                                    hipsolverOperation_t    trans,
-                                                    int                     n,
-                                                    int                     nrhs,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    int*                    ipiv,
-                                                    hipsolverDoubleComplex* B,
-                                                    int                     ldb,
-                                                    int*                    lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZgetrs_bufferSize(handle,
-                                          trans,
-                                          n,
-                                          nrhs,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          ipiv,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          lwork);
-    case API_FORTRAN:
-        return hipsolverZgetrs_bufferSizeFortran(handle,
-                                                 trans,
-                                                 n,
-                                                 nrhs,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 ipiv,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 lwork);
+        return hipsolverDgetrfBatched_bufferSize(handle, m, n, A, lda, lworkOnDevice, bc);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int64_t              n,
-                                                    int64_t              nrhs,
-                                                    float*               A,
-                                                    int64_t              lda,
-                                                    int64_t*             ipiv,
-                                                    float*               B,
-                                                    int64_t              ldb,
-                                                    size_t*              lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int                 m,
+                                                    int                 n,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
+    case API_NORMAL:
+        return hipsolverCgetrfBatched_bufferSize(
+            handle, m, n, (hipFloatComplex**)A, lda, lworkOnDevice, bc);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int64_t              n,
-                                                    int64_t              nrhs,
-                                                    double*              A,
-                                                    int64_t              lda,
-                                                    int64_t*             ipiv,
-                                                    double*              B,
-                                                    int64_t              ldb,
-                                                    size_t*              lwork)
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
+                                                    int                     m,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    lworkOnDevice,
+                                                    int*                    lworkOnHost,
+                                                    int                     bc)
 {
+    *lworkOnHost = 0;
     switch(API)
     {
+    case API_NORMAL:
+        return hipsolverZgetrfBatched_bufferSize(
+            handle, m, n, (hipDoubleComplex**)A, lda, lworkOnDevice, bc);
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
-                                                    hipsolverHandle_t    handle,
-                                                    hipsolverDnParams_t  params,
-                                                    hipsolverOperation_t trans,
-                                                    int64_t              n,
-                                                    int64_t              nrhs,
-                                                    hipsolverComplex*    A,
-                                                    int64_t              lda,
-                                                    int64_t*             ipiv,
-                                                    hipsolverComplex*    B,
-                                                    int64_t              ldb,
-                                                    size_t*              lwork)
-{
-    switch(API)
-    {
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    float*              A[],
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(API)
+    {
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    double*             A[],
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverDnParams_t params,
+                                                    int64_t             m,
+                                                    int64_t             n,
+                                                    hipsolverComplex*   A[],
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrf_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
                                                     hipsolverDnParams_t     params,
-                                                    hipsolverOperation_t    trans,
+                                                    int64_t                 m,
                                                     int64_t                 n,
-                                                    int64_t                 nrhs,
-                                                    hipsolverDoubleComplex* A,
+                                                    hipsolverDoubleComplex* A[],
                                                     int64_t                 lda,
-                                                    int64_t*                ipiv,
-                                                    hipsolverDoubleComplex* B,
-                                                    int64_t                 ldb,
-                                                    size_t*                 lwork)
+                                                    int64_t                 stA,
+                                                    size_t*                 lworkOnDevice,
+                                                    size_t*                 lworkOnHost,
+                                                    int                     bc)
 {
     switch(API)
     {
     default:
-        *lwork = 0;
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         float*               A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         float*               B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         float*               work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int                 m,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              workOnDevice,
+                                         int                 lworkOnDevice,
+                                         float*              workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, NPVT))
     {
-    case API_NORMAL:
-        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+    case C_NORMAL:
+        return hipsolverSgetrfBatched(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, stP, info, bc);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrfBatched(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, stP, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         double*              A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         double*              B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         double*              work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int                 m,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             workOnDevice,
+                                         int                 lworkOnDevice,
+                                         double*             workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, NPVT))
     {
-    case API_NORMAL:
-        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDgetrsFortran(
-            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
+    case C_NORMAL:
+        return hipsolverDgetrfBatched(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, ipiv, stP, info, bc);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrfBatched(
+            handle, m, n, A, lda, workOnDevice, lworkOnDevice, nullptr, stP, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int                  n,
-                                         int                  nrhs,
-                                         hipsolverComplex*    A,
-                                         int                  lda,
-                                         int                  stA,
-                                         int*                 ipiv,
-                                         int                  stP,
-                                         hipsolverComplex*    B,
-                                         int                  ldb,
-                                         int                  stB,
-                                         hipsolverComplex*    work,
-                                         int                  lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int                 m,
+                                         int                 n,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   workOnDevice,
+                                         int                 lworkOnDevice,
+                                         hipsolverComplex*   workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, NPVT))
     {
-    case API_NORMAL:
-        return hipsolverCgetrs(handle,
-                               trans,
-                               n,
-                               nrhs,
-                               (hipFloatComplex*)A,
-                               lda,
-                               ipiv,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverCgetrsFortran(handle,
-                                      trans,
+    case C_NORMAL:
+        return hipsolverCgetrfBatched(handle,
+                                      m,
                                       n,
-                                      nrhs,
-                                      (hipFloatComplex*)A,
+                                      (hipFloatComplex**)A,
                                       lda,
+                                      (hipFloatComplex*)workOnDevice,
+                                      lworkOnDevice,
                                       ipiv,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
-    case API_COMPAT:
-        return hipsolverDnCgetrs(
-            handle, trans, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, info);
+                                      stP,
+                                      info,
+                                      bc);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrfBatched(handle,
+                                      m,
+                                      n,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      (hipFloatComplex*)workOnDevice,
+                                      lworkOnDevice,
+                                      nullptr,
+                                      stP,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
+                                         bool                    NPVT,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverDnParams_t     params,
-                                         hipsolverOperation_t    trans,
+                                         int                     m,
                                          int                     n,
-                                         int                     nrhs,
-                                         hipsolverDoubleComplex* A,
+                                         hipsolverDoubleComplex* A[],
                                          int                     lda,
                                          int                     stA,
                                          int*                    ipiv,
                                          int                     stP,
-                                         hipsolverDoubleComplex* B,
-                                         int                     ldb,
-                                         int                     stB,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
+                                         hipsolverDoubleComplex* workOnDevice,
+                                         int                     lworkOnDevice,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         int                     lworkOnHost,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, NPVT))
     {
-    case API_NORMAL:
-        return hipsolverZgetrs(handle,
-                               trans,
-                               n,
-                               nrhs,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               ipiv,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverZgetrsFortran(handle,
-                                      trans,
+    case C_NORMAL:
+        return hipsolverZgetrfBatched(handle,
+                                      m,
                                       n,
-                                      nrhs,
-                                      (hipDoubleComplex*)A,
+                                      (hipDoubleComplex**)A,
                                       lda,
+                                      (hipDoubleComplex*)workOnDevice,
+                                      lworkOnDevice,
                                       ipiv,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
-    case API_COMPAT:
-        return hipsolverDnZgetrs(handle,
-                                 trans,
-                                 n,
-                                 nrhs,
-                                 (hipDoubleComplex*)A,
-                                 lda,
-                                 ipiv,
-                                 (hipDoubleComplex*)B,
-                                 ldb,
-                                 info);
+                                      stP,
+                                      info,
+                                      bc);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrfBatched(handle,
+                                      m,
+                                      n,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      (hipDoubleComplex*)workOnDevice,
+                                      lworkOnDevice,
+                                      nullptr,
+                                      stP,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int64_t              n,
-                                         int64_t              nrhs,
-                                         float*               A,
-                                         int64_t              lda,
-                                         int64_t              stA,
-                                         int64_t*             ipiv,
-                                         int64_t              stP,
-                                         float*               B,
-                                         int64_t              ldb,
-                                         int64_t              stB,
-                                         float*               work,
-                                         size_t               lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         float*              A[],
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         float*              workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         float*              workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_R_32F, A, lda, ipiv, HIP_R_32F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int64_t              n,
-                                         int64_t              nrhs,
-                                         double*              A,
-                                         int64_t              lda,
-                                         int64_t              stA,
-                                         int64_t*             ipiv,
-                                         int64_t              stP,
-                                         double*              B,
-                                         int64_t              ldb,
-                                         int64_t              stB,
-                                         double*              work,
-                                         size_t               lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         double*             A[],
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         double*             workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         double*             workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_R_64F, A, lda, ipiv, HIP_R_64F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
-                                         hipsolverHandle_t    handle,
-                                         hipsolverDnParams_t  params,
-                                         hipsolverOperation_t trans,
-                                         int64_t              n,
-                                         int64_t              nrhs,
-                                         hipsolverComplex*    A,
-                                         int64_t              lda,
-                                         int64_t              stA,
-                                         int64_t*             ipiv,
-                                         int64_t              stP,
-                                         hipsolverComplex*    B,
-                                         int64_t              ldb,
-                                         int64_t              stB,
-                                         hipsolverComplex*    work,
-                                         size_t               lwork,
-                                         int*                 info,
-                                         int                  bc)
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t           API,
+                                         bool                NPVT,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverDnParams_t params,
+                                         int64_t             m,
+                                         int64_t             n,
+                                         hipsolverComplex*   A[],
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         hipsolverComplex*   workOnDevice,
+                                         size_t              lworkOnDevice,
+                                         hipsolverComplex*   workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_C_32F, A, lda, ipiv, HIP_C_32F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrf(testAPI_t               API,
+                                         bool                    NPVT,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
                                          hipsolverDnParams_t     params,
-                                         hipsolverOperation_t    trans,
+                                         int64_t                 m,
                                          int64_t                 n,
-                                         int64_t                 nrhs,
-                                         hipsolverDoubleComplex* A,
+                                         hipsolverDoubleComplex* A[],
                                          int64_t                 lda,
                                          int64_t                 stA,
                                          int64_t*                ipiv,
                                          int64_t                 stP,
-                                         hipsolverDoubleComplex* B,
-                                         int64_t                 ldb,
-                                         int64_t                 stB,
-                                         hipsolverDoubleComplex* work,
-                                         size_t                  lwork,
+                                         hipsolverDoubleComplex* workOnDevice,
+                                         size_t                  lworkOnDevice,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         size_t                  lworkOnHost,
                                          int*                    info,
                                          int                     bc)
 {
     switch(API)
     {
-    case API_COMPAT:
-        return hipsolverDnXgetrs(
-            handle, params, trans, n, nrhs, HIP_C_64F, A, lda, ipiv, HIP_C_64F, B, ldb, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+
 /********************************************************/
 
-/******************** POTRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+/******************** GETRI ********************/
+// strided_batched
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t         API,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    float*            A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    float*            C,
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+        return hipsolverSgetriStridedBatched_bufferSize(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t         API,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    double*           A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    double*           C,
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
+        return hipsolverDgetriStridedBatched_bufferSize(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t         API,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    hipsolverComplex* A,
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    hipsolverComplex* C,
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+        return hipsolverCgetriStridedBatched_bufferSize(handle,
+                                                        n,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipFloatComplex*)C,
+                                                        ldc,
+                                                        stC,
+                                                        lwork,
+                                                        bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t               API,
                                                     hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* C,
+                                                    int                     ldc,
+                                                    int                     stC,
                                                     int*                    lwork,
                                                     int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_COMPAT:
-        return hipsolverDnZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+        return hipsolverZgetriStridedBatched_bufferSize(handle,
+                                                        n,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipDoubleComplex*)C,
+                                                        ldc,
+                                                        stC,
+                                                        lwork,
+                                                        bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getri(testAPI_t         API,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            A,
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         float*            C,
+                                         int               ldc,
+                                         int               stC,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSpotrf(handle, uplo, n, A, lda, work, lwork, info);
+        return hipsolverSgetriStridedBatched(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getri(testAPI_t         API,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           A,
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         double*           C,
+                                         int               ldc,
+                                         int               stC,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDpotrf(handle, uplo, n, A, lda, work, lwork, info);
+        return hipsolverDgetriStridedBatched(
+            handle, n, A, lda, stA, ipiv, stP, C, ldc, stC, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getri(testAPI_t         API,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         hipsolverComplex* A,
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         hipsolverComplex* C,
+                                         int               ldc,
+                                         int               stC,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverCpotrfFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnCpotrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+        return hipsolverCgetriStridedBatched(handle,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipFloatComplex*)C,
+                                             ldc,
+                                             stC,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getri(testAPI_t               API,
                                          hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
                                          int                     n,
                                          hipsolverDoubleComplex* A,
                                          int                     lda,
                                          int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* C,
+                                         int                     ldc,
+                                         int                     stC,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
                                          int*                    info,
@@ -5783,192 +7047,229 @@ inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverZpotrfFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnZpotrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+        return hipsolverZgetriStridedBatched(handle,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipDoubleComplex*)C,
+                                             ldc,
+                                             stC,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
 // batched
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t         API,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    float*            A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    float*            C[],
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+        return hipsolverSgetriBatched_bufferSize(handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t         API,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    double*           A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    double*           C[],
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
+        return hipsolverDgetriBatched_bufferSize(handle, n, A, lda, ipiv, stP, C, ldc, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A[],
-                                                    int                 lda,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t         API,
+                                                    hipsolverHandle_t handle,
+                                                    int               n,
+                                                    hipsolverComplex* A[],
+                                                    int               lda,
+                                                    int               stA,
+                                                    int*              ipiv,
+                                                    int               stP,
+                                                    hipsolverComplex* C[],
+                                                    int               ldc,
+                                                    int               stC,
+                                                    int*              lwork,
+                                                    int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrfBatched_bufferSize(
-            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverCpotrfBatched_bufferSizeFortran(
-            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+        return hipsolverCgetriBatched_bufferSize(
+            handle, n, (hipFloatComplex**)A, lda, ipiv, stP, (hipFloatComplex**)C, ldc, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getri_bufferSize(testAPI_t               API,
                                                     hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
                                                     int                     n,
                                                     hipsolverDoubleComplex* A[],
                                                     int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* C[],
+                                                    int                     ldc,
+                                                    int                     stC,
                                                     int*                    lwork,
                                                     int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrfBatched_bufferSize(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverZpotrfBatched_bufferSizeFortran(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+        return hipsolverZgetriBatched_bufferSize(handle,
+                                                 n,
+                                                 (hipDoubleComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 stP,
+                                                 (hipDoubleComplex**)C,
+                                                 ldc,
+                                                 lwork,
+                                                 bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getri(testAPI_t         API,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            A[],
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         float*            C[],
+                                         int               ldc,
+                                         int               stC,
+                                         float*            work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnSpotrfBatched(handle, uplo, n, A, lda, info, bc);
+        return hipsolverSgetriBatched(handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getri(testAPI_t         API,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           A[],
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         double*           C[],
+                                         int               ldc,
+                                         int               stC,
+                                         double*           work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnDpotrfBatched(handle, uplo, n, A, lda, info, bc);
+        return hipsolverDgetriBatched(handle, n, A, lda, ipiv, stP, C, ldc, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getri(testAPI_t         API,
+                                         hipsolverHandle_t handle,
+                                         int               n,
+                                         hipsolverComplex* A[],
+                                         int               lda,
+                                         int               stA,
+                                         int*              ipiv,
+                                         int               stP,
+                                         hipsolverComplex* C[],
+                                         int               ldc,
+                                         int               stC,
+                                         hipsolverComplex* work,
+                                         int               lwork,
+                                         int*              info,
+                                         int               bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCpotrfBatched(
-            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverCpotrfBatchedFortran(
-            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnCpotrfBatched(handle, uplo, n, (hipFloatComplex**)A, lda, info, bc);
+        return hipsolverCgetriBatched(handle,
+                                      n,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      ipiv,
+                                      stP,
+                                      (hipFloatComplex**)C,
+                                      ldc,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getri(testAPI_t               API,
                                          hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
                                          int                     n,
                                          hipsolverDoubleComplex* A[],
                                          int                     lda,
                                          int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* C[],
+                                         int                     ldc,
+                                         int                     stC,
                                          hipsolverDoubleComplex* work,
                                          int                     lwork,
                                          int*                    info,
@@ -5977,412 +7278,483 @@ inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrfBatched(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverZpotrfBatchedFortran(
-            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnZpotrfBatched(handle, uplo, n, (hipDoubleComplex**)A, lda, info, bc);
+        return hipsolverZgetriBatched(handle,
+                                      n,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      ipiv,
+                                      stP,
+                                      (hipDoubleComplex**)C,
+                                      ldc,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** POTRI ********************/
+/******************** GETRS ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    int*                lwork)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    float*               A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    float*               B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverSgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    int*                lwork)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    double*              A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    double*              B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverDgetrs_bufferSize(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrsStridedBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrs_bufferSizeFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    int*                lwork)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    hipsolverComplex*    A,
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    hipsolverComplex*    B,
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotri_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverCpotri_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverCgetrs_bufferSize(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrsStridedBatched_bufferSize(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipFloatComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrs_bufferSizeFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
+                                                    hipsolverDnParams_t     params,
+                                                    hipsolverOperation_t    trans,
                                                     int                     n,
+                                                    int                     nrhs,
                                                     hipsolverDoubleComplex* A,
                                                     int                     lda,
-                                                    int*                    lwork)
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int                     stB,
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotri_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverZpotri_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    case C_NORMAL:
+        return hipsolverZgetrs_bufferSize(handle,
+                                          trans,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZgetrsStridedBatched_bufferSize(handle,
+                                                        trans,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipDoubleComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrs_bufferSizeFortran(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 ipiv,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    float*               A,
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    float*               B,
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    double*              A,
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    double*              B,
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverCpotri(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverCpotriFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
-
-inline hipsolverStatus_t hipsolver_potri(testAPI_t               API,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    hipsolverComplex*    A,
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    hipsolverComplex*    B,
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotri(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverZpotriFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** POTRS ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    float*              A,
-                                                    int                 lda,
-                                                    float*              B,
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
+                                                    hipsolverOperation_t    trans,
+                                                    int64_t                 n,
+                                                    int64_t                 nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    int64_t                 stA,
+                                                    int64_t*                ipiv,
+                                                    int64_t                 stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int64_t                 ldb,
+                                                    int64_t                 stB,
+                                                    size_t*                 lwork,
+                                                    int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    double*             A,
-                                                    int                 lda,
-                                                    double*             B,
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         float*               B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case C_NORMAL:
+        return hipsolverSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnSgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipsolverComplex*   A,
-                                                    int                 lda,
-                                                    hipsolverComplex*   B,
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         double*              B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrs_bufferSize(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverCpotrs_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    case C_NORMAL:
+        return hipsolverDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDgetrsStridedBatched(
+            handle, trans, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDgetrsFortran(
+            handle, trans, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnDgetrs(handle, trans, n, nrhs, A, lda, ipiv, B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
-                                                    hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
-                                                    int                     n,
-                                                    int                     nrhs,
-                                                    hipsolverDoubleComplex* A,
-                                                    int                     lda,
-                                                    hipsolverDoubleComplex* B,
-                                                    int                     ldb,
-                                                    int*                    lwork,
-                                                    int                     bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipsolverComplex*    A,
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         hipsolverComplex*    B,
+                                         int                  ldb,
+                                         int                  stB,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrs_bufferSize(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
-    case API_FORTRAN:
-        return hipsolverZpotrs_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    case C_NORMAL:
+        return hipsolverCgetrs(handle,
+                               trans,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverCgetrsStridedBatched(handle,
+                                             trans,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCgetrsFortran(handle,
+                                      trans,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      ipiv,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    case COMPAT_NORMAL:
+        return hipsolverDnCgetrs(
+            handle, trans, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              B,
-                                         int                 ldb,
-                                         int                 stB,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
-
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             B,
-                                         int                 ldb,
-                                         int                 stB,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
-
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   B,
-                                         int                 ldb,
-                                         int                 stB,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverCpotrs(handle,
-                               uplo,
-                               n,
-                               nrhs,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverCpotrsFortran(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
-    case API_COMPAT:
-        return hipsolverDnCpotrs(
-            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, info);
-    default:
-        return HIPSOLVER_STATUS_NOT_SUPPORTED;
-    }
-}
-
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+                                         bool                    STRIDED,
                                          hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
+                                         hipsolverDnParams_t     params,
+                                         hipsolverOperation_t    trans,
                                          int                     n,
                                          int                     nrhs,
                                          hipsolverDoubleComplex* A,
                                          int                     lda,
                                          int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
                                          hipsolverDoubleComplex* B,
                                          int                     ldb,
                                          int                     stB,
@@ -6391,2896 +7763,8432 @@ inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
                                          int*                    info,
                                          int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZpotrs(handle,
-                               uplo,
+    case C_NORMAL:
+        return hipsolverZgetrs(handle,
+                               trans,
                                n,
                                nrhs,
                                (hipDoubleComplex*)A,
                                lda,
+                               ipiv,
                                (hipDoubleComplex*)B,
                                ldb,
                                (hipDoubleComplex*)work,
                                lwork,
                                info);
-    case API_FORTRAN:
-        return hipsolverZpotrsFortran(handle,
-                                      uplo,
+    case C_NORMAL_ALT:
+        return hipsolverZgetrsStridedBatched(handle,
+                                             trans,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZgetrsFortran(handle,
+                                      trans,
                                       n,
                                       nrhs,
                                       (hipDoubleComplex*)A,
                                       lda,
+                                      ipiv,
                                       (hipDoubleComplex*)B,
                                       ldb,
                                       (hipDoubleComplex*)work,
                                       lwork,
                                       info);
-    case API_COMPAT:
-        return hipsolverDnZpotrs(
-            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnZgetrs(handle,
+                                 trans,
+                                 n,
+                                 nrhs,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 ipiv,
+                                 (hipDoubleComplex*)B,
+                                 ldb,
+                                 info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-// batched
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    float*              A[],
-                                                    int                 lda,
-                                                    float*              B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         float*               A,
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         float*               B,
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         float*               work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_R_32F, A, lda, ipiv, HIP_R_32F, B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    double*             A[],
-                                                    int                 lda,
-                                                    double*             B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         double*              A,
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         double*              B,
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         double*              work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_R_64F, A, lda, ipiv, HIP_R_64F, B, ldb, info);
     default:
-        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
-                                                    hipsolverHandle_t   handle,
-                                                    hipsolverFillMode_t uplo,
-                                                    int                 n,
-                                                    int                 nrhs,
-                                                    hipsolverComplex*   A[],
-                                                    int                 lda,
-                                                    hipsolverComplex*   B[],
-                                                    int                 ldb,
-                                                    int*                lwork,
-                                                    int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         hipsolverComplex*    A,
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         hipsolverComplex*    B,
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         hipsolverComplex*    work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCpotrsBatched_bufferSize(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
-    case API_FORTRAN:
-        return hipsolverCpotrsBatched_bufferSizeFortran(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_C_32F, A, lda, ipiv, HIP_C_32F, B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
+                                         hipsolverOperation_t    trans,
+                                         int64_t                 n,
+                                         int64_t                 nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         int64_t*                ipiv,
+                                         int64_t                 stP,
+                                         hipsolverDoubleComplex* B,
+                                         int64_t                 ldb,
+                                         int64_t                 stB,
+                                         hipsolverDoubleComplex* work,
+                                         size_t                  lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXgetrs(
+            handle, params, trans, n, nrhs, HIP_C_64F, A, lda, ipiv, HIP_C_64F, B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    float*               A[],
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    float*               B[],
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSgetrsBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    double*              A[],
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    double*              B[],
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDgetrsBatched_bufferSize(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int                  n,
+                                                    int                  nrhs,
+                                                    hipsolverComplex*    A[],
+                                                    int                  lda,
+                                                    int                  stA,
+                                                    int*                 ipiv,
+                                                    int                  stP,
+                                                    hipsolverComplex*    B[],
+                                                    int                  ldb,
+                                                    int                  stB,
+                                                    int*                 lwork,
+                                                    int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCgetrsBatched_bufferSize(handle,
+                                                 trans,
+                                                 n,
+                                                 nrhs,
+                                                 (hipFloatComplex**)A,
+                                                 lda,
+                                                 ipiv,
+                                                 stP,
+                                                 (hipFloatComplex**)B,
+                                                 ldb,
+                                                 lwork,
+                                                 bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
                                                     hipsolverHandle_t       handle,
-                                                    hipsolverFillMode_t     uplo,
+                                                    hipsolverDnParams_t     params,
+                                                    hipsolverOperation_t    trans,
                                                     int                     n,
                                                     int                     nrhs,
                                                     hipsolverDoubleComplex* A[],
                                                     int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
                                                     hipsolverDoubleComplex* B[],
                                                     int                     ldb,
+                                                    int                     stB,
                                                     int*                    lwork,
                                                     int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZpotrsBatched_bufferSize(handle,
-                                                 uplo,
+        return hipsolverZgetrsBatched_bufferSize(handle,
+                                                 trans,
                                                  n,
                                                  nrhs,
                                                  (hipDoubleComplex**)A,
                                                  lda,
+                                                 ipiv,
+                                                 stP,
                                                  (hipDoubleComplex**)B,
                                                  ldb,
                                                  lwork,
                                                  bc);
-    case API_FORTRAN:
-        return hipsolverZpotrsBatched_bufferSizeFortran(handle,
-                                                        uplo,
-                                                        n,
-                                                        nrhs,
-                                                        (hipDoubleComplex**)A,
-                                                        lda,
-                                                        (hipDoubleComplex**)B,
-                                                        ldb,
-                                                        lwork,
-                                                        bc);
     default:
         *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         float*              A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         float*              B[],
-                                         int                 ldb,
-                                         int                 stB,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    float*               A[],
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    float*               B[],
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverSpotrsBatchedFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         double*             A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         double*             B[],
-                                         int                 ldb,
-                                         int                 stB,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    double*              A[],
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    double*              B[],
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_FORTRAN:
-        return hipsolverDpotrsBatchedFortran(
-            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
-    case API_COMPAT:
-        return hipsolverDnDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         int                 nrhs,
-                                         hipsolverComplex*   A[],
-                                         int                 lda,
-                                         int                 stA,
-                                         hipsolverComplex*   B[],
-                                         int                 ldb,
-                                         int                 stB,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t            API,
+                                                    bool                 STRIDED,
+                                                    hipsolverHandle_t    handle,
+                                                    hipsolverDnParams_t  params,
+                                                    hipsolverOperation_t trans,
+                                                    int64_t              n,
+                                                    int64_t              nrhs,
+                                                    hipsolverComplex*    A[],
+                                                    int64_t              lda,
+                                                    int64_t              stA,
+                                                    int64_t*             ipiv,
+                                                    int64_t              stP,
+                                                    hipsolverComplex*    B[],
+                                                    int64_t              ldb,
+                                                    int64_t              stB,
+                                                    size_t*              lwork,
+                                                    int                  bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverCpotrsBatched(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipFloatComplex**)A,
-                                      lda,
-                                      (hipFloatComplex**)B,
-                                      ldb,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      bc);
-    case API_FORTRAN:
-        return hipsolverCpotrsBatchedFortran(handle,
-                                             uplo,
-                                             n,
-                                             nrhs,
-                                             (hipFloatComplex**)A,
-                                             lda,
-                                             (hipFloatComplex**)B,
-                                             ldb,
-                                             (hipFloatComplex*)work,
-                                             lwork,
-                                             info,
-                                             bc);
-    case API_COMPAT:
-        return hipsolverDnCpotrsBatched(
-            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, info, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         int                     nrhs,
-                                         hipsolverDoubleComplex* A[],
-                                         int                     lda,
-                                         int                     stA,
-                                         hipsolverDoubleComplex* B[],
-                                         int                     ldb,
-                                         int                     stB,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverZpotrsBatched(handle,
-                                      uplo,
-                                      n,
-                                      nrhs,
-                                      (hipDoubleComplex**)A,
-                                      lda,
-                                      (hipDoubleComplex**)B,
-                                      ldb,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      bc);
-    case API_FORTRAN:
-        return hipsolverZpotrsBatchedFortran(handle,
-                                             uplo,
-                                             n,
-                                             nrhs,
-                                             (hipDoubleComplex**)A,
-                                             lda,
-                                             (hipDoubleComplex**)B,
-                                             ldb,
-                                             (hipDoubleComplex*)work,
-                                             lwork,
-                                             info,
-                                             bc);
-    case API_COMPAT:
-        return hipsolverDnZpotrsBatched(handle,
-                                        uplo,
-                                        n,
-                                        nrhs,
-                                        (hipDoubleComplex**)A,
-                                        lda,
-                                        (hipDoubleComplex**)B,
-                                        ldb,
-                                        info,
-                                        bc);
+inline hipsolverStatus_t hipsolver_getrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverDnParams_t     params,
+                                                    hipsolverOperation_t    trans,
+                                                    int64_t                 n,
+                                                    int64_t                 nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int64_t                 lda,
+                                                    int64_t                 stA,
+                                                    int64_t*                ipiv,
+                                                    int64_t                 stP,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int64_t                 ldb,
+                                                    int64_t                 stB,
+                                                    size_t*                 lwork,
+                                                    int                     bc)
+{
+    switch(API)
+    {
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYEVD/HEEVD ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A[],
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         float*               B[],
+                                         int                  ldb,
+                                         int                  stB,
+                                         float*               work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
-    case API_FORTRAN:
-        return hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork);
+        return hipsolverSgetrsBatched(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A[],
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         double*              B[],
+                                         int                  ldb,
+                                         int                  stB,
+                                         double*              work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork);
-    case API_FORTRAN:
-        return hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork);
+        return hipsolverDgetrsBatched(
+            handle, trans, n, nrhs, A, lda, ipiv, stP, B, ldb, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipsolverComplex*    A[],
+                                         int                  lda,
+                                         int                  stA,
+                                         int*                 ipiv,
+                                         int                  stP,
+                                         hipsolverComplex*    B[],
+                                         int                  ldb,
+                                         int                  stB,
+                                         hipsolverComplex*    work,
+                                         int                  lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverCheevd_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork);
-    case API_FORTRAN:
-        return hipsolverCheevd_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork);
+        return hipsolverCgetrsBatched(handle,
+                                      trans,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      ipiv,
+                                      stP,
+                                      (hipFloatComplex**)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverEigMode_t      jobz,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          double*                 W,
-                                                          int*                    lwork)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
+                                         hipsolverOperation_t    trans,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B[],
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZheevd_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork);
-    case API_FORTRAN:
-        return hipsolverZheevd_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork);
+        return hipsolverZgetrsBatched(handle,
+                                      trans,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      ipiv,
+                                      stP,
+                                      (hipDoubleComplex**)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              W,
-                                               int                 stW,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         float*               A[],
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         float*               B[],
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         float*               work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverSsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSsyevdFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               int                 stA,
-                                               double*             W,
-                                               int                 stW,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         double*              A[],
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         double*              B[],
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         double*              work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverDsyevd(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDsyevdFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              W,
-                                               int                 stW,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t            API,
+                                         bool                 STRIDED,
+                                         hipsolverHandle_t    handle,
+                                         hipsolverDnParams_t  params,
+                                         hipsolverOperation_t trans,
+                                         int64_t              n,
+                                         int64_t              nrhs,
+                                         hipsolverComplex*    A[],
+                                         int64_t              lda,
+                                         int64_t              stA,
+                                         int64_t*             ipiv,
+                                         int64_t              stP,
+                                         hipsolverComplex*    B[],
+                                         int64_t              ldb,
+                                         int64_t              stB,
+                                         hipsolverComplex*    work,
+                                         size_t               lwork,
+                                         int*                 info,
+                                         int                  bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverCheevd(handle,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               W,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverCheevdFortran(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverEigMode_t      jobz,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               double*                 W,
-                                               int                     stW,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_getrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverDnParams_t     params,
+                                         hipsolverOperation_t    trans,
+                                         int64_t                 n,
+                                         int64_t                 nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         int64_t*                ipiv,
+                                         int64_t                 stP,
+                                         hipsolverDoubleComplex* B[],
+                                         int64_t                 ldb,
+                                         int64_t                 stB,
+                                         hipsolverDoubleComplex* work,
+                                         size_t                  lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
     switch(API)
     {
-    case API_NORMAL:
-        return hipsolverZheevd(handle,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               W,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverZheevdFortran(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
+
 /********************************************************/
 
-/******************** SYEVDX/HEEVDX ********************/
+/******************** POSV ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            float*              A,
-                                                            int                 lda,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnSsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    case C_NORMAL:
+        return hipsolverSposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSposvStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            double*             A,
-                                                            int                 lda,
-                                                            double              vl,
-                                                            double              vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            double*             W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnDsyevdx_bufferSize(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+    case C_NORMAL:
+        return hipsolverDposv_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDposvStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            hipsolverComplex*   A,
-                                                            int                 lda,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   hipsolverComplex*   B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipFloatComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnCheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipFloatComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
+    case C_NORMAL:
+        return hipsolverCposv_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverCposvStridedBatched_bufferSize(handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       (hipFloatComplex*)A,
+                                                       lda,
+                                                       stA,
+                                                       (hipFloatComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t               API,
-                                                            hipsolverHandle_t       handle,
-                                                            hipsolverEigMode_t      jobz,
-                                                            hipsolverEigRange_t     range,
-                                                            hipsolverFillMode_t     uplo,
-                                                            int                     n,
-                                                            hipsolverDoubleComplex* A,
-                                                            int                     lda,
-                                                            double                  vl,
-                                                            double                  vu,
-                                                            int                     il,
-                                                            int                     iu,
-                                                            int*                    nev,
-                                                            double*                 W,
-                                                            int*                    lwork)
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t               API,
+                                                   bool                    STRIDED,
+                                                   hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int                     stA,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   int                     stB,
+                                                   int*                    lwork,
+                                                   int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipDoubleComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnZheevdx_bufferSize(
-            handle, jobz, range, uplo, n, (hipDoubleComplex*)A, lda, vl, vu, il, iu, nev, W, lwork);
+    case C_NORMAL:
+        return hipsolverZposv_bufferSize(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZposvStridedBatched_bufferSize(handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       (hipDoubleComplex*)A,
+                                                       lda,
+                                                       stA,
+                                                       (hipDoubleComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 float*              A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 float               vl,
-                                                 float               vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 float*              W,
-                                                 int                 stW,
-                                                 float*              work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A,
+                                        int                 lda,
+                                        int                 stA,
+                                        float*              B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverSsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnSsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    case C_NORMAL:
+        return hipsolverSposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSposvStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 double*             A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 double              vl,
-                                                 double              vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 double*             W,
-                                                 int                 stW,
-                                                 double*             work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A,
+                                        int                 lda,
+                                        int                 stA,
+                                        double*             B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverDsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
-    case API_COMPAT:
-        return hipsolverDnDsyevdx(
-            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    case C_NORMAL:
+        return hipsolverDposv(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDposvStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, B, ldb, stB, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 hipsolverComplex*   A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 float               vl,
-                                                 float               vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 float*              W,
-                                                 int                 stW,
-                                                 hipsolverComplex*   work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipsolverComplex*   A,
+                                        int                 lda,
+                                        int                 stA,
+                                        hipsolverComplex*   B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        hipsolverComplex*   work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverCheevdx(handle,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipFloatComplex*)A,
-                                lda,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipFloatComplex*)work,
-                                lwork,
-                                info);
-    case API_COMPAT:
-        return hipsolverDnCheevdx(handle,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipFloatComplex*)A,
-                                  lda,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipFloatComplex*)work,
-                                  lwork,
-                                  info);
+    case C_NORMAL:
+        return hipsolverCposv(handle,
+                              uplo,
+                              n,
+                              nrhs,
+                              (hipFloatComplex*)A,
+                              lda,
+                              (hipFloatComplex*)B,
+                              ldb,
+                              (hipFloatComplex*)work,
+                              lwork,
+                              info);
+    case C_NORMAL_ALT:
+        return hipsolverCposvStridedBatched(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipFloatComplex*)A,
+                                            lda,
+                                            stA,
+                                            (hipFloatComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t               API,
-                                                 hipsolverHandle_t       handle,
-                                                 hipsolverEigMode_t      jobz,
-                                                 hipsolverEigRange_t     range,
-                                                 hipsolverFillMode_t     uplo,
-                                                 int                     n,
-                                                 hipsolverDoubleComplex* A,
-                                                 int                     lda,
-                                                 int                     stA,
-                                                 double                  vl,
-                                                 double                  vu,
-                                                 int                     il,
-                                                 int                     iu,
-                                                 int*                    nev,
-                                                 double*                 W,
-                                                 int                     stW,
-                                                 hipsolverDoubleComplex* work,
-                                                 int                     lwork,
-                                                 int*                    info,
-                                                 int                     bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t               API,
+                                        bool                    STRIDED,
+                                        hipsolverHandle_t       handle,
+                                        hipsolverFillMode_t     uplo,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        int                     stA,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info,
+                                        int                     bc)
 {
-    switch(API)
+    switch(api2marshal(API, STRIDED))
     {
-    case API_NORMAL:
-        return hipsolverZheevdx(handle,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipDoubleComplex*)A,
-                                lda,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipDoubleComplex*)work,
-                                lwork,
-                                info);
-    case API_COMPAT:
-        return hipsolverDnZheevdx(handle,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipDoubleComplex*)A,
-                                  lda,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipDoubleComplex*)work,
-                                  lwork,
-                                  info);
+    case C_NORMAL:
+        return hipsolverZposv(handle,
+                              uplo,
+                              n,
+                              nrhs,
+                              (hipDoubleComplex*)A,
+                              lda,
+                              (hipDoubleComplex*)B,
+                              ldb,
+                              (hipDoubleComplex*)work,
+                              lwork,
+                              info);
+    case C_NORMAL_ALT:
+        return hipsolverZposvStridedBatched(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipDoubleComplex*)A,
+                                            lda,
+                                            stA,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYEVJ/HEEVJ ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
-                                                          bool                 STRIDED,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          float*               A,
-                                                          int                  lda,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params,
-                                                          int                  bc)
+// batched
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A[],
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   float*              B[],
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case C_NORMAL_ALT:
-        return hipsolverSsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
-    case FORTRAN_NORMAL:
-        return hipsolverSsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverSsyevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnSsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case API_NORMAL:
+        return hipsolverSposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
-                                                          bool                 STRIDED,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          double*              A,
-                                                          int                  lda,
-                                                          double*              W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params,
-                                                          int                  bc)
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A[],
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   double*             B[],
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case C_NORMAL_ALT:
-        return hipsolverDsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
-    case FORTRAN_NORMAL:
-        return hipsolverDsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverDsyevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnDsyevjBatched_bufferSize(
-            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case API_NORMAL:
+        return hipsolverDposvBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
-                                                          bool                 STRIDED,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          hipsolverComplex*    A,
-                                                          int                  lda,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params,
-                                                          int                  bc)
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   A[],
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   hipsolverComplex*   B[],
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverCheevj_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
-    case C_NORMAL_ALT:
-        return hipsolverCheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
-    case FORTRAN_NORMAL:
-        return hipsolverCheevj_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverCheevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnCheevj_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnCheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+    case API_NORMAL:
+        return hipsolverCposvBatched_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t               API,
-                                                          bool                    STRIDED,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverEigMode_t      jobz,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          double*                 W,
-                                                          int*                    lwork,
-                                                          hipsolverSyevjInfo_t    params,
-                                                          int                     bc)
+inline hipsolverStatus_t hipsolver_posv_bufferSize(testAPI_t               API,
+                                                   bool                    STRIDED,
+                                                   hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A[],
+                                                   int                     lda,
+                                                   int                     stA,
+                                                   hipsolverDoubleComplex* B[],
+                                                   int                     ldb,
+                                                   int                     stB,
+                                                   int*                    lwork,
+                                                   int                     bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverZheevj_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
-    case C_NORMAL_ALT:
-        return hipsolverZheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
-    case FORTRAN_NORMAL:
-        return hipsolverZheevj_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverZheevjBatched_bufferSizeFortran(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnZheevj_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnZheevjBatched_bufferSize(
-            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+    case API_NORMAL:
+        return hipsolverZposvBatched_bufferSize(handle,
+                                                uplo,
+                                                n,
+                                                nrhs,
+                                                (hipDoubleComplex**)A,
+                                                lda,
+                                                (hipDoubleComplex**)B,
+                                                ldb,
+                                                lwork,
+                                                bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
-                                               bool                 STRIDED,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               float*               A,
-                                               int                  lda,
-                                               int                  stA,
-                                               float*               W,
-                                               int                  stW,
-                                               float*               work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A[],
+                                        int                 lda,
+                                        int                 stA,
+                                        float*              B[],
+                                        int                 ldb,
+                                        int                 stB,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case C_NORMAL_ALT:
-        return hipsolverSsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
-    case FORTRAN_NORMAL:
-        return hipsolverSsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverSsyevjBatchedFortran(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnSsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case API_NORMAL:
+        return hipsolverSposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
-                                               bool                 STRIDED,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               double*              A,
-                                               int                  lda,
-                                               int                  stA,
-                                               double*              W,
-                                               int                  stW,
-                                               double*              work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A[],
+                                        int                 lda,
+                                        int                 stA,
+                                        double*             B[],
+                                        int                 ldb,
+                                        int                 stB,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case C_NORMAL_ALT:
-        return hipsolverDsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
-    case FORTRAN_NORMAL:
-        return hipsolverDsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverDsyevjBatchedFortran(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnDsyevjBatched(
-            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case API_NORMAL:
+        return hipsolverDposvBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
-                                               bool                 STRIDED,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               hipsolverComplex*    A,
-                                               int                  lda,
-                                               int                  stA,
-                                               float*               W,
-                                               int                  stW,
-                                               hipsolverComplex*    work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipsolverComplex*   A[],
+                                        int                 lda,
+                                        int                 stA,
+                                        hipsolverComplex*   B[],
+                                        int                 ldb,
+                                        int                 stB,
+                                        hipsolverComplex*   work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverCheevj(handle,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               W,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info,
-                               params);
-    case C_NORMAL_ALT:
-        return hipsolverCheevjBatched(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      params,
-                                      bc);
-    case FORTRAN_NORMAL:
-        return hipsolverCheevjFortran(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverCheevjBatchedFortran(handle,
-                                             jobz,
-                                             uplo,
-                                             n,
-                                             (hipFloatComplex*)A,
-                                             lda,
-                                             W,
-                                             (hipFloatComplex*)work,
-                                             lwork,
-                                             info,
-                                             params,
-                                             bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnCheevj(handle,
-                                 jobz,
-                                 uplo,
-                                 n,
-                                 (hipFloatComplex*)A,
-                                 lda,
-                                 W,
-                                 (hipFloatComplex*)work,
-                                 lwork,
-                                 info,
-                                 params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnCheevjBatched(handle,
-                                        jobz,
-                                        uplo,
-                                        n,
-                                        (hipFloatComplex*)A,
-                                        lda,
-                                        W,
-                                        (hipFloatComplex*)work,
-                                        lwork,
-                                        info,
-                                        params,
-                                        bc);
+    case API_NORMAL:
+        return hipsolverCposvBatched(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     (hipFloatComplex**)A,
+                                     lda,
+                                     (hipFloatComplex**)B,
+                                     ldb,
+                                     (hipFloatComplex*)work,
+                                     lwork,
+                                     info,
+                                     bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t               API,
-                                               bool                    STRIDED,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverEigMode_t      jobz,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               double*                 W,
-                                               int                     stW,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               hipsolverSyevjInfo_t    params,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_posv(testAPI_t               API,
+                                        bool                    STRIDED,
+                                        hipsolverHandle_t       handle,
+                                        hipsolverFillMode_t     uplo,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A[],
+                                        int                     lda,
+                                        int                     stA,
+                                        hipsolverDoubleComplex* B[],
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info,
+                                        int                     bc)
 {
-    switch(api2marshal(API, STRIDED))
+    switch(API)
     {
-    case C_NORMAL:
-        return hipsolverZheevj(handle,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               W,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info,
-                               params);
-    case C_NORMAL_ALT:
-        return hipsolverZheevjBatched(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      params,
-                                      bc);
-    case FORTRAN_NORMAL:
-        return hipsolverZheevjFortran(handle,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case FORTRAN_NORMAL_ALT:
-        return hipsolverZheevjBatchedFortran(handle,
-                                             jobz,
-                                             uplo,
-                                             n,
-                                             (hipDoubleComplex*)A,
-                                             lda,
-                                             W,
-                                             (hipDoubleComplex*)work,
-                                             lwork,
-                                             info,
-                                             params,
-                                             bc);
-    case COMPAT_NORMAL:
-        return hipsolverDnZheevj(handle,
-                                 jobz,
-                                 uplo,
-                                 n,
-                                 (hipDoubleComplex*)A,
-                                 lda,
-                                 W,
-                                 (hipDoubleComplex*)work,
-                                 lwork,
-                                 info,
-                                 params);
-    case COMPAT_NORMAL_ALT:
-        return hipsolverDnZheevjBatched(handle,
-                                        jobz,
-                                        uplo,
-                                        n,
-                                        (hipDoubleComplex*)A,
-                                        lda,
-                                        W,
-                                        (hipDoubleComplex*)work,
-                                        lwork,
-                                        info,
-                                        params,
-                                        bc);
+    case API_NORMAL:
+        return hipsolverZposvBatched(handle,
+                                     uplo,
+                                     n,
+                                     nrhs,
+                                     (hipDoubleComplex**)A,
+                                     lda,
+                                     (hipDoubleComplex**)B,
+                                     ldb,
+                                     (hipDoubleComplex*)work,
+                                     lwork,
+                                     info,
+                                     bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYGVD/HEGVD ********************/
+/******************** POTRF ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              B,
-                                                          int                 ldb,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+        return hipsolverSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverSsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+        return hipsolverSpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnSpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             B,
-                                                          int                 ldb,
-                                                          double*             W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+        return hipsolverDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverDsygvd_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+        return hipsolverDpotrf_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnDpotrf_bufferSize(handle, uplo, n, A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverEigType_t  itype,
-                                                          hipsolverEigMode_t  jobz,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          hipsolverComplex*   B,
-                                                          int                 ldb,
-                                                          float*              W,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvd_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork);
+        return hipsolverCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverChegvd_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork);
+        return hipsolverCpotrf_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnCpotrf_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverEigType_t      itype,
-                                                          hipsolverEigMode_t      jobz,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          hipsolverDoubleComplex* B,
-                                                          int                     ldb,
-                                                          double*                 W,
-                                                          int*                    lwork)
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZhegvd_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork);
+        return hipsolverZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverZhegvd_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork);
+        return hipsolverZpotrf_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
+    case API_COMPAT:
+        return hipsolverDnZpotrf_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              B,
-                                               int                 ldb,
-                                               int                 stB,
-                                               float*              W,
-                                               int                 stW,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+        return hipsolverSpotrf(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverSsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+        return hipsolverSpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnSpotrf(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               int                 stA,
-                                               double*             B,
-                                               int                 ldb,
-                                               int                 stB,
-                                               double*             W,
-                                               int                 stW,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+        return hipsolverDpotrf(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverDsygvdFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+        return hipsolverDpotrfFortran(handle, uplo, n, A, lda, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnDpotrf(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverEigType_t  itype,
-                                               hipsolverEigMode_t  jobz,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               int                 stA,
-                                               hipsolverComplex*   B,
-                                               int                 ldb,
-                                               int                 stB,
-                                               float*              W,
-                                               int                 stW,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvd(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               W,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
+        return hipsolverCpotrf(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverChegvdFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
+        return hipsolverCpotrfFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnCpotrf(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverEigType_t      itype,
-                                               hipsolverEigMode_t      jobz,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               hipsolverDoubleComplex* B,
-                                               int                     ldb,
-                                               int                     stB,
-                                               double*                 W,
-                                               int                     stW,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZhegvd(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               W,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
+        return hipsolverZpotrf(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverZhegvdFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
+        return hipsolverZpotrfFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnZpotrf(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYGVDX/HEGVDX ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigType_t  itype,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            float*              A,
-                                                            int                 lda,
-                                                            float*              B,
-                                                            int                 ldb,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+// batched
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnSsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+        return hipsolverSpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigType_t  itype,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            double*             A,
-                                                            int                 lda,
-                                                            double*             B,
-                                                            int                 ldb,
-                                                            double              vl,
-                                                            double              vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            double*             W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
-    case API_COMPAT:
-        return hipsolverDnDsygvdx_bufferSize(
-            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+        return hipsolverDpotrfBatched_bufferSize(handle, uplo, n, A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfBatched_bufferSizeFortran(handle, uplo, n, A, lda, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
-                                                            hipsolverHandle_t   handle,
-                                                            hipsolverEigType_t  itype,
-                                                            hipsolverEigMode_t  jobz,
-                                                            hipsolverEigRange_t range,
-                                                            hipsolverFillMode_t uplo,
-                                                            int                 n,
-                                                            hipsolverComplex*   A,
-                                                            int                 lda,
-                                                            hipsolverComplex*   B,
-                                                            int                 ldb,
-                                                            float               vl,
-                                                            float               vu,
-                                                            int                 il,
-                                                            int                 iu,
-                                                            int*                nev,
-                                                            float*              W,
-                                                            int*                lwork)
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    int*                lwork,
+                                                    int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvdx_bufferSize(handle,
-                                           itype,
-                                           jobz,
-                                           range,
-                                           uplo,
-                                           n,
-                                           (hipFloatComplex*)A,
-                                           lda,
-                                           (hipFloatComplex*)B,
-                                           ldb,
-                                           vl,
-                                           vu,
-                                           il,
-                                           iu,
-                                           nev,
-                                           W,
-                                           lwork);
-    case API_COMPAT:
-        return hipsolverDnChegvdx_bufferSize(handle,
-                                             itype,
-                                             jobz,
-                                             range,
-                                             uplo,
-                                             n,
-                                             (hipFloatComplex*)A,
-                                             lda,
-                                             (hipFloatComplex*)B,
-                                             ldb,
-                                             vl,
-                                             vu,
-                                             il,
-                                             iu,
-                                             nev,
-                                             W,
-                                             lwork);
+        return hipsolverCpotrfBatched_bufferSize(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfBatched_bufferSizeFortran(
+            handle, uplo, n, (hipFloatComplex**)A, lda, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t               API,
-                                                            hipsolverHandle_t       handle,
-                                                            hipsolverEigType_t      itype,
-                                                            hipsolverEigMode_t      jobz,
-                                                            hipsolverEigRange_t     range,
-                                                            hipsolverFillMode_t     uplo,
-                                                            int                     n,
-                                                            hipsolverDoubleComplex* A,
-                                                            int                     lda,
-                                                            hipsolverDoubleComplex* B,
-                                                            int                     ldb,
-                                                            double                  vl,
-                                                            double                  vu,
-                                                            int                     il,
-                                                            int                     iu,
-                                                            int*                    nev,
-                                                            double*                 W,
-                                                            int*                    lwork)
+inline hipsolverStatus_t hipsolver_potrf_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    int*                    lwork,
+                                                    int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZhegvdx_bufferSize(handle,
-                                           itype,
-                                           jobz,
-                                           range,
-                                           uplo,
-                                           n,
-                                           (hipDoubleComplex*)A,
-                                           lda,
-                                           (hipDoubleComplex*)B,
-                                           ldb,
-                                           vl,
-                                           vu,
-                                           il,
-                                           iu,
-                                           nev,
-                                           W,
-                                           lwork);
-    case API_COMPAT:
-        return hipsolverDnZhegvdx_bufferSize(handle,
-                                             itype,
-                                             jobz,
-                                             range,
-                                             uplo,
-                                             n,
-                                             (hipDoubleComplex*)A,
-                                             lda,
-                                             (hipDoubleComplex*)B,
-                                             ldb,
-                                             vl,
-                                             vu,
-                                             il,
-                                             iu,
-                                             nev,
-                                             W,
-                                             lwork);
+        return hipsolverZpotrfBatched_bufferSize(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfBatched_bufferSizeFortran(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, lwork, bc);
     default:
+        *lwork = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigType_t  itype,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 float*              A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 float*              B,
-                                                 int                 ldb,
-                                                 int                 stB,
-                                                 float               vl,
-                                                 float               vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 float*              W,
-                                                 int                 stW,
-                                                 float*              work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                A,
-                                lda,
-                                B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                work,
-                                lwork,
-                                info);
+        return hipsolverSpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnSsygvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  A,
-                                  lda,
-                                  B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  work,
-                                  lwork,
-                                  info);
+        return hipsolverDnSpotrfBatched(handle, uplo, n, A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigType_t  itype,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 double*             A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 double*             B,
-                                                 int                 ldb,
-                                                 int                 stB,
-                                                 double              vl,
-                                                 double              vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 double*             W,
-                                                 int                 stW,
-                                                 double*             work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsygvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                A,
-                                lda,
-                                B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                work,
-                                lwork,
-                                info);
+        return hipsolverDpotrfBatched(handle, uplo, n, A, lda, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrfBatchedFortran(handle, uplo, n, A, lda, work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnDsygvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  A,
-                                  lda,
-                                  B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  work,
-                                  lwork,
-                                  info);
+        return hipsolverDnDpotrfBatched(handle, uplo, n, A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
-                                                 hipsolverHandle_t   handle,
-                                                 hipsolverEigType_t  itype,
-                                                 hipsolverEigMode_t  jobz,
-                                                 hipsolverEigRange_t range,
-                                                 hipsolverFillMode_t uplo,
-                                                 int                 n,
-                                                 hipsolverComplex*   A,
-                                                 int                 lda,
-                                                 int                 stA,
-                                                 hipsolverComplex*   B,
-                                                 int                 ldb,
-                                                 int                 stB,
-                                                 float               vl,
-                                                 float               vu,
-                                                 int                 il,
-                                                 int                 iu,
-                                                 int*                nev,
-                                                 float*              W,
-                                                 int                 stW,
-                                                 hipsolverComplex*   work,
-                                                 int                 lwork,
-                                                 int*                info,
-                                                 int                 bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipFloatComplex*)A,
-                                lda,
-                                (hipFloatComplex*)B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipFloatComplex*)work,
-                                lwork,
-                                info);
+        return hipsolverCpotrfBatched(
+            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrfBatchedFortran(
+            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex*)work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnChegvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipFloatComplex*)A,
-                                  lda,
-                                  (hipFloatComplex*)B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipFloatComplex*)work,
-                                  lwork,
-                                  info);
+        return hipsolverDnCpotrfBatched(handle, uplo, n, (hipFloatComplex**)A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t               API,
-                                                 hipsolverHandle_t       handle,
-                                                 hipsolverEigType_t      itype,
-                                                 hipsolverEigMode_t      jobz,
-                                                 hipsolverEigRange_t     range,
-                                                 hipsolverFillMode_t     uplo,
-                                                 int                     n,
-                                                 hipsolverDoubleComplex* A,
-                                                 int                     lda,
-                                                 int                     stA,
-                                                 hipsolverDoubleComplex* B,
-                                                 int                     ldb,
-                                                 int                     stB,
-                                                 double                  vl,
-                                                 double                  vu,
-                                                 int                     il,
-                                                 int                     iu,
-                                                 int*                    nev,
-                                                 double*                 W,
-                                                 int                     stW,
-                                                 hipsolverDoubleComplex* work,
-                                                 int                     lwork,
-                                                 int*                    info,
-                                                 int                     bc)
+inline hipsolverStatus_t hipsolver_potrf(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZhegvdx(handle,
-                                itype,
-                                jobz,
-                                range,
-                                uplo,
-                                n,
-                                (hipDoubleComplex*)A,
-                                lda,
-                                (hipDoubleComplex*)B,
-                                ldb,
-                                vl,
-                                vu,
-                                il,
-                                iu,
-                                nev,
-                                W,
-                                (hipDoubleComplex*)work,
-                                lwork,
-                                info);
+        return hipsolverZpotrfBatched(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverZpotrfBatchedFortran(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex*)work, lwork, info, bc);
     case API_COMPAT:
-        return hipsolverDnZhegvdx(handle,
-                                  itype,
-                                  jobz,
-                                  range,
-                                  uplo,
-                                  n,
-                                  (hipDoubleComplex*)A,
-                                  lda,
-                                  (hipDoubleComplex*)B,
-                                  ldb,
-                                  vl,
-                                  vu,
-                                  il,
-                                  iu,
-                                  nev,
-                                  W,
-                                  (hipDoubleComplex*)work,
-                                  lwork,
-                                  info);
+        return hipsolverDnZpotrfBatched(handle, uplo, n, (hipDoubleComplex**)A, lda, info, bc);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** SYGVJ/HEGVJ ********************/
+/******************** POTRI ********************/
 // normal and strided_batched
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigType_t   itype,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          float*               A,
-                                                          int                  lda,
-                                                          float*               B,
-                                                          int                  ldb,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params)
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+        return hipsolverSpotri_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverSsygvj_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-    case API_COMPAT:
-        return hipsolverDnSsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+        return hipsolverSpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigType_t   itype,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          double*              A,
-                                                          int                  lda,
-                                                          double*              B,
-                                                          int                  ldb,
-                                                          double*              W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params)
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+        return hipsolverDpotri_bufferSize(handle, uplo, n, A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverDsygvj_bufferSizeFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
-    case API_COMPAT:
-        return hipsolverDnDsygvj_bufferSize(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+        return hipsolverDpotri_bufferSizeFortran(handle, uplo, n, A, lda, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
-                                                          hipsolverHandle_t    handle,
-                                                          hipsolverEigType_t   itype,
-                                                          hipsolverEigMode_t   jobz,
-                                                          hipsolverFillMode_t  uplo,
-                                                          int                  n,
-                                                          hipsolverComplex*    A,
-                                                          int                  lda,
-                                                          hipsolverComplex*    B,
-                                                          int                  ldb,
-                                                          float*               W,
-                                                          int*                 lwork,
-                                                          hipsolverSyevjInfo_t params)
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int*                lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvj_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipFloatComplex*)A,
-                                          lda,
-                                          (hipFloatComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork,
-                                          params);
+        return hipsolverCpotri_bufferSize(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverChegvj_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipFloatComplex*)A,
-                                                 lda,
-                                                 (hipFloatComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork,
-                                                 params);
-    case API_COMPAT:
-        return hipsolverDnChegvj_bufferSize(handle,
-                                            itype,
-                                            jobz,
-                                            uplo,
-                                            n,
-                                            (hipFloatComplex*)A,
-                                            lda,
-                                            (hipFloatComplex*)B,
-                                            ldb,
-                                            W,
-                                            lwork,
-                                            params);
+        return hipsolverCpotri_bufferSizeFortran(handle, uplo, n, (hipFloatComplex*)A, lda, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverEigType_t      itype,
-                                                          hipsolverEigMode_t      jobz,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          hipsolverDoubleComplex* B,
-                                                          int                     ldb,
-                                                          double*                 W,
-                                                          int*                    lwork,
-                                                          hipsolverSyevjInfo_t    params)
+inline hipsolverStatus_t hipsolver_potri_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int*                    lwork)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverZhegvj_bufferSize(handle,
-                                          itype,
-                                          jobz,
-                                          uplo,
-                                          n,
-                                          (hipDoubleComplex*)A,
-                                          lda,
-                                          (hipDoubleComplex*)B,
-                                          ldb,
-                                          W,
-                                          lwork,
-                                          params);
+        return hipsolverZpotri_bufferSize(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     case API_FORTRAN:
-        return hipsolverZhegvj_bufferSizeFortran(handle,
-                                                 itype,
-                                                 jobz,
-                                                 uplo,
-                                                 n,
-                                                 (hipDoubleComplex*)A,
-                                                 lda,
-                                                 (hipDoubleComplex*)B,
-                                                 ldb,
-                                                 W,
-                                                 lwork,
-                                                 params);
-    case API_COMPAT:
-        return hipsolverDnZhegvj_bufferSize(handle,
-                                            itype,
-                                            jobz,
-                                            uplo,
-                                            n,
-                                            (hipDoubleComplex*)A,
-                                            lda,
-                                            (hipDoubleComplex*)B,
-                                            ldb,
-                                            W,
-                                            lwork,
-                                            params);
+        return hipsolverZpotri_bufferSizeFortran(handle, uplo, n, (hipDoubleComplex*)A, lda, lwork);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigType_t   itype,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               float*               A,
-                                               int                  lda,
-                                               int                  stA,
-                                               float*               B,
-                                               int                  ldb,
-                                               int                  stB,
-                                               float*               W,
-                                               int                  stW,
-                                               float*               work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverSsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+        return hipsolverSpotri(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverSsygvjFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-    case API_COMPAT:
-        return hipsolverDnSsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+        return hipsolverSpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigType_t   itype,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               double*              A,
-                                               int                  lda,
-                                               int                  stA,
-                                               double*              B,
-                                               int                  ldb,
-                                               int                  stB,
-                                               double*              W,
-                                               int                  stW,
-                                               double*              work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverDsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+        return hipsolverDpotri(handle, uplo, n, A, lda, work, lwork, info);
     case API_FORTRAN:
-        return hipsolverDsygvjFortran(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
-    case API_COMPAT:
-        return hipsolverDnDsygvj(
-            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+        return hipsolverDpotriFortran(handle, uplo, n, A, lda, work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
-                                               hipsolverHandle_t    handle,
-                                               hipsolverEigType_t   itype,
-                                               hipsolverEigMode_t   jobz,
-                                               hipsolverFillMode_t  uplo,
-                                               int                  n,
-                                               hipsolverComplex*    A,
-                                               int                  lda,
-                                               int                  stA,
-                                               hipsolverComplex*    B,
-                                               int                  ldb,
-                                               int                  stB,
-                                               float*               W,
-                                               int                  stW,
-                                               hipsolverComplex*    work,
-                                               int                  lwork,
-                                               int*                 info,
-                                               hipsolverSyevjInfo_t params,
-                                               int                  bc)
+inline hipsolverStatus_t hipsolver_potri(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
 {
     switch(API)
     {
     case API_NORMAL:
-        return hipsolverChegvj(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               (hipFloatComplex*)B,
-                               ldb,
-                               W,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info,
-                               params);
+        return hipsolverCpotri(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverChegvjFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      (hipFloatComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case API_COMPAT:
-        return hipsolverDnChegvj(handle,
-                                 itype,
-                                 jobz,
-                                 uplo,
-                                 n,
-                                 (hipFloatComplex*)A,
-                                 lda,
-                                 (hipFloatComplex*)B,
-                                 ldb,
-                                 W,
-                                 (hipFloatComplex*)work,
-                                 lwork,
-                                 info,
-                                 params);
+        return hipsolverCpotriFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, (hipFloatComplex*)work, lwork, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverEigType_t      itype,
-                                               hipsolverEigMode_t      jobz,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               hipsolverDoubleComplex* B,
-                                               int                     ldb,
-                                               int                     stB,
-                                               double*                 W,
-                                               int                     stW,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               hipsolverSyevjInfo_t    params,
-                                               int                     bc)
-{
-    switch(API)
-    {
-    case API_NORMAL:
-        return hipsolverZhegvj(handle,
-                               itype,
-                               jobz,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               (hipDoubleComplex*)B,
-                               ldb,
-                               W,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info,
-                               params);
+inline hipsolverStatus_t hipsolver_potri(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotri(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
     case API_FORTRAN:
-        return hipsolverZhegvjFortran(handle,
-                                      itype,
-                                      jobz,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      (hipDoubleComplex*)B,
-                                      ldb,
-                                      W,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info,
-                                      params);
-    case API_COMPAT:
-        return hipsolverDnZhegvj(handle,
-                                 itype,
-                                 jobz,
+        return hipsolverZpotriFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRI_BATCHED ********************/
+// strided_batched
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            float*              C,
+                                                            int                 ldc,
+                                                            int                 stC,
+                                                            int*                lwork,
+                                                            int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotriStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, C, ldc, stC, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            double*             C,
+                                                            int                 ldc,
+                                                            int                 stC,
+                                                            int*                lwork,
+                                                            int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotriStridedBatched_bufferSize(
+            handle, uplo, n, A, lda, stA, C, ldc, stC, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            hipsolverComplex*   C,
+                                                            int                 ldc,
+                                                            int                 stC,
+                                                            int*                lwork,
+                                                            int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotriStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        (hipFloatComplex*)C,
+                                                        ldc,
+                                                        stC,
+                                                        lwork,
+                                                        bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t               API,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            int                     stA,
+                                                            hipsolverDoubleComplex* C,
+                                                            int                     ldc,
+                                                            int                     stC,
+                                                            int*                    lwork,
+                                                            int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotriStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        (hipDoubleComplex*)C,
+                                                        ldc,
+                                                        stC,
+                                                        lwork,
+                                                        bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float*              C,
+                                                 int                 ldc,
+                                                 int                 stC,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotriStridedBatched(
+            handle, uplo, n, A, lda, stA, C, ldc, stC, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 double*             C,
+                                                 int                 ldc,
+                                                 int                 stC,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotriStridedBatched(
+            handle, uplo, n, A, lda, stA, C, ldc, stC, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 hipsolverComplex*   C,
+                                                 int                 ldc,
+                                                 int                 stC,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotriStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipFloatComplex*)C,
+                                             ldc,
+                                             stC,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t               API,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     stA,
+                                                 hipsolverDoubleComplex* C,
+                                                 int                     ldc,
+                                                 int                     stC,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    info,
+                                                 int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotriStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipDoubleComplex*)C,
+                                             ldc,
+                                             stC,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A[],
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            float*              C[],
+                                                            int                 ldc,
+                                                            int                 stC,
+                                                            int*                lwork,
+                                                            int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotriBatched_bufferSize(handle, uplo, n, A, lda, C, ldc, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A[],
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            double*             C[],
+                                                            int                 ldc,
+                                                            int                 stC,
+                                                            int*                lwork,
+                                                            int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotriBatched_bufferSize(handle, uplo, n, A, lda, C, ldc, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A[],
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            hipsolverComplex*   C[],
+                                                            int                 ldc,
+                                                            int                 stC,
+                                                            int*                lwork,
+                                                            int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotriBatched_bufferSize(
+            handle, uplo, n, (hipFloatComplex**)A, lda, (hipFloatComplex**)C, ldc, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched_bufferSize(testAPI_t               API,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A[],
+                                                            int                     lda,
+                                                            int                     stA,
+                                                            hipsolverDoubleComplex* C[],
+                                                            int                     ldc,
+                                                            int                     stC,
+                                                            int*                    lwork,
+                                                            int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotriBatched_bufferSize(
+            handle, uplo, n, (hipDoubleComplex**)A, lda, (hipDoubleComplex**)C, ldc, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A[],
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float*              C[],
+                                                 int                 ldc,
+                                                 int                 stC,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotriBatched(handle, uplo, n, A, lda, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A[],
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 double*             C[],
+                                                 int                 ldc,
+                                                 int                 stC,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotriBatched(handle, uplo, n, A, lda, C, ldc, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A[],
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 hipsolverComplex*   C[],
+                                                 int                 ldc,
+                                                 int                 stC,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotriBatched(handle,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      (hipFloatComplex**)C,
+                                      ldc,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potri_batched(testAPI_t               API,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A[],
+                                                 int                     lda,
+                                                 int                     stA,
+                                                 hipsolverDoubleComplex* C[],
+                                                 int                     ldc,
+                                                 int                     stC,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    info,
+                                                 int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotriBatched(handle,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      (hipDoubleComplex**)C,
+                                      ldc,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** POTRS ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverSpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrs_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverDpotrs_bufferSizeFortran(handle, uplo, n, nrhs, A, lda, B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrs_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverCpotrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrs_bufferSize(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    case API_FORTRAN:
+        return hipsolverZpotrs_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, lwork);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnSpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDpotrsFortran(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info);
+    case API_COMPAT:
+        return hipsolverDnDpotrs(handle, uplo, n, nrhs, A, lda, B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverCpotrsFortran(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    case API_COMPAT:
+        return hipsolverDnCpotrs(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, (hipFloatComplex*)B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverZpotrsFortran(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    case API_COMPAT:
+        return hipsolverDnZpotrs(
+            handle, uplo, n, nrhs, (hipDoubleComplex*)A, lda, (hipDoubleComplex*)B, ldb, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A[],
+                                                    int                 lda,
+                                                    float*              B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A[],
+                                                    int                 lda,
+                                                    double*             B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrsBatched_bufferSize(handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A[],
+                                                    int                 lda,
+                                                    hipsolverComplex*   B[],
+                                                    int                 ldb,
+                                                    int*                lwork,
+                                                    int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrsBatched_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsBatched_bufferSizeFortran(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A[],
+                                                    int                     lda,
+                                                    hipsolverDoubleComplex* B[],
+                                                    int                     ldb,
+                                                    int*                    lwork,
+                                                    int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrsBatched_bufferSize(handle,
+                                                 uplo,
+                                                 n,
+                                                 nrhs,
+                                                 (hipDoubleComplex**)A,
+                                                 lda,
+                                                 (hipDoubleComplex**)B,
+                                                 ldb,
+                                                 lwork,
+                                                 bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsBatched_bufferSizeFortran(handle,
+                                                        uplo,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex**)A,
+                                                        lda,
+                                                        (hipDoubleComplex**)B,
+                                                        ldb,
+                                                        lwork,
+                                                        bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         float*              B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverSpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnSpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         double*             B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_FORTRAN:
+        return hipsolverDpotrsBatchedFortran(
+            handle, uplo, n, nrhs, A, lda, B, ldb, work, lwork, info, bc);
+    case API_COMPAT:
+        return hipsolverDnDpotrsBatched(handle, uplo, n, nrhs, A, lda, B, ldb, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A[],
+                                         int                 lda,
+                                         int                 stA,
+                                         hipsolverComplex*   B[],
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCpotrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipFloatComplex**)A,
+                                      lda,
+                                      (hipFloatComplex**)B,
+                                      ldb,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    case API_FORTRAN:
+        return hipsolverCpotrsBatchedFortran(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex**)A,
+                                             lda,
+                                             (hipFloatComplex**)B,
+                                             ldb,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case API_COMPAT:
+        return hipsolverDnCpotrsBatched(
+            handle, uplo, n, nrhs, (hipFloatComplex**)A, lda, (hipFloatComplex**)B, ldb, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_potrs(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A[],
+                                         int                     lda,
+                                         int                     stA,
+                                         hipsolverDoubleComplex* B[],
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZpotrsBatched(handle,
+                                      uplo,
+                                      n,
+                                      nrhs,
+                                      (hipDoubleComplex**)A,
+                                      lda,
+                                      (hipDoubleComplex**)B,
+                                      ldb,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      bc);
+    case API_FORTRAN:
+        return hipsolverZpotrsBatchedFortran(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex**)A,
+                                             lda,
+                                             (hipDoubleComplex**)B,
+                                             ldb,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case API_COMPAT:
+        return hipsolverDnZpotrsBatched(handle,
+                                        uplo,
+                                        n,
+                                        nrhs,
+                                        (hipDoubleComplex**)A,
+                                        lda,
+                                        (hipDoubleComplex**)B,
+                                        ldb,
+                                        info,
+                                        bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYEVD/HEEVD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverDnParams_t params,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lworkOnDevice,
+                                                          int*                lworkOnHost,
+                                                          int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverDnParams_t params,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             W,
+                                                          int                 stW,
+                                                          int*                lworkOnDevice,
+                                                          int*                lworkOnHost,
+                                                          int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevd_bufferSize(handle, jobz, uplo, n, A, lda, W, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevd_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverDnParams_t params,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lworkOnDevice,
+                                                          int*                lworkOnHost,
+                                                          int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevd_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverCheevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, stA, W, stW, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevd_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t               API,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverDnParams_t     params,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          double*                 W,
+                                                          int                     stW,
+                                                          int*                    lworkOnDevice,
+                                                          int*                    lworkOnHost,
+                                                          int                     bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevd_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverZheevdStridedBatched_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, stA, W, stW, lworkOnDevice, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevd_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverDnParams_t params,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int64_t             n,
+                                                          float*              A,
+                                                          int64_t             lda,
+                                                          int64_t             stA,
+                                                          float*              W,
+                                                          int64_t             stW,
+                                                          size_t*             lworkOnDevice,
+                                                          size_t*             lworkOnHost,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd_bufferSize(handle,
+                                            params,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            HIP_R_32F,
+                                            A,
+                                            lda,
+                                            HIP_R_32F,
+                                            W,
+                                            HIP_R_32F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverDnParams_t params,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int64_t             n,
+                                                          double*             A,
+                                                          int64_t             lda,
+                                                          int64_t             stA,
+                                                          double*             W,
+                                                          int64_t             stW,
+                                                          size_t*             lworkOnDevice,
+                                                          size_t*             lworkOnHost,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd_bufferSize(handle,
+                                            params,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            HIP_R_64F,
+                                            A,
+                                            lda,
+                                            HIP_R_64F,
+                                            W,
+                                            HIP_R_64F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverDnParams_t params,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int64_t             n,
+                                                          hipsolverComplex*   A,
+                                                          int64_t             lda,
+                                                          int64_t             stA,
+                                                          float*              W,
+                                                          int64_t             stW,
+                                                          size_t*             lworkOnDevice,
+                                                          size_t*             lworkOnHost,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd_bufferSize(handle,
+                                            params,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            HIP_C_32F,
+                                            A,
+                                            lda,
+                                            HIP_R_32F,
+                                            W,
+                                            HIP_C_32F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd_bufferSize(testAPI_t               API,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverDnParams_t     params,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int64_t                 n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int64_t                 lda,
+                                                          int64_t                 stA,
+                                                          double*                 W,
+                                                          int64_t                 stW,
+                                                          size_t*                 lworkOnDevice,
+                                                          size_t*                 lworkOnHost,
+                                                          int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd_bufferSize(handle,
+                                            params,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            HIP_C_64F,
+                                            A,
+                                            lda,
+                                            HIP_R_64F,
+                                            W,
+                                            HIP_C_64F,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              W,
+                                               int                 stW,
+                                               float*              workOnDevice,
+                                               int                 lworkOnDevice,
+                                               float*              workOnHost,
+                                               int                 lworkOnHost,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevd(handle, jobz, uplo, n, A, lda, W, workOnDevice, lworkOnDevice, info);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, workOnDevice, lworkOnDevice, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevdFortran(
+            handle, jobz, uplo, n, A, lda, W, workOnDevice, lworkOnDevice, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             W,
+                                               int                 stW,
+                                               double*             workOnDevice,
+                                               int                 lworkOnDevice,
+                                               double*             workOnHost,
+                                               int                 lworkOnHost,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevd(handle, jobz, uplo, n, A, lda, W, workOnDevice, lworkOnDevice, info);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevdStridedBatched(
+            handle, jobz, uplo, n, A, lda, stA, W, stW, workOnDevice, lworkOnDevice, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevdFortran(
+            handle, jobz, uplo, n, A, lda, W, workOnDevice, lworkOnDevice, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              W,
+                                               int                 stW,
+                                               hipsolverComplex*   workOnDevice,
+                                               int                 lworkOnDevice,
+                                               hipsolverComplex*   workOnHost,
+                                               int                 lworkOnHost,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevd(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               W,
+                               (hipFloatComplex*)workOnDevice,
+                               lworkOnDevice,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverCheevdStridedBatched(handle,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             W,
+                                             stW,
+                                             (hipFloatComplex*)workOnDevice,
+                                             lworkOnDevice,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevdFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipFloatComplex*)workOnDevice,
+                                      lworkOnDevice,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t               API,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverDnParams_t     params,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* workOnDevice,
+                                               int                     lworkOnDevice,
+                                               hipsolverDoubleComplex* workOnHost,
+                                               int                     lworkOnHost,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevd(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               W,
+                               (hipDoubleComplex*)workOnDevice,
+                               lworkOnDevice,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverZheevdStridedBatched(handle,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             W,
+                                             stW,
+                                             (hipDoubleComplex*)workOnDevice,
+                                             lworkOnDevice,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevdFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipDoubleComplex*)workOnDevice,
+                                      lworkOnDevice,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               float*              A,
+                                               int64_t             lda,
+                                               int64_t             stA,
+                                               float*              W,
+                                               int64_t             stW,
+                                               float*              workOnDevice,
+                                               size_t              lworkOnDevice,
+                                               float*              workOnHost,
+                                               size_t              lworkOnHost,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd(handle,
+                                 params,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 HIP_R_32F,
+                                 A,
+                                 lda,
+                                 HIP_R_32F,
+                                 W,
+                                 HIP_R_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               double*             A,
+                                               int64_t             lda,
+                                               int64_t             stA,
+                                               double*             W,
+                                               int64_t             stW,
+                                               double*             workOnDevice,
+                                               size_t              lworkOnDevice,
+                                               double*             workOnHost,
+                                               size_t              lworkOnHost,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd(handle,
+                                 params,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 HIP_R_64F,
+                                 A,
+                                 lda,
+                                 HIP_R_64F,
+                                 W,
+                                 HIP_R_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               hipsolverComplex*   A,
+                                               int64_t             lda,
+                                               int64_t             stA,
+                                               float*              W,
+                                               int64_t             stW,
+                                               hipsolverComplex*   workOnDevice,
+                                               size_t              lworkOnDevice,
+                                               hipsolverComplex*   workOnHost,
+                                               size_t              lworkOnHost,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd(handle,
+                                 params,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 HIP_R_32F,
+                                 W,
+                                 HIP_C_32F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevd_heevd(testAPI_t               API,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverDnParams_t     params,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int64_t                 n,
+                                               hipsolverDoubleComplex* A,
+                                               int64_t                 lda,
+                                               int64_t                 stA,
+                                               double*                 W,
+                                               int64_t                 stW,
+                                               hipsolverDoubleComplex* workOnDevice,
+                                               size_t                  lworkOnDevice,
+                                               hipsolverDoubleComplex* workOnHost,
+                                               size_t                  lworkOnHost,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevd(handle,
+                                 params,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 HIP_C_64F,
+                                 A,
+                                 lda,
+                                 HIP_R_64F,
+                                 W,
+                                 HIP_C_64F,
+                                 workOnDevice,
+                                 lworkOnDevice,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYEVDX/HEEVDX ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            bool                STRIDED,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverDnParams_t params,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int                 stW,
+                                                            int*                lworkOnDevice,
+                                                            int*                lworkOnHost,
+                                                            int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevdxStridedBatched_bufferSize(handle,
+                                                         jobz,
+                                                         range,
+                                                         uplo,
+                                                         n,
+                                                         A,
+                                                         lda,
+                                                         stA,
+                                                         vl,
+                                                         vu,
+                                                         il,
+                                                         iu,
+                                                         nev,
+                                                         W,
+                                                         stW,
+                                                         lworkOnDevice,
+                                                         bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnSsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            bool                STRIDED,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverDnParams_t params,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            double              vl,
+                                                            double              vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            double*             W,
+                                                            int                 stW,
+                                                            int*                lworkOnDevice,
+                                                            int*                lworkOnHost,
+                                                            int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevdxStridedBatched_bufferSize(handle,
+                                                         jobz,
+                                                         range,
+                                                         uplo,
+                                                         n,
+                                                         A,
+                                                         lda,
+                                                         stA,
+                                                         vl,
+                                                         vu,
+                                                         il,
+                                                         iu,
+                                                         nev,
+                                                         W,
+                                                         stW,
+                                                         lworkOnDevice,
+                                                         bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnDsyevdx_bufferSize(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            bool                STRIDED,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverDnParams_t params,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            int                 stA,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int                 stW,
+                                                            int*                lworkOnDevice,
+                                                            int*                lworkOnHost,
+                                                            int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevdx_bufferSize(handle,
+                                           jobz,
+                                           range,
+                                           uplo,
+                                           n,
+                                           (hipFloatComplex*)A,
+                                           lda,
+                                           vl,
+                                           vu,
+                                           il,
+                                           iu,
+                                           nev,
+                                           W,
+                                           lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverCheevdxStridedBatched_bufferSize(handle,
+                                                         jobz,
+                                                         range,
+                                                         uplo,
+                                                         n,
+                                                         (hipFloatComplex*)A,
+                                                         lda,
+                                                         stA,
+                                                         vl,
+                                                         vu,
+                                                         il,
+                                                         iu,
+                                                         nev,
+                                                         W,
+                                                         stW,
+                                                         lworkOnDevice,
+                                                         bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnCheevdx_bufferSize(handle,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             vl,
+                                             vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             W,
+                                             lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t               API,
+                                                            bool                    STRIDED,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverDnParams_t     params,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverEigRange_t     range,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            int                     stA,
+                                                            double                  vl,
+                                                            double                  vu,
+                                                            int                     il,
+                                                            int                     iu,
+                                                            int*                    nev,
+                                                            double*                 W,
+                                                            int                     stW,
+                                                            int*                    lworkOnDevice,
+                                                            int*                    lworkOnHost,
+                                                            int                     bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevdx_bufferSize(handle,
+                                           jobz,
+                                           range,
+                                           uplo,
+                                           n,
+                                           (hipDoubleComplex*)A,
+                                           lda,
+                                           vl,
+                                           vu,
+                                           il,
+                                           iu,
+                                           nev,
+                                           W,
+                                           lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverZheevdxStridedBatched_bufferSize(handle,
+                                                         jobz,
+                                                         range,
+                                                         uplo,
+                                                         n,
+                                                         (hipDoubleComplex*)A,
+                                                         lda,
+                                                         stA,
+                                                         vl,
+                                                         vu,
+                                                         il,
+                                                         iu,
+                                                         nev,
+                                                         W,
+                                                         stW,
+                                                         lworkOnDevice,
+                                                         bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnZheevdx_bufferSize(handle,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             vl,
+                                             vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             W,
+                                             lworkOnDevice);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 bool                STRIDED,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverDnParams_t params,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 int                 stW,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 float*              workOnHost,
+                                                 int                 lworkOnHost,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevdxStridedBatched(handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              A,
+                                              lda,
+                                              stA,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              nev,
+                                              W,
+                                              stW,
+                                              work,
+                                              lwork,
+                                              info,
+                                              bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnSsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 bool                STRIDED,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverDnParams_t params,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 double*             W,
+                                                 int                 stW,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 double*             workOnHost,
+                                                 int                 lworkOnHost,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevdxStridedBatched(handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              A,
+                                              lda,
+                                              stA,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              nev,
+                                              W,
+                                              stW,
+                                              work,
+                                              lwork,
+                                              info,
+                                              bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnDsyevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 bool                STRIDED,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverDnParams_t params,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 int                 stW,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 hipsolverComplex*   workOnHost,
+                                                 int                 lworkOnHost,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevdx(handle,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipFloatComplex*)A,
+                                lda,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipFloatComplex*)work,
+                                lwork,
+                                info);
+    case C_NORMAL_ALT:
+        return hipsolverCheevdxStridedBatched(handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              (hipFloatComplex*)A,
+                                              lda,
+                                              stA,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              nev,
+                                              W,
+                                              stW,
+                                              (hipFloatComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnCheevdx(handle,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipFloatComplex*)A,
+                                  lda,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipFloatComplex*)work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t               API,
+                                                 bool                    STRIDED,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverDnParams_t     params,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     stA,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int                     il,
+                                                 int                     iu,
+                                                 int*                    nev,
+                                                 double*                 W,
+                                                 int                     stW,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 hipsolverDoubleComplex* workOnHost,
+                                                 int                     lworkOnHost,
+                                                 int*                    info,
+                                                 int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevdx(handle,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipDoubleComplex*)A,
+                                lda,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipDoubleComplex*)work,
+                                lwork,
+                                info);
+    case C_NORMAL_ALT:
+        return hipsolverZheevdxStridedBatched(handle,
+                                              jobz,
+                                              range,
+                                              uplo,
+                                              n,
+                                              (hipDoubleComplex*)A,
+                                              lda,
+                                              stA,
+                                              vl,
+                                              vu,
+                                              il,
+                                              iu,
+                                              nev,
+                                              W,
+                                              stW,
+                                              (hipDoubleComplex*)work,
+                                              lwork,
+                                              info,
+                                              bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnZheevdx(handle,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipDoubleComplex*)A,
+                                  lda,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipDoubleComplex*)work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            bool                STRIDED,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverDnParams_t params,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int64_t             n,
+                                                            float*              A,
+                                                            int64_t             lda,
+                                                            int64_t             stA,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int64_t             il,
+                                                            int64_t             iu,
+                                                            int64_t*            nev,
+                                                            float*              W,
+                                                            int64_t             stW,
+                                                            size_t*             lworkOnDevice,
+                                                            size_t*             lworkOnHost,
+                                                            int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             HIP_R_32F,
+                                             A,
+                                             lda,
+                                             &vl,
+                                             &vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             HIP_R_32F,
+                                             W,
+                                             HIP_R_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            bool                STRIDED,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverDnParams_t params,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int64_t             n,
+                                                            double*             A,
+                                                            int64_t             lda,
+                                                            int64_t             stA,
+                                                            double              vl,
+                                                            double              vu,
+                                                            int64_t             il,
+                                                            int64_t             iu,
+                                                            int64_t*            nev,
+                                                            double*             W,
+                                                            int64_t             stW,
+                                                            size_t*             lworkOnDevice,
+                                                            size_t*             lworkOnHost,
+                                                            int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             HIP_R_64F,
+                                             A,
+                                             lda,
+                                             &vl,
+                                             &vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             HIP_R_64F,
+                                             W,
+                                             HIP_R_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t           API,
+                                                            bool                STRIDED,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverDnParams_t params,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int64_t             n,
+                                                            hipsolverComplex*   A,
+                                                            int64_t             lda,
+                                                            int64_t             stA,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int64_t             il,
+                                                            int64_t             iu,
+                                                            int64_t*            nev,
+                                                            float*              W,
+                                                            int64_t             stW,
+                                                            size_t*             lworkOnDevice,
+                                                            size_t*             lworkOnHost,
+                                                            int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             HIP_C_32F,
+                                             A,
+                                             lda,
+                                             &vl,
+                                             &vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             HIP_R_32F,
+                                             W,
+                                             HIP_C_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx_bufferSize(testAPI_t               API,
+                                                            bool                    STRIDED,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverDnParams_t     params,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverEigRange_t     range,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int64_t                 n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int64_t                 lda,
+                                                            int64_t                 stA,
+                                                            double                  vl,
+                                                            double                  vu,
+                                                            int64_t                 il,
+                                                            int64_t                 iu,
+                                                            int64_t*                nev,
+                                                            double*                 W,
+                                                            int64_t                 stW,
+                                                            size_t*                 lworkOnDevice,
+                                                            size_t*                 lworkOnHost,
+                                                            int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx_bufferSize(handle,
+                                             params,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             HIP_C_64F,
+                                             A,
+                                             lda,
+                                             &vl,
+                                             &vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             HIP_R_64F,
+                                             W,
+                                             HIP_C_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 bool                STRIDED,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverDnParams_t params,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int64_t             n,
+                                                 float*              A,
+                                                 int64_t             lda,
+                                                 int64_t             stA,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int64_t             il,
+                                                 int64_t             iu,
+                                                 int64_t*            nev,
+                                                 float*              W,
+                                                 int64_t             stW,
+                                                 float*              work,
+                                                 size_t              lwork,
+                                                 float*              workOnHost,
+                                                 size_t              lworkOnHost,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx(handle,
+                                  params,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  HIP_R_32F,
+                                  A,
+                                  lda,
+                                  &vl,
+                                  &vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  HIP_R_32F,
+                                  W,
+                                  HIP_R_32F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 bool                STRIDED,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverDnParams_t params,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int64_t             n,
+                                                 double*             A,
+                                                 int64_t             lda,
+                                                 int64_t             stA,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int64_t             il,
+                                                 int64_t             iu,
+                                                 int64_t*            nev,
+                                                 double*             W,
+                                                 int64_t             stW,
+                                                 double*             work,
+                                                 size_t              lwork,
+                                                 double*             workOnHost,
+                                                 size_t              lworkOnHost,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx(handle,
+                                  params,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  HIP_R_64F,
+                                  A,
+                                  lda,
+                                  &vl,
+                                  &vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  HIP_R_64F,
+                                  W,
+                                  HIP_R_64F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t           API,
+                                                 bool                STRIDED,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverDnParams_t params,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int64_t             n,
+                                                 hipsolverComplex*   A,
+                                                 int64_t             lda,
+                                                 int64_t             stA,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int64_t             il,
+                                                 int64_t             iu,
+                                                 int64_t*            nev,
+                                                 float*              W,
+                                                 int64_t             stW,
+                                                 hipsolverComplex*   work,
+                                                 size_t              lwork,
+                                                 hipsolverComplex*   workOnHost,
+                                                 size_t              lworkOnHost,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx(handle,
+                                  params,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  HIP_C_32F,
+                                  A,
+                                  lda,
+                                  &vl,
+                                  &vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  HIP_R_32F,
+                                  W,
+                                  HIP_C_32F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevdx_heevdx(testAPI_t               API,
+                                                 bool                    STRIDED,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverDnParams_t     params,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int64_t                 n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int64_t                 lda,
+                                                 int64_t                 stA,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int64_t                 il,
+                                                 int64_t                 iu,
+                                                 int64_t*                nev,
+                                                 double*                 W,
+                                                 int64_t                 stW,
+                                                 hipsolverDoubleComplex* work,
+                                                 size_t                  lwork,
+                                                 hipsolverDoubleComplex* workOnHost,
+                                                 size_t                  lworkOnHost,
+                                                 int*                    info,
+                                                 int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsyevdx(handle,
+                                  params,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  HIP_C_64F,
+                                  A,
+                                  lda,
+                                  &vl,
+                                  &vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  HIP_R_64F,
+                                  W,
+                                  HIP_C_64F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYEVJ/HEEVJ ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSsyevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnSsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnSsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          double*              W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevj_bufferSizeFortran(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDsyevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnDsyevj_bufferSize(handle, jobz, uplo, n, A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnDsyevjBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevj_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverCheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevj_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCheevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnCheevj_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnCheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex*)A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t               API,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          double*                 W,
+                                                          int*                    lwork,
+                                                          hipsolverSyevjInfo_t    params,
+                                                          int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevj_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
+    case C_NORMAL_ALT:
+        return hipsolverZheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevj_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZheevjBatched_bufferSizeFortran(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnZheevj_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnZheevjBatched_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex*)A, lda, W, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               float*               A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_NORMAL_ALT:
+        return hipsolverSsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverSsyevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnSsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnSsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               double*              A,
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              W,
+                                               int                  stW,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case C_NORMAL_ALT:
+        return hipsolverDsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsyevjFortran(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverDsyevjBatchedFortran(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnDsyevj(handle, jobz, uplo, n, A, lda, W, work, lwork, info, params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnDsyevjBatched(
+            handle, jobz, uplo, n, A, lda, W, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               hipsolverComplex*    A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCheevj(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               W,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case C_NORMAL_ALT:
+        return hipsolverCheevjBatched(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      params,
+                                      bc);
+    case FORTRAN_NORMAL:
+        return hipsolverCheevjFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverCheevjBatchedFortran(handle,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             W,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             params,
+                                             bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnCheevj(handle,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipFloatComplex*)A,
+                                 lda,
+                                 W,
+                                 (hipFloatComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnCheevjBatched(handle,
+                                        jobz,
+                                        uplo,
+                                        n,
+                                        (hipFloatComplex*)A,
+                                        lda,
+                                        W,
+                                        (hipFloatComplex*)work,
+                                        lwork,
+                                        info,
+                                        params,
+                                        bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t               API,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               hipsolverSyevjInfo_t    params,
+                                               int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZheevj(handle,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               W,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case C_NORMAL_ALT:
+        return hipsolverZheevjBatched(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      params,
+                                      bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZheevjFortran(handle,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case FORTRAN_NORMAL_ALT:
+        return hipsolverZheevjBatchedFortran(handle,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             W,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             params,
+                                             bc);
+    case COMPAT_NORMAL:
+        return hipsolverDnZheevj(handle,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 W,
+                                 (hipDoubleComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    case COMPAT_NORMAL_ALT:
+        return hipsolverDnZheevjBatched(handle,
+                                        jobz,
+                                        uplo,
+                                        n,
+                                        (hipDoubleComplex*)A,
+                                        lda,
+                                        W,
+                                        (hipDoubleComplex*)work,
+                                        lwork,
+                                        info,
+                                        params,
+                                        bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// batched
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          float*               A[],
+                                                          int                  lda,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    // the workspace size does not depend on the strides
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsyevjPtrBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, n, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          double*              A[],
+                                                          int                  lda,
+                                                          double*              W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    // the workspace size does not depend on the strides
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsyevjPtrBatched_bufferSize(
+            handle, jobz, uplo, n, A, lda, W, n, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t            API,
+                                                          bool                 STRIDED,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          hipsolverComplex*    A[],
+                                                          int                  lda,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params,
+                                                          int                  bc)
+{
+    // the workspace size does not depend on the strides
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCheevjPtrBatched_bufferSize(
+            handle, jobz, uplo, n, (hipFloatComplex**)A, lda, W, n, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj_bufferSize(testAPI_t               API,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A[],
+                                                          int                     lda,
+                                                          double*                 W,
+                                                          int*                    lwork,
+                                                          hipsolverSyevjInfo_t    params,
+                                                          int                     bc)
+{
+    // the workspace size does not depend on the strides
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZheevjPtrBatched_bufferSize(
+            handle, jobz, uplo, n, (hipDoubleComplex**)A, lda, W, n, lwork, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               float*               A[],
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsyevjPtrBatched(
+            handle, jobz, uplo, n, A, lda, W, stW, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               double*              A[],
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              W,
+                                               int                  stW,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsyevjPtrBatched(
+            handle, jobz, uplo, n, A, lda, W, stW, work, lwork, info, params, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t            API,
+                                               bool                 STRIDED,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               hipsolverComplex*    A[],
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               W,
+                                               int                  stW,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCheevjPtrBatched(handle,
+                                         jobz,
+                                         uplo,
+                                         n,
+                                         (hipFloatComplex**)A,
+                                         lda,
+                                         W,
+                                         stW,
+                                         (hipFloatComplex*)work,
+                                         lwork,
+                                         info,
+                                         params,
+                                         bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_syevj_heevj(testAPI_t               API,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A[],
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               hipsolverSyevjInfo_t    params,
+                                               int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZheevjPtrBatched(handle,
+                                         jobz,
+                                         uplo,
+                                         n,
+                                         (hipDoubleComplex**)A,
+                                         lda,
+                                         W,
+                                         stW,
+                                         (hipDoubleComplex*)work,
+                                         lwork,
+                                         info,
+                                         params,
+                                         bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYGVD/HEGVD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          float*              B,
+                                                          int                 ldb,
+                                                          int                 stB,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSsygvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          double*             B,
+                                                          int                 ldb,
+                                                          int                 stB,
+                                                          double*             W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvd_bufferSize(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDsygvdStridedBatched_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, lwork, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsygvd_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t           API,
+                                                          bool                STRIDED,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverEigType_t  itype,
+                                                          hipsolverEigMode_t  jobz,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          int                 stA,
+                                                          hipsolverComplex*   B,
+                                                          int                 ldb,
+                                                          int                 stB,
+                                                          float*              W,
+                                                          int                 stW,
+                                                          int*                lwork,
+                                                          int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverChegvd_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverChegvdStridedBatched_bufferSize(handle,
+                                                        itype,
+                                                        jobz,
+                                                        uplo,
+                                                        n,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        (hipFloatComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        W,
+                                                        stW,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverChegvd_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd_bufferSize(testAPI_t               API,
+                                                          bool                    STRIDED,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigType_t      itype,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          int                     stA,
+                                                          hipsolverDoubleComplex* B,
+                                                          int                     ldb,
+                                                          int                     stB,
+                                                          double*                 W,
+                                                          int                     stW,
+                                                          int*                    lwork,
+                                                          int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvd_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZhegvdStridedBatched_bufferSize(handle,
+                                                        itype,
+                                                        jobz,
+                                                        uplo,
+                                                        n,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        (hipDoubleComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        W,
+                                                        stW,
+                                                        lwork,
+                                                        bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZhegvd_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               float*              W,
+                                               int                 stW,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSsygvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverSsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               double*             W,
+                                               int                 stW,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsygvd(handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDsygvdStridedBatched(
+            handle, itype, jobz, uplo, n, A, lda, stA, B, ldb, stB, W, stW, work, lwork, info, bc);
+    case FORTRAN_NORMAL:
+        return hipsolverDsygvdFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t           API,
+                                               bool                STRIDED,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverEigType_t  itype,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               hipsolverComplex*   B,
+                                               int                 ldb,
+                                               int                 stB,
+                                               float*              W,
+                                               int                 stW,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverChegvd(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               W,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverChegvdStridedBatched(handle,
+                                             itype,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             stB,
+                                             W,
+                                             stW,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverChegvdFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvd_hegvd(testAPI_t               API,
+                                               bool                    STRIDED,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigType_t      itype,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* B,
+                                               int                     ldb,
+                                               int                     stB,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZhegvd(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               W,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverZhegvdStridedBatched(handle,
+                                             itype,
+                                             jobz,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             stB,
+                                             W,
+                                             stW,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    case FORTRAN_NORMAL:
+        return hipsolverZhegvdFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYGVDX/HEGVDX ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            float*              A,
+                                                            int                 lda,
+                                                            float*              B,
+                                                            int                 ldb,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnSsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            double*             A,
+                                                            int                 lda,
+                                                            double*             B,
+                                                            int                 ldb,
+                                                            double              vl,
+                                                            double              vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            double*             W,
+                                                            int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    case API_COMPAT:
+        return hipsolverDnDsygvdx_bufferSize(
+            handle, itype, jobz, range, uplo, n, A, lda, B, ldb, vl, vu, il, iu, nev, W, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t           API,
+                                                            hipsolverHandle_t   handle,
+                                                            hipsolverEigType_t  itype,
+                                                            hipsolverEigMode_t  jobz,
+                                                            hipsolverEigRange_t range,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            hipsolverComplex*   A,
+                                                            int                 lda,
+                                                            hipsolverComplex*   B,
+                                                            int                 ldb,
+                                                            float               vl,
+                                                            float               vu,
+                                                            int                 il,
+                                                            int                 iu,
+                                                            int*                nev,
+                                                            float*              W,
+                                                            int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChegvdx_bufferSize(handle,
+                                           itype,
+                                           jobz,
+                                           range,
+                                           uplo,
+                                           n,
+                                           (hipFloatComplex*)A,
+                                           lda,
+                                           (hipFloatComplex*)B,
+                                           ldb,
+                                           vl,
+                                           vu,
+                                           il,
+                                           iu,
+                                           nev,
+                                           W,
+                                           lwork);
+    case API_COMPAT:
+        return hipsolverDnChegvdx_bufferSize(handle,
+                                             itype,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             vl,
+                                             vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             W,
+                                             lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx_bufferSize(testAPI_t               API,
+                                                            hipsolverHandle_t       handle,
+                                                            hipsolverEigType_t      itype,
+                                                            hipsolverEigMode_t      jobz,
+                                                            hipsolverEigRange_t     range,
+                                                            hipsolverFillMode_t     uplo,
+                                                            int                     n,
+                                                            hipsolverDoubleComplex* A,
+                                                            int                     lda,
+                                                            hipsolverDoubleComplex* B,
+                                                            int                     ldb,
+                                                            double                  vl,
+                                                            double                  vu,
+                                                            int                     il,
+                                                            int                     iu,
+                                                            int*                    nev,
+                                                            double*                 W,
+                                                            int*                    lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvdx_bufferSize(handle,
+                                           itype,
+                                           jobz,
+                                           range,
+                                           uplo,
+                                           n,
+                                           (hipDoubleComplex*)A,
+                                           lda,
+                                           (hipDoubleComplex*)B,
+                                           ldb,
+                                           vl,
+                                           vu,
+                                           il,
+                                           iu,
+                                           nev,
+                                           W,
+                                           lwork);
+    case API_COMPAT:
+        return hipsolverDnZhegvdx_bufferSize(handle,
+                                             itype,
+                                             jobz,
+                                             range,
+                                             uplo,
+                                             n,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             vl,
+                                             vu,
+                                             il,
+                                             iu,
+                                             nev,
+                                             W,
+                                             lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 float*              A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 float*              B,
+                                                 int                 ldb,
+                                                 int                 stB,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 int                 stW,
+                                                 float*              work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnSsygvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 double*             A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 double*             B,
+                                                 int                 ldb,
+                                                 int                 stB,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 double*             W,
+                                                 int                 stW,
+                                                 double*             work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                A,
+                                lda,
+                                B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnDsygvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  A,
+                                  lda,
+                                  B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t           API,
+                                                 hipsolverHandle_t   handle,
+                                                 hipsolverEigType_t  itype,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 hipsolverComplex*   A,
+                                                 int                 lda,
+                                                 int                 stA,
+                                                 hipsolverComplex*   B,
+                                                 int                 ldb,
+                                                 int                 stB,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 float*              W,
+                                                 int                 stW,
+                                                 hipsolverComplex*   work,
+                                                 int                 lwork,
+                                                 int*                info,
+                                                 int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChegvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipFloatComplex*)A,
+                                lda,
+                                (hipFloatComplex*)B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipFloatComplex*)work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnChegvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipFloatComplex*)A,
+                                  lda,
+                                  (hipFloatComplex*)B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipFloatComplex*)work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvdx_hegvdx(testAPI_t               API,
+                                                 hipsolverHandle_t       handle,
+                                                 hipsolverEigType_t      itype,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 hipsolverDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     stA,
+                                                 hipsolverDoubleComplex* B,
+                                                 int                     ldb,
+                                                 int                     stB,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int                     il,
+                                                 int                     iu,
+                                                 int*                    nev,
+                                                 double*                 W,
+                                                 int                     stW,
+                                                 hipsolverDoubleComplex* work,
+                                                 int                     lwork,
+                                                 int*                    info,
+                                                 int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvdx(handle,
+                                itype,
+                                jobz,
+                                range,
+                                uplo,
+                                n,
+                                (hipDoubleComplex*)A,
+                                lda,
+                                (hipDoubleComplex*)B,
+                                ldb,
+                                vl,
+                                vu,
+                                il,
+                                iu,
+                                nev,
+                                W,
+                                (hipDoubleComplex*)work,
+                                lwork,
+                                info);
+    case API_COMPAT:
+        return hipsolverDnZhegvdx(handle,
+                                  itype,
+                                  jobz,
+                                  range,
+                                  uplo,
+                                  n,
+                                  (hipDoubleComplex*)A,
+                                  lda,
+                                  (hipDoubleComplex*)B,
+                                  ldb,
+                                  vl,
+                                  vu,
+                                  il,
+                                  iu,
+                                  nev,
+                                  W,
+                                  (hipDoubleComplex*)work,
+                                  lwork,
+                                  info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYGVJ/HEGVJ ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigType_t   itype,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          float*               A,
+                                                          int                  lda,
+                                                          float*               B,
+                                                          int                  ldb,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_FORTRAN:
+        return hipsolverSsygvj_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_COMPAT:
+        return hipsolverDnSsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigType_t   itype,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          double*              A,
+                                                          int                  lda,
+                                                          double*              B,
+                                                          int                  ldb,
+                                                          double*              W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_FORTRAN:
+        return hipsolverDsygvj_bufferSizeFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    case API_COMPAT:
+        return hipsolverDnDsygvj_bufferSize(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, lwork, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t            API,
+                                                          hipsolverHandle_t    handle,
+                                                          hipsolverEigType_t   itype,
+                                                          hipsolverEigMode_t   jobz,
+                                                          hipsolverFillMode_t  uplo,
+                                                          int                  n,
+                                                          hipsolverComplex*    A,
+                                                          int                  lda,
+                                                          hipsolverComplex*    B,
+                                                          int                  ldb,
+                                                          float*               W,
+                                                          int*                 lwork,
+                                                          hipsolverSyevjInfo_t params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChegvj_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork,
+                                          params);
+    case API_FORTRAN:
+        return hipsolverChegvj_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipFloatComplex*)A,
+                                                 lda,
+                                                 (hipFloatComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork,
+                                                 params);
+    case API_COMPAT:
+        return hipsolverDnChegvj_bufferSize(handle,
+                                            itype,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            (hipFloatComplex*)A,
+                                            lda,
+                                            (hipFloatComplex*)B,
+                                            ldb,
+                                            W,
+                                            lwork,
+                                            params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj_bufferSize(testAPI_t               API,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverEigType_t      itype,
+                                                          hipsolverEigMode_t      jobz,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          hipsolverDoubleComplex* B,
+                                                          int                     ldb,
+                                                          double*                 W,
+                                                          int*                    lwork,
+                                                          hipsolverSyevjInfo_t    params)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvj_bufferSize(handle,
+                                          itype,
+                                          jobz,
+                                          uplo,
+                                          n,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          W,
+                                          lwork,
+                                          params);
+    case API_FORTRAN:
+        return hipsolverZhegvj_bufferSizeFortran(handle,
+                                                 itype,
+                                                 jobz,
+                                                 uplo,
+                                                 n,
+                                                 (hipDoubleComplex*)A,
+                                                 lda,
+                                                 (hipDoubleComplex*)B,
+                                                 ldb,
+                                                 W,
+                                                 lwork,
+                                                 params);
+    case API_COMPAT:
+        return hipsolverDnZhegvj_bufferSize(handle,
+                                            itype,
+                                            jobz,
+                                            uplo,
+                                            n,
+                                            (hipDoubleComplex*)A,
+                                            lda,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            W,
+                                            lwork,
+                                            params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigType_t   itype,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               float*               A,
+                                               int                  lda,
+                                               int                  stA,
+                                               float*               B,
+                                               int                  ldb,
+                                               int                  stB,
+                                               float*               W,
+                                               int                  stW,
+                                               float*               work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_FORTRAN:
+        return hipsolverSsygvjFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_COMPAT:
+        return hipsolverDnSsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigType_t   itype,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               double*              A,
+                                               int                  lda,
+                                               int                  stA,
+                                               double*              B,
+                                               int                  ldb,
+                                               int                  stB,
+                                               double*              W,
+                                               int                  stW,
+                                               double*              work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_FORTRAN:
+        return hipsolverDsygvjFortran(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    case API_COMPAT:
+        return hipsolverDnDsygvj(
+            handle, itype, jobz, uplo, n, A, lda, B, ldb, W, work, lwork, info, params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t            API,
+                                               hipsolverHandle_t    handle,
+                                               hipsolverEigType_t   itype,
+                                               hipsolverEigMode_t   jobz,
+                                               hipsolverFillMode_t  uplo,
+                                               int                  n,
+                                               hipsolverComplex*    A,
+                                               int                  lda,
+                                               int                  stA,
+                                               hipsolverComplex*    B,
+                                               int                  ldb,
+                                               int                  stB,
+                                               float*               W,
+                                               int                  stW,
+                                               hipsolverComplex*    work,
+                                               int                  lwork,
+                                               int*                 info,
+                                               hipsolverSyevjInfo_t params,
+                                               int                  bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChegvj(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               W,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case API_FORTRAN:
+        return hipsolverChegvjFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      (hipFloatComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case API_COMPAT:
+        return hipsolverDnChegvj(handle,
+                                 itype,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipFloatComplex*)A,
+                                 lda,
+                                 (hipFloatComplex*)B,
+                                 ldb,
+                                 W,
+                                 (hipFloatComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sygvj_hegvj(testAPI_t               API,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverEigType_t      itype,
+                                               hipsolverEigMode_t      jobz,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               hipsolverDoubleComplex* B,
+                                               int                     ldb,
+                                               int                     stB,
+                                               double*                 W,
+                                               int                     stW,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               hipsolverSyevjInfo_t    params,
+                                               int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhegvj(handle,
+                               itype,
+                               jobz,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               W,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info,
+                               params);
+    case API_FORTRAN:
+        return hipsolverZhegvjFortran(handle,
+                                      itype,
+                                      jobz,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      (hipDoubleComplex*)B,
+                                      ldb,
+                                      W,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info,
+                                      params);
+    case API_COMPAT:
+        return hipsolverDnZhegvj(handle,
+                                 itype,
+                                 jobz,
+                                 uplo,
+                                 n,
+                                 (hipDoubleComplex*)A,
+                                 lda,
+                                 (hipDoubleComplex*)B,
+                                 ldb,
+                                 W,
+                                 (hipDoubleComplex*)work,
+                                 lwork,
+                                 info,
+                                 params);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYSV ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sysv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   int*                ipiv,
+                                                   int                 stP,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsysv_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverSsysvStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sysv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   int*                ipiv,
+                                                   int                 stP,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsysv_bufferSize(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverDsysvStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lwork, bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sysv_bufferSize(testAPI_t           API,
+                                                   bool                STRIDED,
+                                                   hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipsolverComplex*   A,
+                                                   int                 lda,
+                                                   int                 stA,
+                                                   int*                ipiv,
+                                                   int                 stP,
+                                                   hipsolverComplex*   B,
+                                                   int                 ldb,
+                                                   int                 stB,
+                                                   int*                lwork,
+                                                   int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCsysv_bufferSize(
+            handle, uplo, n, nrhs, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)B, ldb, lwork);
+    case C_NORMAL_ALT:
+        return hipsolverCsysvStridedBatched_bufferSize(handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       (hipFloatComplex*)A,
+                                                       lda,
+                                                       stA,
+                                                       ipiv,
+                                                       stP,
+                                                       (hipFloatComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sysv_bufferSize(testAPI_t               API,
+                                                   bool                    STRIDED,
+                                                   hipsolverHandle_t       handle,
+                                                   hipsolverFillMode_t     uplo,
+                                                   int                     n,
+                                                   int                     nrhs,
+                                                   hipsolverDoubleComplex* A,
+                                                   int                     lda,
+                                                   int                     stA,
+                                                   int*                    ipiv,
+                                                   int                     stP,
+                                                   hipsolverDoubleComplex* B,
+                                                   int                     ldb,
+                                                   int                     stB,
+                                                   int*                    lwork,
+                                                   int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZsysv_bufferSize(handle,
+                                         uplo,
+                                         n,
+                                         nrhs,
+                                         (hipDoubleComplex*)A,
+                                         lda,
+                                         ipiv,
+                                         (hipDoubleComplex*)B,
+                                         ldb,
+                                         lwork);
+    case C_NORMAL_ALT:
+        return hipsolverZsysvStridedBatched_bufferSize(handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       (hipDoubleComplex*)A,
+                                                       lda,
+                                                       stA,
+                                                       ipiv,
+                                                       stP,
+                                                       (hipDoubleComplex*)B,
+                                                       ldb,
+                                                       stB,
+                                                       lwork,
+                                                       bc);
+    default:
+        *lwork = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sysv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A,
+                                        int                 lda,
+                                        int                 stA,
+                                        int*                ipiv,
+                                        int                 stP,
+                                        float*              B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        float*              work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSsysvStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sysv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A,
+                                        int                 lda,
+                                        int                 stA,
+                                        int*                ipiv,
+                                        int                 stP,
+                                        double*             B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        double*             work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsysv(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDsysvStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sysv(testAPI_t           API,
+                                        bool                STRIDED,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipsolverComplex*   A,
+                                        int                 lda,
+                                        int                 stA,
+                                        int*                ipiv,
+                                        int                 stP,
+                                        hipsolverComplex*   B,
+                                        int                 ldb,
+                                        int                 stB,
+                                        hipsolverComplex*   work,
+                                        int                 lwork,
+                                        int*                info,
+                                        int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCsysv(handle,
+                              uplo,
+                              n,
+                              nrhs,
+                              (hipFloatComplex*)A,
+                              lda,
+                              ipiv,
+                              (hipFloatComplex*)B,
+                              ldb,
+                              (hipFloatComplex*)work,
+                              lwork,
+                              info);
+    case C_NORMAL_ALT:
+        return hipsolverCsysvStridedBatched(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipFloatComplex*)A,
+                                            lda,
+                                            stA,
+                                            ipiv,
+                                            stP,
+                                            (hipFloatComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipFloatComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sysv(testAPI_t               API,
+                                        bool                    STRIDED,
+                                        hipsolverHandle_t       handle,
+                                        hipsolverFillMode_t     uplo,
+                                        int                     n,
+                                        int                     nrhs,
+                                        hipsolverDoubleComplex* A,
+                                        int                     lda,
+                                        int                     stA,
+                                        int*                    ipiv,
+                                        int                     stP,
+                                        hipsolverDoubleComplex* B,
+                                        int                     ldb,
+                                        int                     stB,
+                                        hipsolverDoubleComplex* work,
+                                        int                     lwork,
+                                        int*                    info,
+                                        int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZsysv(handle,
+                              uplo,
+                              n,
+                              nrhs,
+                              (hipDoubleComplex*)A,
+                              lda,
+                              ipiv,
+                              (hipDoubleComplex*)B,
+                              ldb,
+                              (hipDoubleComplex*)work,
+                              lwork,
+                              info);
+    case C_NORMAL_ALT:
+        return hipsolverZsysvStridedBatched(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            (hipDoubleComplex*)A,
+                                            lda,
+                                            stA,
+                                            ipiv,
+                                            stP,
+                                            (hipDoubleComplex*)B,
+                                            ldb,
+                                            stB,
+                                            (hipDoubleComplex*)work,
+                                            lwork,
+                                            info,
+                                            bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRD/HETRD ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A,
+                                                          int                 lda,
+                                                          float*              D,
+                                                          float*              E,
+                                                          float*              tau,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case API_FORTRAN:
+        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A,
+                                                          int                 lda,
+                                                          double*             D,
+                                                          double*             E,
+                                                          double*             tau,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case API_FORTRAN:
+        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
+                                                          hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipsolverComplex*   A,
+                                                          int                 lda,
+                                                          float*              D,
+                                                          float*              E,
+                                                          hipsolverComplex*   tau,
+                                                          int*                lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChetrd_bufferSize(
+            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+    case API_FORTRAN:
+        return hipsolverChetrd_bufferSizeFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t               API,
+                                                          hipsolverHandle_t       handle,
+                                                          hipsolverFillMode_t     uplo,
+                                                          int                     n,
+                                                          hipsolverDoubleComplex* A,
+                                                          int                     lda,
+                                                          double*                 D,
+                                                          double*                 E,
+                                                          hipsolverDoubleComplex* tau,
+                                                          int*                    lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhetrd_bufferSize(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+    case API_FORTRAN:
+        return hipsolverZhetrd_bufferSizeFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               float*              tau,
+                                               int                 stP,
+                                               float*              work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 stA,
+                                               double*             D,
+                                               int                 stD,
+                                               double*             E,
+                                               int                 stE,
+                                               double*             tau,
+                                               int                 stP,
+                                               double*             work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
+                                               hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               hipsolverComplex*   A,
+                                               int                 lda,
+                                               int                 stA,
+                                               float*              D,
+                                               int                 stD,
+                                               float*              E,
+                                               int                 stE,
+                                               hipsolverComplex*   tau,
+                                               int                 stP,
+                                               hipsolverComplex*   work,
+                                               int                 lwork,
+                                               int*                info,
+                                               int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverChetrd(handle,
+                               uplo,
+                               n,
+                               (hipFloatComplex*)A,
+                               lda,
+                               D,
+                               E,
+                               (hipFloatComplex*)tau,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverChetrdFortran(handle,
+                                      uplo,
+                                      n,
+                                      (hipFloatComplex*)A,
+                                      lda,
+                                      D,
+                                      E,
+                                      (hipFloatComplex*)tau,
+                                      (hipFloatComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t               API,
+                                               hipsolverHandle_t       handle,
+                                               hipsolverFillMode_t     uplo,
+                                               int                     n,
+                                               hipsolverDoubleComplex* A,
+                                               int                     lda,
+                                               int                     stA,
+                                               double*                 D,
+                                               int                     stD,
+                                               double*                 E,
+                                               int                     stE,
+                                               hipsolverDoubleComplex* tau,
+                                               int                     stP,
+                                               hipsolverDoubleComplex* work,
+                                               int                     lwork,
+                                               int*                    info,
+                                               int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZhetrd(handle,
+                               uplo,
+                               n,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               D,
+                               E,
+                               (hipDoubleComplex*)tau,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case API_FORTRAN:
+        return hipsolverZhetrdFortran(handle,
+                                      uplo,
+                                      n,
+                                      (hipDoubleComplex*)A,
+                                      lda,
+                                      D,
+                                      E,
+                                      (hipDoubleComplex*)tau,
+                                      (hipDoubleComplex*)work,
+                                      lwork,
+                                      info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRF ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverSsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverDsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverComplex* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCsytrf_bufferSize(handle, n, (hipFloatComplex*)A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverCsytrf_bufferSizeFortran(handle, n, (hipFloatComplex*)A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
+    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZsytrf_bufferSize(handle, n, (hipDoubleComplex*)A, lda, lwork);
+    case API_FORTRAN:
+        return hipsolverZsytrf_bufferSizeFortran(handle, n, (hipDoubleComplex*)A, lda, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverSsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverDsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverCsytrf(
+            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverCsytrfFortran(
+            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrf(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(API)
+    {
+    case API_NORMAL:
+        return hipsolverZsytrf(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
+    case API_FORTRAN:
+        return hipsolverZsytrfFortran(
+            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+/********************************************************/
+
+/******************** SYTRS ********************/
+// normal and strided_batched
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    float*              A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    float*              B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrs_bufferSize(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverSsytrsStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lworkOnDevice, bc);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    double*             A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    double*             B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrs_bufferSize(
+            handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverDsytrsStridedBatched_bufferSize(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, lworkOnDevice, bc);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int                 n,
+                                                    int                 nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int                 lda,
+                                                    int                 stA,
+                                                    int*                ipiv,
+                                                    int                 stP,
+                                                    hipsolverComplex*   B,
+                                                    int                 ldb,
+                                                    int                 stB,
+                                                    int*                lworkOnDevice,
+                                                    int*                lworkOnHost,
+                                                    int                 bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCsytrs_bufferSize(handle,
+                                          uplo,
+                                          n,
+                                          nrhs,
+                                          (hipFloatComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipFloatComplex*)B,
+                                          ldb,
+                                          lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverCsytrsStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        nrhs,
+                                                        (hipFloatComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipFloatComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lworkOnDevice,
+                                                        bc);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int                     n,
+                                                    int                     nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int                     lda,
+                                                    int                     stA,
+                                                    int*                    ipiv,
+                                                    int                     stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int                     ldb,
+                                                    int                     stB,
+                                                    int*                    lworkOnDevice,
+                                                    int*                    lworkOnHost,
+                                                    int                     bc)
+{
+    *lworkOnHost = 0;
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZsytrs_bufferSize(handle,
+                                          uplo,
+                                          n,
+                                          nrhs,
+                                          (hipDoubleComplex*)A,
+                                          lda,
+                                          ipiv,
+                                          (hipDoubleComplex*)B,
+                                          ldb,
+                                          lworkOnDevice);
+    case C_NORMAL_ALT:
+        return hipsolverZsytrsStridedBatched_bufferSize(handle,
+                                                        uplo,
+                                                        n,
+                                                        nrhs,
+                                                        (hipDoubleComplex*)A,
+                                                        lda,
+                                                        stA,
+                                                        ipiv,
+                                                        stP,
+                                                        (hipDoubleComplex*)B,
+                                                        ldb,
+                                                        stB,
+                                                        lworkOnDevice,
+                                                        bc);
+    default:
+        *lworkOnDevice = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         float*              B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         float*              work,
+                                         int                 lwork,
+                                         float*              workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverSsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverSsytrsStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         double*             B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         double*             work,
+                                         int                 lwork,
+                                         double*             workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverDsytrs(handle, uplo, n, nrhs, A, lda, ipiv, B, ldb, work, lwork, info);
+    case C_NORMAL_ALT:
+        return hipsolverDsytrsStridedBatched(
+            handle, uplo, n, nrhs, A, lda, stA, ipiv, stP, B, ldb, stB, work, lwork, info, bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipsolverComplex*   A,
+                                         int                 lda,
+                                         int                 stA,
+                                         int*                ipiv,
+                                         int                 stP,
+                                         hipsolverComplex*   B,
+                                         int                 ldb,
+                                         int                 stB,
+                                         hipsolverComplex*   work,
+                                         int                 lwork,
+                                         hipsolverComplex*   workOnHost,
+                                         int                 lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverCsytrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipFloatComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipFloatComplex*)B,
+                               ldb,
+                               (hipFloatComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverCsytrsStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipFloatComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipFloatComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipFloatComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int                     n,
+                                         int                     nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int                     lda,
+                                         int                     stA,
+                                         int*                    ipiv,
+                                         int                     stP,
+                                         hipsolverDoubleComplex* B,
+                                         int                     ldb,
+                                         int                     stB,
+                                         hipsolverDoubleComplex* work,
+                                         int                     lwork,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         int                     lworkOnHost,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case C_NORMAL:
+        return hipsolverZsytrs(handle,
+                               uplo,
+                               n,
+                               nrhs,
+                               (hipDoubleComplex*)A,
+                               lda,
+                               ipiv,
+                               (hipDoubleComplex*)B,
+                               ldb,
+                               (hipDoubleComplex*)work,
+                               lwork,
+                               info);
+    case C_NORMAL_ALT:
+        return hipsolverZsytrsStridedBatched(handle,
+                                             uplo,
+                                             n,
+                                             nrhs,
+                                             (hipDoubleComplex*)A,
+                                             lda,
+                                             stA,
+                                             ipiv,
+                                             stP,
+                                             (hipDoubleComplex*)B,
+                                             ldb,
+                                             stB,
+                                             (hipDoubleComplex*)work,
+                                             lwork,
+                                             info,
+                                             bc);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    float*              A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    float*              B,
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            HIP_R_32F,
+                                            A,
+                                            lda,
+                                            ipiv,
+                                            HIP_R_32F,
+                                            B,
+                                            ldb,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    double*             A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    double*             B,
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            HIP_R_64F,
+                                            A,
+                                            lda,
+                                            ipiv,
+                                            HIP_R_64F,
+                                            B,
+                                            ldb,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t           API,
+                                                    bool                STRIDED,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    int64_t             n,
+                                                    int64_t             nrhs,
+                                                    hipsolverComplex*   A,
+                                                    int64_t             lda,
+                                                    int64_t             stA,
+                                                    int64_t*            ipiv,
+                                                    int64_t             stP,
+                                                    hipsolverComplex*   B,
+                                                    int64_t             ldb,
+                                                    int64_t             stB,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost,
+                                                    int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            HIP_C_32F,
+                                            A,
+                                            lda,
+                                            ipiv,
+                                            HIP_C_32F,
+                                            B,
+                                            ldb,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs_bufferSize(testAPI_t               API,
+                                                    bool                    STRIDED,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    int64_t                 n,
+                                                    int64_t                 nrhs,
+                                                    hipsolverDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    int64_t                 stA,
+                                                    int64_t*                ipiv,
+                                                    int64_t                 stP,
+                                                    hipsolverDoubleComplex* B,
+                                                    int64_t                 ldb,
+                                                    int64_t                 stB,
+                                                    size_t*                 lworkOnDevice,
+                                                    size_t*                 lworkOnHost,
+                                                    int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs_bufferSize(handle,
+                                            uplo,
+                                            n,
+                                            nrhs,
+                                            HIP_C_64F,
+                                            A,
+                                            lda,
+                                            ipiv,
+                                            HIP_C_64F,
+                                            B,
+                                            ldb,
+                                            lworkOnDevice,
+                                            lworkOnHost);
+    default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         float*              A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         float*              B,
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         float*              work,
+                                         size_t              lwork,
+                                         float*              workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs(handle,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 HIP_R_32F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_R_32F,
+                                 B,
+                                 ldb,
+                                 work,
+                                 lwork,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         double*             A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         double*             B,
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         double*             work,
+                                         size_t              lwork,
+                                         double*             workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs(handle,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 HIP_R_64F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_R_64F,
+                                 B,
+                                 ldb,
+                                 work,
+                                 lwork,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t           API,
+                                         bool                STRIDED,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int64_t             n,
+                                         int64_t             nrhs,
+                                         hipsolverComplex*   A,
+                                         int64_t             lda,
+                                         int64_t             stA,
+                                         int64_t*            ipiv,
+                                         int64_t             stP,
+                                         hipsolverComplex*   B,
+                                         int64_t             ldb,
+                                         int64_t             stB,
+                                         hipsolverComplex*   work,
+                                         size_t              lwork,
+                                         hipsolverComplex*   workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info,
+                                         int                 bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs(handle,
+                                 uplo,
+                                 n,
+                                 nrhs,
+                                 HIP_C_32F,
+                                 A,
+                                 lda,
+                                 ipiv,
+                                 HIP_C_32F,
+                                 B,
+                                 ldb,
+                                 work,
+                                 lwork,
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+inline hipsolverStatus_t hipsolver_sytrs(testAPI_t               API,
+                                         bool                    STRIDED,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         int64_t                 n,
+                                         int64_t                 nrhs,
+                                         hipsolverDoubleComplex* A,
+                                         int64_t                 lda,
+                                         int64_t                 stA,
+                                         int64_t*                ipiv,
+                                         int64_t                 stP,
+                                         hipsolverDoubleComplex* B,
+                                         int64_t                 ldb,
+                                         int64_t                 stB,
+                                         hipsolverDoubleComplex* work,
+                                         size_t                  lwork,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         size_t                  lworkOnHost,
+                                         int*                    info,
+                                         int                     bc)
+{
+    switch(api2marshal(API, STRIDED))
+    {
+    case COMPAT_NORMAL:
+        return hipsolverDnXsytrs(handle,
                                  uplo,
                                  n,
-                                 (hipDoubleComplex*)A,
+                                 nrhs,
+                                 HIP_C_64F,
+                                 A,
                                  lda,
-                                 (hipDoubleComplex*)B,
+                                 ipiv,
+                                 HIP_C_64F,
+                                 B,
                                  ldb,
-                                 W,
-                                 (hipDoubleComplex*)work,
+                                 work,
                                  lwork,
-                                 info,
-                                 params);
+                                 workOnHost,
+                                 lworkOnHost,
+                                 info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 /********************************************************/
 
-/******************** SYTRD/HETRD ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          float*              A,
-                                                          int                 lda,
-                                                          float*              D,
-                                                          float*              E,
-                                                          float*              tau,
-                                                          int*                lwork)
+/******************** TRTRI ********************/
+inline hipsolverStatus_t hipsolver_trtri_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    hipblasDiagType_t   diag,
+                                                    int64_t             n,
+                                                    float*              A,
+                                                    int64_t             lda,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverSsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    case API_FORTRAN:
-        return hipsolverSsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri_bufferSize(
+            handle, uplo, diag, n, HIP_R_32F, A, lda, lworkOnDevice, lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          double*             A,
-                                                          int                 lda,
-                                                          double*             D,
-                                                          double*             E,
-                                                          double*             tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_trtri_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    hipblasDiagType_t   diag,
+                                                    int64_t             n,
+                                                    double*             A,
+                                                    int64_t             lda,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverDsytrd_bufferSize(handle, uplo, n, A, lda, D, E, tau, lwork);
-    case API_FORTRAN:
-        return hipsolverDsytrd_bufferSizeFortran(handle, uplo, n, A, lda, D, E, tau, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri_bufferSize(
+            handle, uplo, diag, n, HIP_R_64F, A, lda, lworkOnDevice, lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t           API,
-                                                          hipsolverHandle_t   handle,
-                                                          hipsolverFillMode_t uplo,
-                                                          int                 n,
-                                                          hipsolverComplex*   A,
-                                                          int                 lda,
-                                                          float*              D,
-                                                          float*              E,
-                                                          hipsolverComplex*   tau,
-                                                          int*                lwork)
+inline hipsolverStatus_t hipsolver_trtri_bufferSize(testAPI_t           API,
+                                                    hipsolverHandle_t   handle,
+                                                    hipsolverFillMode_t uplo,
+                                                    hipblasDiagType_t   diag,
+                                                    int64_t             n,
+                                                    hipsolverComplex*   A,
+                                                    int64_t             lda,
+                                                    size_t*             lworkOnDevice,
+                                                    size_t*             lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverChetrd_bufferSize(
-            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
-    case API_FORTRAN:
-        return hipsolverChetrd_bufferSizeFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, D, E, (hipFloatComplex*)tau, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri_bufferSize(
+            handle, uplo, diag, n, HIP_C_32F, A, lda, lworkOnDevice, lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd_bufferSize(testAPI_t               API,
-                                                          hipsolverHandle_t       handle,
-                                                          hipsolverFillMode_t     uplo,
-                                                          int                     n,
-                                                          hipsolverDoubleComplex* A,
-                                                          int                     lda,
-                                                          double*                 D,
-                                                          double*                 E,
-                                                          hipsolverDoubleComplex* tau,
-                                                          int*                    lwork)
+inline hipsolverStatus_t hipsolver_trtri_bufferSize(testAPI_t               API,
+                                                    hipsolverHandle_t       handle,
+                                                    hipsolverFillMode_t     uplo,
+                                                    hipblasDiagType_t       diag,
+                                                    int64_t                 n,
+                                                    hipsolverDoubleComplex* A,
+                                                    int64_t                 lda,
+                                                    size_t*                 lworkOnDevice,
+                                                    size_t*                 lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverZhetrd_bufferSize(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
-    case API_FORTRAN:
-        return hipsolverZhetrd_bufferSizeFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, D, E, (hipDoubleComplex*)tau, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri_bufferSize(
+            handle, uplo, diag, n, HIP_C_64F, A, lda, lworkOnDevice, lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               float*              A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              D,
-                                               int                 stD,
-                                               float*              E,
-                                               int                 stE,
-                                               float*              tau,
-                                               int                 stP,
-                                               float*              work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_trtri(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         hipblasDiagType_t   diag,
+                                         int64_t             n,
+                                         float*              A,
+                                         int64_t             lda,
+                                         float*              work,
+                                         size_t              lwork,
+                                         float*              workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverSsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri(
+            handle, uplo, diag, n, HIP_R_32F, A, lda, work, lwork, workOnHost, lworkOnHost, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               double*             A,
-                                               int                 lda,
-                                               int                 stA,
-                                               double*             D,
-                                               int                 stD,
-                                               double*             E,
-                                               int                 stE,
-                                               double*             tau,
-                                               int                 stP,
-                                               double*             work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_trtri(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         hipblasDiagType_t   diag,
+                                         int64_t             n,
+                                         double*             A,
+                                         int64_t             lda,
+                                         double*             work,
+                                         size_t              lwork,
+                                         double*             workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverDsytrd(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDsytrdFortran(handle, uplo, n, A, lda, D, E, tau, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri(
+            handle, uplo, diag, n, HIP_R_64F, A, lda, work, lwork, workOnHost, lworkOnHost, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t           API,
-                                               hipsolverHandle_t   handle,
-                                               hipsolverFillMode_t uplo,
-                                               int                 n,
-                                               hipsolverComplex*   A,
-                                               int                 lda,
-                                               int                 stA,
-                                               float*              D,
-                                               int                 stD,
-                                               float*              E,
-                                               int                 stE,
-                                               hipsolverComplex*   tau,
-                                               int                 stP,
-                                               hipsolverComplex*   work,
-                                               int                 lwork,
-                                               int*                info,
-                                               int                 bc)
+inline hipsolverStatus_t hipsolver_trtri(testAPI_t           API,
+                                         hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         hipblasDiagType_t   diag,
+                                         int64_t             n,
+                                         hipsolverComplex*   A,
+                                         int64_t             lda,
+                                         hipsolverComplex*   work,
+                                         size_t              lwork,
+                                         hipsolverComplex*   workOnHost,
+                                         size_t              lworkOnHost,
+                                         int*                info)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverChetrd(handle,
-                               uplo,
-                               n,
-                               (hipFloatComplex*)A,
-                               lda,
-                               D,
-                               E,
-                               (hipFloatComplex*)tau,
-                               (hipFloatComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverChetrdFortran(handle,
-                                      uplo,
-                                      n,
-                                      (hipFloatComplex*)A,
-                                      lda,
-                                      D,
-                                      E,
-                                      (hipFloatComplex*)tau,
-                                      (hipFloatComplex*)work,
-                                      lwork,
-                                      info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri(
+            handle, uplo, diag, n, HIP_C_32F, A, lda, work, lwork, workOnHost, lworkOnHost, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrd_hetrd(testAPI_t               API,
-                                               hipsolverHandle_t       handle,
-                                               hipsolverFillMode_t     uplo,
-                                               int                     n,
-                                               hipsolverDoubleComplex* A,
-                                               int                     lda,
-                                               int                     stA,
-                                               double*                 D,
-                                               int                     stD,
-                                               double*                 E,
-                                               int                     stE,
-                                               hipsolverDoubleComplex* tau,
-                                               int                     stP,
-                                               hipsolverDoubleComplex* work,
-                                               int                     lwork,
-                                               int*                    info,
-                                               int                     bc)
+inline hipsolverStatus_t hipsolver_trtri(testAPI_t               API,
+                                         hipsolverHandle_t       handle,
+                                         hipsolverFillMode_t     uplo,
+                                         hipblasDiagType_t       diag,
+                                         int64_t                 n,
+                                         hipsolverDoubleComplex* A,
+                                         int64_t                 lda,
+                                         hipsolverDoubleComplex* work,
+                                         size_t                  lwork,
+                                         hipsolverDoubleComplex* workOnHost,
+                                         size_t                  lworkOnHost,
+                                         int*                    info)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverZhetrd(handle,
-                               uplo,
-                               n,
-                               (hipDoubleComplex*)A,
-                               lda,
-                               D,
-                               E,
-                               (hipDoubleComplex*)tau,
-                               (hipDoubleComplex*)work,
-                               lwork,
-                               info);
-    case API_FORTRAN:
-        return hipsolverZhetrdFortran(handle,
-                                      uplo,
-                                      n,
-                                      (hipDoubleComplex*)A,
-                                      lda,
-                                      D,
-                                      E,
-                                      (hipDoubleComplex*)tau,
-                                      (hipDoubleComplex*)work,
-                                      lwork,
-                                      info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXtrtri(
+            handle, uplo, diag, n, HIP_C_64F, A, lda, work, lwork, workOnHost, lworkOnHost, info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
-/********************************************************/
 
-/******************** SYTRF ********************/
-// normal and strided_batched
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, float* A, int lda, int* lwork)
+/******************** GESVDR ********************/
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t           API,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     signed char         jobu,
+                                                     signed char         jobv,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     int64_t             k,
+                                                     int64_t             p,
+                                                     int64_t             niters,
+                                                     float*              A,
+                                                     int64_t             lda,
+                                                     float*              S,
+                                                     float*              U,
+                                                     int64_t             ldu,
+                                                     float*              V,
+                                                     int64_t             ldv,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverSsytrf_bufferSize(handle, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverSsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_R_32F,
+                                             A,
+                                             lda,
+                                             HIP_R_32F,
+                                             S,
+                                             HIP_R_32F,
+                                             U,
+                                             ldu,
+                                             HIP_R_32F,
+                                             V,
+                                             ldv,
+                                             HIP_R_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, double* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t           API,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     signed char         jobu,
+                                                     signed char         jobv,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     int64_t             k,
+                                                     int64_t             p,
+                                                     int64_t             niters,
+                                                     double*             A,
+                                                     int64_t             lda,
+                                                     double*             S,
+                                                     double*             U,
+                                                     int64_t             ldu,
+                                                     double*             V,
+                                                     int64_t             ldv,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverDsytrf_bufferSize(handle, n, A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverDsytrf_bufferSizeFortran(handle, n, A, lda, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_R_64F,
+                                             A,
+                                             lda,
+                                             HIP_R_64F,
+                                             S,
+                                             HIP_R_64F,
+                                             U,
+                                             ldu,
+                                             HIP_R_64F,
+                                             V,
+                                             ldv,
+                                             HIP_R_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverComplex* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t           API,
+                                                     hipsolverHandle_t   handle,
+                                                     hipsolverDnParams_t params,
+                                                     signed char         jobu,
+                                                     signed char         jobv,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     int64_t             k,
+                                                     int64_t             p,
+                                                     int64_t             niters,
+                                                     hipsolverComplex*   A,
+                                                     int64_t             lda,
+                                                     float*              S,
+                                                     hipsolverComplex*   U,
+                                                     int64_t             ldu,
+                                                     hipsolverComplex*   V,
+                                                     int64_t             ldv,
+                                                     size_t*             lworkOnDevice,
+                                                     size_t*             lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverCsytrf_bufferSize(handle, n, (hipFloatComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverCsytrf_bufferSizeFortran(handle, n, (hipFloatComplex*)A, lda, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_C_32F,
+                                             A,
+                                             lda,
+                                             HIP_R_32F,
+                                             S,
+                                             HIP_C_32F,
+                                             U,
+                                             ldu,
+                                             HIP_C_32F,
+                                             V,
+                                             ldv,
+                                             HIP_C_32F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf_bufferSize(
-    testAPI_t API, hipsolverHandle_t handle, int n, hipsolverDoubleComplex* A, int lda, int* lwork)
+inline hipsolverStatus_t hipsolver_gesvdr_bufferSize(testAPI_t               API,
+                                                     hipsolverHandle_t       handle,
+                                                     hipsolverDnParams_t     params,
+                                                     signed char             jobu,
+                                                     signed char             jobv,
+                                                     int64_t                 m,
+                                                     int64_t                 n,
+                                                     int64_t                 k,
+                                                     int64_t                 p,
+                                                     int64_t                 niters,
+                                                     hipsolverDoubleComplex* A,
+                                                     int64_t                 lda,
+                                                     double*                 S,
+                                                     hipsolverDoubleComplex* U,
+                                                     int64_t                 ldu,
+                                                     hipsolverDoubleComplex* V,
+                                                     int64_t                 ldv,
+                                                     size_t*                 lworkOnDevice,
+                                                     size_t*                 lworkOnHost)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverZsytrf_bufferSize(handle, n, (hipDoubleComplex*)A, lda, lwork);
-    case API_FORTRAN:
-        return hipsolverZsytrf_bufferSizeFortran(handle, n, (hipDoubleComplex*)A, lda, lwork);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr_bufferSize(handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             HIP_C_64F,
+                                             A,
+                                             lda,
+                                             HIP_R_64F,
+                                             S,
+                                             HIP_C_64F,
+                                             U,
+                                             ldu,
+                                             HIP_C_64F,
+                                             V,
+                                             ldv,
+                                             HIP_C_64F,
+                                             lworkOnDevice,
+                                             lworkOnHost);
     default:
+        *lworkOnDevice = 0;
+        *lworkOnHost   = 0;
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         float*              A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         float*              work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
-{
-    switch(API)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t           API,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          signed char         jobu,
+                                          signed char         jobv,
+                                          int64_t             m,
+                                          int64_t             n,
+                                          int64_t             k,
+                                          int64_t             p,
+                                          int64_t             niters,
+                                          float*              A,
+                                          int64_t             lda,
+                                          float*              S,
+                                          float*              U,
+                                          int64_t             ldu,
+                                          float*              V,
+                                          int64_t             ldv,
+                                          float*              work,
+                                          size_t              lwork,
+                                          float*              workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info)
+{
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverSsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverSsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_R_32F,
+                                  A,
+                                  lda,
+                                  HIP_R_32F,
+                                  S,
+                                  HIP_R_32F,
+                                  U,
+                                  ldu,
+                                  HIP_R_32F,
+                                  V,
+                                  ldv,
+                                  HIP_R_32F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         double*             A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         double*             work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t           API,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          signed char         jobu,
+                                          signed char         jobv,
+                                          int64_t             m,
+                                          int64_t             n,
+                                          int64_t             k,
+                                          int64_t             p,
+                                          int64_t             niters,
+                                          double*             A,
+                                          int64_t             lda,
+                                          double*             S,
+                                          double*             U,
+                                          int64_t             ldu,
+                                          double*             V,
+                                          int64_t             ldv,
+                                          double*             work,
+                                          size_t              lwork,
+                                          double*             workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverDsytrf(handle, uplo, n, A, lda, ipiv, work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverDsytrfFortran(handle, uplo, n, A, lda, ipiv, work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_R_64F,
+                                  A,
+                                  lda,
+                                  HIP_R_64F,
+                                  S,
+                                  HIP_R_64F,
+                                  U,
+                                  ldu,
+                                  HIP_R_64F,
+                                  V,
+                                  ldv,
+                                  HIP_R_64F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t           API,
-                                         hipsolverHandle_t   handle,
-                                         hipsolverFillMode_t uplo,
-                                         int                 n,
-                                         hipsolverComplex*   A,
-                                         int                 lda,
-                                         int                 stA,
-                                         int*                ipiv,
-                                         int                 stP,
-                                         hipsolverComplex*   work,
-                                         int                 lwork,
-                                         int*                info,
-                                         int                 bc)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t           API,
+                                          hipsolverHandle_t   handle,
+                                          hipsolverDnParams_t params,
+                                          signed char         jobu,
+                                          signed char         jobv,
+                                          int64_t             m,
+                                          int64_t             n,
+                                          int64_t             k,
+                                          int64_t             p,
+                                          int64_t             niters,
+                                          hipsolverComplex*   A,
+                                          int64_t             lda,
+                                          float*              S,
+                                          hipsolverComplex*   U,
+                                          int64_t             ldu,
+                                          hipsolverComplex*   V,
+                                          int64_t             ldv,
+                                          hipsolverComplex*   work,
+                                          size_t              lwork,
+                                          hipsolverComplex*   workOnHost,
+                                          size_t              lworkOnHost,
+                                          int*                info)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverCsytrf(
-            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverCsytrfFortran(
-            handle, uplo, n, (hipFloatComplex*)A, lda, ipiv, (hipFloatComplex*)work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_C_32F,
+                                  A,
+                                  lda,
+                                  HIP_R_32F,
+                                  S,
+                                  HIP_C_32F,
+                                  U,
+                                  ldu,
+                                  HIP_C_32F,
+                                  V,
+                                  ldv,
+                                  HIP_C_32F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
 }
 
-inline hipsolverStatus_t hipsolver_sytrf(testAPI_t               API,
-                                         hipsolverHandle_t       handle,
-                                         hipsolverFillMode_t     uplo,
-                                         int                     n,
-                                         hipsolverDoubleComplex* A,
-                                         int                     lda,
-                                         int                     stA,
-                                         int*                    ipiv,
-                                         int                     stP,
-                                         hipsolverDoubleComplex* work,
-                                         int                     lwork,
-                                         int*                    info,
-                                         int                     bc)
+inline hipsolverStatus_t hipsolver_gesvdr(testAPI_t               API,
+                                          hipsolverHandle_t       handle,
+                                          hipsolverDnParams_t     params,
+                                          signed char             jobu,
+                                          signed char             jobv,
+                                          int64_t                 m,
+                                          int64_t                 n,
+                                          int64_t                 k,
+                                          int64_t                 p,
+                                          int64_t                 niters,
+                                          hipsolverDoubleComplex* A,
+                                          int64_t                 lda,
+                                          double*                 S,
+                                          hipsolverDoubleComplex* U,
+                                          int64_t                 ldu,
+                                          hipsolverDoubleComplex* V,
+                                          int64_t                 ldv,
+                                          hipsolverDoubleComplex* work,
+                                          size_t                  lwork,
+                                          hipsolverDoubleComplex* workOnHost,
+                                          size_t                  lworkOnHost,
+                                          int*                    info)
 {
-    switch(API)
+    switch(api2marshal(API, false))
     {
-    case API_NORMAL:
-        return hipsolverZsytrf(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
-    case API_FORTRAN:
-        return hipsolverZsytrfFortran(
-            handle, uplo, n, (hipDoubleComplex*)A, lda, ipiv, (hipDoubleComplex*)work, lwork, info);
+    case COMPAT_NORMAL:
+        return hipsolverDnXgesvdr(handle,
+                                  params,
+                                  jobu,
+                                  jobv,
+                                  m,
+                                  n,
+                                  k,
+                                  p,
+                                  niters,
+                                  HIP_C_64F,
+                                  A,
+                                  lda,
+                                  HIP_R_64F,
+                                  S,
+                                  HIP_C_64F,
+                                  U,
+                                  ldu,
+                                  HIP_C_64F,
+                                  V,
+                                  ldv,
+                                  HIP_C_64F,
+                                  work,
+                                  lwork,
+                                  workOnHost,
+                                  lworkOnHost,
+                                  info);
     default:
         return HIPSOLVER_STATUS_NOT_SUPPORTED;
     }
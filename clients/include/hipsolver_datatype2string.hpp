@@ -90,6 +90,8 @@ char hipsolver2char_eform(hipsolverEigType_t value);
 
 char hipsolver2char_erange(hipsolverEigRange_t value);
 
+char hipsolver2char_diag(hipblasDiagType_t value);
+
 /* ============================================================================================ */
 /*  Convert lapack char constants to hipsolver type. */
 
@@ -106,3 +108,5 @@ hipsolverEigMode_t char2hipsolver_evect(char value);
 hipsolverEigType_t char2hipsolver_eform(char value);
 
 hipsolverEigRange_t char2hipsolver_erange(char value);
+
+hipblasDiagType_t char2hipblas_diag(char value);
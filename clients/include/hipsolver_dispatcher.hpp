@@ -34,15 +34,19 @@
 #include "testing_gesvd.hpp"
 #include "testing_gesvda.hpp"
 #include "testing_gesvdj.hpp"
+#include "testing_gesvdr.hpp"
 #include "testing_getrf.hpp"
+#include "testing_getri.hpp"
 #include "testing_getrs.hpp"
 #include "testing_orgbr_ungbr.hpp"
 #include "testing_orgqr_ungqr.hpp"
 #include "testing_orgtr_ungtr.hpp"
 #include "testing_ormqr_unmqr.hpp"
 #include "testing_ormtr_unmtr.hpp"
+#include "testing_posv.hpp"
 #include "testing_potrf.hpp"
 #include "testing_potri.hpp"
+#include "testing_potri_batched.hpp"
 #include "testing_potrs.hpp"
 #include "testing_syevd_heevd.hpp"
 #include "testing_syevdx_heevdx.hpp"
@@ -50,8 +54,11 @@
 #include "testing_sygvd_hegvd.hpp"
 #include "testing_sygvdx_hegvdx.hpp"
 #include "testing_sygvj_hegvj.hpp"
+#include "testing_sysv.hpp"
 #include "testing_sytrd_hetrd.hpp"
 #include "testing_sytrf.hpp"
+#include "testing_sytrs.hpp"
+#include "testing_trtri.hpp"
 
 #ifdef HAVE_HIPSPARSE
 #include "testing_csrlsvchol.hpp"
@@ -77,24 +84,50 @@ class hipsolver_dispatcher
         // Map for functions that support all precisions
         static const func_map map = {
             {"gebrd", testing_gebrd<API_NORMAL, false, false, T>},
-            {"gels", testing_gels<API_NORMAL, false, false, false, T>},
+            {"gels", testing_gels<API_NORMAL, false, false, false, false, T>},
+            {"gels_mixed", testing_gels<API_NORMAL, false, false, false, true, T>},
             {"geqrf", testing_geqrf<API_NORMAL, false, false, T, int, int>},
             {"geqrf_64", testing_geqrf<API_COMPAT, false, false, T, int64_t, size_t>},
-            {"gesv", testing_gesv<API_NORMAL, false, false, false, T>},
-            {"gesvd", testing_gesvd<API_NORMAL, false, false, false, T>},
+            {"gesv", testing_gesv<API_NORMAL, false, false, false, false, T>},
+            {"gesv_mixed", testing_gesv<API_NORMAL, false, false, false, true, T>},
+            {"gesvd", testing_gesvd<API_NORMAL, false, false, false, T, int, int>},
+            {"gesvd_64", testing_gesvd<API_COMPAT, false, false, false, T, int64_t, size_t>},
             {"gesvda_strided_batched", testing_gesvda<API_COMPAT, false, true, T>},
             {"gesvdj", testing_gesvdj<API_NORMAL, false, false, T>},
             {"gesvdj_batched", testing_gesvdj<API_NORMAL, false, true, T>},
+            {"gesvdj_ptr_batched", testing_gesvdj<API_NORMAL, true, false, T>},
+            {"gesvdr_64", testing_gesvdr<API_COMPAT, T, int64_t, size_t>},
             {"getrf", testing_getrf<API_NORMAL, false, false, false, T, int, int>},
+            {"getrf_batched", testing_getrf<API_NORMAL, true, false, false, T, int, int>},
+            {"getrf_strided_batched", testing_getrf<API_NORMAL, false, true, false, T, int, int>},
+            {"getrf_npvt", testing_getrf<API_NORMAL, false, false, true, T, int, int>},
+            {"getrf_npvt_batched", testing_getrf<API_NORMAL, true, false, true, T, int, int>},
+            {"getrf_npvt_strided_batched",
+             testing_getrf<API_NORMAL, false, true, true, T, int, int>},
             {"getrf_64", testing_getrf<API_COMPAT, false, false, false, T, int64_t, size_t>},
+            {"getri_batched", testing_getri<API_NORMAL, true, false, T>},
+            {"getri_strided_batched", testing_getri<API_NORMAL, false, true, T>},
             {"getrs", testing_getrs<API_NORMAL, false, false, T, int, int>},
+            {"getrs_batched", testing_getrs<API_NORMAL, true, false, T, int, int>},
+            {"getrs_strided_batched", testing_getrs<API_NORMAL, false, true, T, int, int>},
             {"getrs_64", testing_getrs<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"posv", testing_posv<API_NORMAL, false, false, T>},
+            {"posv_batched", testing_posv<API_NORMAL, true, false, T>},
+            {"posv_strided_batched", testing_posv<API_NORMAL, false, true, T>},
             {"potrf", testing_potrf<API_NORMAL, false, false, T>},
             {"potrf_batched", testing_potrf<API_NORMAL, true, false, T>},
             {"potri", testing_potri<API_NORMAL, false, false, T>},
+            {"potri_batched", testing_potri_batched<API_NORMAL, true, false, T>},
+            {"potri_strided_batched", testing_potri_batched<API_NORMAL, false, true, T>},
             {"potrs", testing_potrs<API_NORMAL, false, false, T>},
             {"potrs_batched", testing_potrs<API_NORMAL, true, false, T>},
+            {"sysv", testing_sysv<API_NORMAL, false, false, T>},
+            {"sysv_strided_batched", testing_sysv<API_NORMAL, false, true, T>},
             {"sytrf", testing_sytrf<API_NORMAL, false, false, T>},
+            {"sytrs", testing_sytrs<API_NORMAL, false, false, T, int, int>},
+            {"sytrs_strided_batched", testing_sytrs<API_NORMAL, false, true, T, int, int>},
+            {"sytrs_64", testing_sytrs<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"trtri_64", testing_trtri<API_COMPAT, T, int64_t, size_t>},
         };
 
         // Grab function from the map and execute
@@ -118,11 +151,18 @@ class hipsolver_dispatcher
             {"orgtr", testing_orgtr_ungtr<API_NORMAL, T>},
             {"ormqr", testing_ormqr_unmqr<API_NORMAL, T>},
             {"ormtr", testing_ormtr_unmtr<API_NORMAL, T>},
-            {"syevd", testing_syevd_heevd<API_NORMAL, false, false, T>},
-            {"syevdx", testing_syevdx_heevdx<API_NORMAL, false, false, T>},
+            {"syevd", testing_syevd_heevd<API_NORMAL, false, false, T, int, int>},
+            {"syevd_64", testing_syevd_heevd<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"syevd_strided_batched", testing_syevd_heevd<API_NORMAL, false, true, T, int, int>},
+            {"syevdx", testing_syevdx_heevdx<API_NORMAL, false, false, T, int, int>},
+            {"syevdx_64", testing_syevdx_heevdx<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"syevdx_strided_batched",
+             testing_syevdx_heevdx<API_NORMAL, false, true, T, int, int>},
             {"syevj", testing_syevj_heevj<API_NORMAL, false, false, T>},
             {"syevj_batched", testing_syevj_heevj<API_NORMAL, false, true, T>},
+            {"syevj_ptr_batched", testing_syevj_heevj<API_NORMAL, true, false, T>},
             {"sygvd", testing_sygvd_hegvd<API_NORMAL, false, false, T>},
+            {"sygvd_strided_batched", testing_sygvd_hegvd<API_NORMAL, false, true, T>},
             {"sygvdx", testing_sygvdx_hegvdx<API_NORMAL, false, false, T>},
             {"sygvj", testing_sygvj_hegvj<API_NORMAL, false, false, T>},
             {"sytrd", testing_sytrd_hetrd<API_NORMAL, false, false, T>},
@@ -154,11 +194,18 @@ class hipsolver_dispatcher
             {"ungtr", testing_orgtr_ungtr<API_NORMAL, T>},
             {"unmqr", testing_ormqr_unmqr<API_NORMAL, T>},
             {"unmtr", testing_ormtr_unmtr<API_NORMAL, T>},
-            {"heevd", testing_syevd_heevd<API_NORMAL, false, false, T>},
-            {"heevdx", testing_syevdx_heevdx<API_NORMAL, false, false, T>},
+            {"heevd", testing_syevd_heevd<API_NORMAL, false, false, T, int, int>},
+            {"heevd_64", testing_syevd_heevd<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"heevd_strided_batched", testing_syevd_heevd<API_NORMAL, false, true, T, int, int>},
+            {"heevdx", testing_syevdx_heevdx<API_NORMAL, false, false, T, int, int>},
+            {"heevdx_64", testing_syevdx_heevdx<API_COMPAT, false, false, T, int64_t, size_t>},
+            {"heevdx_strided_batched",
+             testing_syevdx_heevdx<API_NORMAL, false, true, T, int, int>},
             {"heevj", testing_syevj_heevj<API_NORMAL, false, false, T>},
             {"heevj_batched", testing_syevj_heevj<API_NORMAL, false, true, T>},
+            {"heevj_ptr_batched", testing_syevj_heevj<API_NORMAL, true, false, T>},
             {"hegvd", testing_sygvd_hegvd<API_NORMAL, false, false, T>},
+            {"hegvd_strided_batched", testing_sygvd_hegvd<API_NORMAL, false, true, T>},
             {"hegvdx", testing_sygvdx_hegvdx<API_NORMAL, false, false, T>},
             {"hegvj", testing_sygvj_hegvj<API_NORMAL, false, false, T>},
             {"hetrd", testing_sytrd_hetrd<API_NORMAL, false, false, T>},
@@ -180,7 +227,11 @@ public:
     {
         hipsolverStatus_t status;
 
-        if(precision == 's')
+        // The mixed precision solvers are only provided for double and double complex data
+        if(name.size() > 6 && name.compare(name.size() - 6, 6, "_mixed") == 0
+           && precision != 'd' && precision != 'z')
+            status = HIPSOLVER_STATUS_INVALID_VALUE;
+        else if(precision == 's')
             status = run_function<float>(name.c_str(), argus);
         else if(precision == 'd')
             status = run_function<double>(name.c_str(), argus);
@@ -220,6 +220,9 @@ void cpu_gesvdx(hipsolverEigMode_t leftv,
 template <typename T>
 void cpu_getrf(int m, int n, T* A, int lda, int* ipiv, int* info);
 
+template <typename T>
+void cpu_getri(int n, T* A, int lda, int* ipiv, T* work, int lwork, int* info);
+
 template <typename T>
 void cpu_getrs(hipsolverOperation_t trans,
                int                  n,
@@ -329,3 +332,10 @@ void cpu_sytrd_hetrd(
 template <typename T>
 void cpu_sytrf(
     hipsolverFillMode_t uplo, int n, T* A, int lda, int* ipiv, T* work, int lwork, int* info);
+
+template <typename T>
+void cpu_sytrs(
+    hipsolverFillMode_t uplo, int n, int nrhs, T* A, int lda, int* ipiv, T* B, int ldb, int* info);
+
+template <typename T>
+void cpu_trtri(hipsolverFillMode_t uplo, hipblasDiagType_t diag, int n, T* A, int lda, int* info);
@@ -25,7 +25,7 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename U>
+template <testAPI_t API, bool MIXED, typename U>
 void gels_checkBadArgs(const hipsolverHandle_t handle,
                        const int               m,
                        const int               n,
@@ -48,6 +48,7 @@ void gels_checkBadArgs(const hipsolverHandle_t handle,
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_gels(API,
                                          false,
+                                         MIXED,
                                          nullptr,
                                          m,
                                          n,
@@ -75,6 +76,7 @@ void gels_checkBadArgs(const hipsolverHandle_t handle,
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gels(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          m,
                                          n,
@@ -96,6 +98,7 @@ void gels_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gels(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          m,
                                          n,
@@ -117,6 +120,7 @@ void gels_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gels(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          m,
                                          n,
@@ -138,6 +142,7 @@ void gels_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gels(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          m,
                                          n,
@@ -160,7 +165,7 @@ void gels_checkBadArgs(const hipsolverHandle_t handle,
 #endif
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, bool MIXED, typename T>
 void testing_gels_bad_arg()
 {
     // safe arguments
@@ -190,31 +195,42 @@ void testing_gels_bad_arg()
         // CHECK_HIP_ERROR(dInfo.memcheck());
 
         // size_t size_W;
-        // hipsolver_gels_bufferSize(
-        //     API, handle, m, n, nrhs, dA.data(), lda, dB.data(), ldb, dX.data(), ldx, &size_W);
+        // hipsolver_gels_bufferSize(API,
+        //                           MIXED,
+        //                           handle,
+        //                           m,
+        //                           n,
+        //                           nrhs,
+        //                           dA.data(),
+        //                           lda,
+        //                           dB.data(),
+        //                           ldb,
+        //                           dX.data(),
+        //                           ldx,
+        //                           &size_W);
         // device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         // if(size_W)
         //     CHECK_HIP_ERROR(dWork.memcheck());
 
         // // check bad arguments
-        // gels_checkBadArgs<API>(handle,
-        //                        m,
-        //                        n,
-        //                        nrhs,
-        //                        dA.data(),
-        //                        lda,
-        //                        stA,
-        //                        dB.data(),
-        //                        ldb,
-        //                        stB,
-        //                        dX.data(),
-        //                        ldx,
-        //                        stX,
-        //                        dWork.data(),
-        //                        size_W,
-        //                        hNIters.data(),
-        //                        dInfo.data(),
-        //                        bc);
+        // gels_checkBadArgs<API, MIXED>(handle,
+        //                               m,
+        //                               n,
+        //                               nrhs,
+        //                               dA.data(),
+        //                               lda,
+        //                               stA,
+        //                               dB.data(),
+        //                               ldb,
+        //                               stB,
+        //                               dX.data(),
+        //                               ldx,
+        //                               stX,
+        //                               dWork.data(),
+        //                               size_W,
+        //                               hNIters.data(),
+        //                               dInfo.data(),
+        //                               bc);
     }
     else
     {
@@ -230,31 +246,42 @@ void testing_gels_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         size_t size_W;
-        hipsolver_gels_bufferSize(
-            API, handle, m, n, nrhs, dA.data(), lda, dB.data(), ldb, dX.data(), ldx, &size_W);
+        hipsolver_gels_bufferSize(API,
+                                  MIXED,
+                                  handle,
+                                  m,
+                                  n,
+                                  nrhs,
+                                  dA.data(),
+                                  lda,
+                                  dB.data(),
+                                  ldb,
+                                  dX.data(),
+                                  ldx,
+                                  &size_W);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        gels_checkBadArgs<API>(handle,
-                               m,
-                               n,
-                               nrhs,
-                               dA.data(),
-                               lda,
-                               stA,
-                               dB.data(),
-                               ldb,
-                               stB,
-                               dX.data(),
-                               ldx,
-                               stX,
-                               dWork.data(),
-                               size_W,
-                               hNIters.data(),
-                               dInfo.data(),
-                               bc);
+        gels_checkBadArgs<API, MIXED>(handle,
+                                      m,
+                                      n,
+                                      nrhs,
+                                      dA.data(),
+                                      lda,
+                                      stA,
+                                      dB.data(),
+                                      ldb,
+                                      stB,
+                                      dX.data(),
+                                      ldx,
+                                      stX,
+                                      dWork.data(),
+                                      size_W,
+                                      hNIters.data(),
+                                      dInfo.data(),
+                                      bc);
     }
 }
 
@@ -318,6 +345,7 @@ void gels_initData(const hipsolverHandle_t handle,
 
 template <testAPI_t API,
           bool      INPLACE,
+          bool      MIXED,
           typename T,
           typename Td,
           typename Ud,
@@ -361,6 +389,7 @@ void gels_getError(const hipsolverHandle_t handle,
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_gels(API,
                                        INPLACE,
+                                       MIXED,
                                        handle,
                                        m,
                                        n,
@@ -432,6 +461,7 @@ void gels_getError(const hipsolverHandle_t handle,
 
 template <testAPI_t API,
           bool      INPLACE,
+          bool      MIXED,
           typename T,
           typename Td,
           typename Ud,
@@ -502,6 +532,7 @@ void gels_getPerfData(const hipsolverHandle_t handle,
 
         CHECK_ROCBLAS_ERROR(hipsolver_gels(API,
                                            INPLACE,
+                                           MIXED,
                                            handle,
                                            m,
                                            n,
@@ -535,6 +566,7 @@ void gels_getPerfData(const hipsolverHandle_t handle,
         start = get_time_us_sync(stream);
         hipsolver_gels(API,
                        INPLACE,
+                       MIXED,
                        handle,
                        m,
                        n,
@@ -562,6 +594,7 @@ template <testAPI_t API,
           bool      BATCHED,
           bool      STRIDED,
           bool      INPLACE,
+          bool      MIXED,
           typename T,
           bool COMPLEX = is_complex<T>>
 void testing_gels(Arguments& argus)
@@ -604,6 +637,7 @@ void testing_gels(Arguments& argus)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_gels(API,
             //                                      INPLACE,
+            //                                      MIXED,
             //                                      handle,
             //                                      m,
             //                                      n,
@@ -628,6 +662,7 @@ void testing_gels(Arguments& argus)
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gels(API,
                                                  INPLACE,
+                                                 MIXED,
                                                  handle,
                                                  m,
                                                  n,
@@ -657,8 +692,19 @@ void testing_gels(Arguments& argus)
 
     // memory size query is necessary
     size_t size_W;
-    hipsolver_gels_bufferSize(
-        API, handle, m, n, nrhs, (T*)nullptr, lda, (T*)nullptr, ldb, (T*)nullptr, ldx, &size_W);
+    hipsolver_gels_bufferSize(API,
+                              MIXED,
+                              handle,
+                              m,
+                              n,
+                              nrhs,
+                              (T*)nullptr,
+                              lda,
+                              (T*)nullptr,
+                              ldb,
+                              (T*)nullptr,
+                              ldx,
+                              &size_W);
 
     if(argus.mem_query)
     {
@@ -695,61 +741,61 @@ void testing_gels(Arguments& argus)
 
         // // check computations
         // if(argus.unit_check || argus.norm_check)
-        //     gels_getError<API, INPLACE, T>(handle,
-        //                                    m,
-        //                                    n,
-        //                                    nrhs,
-        //                                    dA,
-        //                                    lda,
-        //                                    stA,
-        //                                    dB,
-        //                                    ldb,
-        //                                    stB,
-        //                                    dX,
-        //                                    ldx,
-        //                                    stX,
-        //                                    dWork,
-        //                                    size_W,
-        //                                    dInfo,
-        //                                    bc,
-        //                                    hA,
-        //                                    hB,
-        //                                    hBRes,
-        //                                    hX,
-        //                                    hXRes,
-        //                                    hNIters,
-        //                                    hInfo,
-        //                                    hInfoRes,
-        //                                    &max_error);
+        //     gels_getError<API, INPLACE, MIXED, T>(handle,
+        //                                           m,
+        //                                           n,
+        //                                           nrhs,
+        //                                           dA,
+        //                                           lda,
+        //                                           stA,
+        //                                           dB,
+        //                                           ldb,
+        //                                           stB,
+        //                                           dX,
+        //                                           ldx,
+        //                                           stX,
+        //                                           dWork,
+        //                                           size_W,
+        //                                           dInfo,
+        //                                           bc,
+        //                                           hA,
+        //                                           hB,
+        //                                           hBRes,
+        //                                           hX,
+        //                                           hXRes,
+        //                                           hNIters,
+        //                                           hInfo,
+        //                                           hInfoRes,
+        //                                           &max_error);
 
         // // collect performance data
         // if(argus.timing)
-        //     gels_getPerfData<API, INPLACE, T>(handle,
-        //                                       m,
-        //                                       n,
-        //                                       nrhs,
-        //                                       dA,
-        //                                       lda,
-        //                                       stA,
-        //                                       dB,
-        //                                       ldb,
-        //                                       stB,
-        //                                       dX,
-        //                                       ldx,
-        //                                       stX,
-        //                                       dWork,
-        //                                       size_W,
-        //                                       dInfo,
-        //                                       bc,
-        //                                       hA,
-        //                                       hB,
-        //                                       hX,
-        //                                       hNIters,
-        //                                       hInfo,
-        //                                       &gpu_time_used,
-        //                                       &cpu_time_used,
-        //                                       hot_calls,
-        //                                       argus.perf);
+        //     gels_getPerfData<API, INPLACE, MIXED, T>(handle,
+        //                                              m,
+        //                                              n,
+        //                                              nrhs,
+        //                                              dA,
+        //                                              lda,
+        //                                              stA,
+        //                                              dB,
+        //                                              ldb,
+        //                                              stB,
+        //                                              dX,
+        //                                              ldx,
+        //                                              stX,
+        //                                              dWork,
+        //                                              size_W,
+        //                                              dInfo,
+        //                                              bc,
+        //                                              hA,
+        //                                              hB,
+        //                                              hX,
+        //                                              hNIters,
+        //                                              hInfo,
+        //                                              &gpu_time_used,
+        //                                              &cpu_time_used,
+        //                                              hot_calls,
+        //                                              argus.perf);
     }
     else
     {
@@ -780,61 +826,61 @@ void testing_gels(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            gels_getError<API, INPLACE, T>(handle,
-                                           m,
-                                           n,
-                                           nrhs,
-                                           dA,
-                                           lda,
-                                           stA,
-                                           dB,
-                                           ldb,
-                                           stB,
-                                           dX,
-                                           ldx,
-                                           stX,
-                                           dWork,
-                                           size_W,
-                                           dInfo,
-                                           bc,
-                                           hA,
-                                           hB,
-                                           hBRes,
-                                           hX,
-                                           hXRes,
-                                           hNIters,
-                                           hInfo,
-                                           hInfoRes,
-                                           &max_error);
+            gels_getError<API, INPLACE, MIXED, T>(handle,
+                                                  m,
+                                                  n,
+                                                  nrhs,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dB,
+                                                  ldb,
+                                                  stB,
+                                                  dX,
+                                                  ldx,
+                                                  stX,
+                                                  dWork,
+                                                  size_W,
+                                                  dInfo,
+                                                  bc,
+                                                  hA,
+                                                  hB,
+                                                  hBRes,
+                                                  hX,
+                                                  hXRes,
+                                                  hNIters,
+                                                  hInfo,
+                                                  hInfoRes,
+                                                  &max_error);
 
         // collect performance data
         if(argus.timing)
-            gels_getPerfData<API, INPLACE, T>(handle,
-                                              m,
-                                              n,
-                                              nrhs,
-                                              dA,
-                                              lda,
-                                              stA,
-                                              dB,
-                                              ldb,
-                                              stB,
-                                              dX,
-                                              ldx,
-                                              stX,
-                                              dWork,
-                                              size_W,
-                                              dInfo,
-                                              bc,
-                                              hA,
-                                              hB,
-                                              hX,
-                                              hNIters,
-                                              hInfo,
-                                              &gpu_time_used,
-                                              &cpu_time_used,
-                                              hot_calls,
-                                              argus.perf);
+            gels_getPerfData<API, INPLACE, MIXED, T>(handle,
+                                                     m,
+                                                     n,
+                                                     nrhs,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dB,
+                                                     ldb,
+                                                     stB,
+                                                     dX,
+                                                     ldx,
+                                                     stX,
+                                                     dWork,
+                                                     size_W,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hB,
+                                                     hX,
+                                                     hNIters,
+                                                     hInfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
     }
     // validate results for rocsolver-test
     // using max(m,n) * machine_precision as tolerance
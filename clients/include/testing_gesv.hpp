@@ -25,7 +25,7 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename U>
+template <testAPI_t API, bool MIXED, typename T, typename U>
 void gesv_checkBadArgs(const hipsolverHandle_t handle,
                        const int               n,
                        const int               nrhs,
@@ -49,6 +49,7 @@ void gesv_checkBadArgs(const hipsolverHandle_t handle,
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
                                          false,
+                                         MIXED,
                                          nullptr,
                                          n,
                                          nrhs,
@@ -77,6 +78,7 @@ void gesv_checkBadArgs(const hipsolverHandle_t handle,
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          n,
                                          nrhs,
@@ -99,6 +101,7 @@ void gesv_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          n,
                                          nrhs,
@@ -121,6 +124,7 @@ void gesv_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          n,
                                          nrhs,
@@ -143,6 +147,7 @@ void gesv_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          n,
                                          nrhs,
@@ -165,6 +170,7 @@ void gesv_checkBadArgs(const hipsolverHandle_t handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
                                          false,
+                                         MIXED,
                                          handle,
                                          n,
                                          nrhs,
@@ -188,7 +194,7 @@ void gesv_checkBadArgs(const hipsolverHandle_t handle,
 #endif
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, bool MIXED, typename T>
 void testing_gesv_bad_arg()
 {
     // safe arguments
@@ -221,6 +227,7 @@ void testing_gesv_bad_arg()
 
         // size_t size_W;
         // hipsolver_gesv_bufferSize(API,
+        //                           MIXED,
         //                           handle,
         //                           n,
         //                           nrhs,
@@ -237,25 +244,25 @@ void testing_gesv_bad_arg()
         //     CHECK_HIP_ERROR(dWork.memcheck());
 
         // // check bad arguments
-        // gesv_checkBadArgs<API>(handle,
-        //                        n,
-        //                        nrhs,
-        //                        dA.data(),
-        //                        lda,
-        //                        stA,
-        //                        dIpiv.data(),
-        //                        stP,
-        //                        dB.data(),
-        //                        ldb,
-        //                        stB,
-        //                        dX.data(),
-        //                        ldx,
-        //                        stX,
-        //                        dWork.data(),
-        //                        size_W,
-        //                        hNiters.data(),
-        //                        dInfo.data(),
-        //                        bc);
+        // gesv_checkBadArgs<API, MIXED>(handle,
+        //                               n,
+        //                               nrhs,
+        //                               dA.data(),
+        //                               lda,
+        //                               stA,
+        //                               dIpiv.data(),
+        //                               stP,
+        //                               dB.data(),
+        //                               ldb,
+        //                               stB,
+        //                               dX.data(),
+        //                               ldx,
+        //                               stX,
+        //                               dWork.data(),
+        //                               size_W,
+        //                               hNiters.data(),
+        //                               dInfo.data(),
+        //                               bc);
     }
     else
     {
@@ -274,6 +281,7 @@ void testing_gesv_bad_arg()
 
         size_t size_W;
         hipsolver_gesv_bufferSize(API,
+                                  MIXED,
                                   handle,
                                   n,
                                   nrhs,
@@ -290,25 +298,25 @@ void testing_gesv_bad_arg()
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        gesv_checkBadArgs<API>(handle,
-                               n,
-                               nrhs,
-                               dA.data(),
-                               lda,
-                               stA,
-                               dIpiv.data(),
-                               stP,
-                               dB.data(),
-                               ldb,
-                               stB,
-                               dX.data(),
-                               ldx,
-                               stX,
-                               dWork.data(),
-                               size_W,
-                               hNiters.data(),
-                               dInfo.data(),
-                               bc);
+        gesv_checkBadArgs<API, MIXED>(handle,
+                                      n,
+                                      nrhs,
+                                      dA.data(),
+                                      lda,
+                                      stA,
+                                      dIpiv.data(),
+                                      stP,
+                                      dB.data(),
+                                      ldb,
+                                      stB,
+                                      dX.data(),
+                                      ldx,
+                                      stX,
+                                      dWork.data(),
+                                      size_W,
+                                      hNiters.data(),
+                                      dInfo.data(),
+                                      bc);
     }
 }
 
@@ -361,6 +369,7 @@ void gesv_initData(const hipsolverHandle_t handle,
 
 template <testAPI_t API,
           bool      INPLACE,
+          bool      MIXED,
           typename T,
           typename Td,
           typename Ud,
@@ -401,6 +410,7 @@ void gesv_getError(const hipsolverHandle_t handle,
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_gesv(API,
                                        INPLACE,
+                                       MIXED,
                                        handle,
                                        n,
                                        nrhs,
@@ -460,6 +470,7 @@ void gesv_getError(const hipsolverHandle_t handle,
 
 template <testAPI_t API,
           bool      INPLACE,
+          bool      MIXED,
           typename T,
           typename Td,
           typename Ud,
@@ -518,6 +529,7 @@ void gesv_getPerfData(const hipsolverHandle_t handle,
 
         CHECK_ROCBLAS_ERROR(hipsolver_gesv(API,
                                            INPLACE,
+                                           MIXED,
                                            handle,
                                            n,
                                            nrhs,
@@ -552,6 +564,7 @@ void gesv_getPerfData(const hipsolverHandle_t handle,
         start = get_time_us_sync(stream);
         hipsolver_gesv(API,
                        INPLACE,
+                       MIXED,
                        handle,
                        n,
                        nrhs,
@@ -576,7 +589,7 @@ void gesv_getPerfData(const hipsolverHandle_t handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, bool INPLACE, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, bool INPLACE, bool MIXED, typename T>
 void testing_gesv(Arguments& argus)
 {
     // get arguments
@@ -616,6 +629,7 @@ void testing_gesv(Arguments& argus)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
             //                                      INPLACE,
+            //                                      MIXED,
             //                                      handle,
             //                                      n,
             //                                      nrhs,
@@ -641,6 +655,7 @@ void testing_gesv(Arguments& argus)
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_gesv(API,
                                                  INPLACE,
+                                                 MIXED,
                                                  handle,
                                                  n,
                                                  nrhs,
@@ -672,6 +687,7 @@ void testing_gesv(Arguments& argus)
     // memory size query is necessary
     size_t size_W;
     hipsolver_gesv_bufferSize(API,
+                              MIXED,
                               handle,
                               n,
                               nrhs,
@@ -720,62 +736,62 @@ void testing_gesv(Arguments& argus)
 
         // // check computations
         // if(argus.unit_check || argus.norm_check)
-        //     gesv_getError<API, INPLACE, T>(handle,
-        //                                    n,
-        //                                    nrhs,
-        //                                    dA,
-        //                                    lda,
-        //                                    stA,
-        //                                    dIpiv,
-        //                                    stP,
-        //                                    dB,
-        //                                    ldb,
-        //                                    stB,
-        //                                    dX,
-        //                                    ldx,
-        //                                    stX,
-        //                                    dWork,
-        //                                    size_W,
-        //                                    dInfo,
-        //                                    bc,
-        //                                    hA,
-        //                                    hIpiv,
-        //                                    hB,
-        //                                    hBRes,
-        //                                    hNiters,
-        //                                    hInfo,
-        //                                    hInfoRes,
-        //                                    &max_error);
+        //     gesv_getError<API, INPLACE, MIXED, T>(handle,
+        //                                           n,
+        //                                           nrhs,
+        //                                           dA,
+        //                                           lda,
+        //                                           stA,
+        //                                           dIpiv,
+        //                                           stP,
+        //                                           dB,
+        //                                           ldb,
+        //                                           stB,
+        //                                           dX,
+        //                                           ldx,
+        //                                           stX,
+        //                                           dWork,
+        //                                           size_W,
+        //                                           dInfo,
+        //                                           bc,
+        //                                           hA,
+        //                                           hIpiv,
+        //                                           hB,
+        //                                           hBRes,
+        //                                           hNiters,
+        //                                           hInfo,
+        //                                           hInfoRes,
+        //                                           &max_error);
 
         // // collect performance data
         // if(argus.timing)
-        //     gesv_getPerfData<API, INPLACE, T>(handle,
-        //                                       n,
-        //                                       nrhs,
-        //                                       dA,
-        //                                       lda,
-        //                                       stA,
-        //                                       dIpiv,
-        //                                       stP,
-        //                                       dB,
-        //                                       ldb,
-        //                                       stB,
-        //                                       dX,
-        //                                       ldx,
-        //                                       stX,
-        //                                       dWork,
-        //                                       size_W,
-        //                                       dInfo,
-        //                                       bc,
-        //                                       hA,
-        //                                       hIpiv,
-        //                                       hB,
-        //                                       hNiters,
-        //                                       hInfo,
-        //                                       &gpu_time_used,
-        //                                       &cpu_time_used,
-        //                                       hot_calls,
-        //                                       argus.perf);
+        //     gesv_getPerfData<API, INPLACE, MIXED, T>(handle,
+        //                                              n,
+        //                                              nrhs,
+        //                                              dA,
+        //                                              lda,
+        //                                              stA,
+        //                                              dIpiv,
+        //                                              stP,
+        //                                              dB,
+        //                                              ldb,
+        //                                              stB,
+        //                                              dX,
+        //                                              ldx,
+        //                                              stX,
+        //                                              dWork,
+        //                                              size_W,
+        //                                              dInfo,
+        //                                              bc,
+        //                                              hA,
+        //                                              hIpiv,
+        //                                              hB,
+        //                                              hNiters,
+        //                                              hInfo,
+        //                                              &gpu_time_used,
+        //                                              &cpu_time_used,
+        //                                              hot_calls,
+        //                                              argus.perf);
     }
 
     else
@@ -808,62 +824,62 @@ void testing_gesv(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            gesv_getError<API, INPLACE, T>(handle,
-                                           n,
-                                           nrhs,
-                                           dA,
-                                           lda,
-                                           stA,
-                                           dIpiv,
-                                           stP,
-                                           dB,
-                                           ldb,
-                                           stB,
-                                           dX,
-                                           ldx,
-                                           stX,
-                                           dWork,
-                                           size_W,
-                                           dInfo,
-                                           bc,
-                                           hA,
-                                           hIpiv,
-                                           hB,
-                                           hBRes,
-                                           hNiters,
-                                           hInfo,
-                                           hInfoRes,
-                                           &max_error);
+            gesv_getError<API, INPLACE, MIXED, T>(handle,
+                                                  n,
+                                                  nrhs,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dIpiv,
+                                                  stP,
+                                                  dB,
+                                                  ldb,
+                                                  stB,
+                                                  dX,
+                                                  ldx,
+                                                  stX,
+                                                  dWork,
+                                                  size_W,
+                                                  dInfo,
+                                                  bc,
+                                                  hA,
+                                                  hIpiv,
+                                                  hB,
+                                                  hBRes,
+                                                  hNiters,
+                                                  hInfo,
+                                                  hInfoRes,
+                                                  &max_error);
 
         // collect performance data
         if(argus.timing)
-            gesv_getPerfData<API, INPLACE, T>(handle,
-                                              n,
-                                              nrhs,
-                                              dA,
-                                              lda,
-                                              stA,
-                                              dIpiv,
-                                              stP,
-                                              dB,
-                                              ldb,
-                                              stB,
-                                              dX,
-                                              ldx,
-                                              stX,
-                                              dWork,
-                                              size_W,
-                                              dInfo,
-                                              bc,
-                                              hA,
-                                              hIpiv,
-                                              hB,
-                                              hNiters,
-                                              hInfo,
-                                              &gpu_time_used,
-                                              &cpu_time_used,
-                                              hot_calls,
-                                              argus.perf);
+            gesv_getPerfData<API, INPLACE, MIXED, T>(handle,
+                                                     n,
+                                                     nrhs,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dIpiv,
+                                                     stP,
+                                                     dB,
+                                                     ldb,
+                                                     stB,
+                                                     dX,
+                                                     ldx,
+                                                     stX,
+                                                     dWork,
+                                                     size_W,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hIpiv,
+                                                     hB,
+                                                     hNiters,
+                                                     hInfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -25,34 +25,44 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename TT, typename W, typename U>
-void gesvd_checkBadArgs(const hipsolverHandle_t handle,
-                        const char              left_svect,
-                        const char              right_svect,
-                        const int               m,
-                        const int               n,
-                        W                       dA,
-                        const int               lda,
-                        const int               stA,
-                        TT                      dS,
-                        const int               stS,
-                        T                       dU,
-                        const int               ldu,
-                        const int               stU,
-                        T                       dV,
-                        const int               ldv,
-                        const int               stV,
-                        T                       dWork,
-                        const int               lwork,
-                        TT                      dE,
-                        const int               stE,
-                        U                       dinfo,
-                        const int               bc)
+template <testAPI_t API,
+          typename I,
+          typename SIZE,
+          typename T,
+          typename TT,
+          typename W,
+          typename U>
+void gesvd_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverDnParams_t params,
+                        const char                left_svect,
+                        const char                right_svect,
+                        const I                   m,
+                        const I                   n,
+                        W                         dA,
+                        const I                   lda,
+                        const I                   stA,
+                        TT                        dS,
+                        const I                   stS,
+                        T                         dU,
+                        const I                   ldu,
+                        const I                   stU,
+                        T                         dV,
+                        const I                   ldv,
+                        const I                   stV,
+                        T                         dWork,
+                        const SIZE                dlwork,
+                        T                         hWork,
+                        const SIZE                hlwork,
+                        TT                        dE,
+                        const I                   stE,
+                        U                         dinfo,
+                        const int                 bc)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           nullptr,
+                                          params,
                                           left_svect,
                                           right_svect,
                                           m,
@@ -69,7 +79,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -80,6 +92,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           '\0',
                                           right_svect,
                                           m,
@@ -96,7 +109,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -105,6 +120,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           left_svect,
                                           '\0',
                                           m,
@@ -121,7 +137,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -130,6 +148,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           'O',
                                           'O',
                                           m,
@@ -146,7 +165,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -158,6 +179,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           left_svect,
                                           right_svect,
                                           m,
@@ -174,7 +196,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -183,6 +207,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           left_svect,
                                           right_svect,
                                           m,
@@ -199,7 +224,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -208,6 +235,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           left_svect,
                                           right_svect,
                                           m,
@@ -224,7 +252,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -233,6 +263,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           left_svect,
                                           right_svect,
                                           m,
@@ -249,7 +280,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           dinfo,
@@ -258,6 +291,7 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
     EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                           false,
                                           handle,
+                                          params,
                                           left_svect,
                                           right_svect,
                                           m,
@@ -274,7 +308,9 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
                                           ldv,
                                           stV,
                                           dWork,
-                                          lwork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
                                           dE,
                                           stE,
                                           (U) nullptr,
@@ -283,25 +319,26 @@ void gesvd_checkBadArgs(const hipsolverHandle_t handle,
 #endif
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T, typename I, typename SIZE>
 void testing_gesvd_bad_arg()
 {
     using S = decltype(std::real(T{}));
 
     // safe arguments
     hipsolver_local_handle handle;
+    hipsolver_local_params params;
     char                   left_svect  = 'A';
     char                   right_svect = 'A';
-    int                    m           = 2;
-    int                    n           = 2;
-    int                    lda         = 2;
-    int                    ldu         = 2;
-    int                    ldv         = 2;
-    int                    stA         = 2;
-    int                    stS         = 2;
-    int                    stU         = 2;
-    int                    stV         = 2;
-    int                    stE         = 2;
+    I                      m           = 2;
+    I                      n           = 2;
+    I                      lda         = 2;
+    I                      ldu         = 2;
+    I                      ldv         = 2;
+    I                      stA         = 2;
+    I                      stS         = 2;
+    I                      stU         = 2;
+    I                      stV         = 2;
+    I                      stE         = 2;
     int                    bc          = 1;
 
     if(BATCHED)
@@ -347,15 +384,31 @@ void testing_gesvd_bad_arg()
         CHECK_HIP_ERROR(dE.memcheck());
         CHECK_HIP_ERROR(dinfo.memcheck());
 
-        int size_W;
-        hipsolver_gesvd_bufferSize(
-            API, handle, left_svect, right_svect, m, n, dA.data(), lda, &size_W);
-        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-        if(size_W)
+        SIZE size_dW, size_hW;
+        hipsolver_gesvd_bufferSize(API,
+                                   handle,
+                                   params,
+                                   left_svect,
+                                   right_svect,
+                                   m,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   dS.data(),
+                                   dU.data(),
+                                   ldu,
+                                   dV.data(),
+                                   ldv,
+                                   &size_dW,
+                                   &size_hW);
+        device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+        host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+        if(size_dW)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
         gesvd_checkBadArgs<API>(handle,
+                                params,
                                 left_svect,
                                 right_svect,
                                 m,
@@ -372,7 +425,9 @@ void testing_gesvd_bad_arg()
                                 ldv,
                                 stV,
                                 dWork.data(),
-                                size_W,
+                                size_dW,
+                                hWork.data(),
+                                size_hW,
                                 dE.data(),
                                 stE,
                                 dinfo.data(),
@@ -380,14 +435,14 @@ void testing_gesvd_bad_arg()
     }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Th>
 void gesvd_initData(const hipsolverHandle_t handle,
                     const char              left_svect,
                     const char              right_svect,
-                    const int               m,
-                    const int               n,
+                    const I                 m,
+                    const I                 n,
                     Td&                     dA,
-                    const int               lda,
+                    const I                 lda,
                     const int               bc,
                     Th&                     hA,
                     std::vector<T>&         A,
@@ -433,6 +488,8 @@ void gesvd_initData(const hipsolverHandle_t handle,
 template <testAPI_t API,
           bool      NRWK,
           typename T,
+          typename I,
+          typename SIZE,
           typename Wd,
           typename Td,
           typename Ud,
@@ -441,56 +498,59 @@ template <testAPI_t API,
           typename Th,
           typename Uh,
           typename Ih>
-void gesvd_getError(const hipsolverHandle_t handle,
-                    const char              left_svect,
-                    const char              right_svect,
-                    const int               m,
-                    const int               n,
-                    Wd&                     dA,
-                    const int               lda,
-                    const int               stA,
-                    Td&                     dS,
-                    const int               stS,
-                    Ud&                     dU,
-                    const int               ldu,
-                    const int               stU,
-                    Ud&                     dV,
-                    const int               ldv,
-                    const int               stV,
-                    Ud&                     dWork,
-                    const int               lwork,
-                    Td&                     dE,
-                    const int               stE,
-                    Id&                     dinfo,
-                    const int               bc,
-                    const char              left_svectT,
-                    const char              right_svectT,
-                    const int               mT,
-                    const int               nT,
-                    Ud&                     dUT,
-                    const int               lduT,
-                    const int               stUT,
-                    Ud&                     dVT,
-                    const int               ldvT,
-                    const int               stVT,
-                    Wh&                     hA,
-                    Th&                     hS,
-                    Th&                     hSres,
-                    Uh&                     hU,
-                    Uh&                     Ures,
-                    const int               ldures,
-                    Uh&                     hV,
-                    Uh&                     Vres,
-                    const int               ldvres,
-                    Th&                     hE,
-                    Th&                     hEres,
-                    Ih&                     hinfo,
-                    Ih&                     hinfoRes,
-                    double*                 max_err,
-                    double*                 max_errv)
+void gesvd_getError(const hipsolverHandle_t   handle,
+                    const hipsolverDnParams_t params,
+                    const char                left_svect,
+                    const char                right_svect,
+                    const I                   m,
+                    const I                   n,
+                    Wd&                       dA,
+                    const I                   lda,
+                    const I                   stA,
+                    Td&                       dS,
+                    const I                   stS,
+                    Ud&                       dU,
+                    const I                   ldu,
+                    const I                   stU,
+                    Ud&                       dV,
+                    const I                   ldv,
+                    const I                   stV,
+                    Ud&                       dWork,
+                    const SIZE                dlwork,
+                    Uh&                       hWork,
+                    const SIZE                hlwork,
+                    Td&                       dE,
+                    const I                   stE,
+                    Id&                       dinfo,
+                    const int                 bc,
+                    const char                left_svectT,
+                    const char                right_svectT,
+                    const I                   mT,
+                    const I                   nT,
+                    Ud&                       dUT,
+                    const I                   lduT,
+                    const I                   stUT,
+                    Ud&                       dVT,
+                    const I                   ldvT,
+                    const I                   stVT,
+                    Wh&                       hA,
+                    Th&                       hS,
+                    Th&                       hSres,
+                    Uh&                       hU,
+                    Uh&                       Ures,
+                    const I                   ldures,
+                    Uh&                       hV,
+                    Uh&                       Vres,
+                    const I                   ldvres,
+                    Th&                       hE,
+                    Th&                       hEres,
+                    Ih&                       hinfo,
+                    Ih&                       hinfoRes,
+                    double*                   max_err,
+                    double*                   max_errv)
 {
     int            size_W = 5 * max(m, n);
-    std::vector<T> hWork(size_W);
+    std::vector<T> work(size_W);
     std::vector<T> A(lda * n * bc);
 
     // input data initialization
@@ -502,6 +562,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
                                         NRWK,
                                         handle,
+                                        params,
                                         left_svectT,
                                         right_svectT,
                                         mT,
@@ -518,7 +579,9 @@ void gesvd_getError(const hipsolverHandle_t handle,
                                         ldvT,
                                         stVT,
                                         dWork.data(),
-                                        lwork,
+                                        dlwork,
+                                        hWork.data(),
+                                        hlwork,
                                         dE.data(),
                                         stE,
                                         dinfo.data(),
@@ -544,7 +607,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
                   ldu,
                   hV[b],
                   ldv,
-                  hWork.data(),
+                  work.data(),
                   size_W,
                   hE[b],
                   hinfo[b]);
@@ -553,6 +616,7 @@ void gesvd_getError(const hipsolverHandle_t handle,
     CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
                                         NRWK,
                                         handle,
+                                        params,
                                         left_svect,
                                         right_svect,
                                         m,
@@ -569,7 +633,9 @@ void gesvd_getError(const hipsolverHandle_t handle,
                                         ldv,
                                         stV,
                                         dWork.data(),
-                                        lwork,
+                                        dlwork,
+                                        hWork.data(),
+                                        hlwork,
                                         dE.data(),
                                         stE,
                                         dinfo.data(),
@@ -656,6 +722,8 @@ void gesvd_getError(const hipsolverHandle_t handle,
 template <testAPI_t API,
           bool      NRWK,
           typename T,
+          typename I,
+          typename SIZE,
           typename Wd,
           typename Td,
           typename Ud,
@@ -664,41 +732,44 @@ template <testAPI_t API,
           typename Th,
           typename Uh,
           typename Ih>
-void gesvd_getPerfData(const hipsolverHandle_t handle,
-                       const char              left_svect,
-                       const char              right_svect,
-                       const int               m,
-                       const int               n,
-                       Wd&                     dA,
-                       const int               lda,
-                       const int               stA,
-                       Td&                     dS,
-                       const int               stS,
-                       Ud&                     dU,
-                       const int               ldu,
-                       const int               stU,
-                       Ud&                     dV,
-                       const int               ldv,
-                       const int               stV,
-                       Ud&                     dWork,
-                       const int               lwork,
-                       Td&                     dE,
-                       const int               stE,
-                       Id&                     dinfo,
-                       const int               bc,
-                       Wh&                     hA,
-                       Th&                     hS,
-                       Uh&                     hU,
-                       Uh&                     hV,
-                       Th&                     hE,
-                       Ih&                     hinfo,
-                       double*                 gpu_time_used,
-                       double*                 cpu_time_used,
-                       const int               hot_calls,
-                       const bool              perf)
+void gesvd_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverDnParams_t params,
+                       const char                left_svect,
+                       const char                right_svect,
+                       const I                   m,
+                       const I                   n,
+                       Wd&                       dA,
+                       const I                   lda,
+                       const I                   stA,
+                       Td&                       dS,
+                       const I                   stS,
+                       Ud&                       dU,
+                       const I                   ldu,
+                       const I                   stU,
+                       Ud&                       dV,
+                       const I                   ldv,
+                       const I                   stV,
+                       Ud&                       dWork,
+                       const SIZE                dlwork,
+                       Uh&                       hWork,
+                       const SIZE                hlwork,
+                       Td&                       dE,
+                       const I                   stE,
+                       Id&                       dinfo,
+                       const int                 bc,
+                       Wh&                       hA,
+                       Th&                       hS,
+                       Uh&                       hU,
+                       Uh&                       hV,
+                       Th&                       hE,
+                       Ih&                       hinfo,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf)
 {
     int            size_W = 5 * max(m, n);
-    std::vector<T> hWork(size_W);
+    std::vector<T> work(size_W);
     std::vector<T> A;
 
     if(!perf)
@@ -720,7 +791,7 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
                       ldu,
                       hV[b],
                       ldv,
-                      hWork.data(),
+                      work.data(),
                       size_W,
                       hE[b],
                       hinfo[b]);
@@ -738,6 +809,7 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
         CHECK_ROCBLAS_ERROR(hipsolver_gesvd(API,
                                             NRWK,
                                             handle,
+                                            params,
                                             left_svect,
                                             right_svect,
                                             m,
@@ -754,7 +826,9 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
                                             ldv,
                                             stV,
                                             dWork.data(),
-                                            lwork,
+                                            dlwork,
+                                            hWork.data(),
+                                            hlwork,
                                             dE.data(),
                                             stE,
                                             dinfo.data(),
@@ -775,6 +849,7 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
         hipsolver_gesvd(API,
                         NRWK,
                         handle,
+                        params,
                         left_svect,
                         right_svect,
                         m,
@@ -791,7 +866,9 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
                         ldv,
                         stV,
                         dWork.data(),
-                        lwork,
+                        dlwork,
+                        hWork.data(),
+                        hlwork,
                         dE.data(),
                         stE,
                         dinfo.data(),
@@ -801,25 +878,32 @@ void gesvd_getPerfData(const hipsolverHandle_t handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, bool NRWK, typename T>
+template <testAPI_t API,
+          bool      BATCHED,
+          bool      STRIDED,
+          bool      NRWK,
+          typename T,
+          typename I,
+          typename SIZE>
 void testing_gesvd(Arguments& argus)
 {
     using S = decltype(std::real(T{}));
 
     // get arguments
     hipsolver_local_handle handle;
+    hipsolver_local_params params;
     char                   leftv  = argus.get<char>("jobu");
     char                   rightv = argus.get<char>("jobv");
-    int                    m      = argus.get<int>("m");
-    int                    n      = argus.get<int>("n", m);
-    int                    lda    = argus.get<int>("lda", m);
-    int                    ldu    = argus.get<int>("ldu", m);
-    int                    ldv    = argus.get<int>("ldv", (rightv == 'A' ? n : min(m, n)));
-    int                    stA    = argus.get<int>("strideA", lda * n);
-    int                    stS    = argus.get<int>("strideS", min(m, n));
-    int                    stU    = argus.get<int>("strideU", ldu * m);
-    int                    stV    = argus.get<int>("strideV", ldv * n);
-    int                    stE    = argus.get<int>("strideE", min(m, n) - 1);
+    I                      m      = argus.get<int>("m");
+    I                      n      = argus.get<int>("n", m);
+    I                      lda    = argus.get<int>("lda", m);
+    I                      ldu    = argus.get<int>("ldu", m);
+    I                      ldv    = argus.get<int>("ldv", (rightv == 'A' ? n : min(m, n)));
+    I                      stA    = argus.get<int>("strideA", lda * n);
+    I                      stS    = argus.get<int>("strideS", min(m, n));
+    I                      stU    = argus.get<int>("strideU", ldu * m);
+    I                      stV    = argus.get<int>("strideV", ldv * n);
+    I                      stE    = argus.get<int>("strideE", min(m, n) - 1);
 
     int bc        = argus.batch_count;
     int hot_calls = argus.iters;
@@ -860,6 +944,7 @@ void testing_gesvd(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                                   NRWK,
                                                   handle,
+                                                  params,
                                                   leftv,
                                                   rightv,
                                                   m,
@@ -876,7 +961,9 @@ void testing_gesvd(Arguments& argus)
                                                   ldv,
                                                   stV,
                                                   (T*)nullptr,
-                                                  0,
+                                                  (SIZE)0,
+                                                  (T*)nullptr,
+                                                  (SIZE)0,
                                                   (S*)nullptr,
                                                   stE,
                                                   (int*)nullptr,
@@ -897,10 +984,10 @@ void testing_gesvd(Arguments& argus)
 
     signed char leftvT  = 'N';
     signed char rightvT = 'N';
-    int         ldvT    = 1;
-    int         lduT    = 1;
-    int         mT      = 0;
-    int         nT      = 0;
+    I           ldvT    = 1;
+    I           lduT    = 1;
+    I           mT      = 0;
+    I           nT      = 0;
     bool        svects  = (leftv != 'N' || rightv != 'N');
 
     if(svects)
@@ -926,8 +1013,8 @@ void testing_gesvd(Arguments& argus)
     }
 
     // determine sizes
-    int    ldures    = 1;
-    int    ldvres    = 1;
+    I      ldures    = 1;
+    I      ldvres    = 1;
     size_t size_Sres = 0;
     size_t size_Eres = 0;
     size_t size_Ures = 0;
@@ -980,10 +1067,10 @@ void testing_gesvd(Arguments& argus)
             }
         }
     }
-    int stUT   = size_UT;
-    int stVT   = size_VT;
-    int stUres = size_Ures;
-    int stVres = size_Vres;
+    I stUT   = size_UT;
+    I stVT   = size_VT;
+    I stUres = size_Ures;
+    I stVres = size_Vres;
 
     double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
 
@@ -1027,6 +1114,7 @@ void testing_gesvd(Arguments& argus)
             EXPECT_ROCBLAS_STATUS(hipsolver_gesvd(API,
                                                   NRWK,
                                                   handle,
+                                                  params,
                                                   leftv,
                                                   rightv,
                                                   m,
@@ -1043,7 +1131,9 @@ void testing_gesvd(Arguments& argus)
                                                   ldv,
                                                   stV,
                                                   (T*)nullptr,
-                                                  0,
+                                                  (SIZE)0,
+                                                  (T*)nullptr,
+                                                  (SIZE)0,
                                                   (S*)nullptr,
                                                   stE,
                                                   (int*)nullptr,
@@ -1058,14 +1148,45 @@ void testing_gesvd(Arguments& argus)
     }
 
     // memory size query is necessary
-    int size_W, w1, w2;
-    hipsolver_gesvd_bufferSize(API, handle, leftv, rightv, m, n, (T*)nullptr, lda, &w1);
-    hipsolver_gesvd_bufferSize(API, handle, leftvT, rightvT, mT, nT, (T*)nullptr, lda, &w2);
-    size_W = max(w1, w2);
+    SIZE size_dW, size_hW, dw1, hw1, dw2, hw2;
+    hipsolver_gesvd_bufferSize(API,
+                               handle,
+                               params,
+                               leftv,
+                               rightv,
+                               m,
+                               n,
+                               (T*)nullptr,
+                               lda,
+                               (S*)nullptr,
+                               (T*)nullptr,
+                               ldu,
+                               (T*)nullptr,
+                               ldv,
+                               &dw1,
+                               &hw1);
+    hipsolver_gesvd_bufferSize(API,
+                               handle,
+                               params,
+                               leftvT,
+                               rightvT,
+                               mT,
+                               nT,
+                               (T*)nullptr,
+                               lda,
+                               (S*)nullptr,
+                               (T*)nullptr,
+                               lduT,
+                               (T*)nullptr,
+                               ldvT,
+                               &dw2,
+                               &hw2);
+    size_dW = max(dw1, dw2);
+    size_hW = max(hw1, hw2);
 
     if(argus.mem_query)
     {
-        rocsolver_bench_inform(inform_mem_query, size_W);
+        rocsolver_bench_inform(inform_mem_query, size_dW);
         return;
     }
 
@@ -1081,6 +1202,7 @@ void testing_gesvd(Arguments& argus)
     host_strided_batch_vector<S>   hEres(size_Eres, 1, stE, bc);
     host_strided_batch_vector<T>   Vres(size_Vres, 1, stVres, bc);
     host_strided_batch_vector<T>   Ures(size_Ures, 1, stUres, bc);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
     // device
     device_strided_batch_vector<S>   dE(size_E, 1, stE, bc);
     device_strided_batch_vector<S>   dS(size_S, 1, stS, bc);
@@ -1089,7 +1211,7 @@ void testing_gesvd(Arguments& argus)
     device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
     device_strided_batch_vector<T>   dVT(size_VT, 1, stVT, bc);
     device_strided_batch_vector<T>   dUT(size_UT, 1, stUT, bc);
-    device_strided_batch_vector<T>   dWork(size_W, 1, size_W, 1); // size_W accounts for bc
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1); // size_dW accounts for bc
     if(size_VT)
         CHECK_HIP_ERROR(dVT.memcheck());
     if(size_UT)
@@ -1103,7 +1225,7 @@ void testing_gesvd(Arguments& argus)
     if(size_U)
         CHECK_HIP_ERROR(dU.memcheck());
     CHECK_HIP_ERROR(dinfo.memcheck());
-    if(size_W)
+    if(size_dW)
         CHECK_HIP_ERROR(dWork.memcheck());
 
     if(BATCHED)
@@ -1216,6 +1338,7 @@ void testing_gesvd(Arguments& argus)
         if(argus.unit_check || argus.norm_check)
         {
             gesvd_getError<API, NRWK, T>(handle,
+                                         params,
                                          leftv,
                                          rightv,
                                          m,
@@ -1232,7 +1355,9 @@ void testing_gesvd(Arguments& argus)
                                          ldv,
                                          stV,
                                          dWork,
-                                         size_W,
+                                         size_dW,
+                                         hWork,
+                                         size_hW,
                                          dE,
                                          stE,
                                          dinfo,
@@ -1268,6 +1393,7 @@ void testing_gesvd(Arguments& argus)
         if(argus.timing)
         {
             gesvd_getPerfData<API, NRWK, T>(handle,
+                                            params,
                                             leftv,
                                             rightv,
                                             m,
@@ -1284,7 +1410,9 @@ void testing_gesvd(Arguments& argus)
                                             ldv,
                                             stV,
                                             dWork,
-                                            size_W,
+                                            size_dW,
+                                            hWork,
+                                            size_hW,
                                             dE,
                                             stE,
                                             dinfo,
@@ -248,62 +248,62 @@ void testing_gesvdj_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T> dA(1, 1, 1);
-        // device_strided_batch_vector<S> dS(1, 1, 1, 1);
-        // device_strided_batch_vector<T> dU(1, 1, 1, 1);
-        // device_strided_batch_vector<T> dV(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dS.memcheck());
-        // CHECK_HIP_ERROR(dU.memcheck());
-        // CHECK_HIP_ERROR(dV.memcheck());
-        // CHECK_HIP_ERROR(dinfo.memcheck());
-
-        // int size_W;
-        // hipsolver_gesvdj_bufferSize(API,
-        //                             STRIDED,
-        //                             handle,
-        //                             jobz,
-        //                             econ,
-        //                             m,
-        //                             n,
-        //                             dA.data(),
-        //                             lda,
-        //                             dS.data(),
-        //                             dU.data(),
-        //                             ldu,
-        //                             dV.data(),
-        //                             ldv,
-        //                             &size_W,
-        //                             params,
-        //                             bc);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // gesvdj_checkBadArgs<API, STRIDED>(handle,
-        //                                   jobz,
-        //                                   econ,
-        //                                   m,
-        //                                   n,
-        //                                   dA.data(),
-        //                                   lda,
-        //                                   stA,
-        //                                   dS.data(),
-        //                                   stS,
-        //                                   dU.data(),
-        //                                   ldu,
-        //                                   stU,
-        //                                   dV.data(),
-        //                                   ldv,
-        //                                   stV,
-        //                                   dWork.data(),
-        //                                   size_W,
-        //                                   dinfo.data(),
-        //                                   params,
-        //                                   bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<S>   dS(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dU(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dV(1, 1, 1, 1);
+        device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dS.memcheck());
+        CHECK_HIP_ERROR(dU.memcheck());
+        CHECK_HIP_ERROR(dV.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        int size_W;
+        hipsolver_gesvdj_bufferSize(API,
+                                    STRIDED,
+                                    handle,
+                                    jobz,
+                                    econ,
+                                    m,
+                                    n,
+                                    dA.data(),
+                                    lda,
+                                    dS.data(),
+                                    dU.data(),
+                                    ldu,
+                                    dV.data(),
+                                    ldv,
+                                    &size_W,
+                                    params,
+                                    bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        gesvdj_checkBadArgs<API, STRIDED>(handle,
+                                          jobz,
+                                          econ,
+                                          m,
+                                          n,
+                                          dA.data(),
+                                          lda,
+                                          stA,
+                                          dS.data(),
+                                          stS,
+                                          dU.data(),
+                                          ldu,
+                                          stU,
+                                          dV.data(),
+                                          ldv,
+                                          stV,
+                                          dWork.data(),
+                                          size_W,
+                                          dinfo.data(),
+                                          params,
+                                          bc);
     }
     else
     {
@@ -416,6 +416,7 @@ void gesvdj_initData(const hipsolverHandle_t handle,
 }
 
 template <testAPI_t API,
+          bool      BATCHED,
           bool      STRIDED,
           typename T,
           typename Wd,
@@ -510,6 +511,18 @@ void gesvdj_getError(const hipsolverHandle_t handle,
     hipsolverXgesvdjGetResidual(handle, params, hResidualRes.data());
     hipsolverXgesvdjGetSweeps(handle, params, hSweepsRes.data());
 
+    // The batched queries are not supported by the cuSOLVER backend
+    bool batched_queries = false;
+    if(BATCHED || STRIDED)
+    {
+        batched_queries
+            = hipsolverXgesvdjGetResidualBatched(handle, params, hResidualRes.data(), bc)
+              == HIPSOLVER_STATUS_SUCCESS;
+        if(batched_queries)
+            CHECK_ROCBLAS_ERROR(
+                hipsolverXgesvdjGetSweepsBatched(handle, params, hSweepsRes.data(), bc));
+    }
+
     // CPU lapack
     // Only singular values needed
     for(int b = 0; b < bc; ++b)
@@ -538,7 +551,7 @@ void gesvdj_getError(const hipsolverHandle_t handle,
             *max_err += 1;
     }
 
-    if(!STRIDED)
+    if((!BATCHED && !STRIDED) || batched_queries)
     {
         // Also check validity of residual
         for(rocblas_int b = 0; b < bc; ++b)
@@ -558,6 +571,56 @@ void gesvdj_getError(const hipsolverHandle_t handle,
         }
     }
 
+    if(batched_queries)
+    {
+        // Exactly the matrices for which the solver returned a nonzero info must be reported
+        std::vector<int> unconverged(bc);
+        int              num_unconverged;
+        CHECK_ROCBLAS_ERROR(hipsolverXgesvdjGetUnconverged(
+            handle, params, unconverged.data(), &num_unconverged, bc));
+
+        auto last = unconverged.begin() + num_unconverged;
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            bool reported = std::find(unconverged.begin(), last, b) != last;
+            EXPECT_EQ(reported, hinfoRes[b][0] != 0) << "where b = " << b;
+            if(reported != (hinfoRes[b][0] != 0))
+                *max_err += 1;
+        }
+    }
+
+    if(!BATCHED && !STRIDED)
+    {
+        // The asynchronous queries must match once the stream has been synchronized. A
+        // second residual query is enqueued on another stream before either completes,
+        // so that the two cannot share their staging.
+        double*     asyncResidual;
+        int*        asyncSweeps;
+        hipStream_t stream, stream2;
+        CHECK_HIP_ERROR(hipHostMalloc(&asyncResidual, 2 * sizeof(double)));
+        CHECK_HIP_ERROR(hipHostMalloc(&asyncSweeps, sizeof(int)));
+        CHECK_HIP_ERROR(hipStreamCreate(&stream2));
+        CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+        CHECK_ROCBLAS_ERROR(hipsolverXgesvdjGetResidualAsync(handle, params, asyncResidual));
+        CHECK_ROCBLAS_ERROR(hipsolverXgesvdjGetSweepsAsync(handle, params, asyncSweeps));
+        CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, stream2));
+        CHECK_ROCBLAS_ERROR(hipsolverXgesvdjGetResidualAsync(handle, params, asyncResidual + 1));
+        CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream2));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream2));
+
+        EXPECT_EQ(asyncResidual[0], hResidualRes[0][0]);
+        EXPECT_EQ(asyncResidual[1], hResidualRes[0][0]);
+        EXPECT_EQ(*asyncSweeps, hSweepsRes[0][0]);
+        if(asyncResidual[0] != hResidualRes[0][0] || asyncResidual[1] != hResidualRes[0][0]
+           || *asyncSweeps != hSweepsRes[0][0])
+            *max_err += 1;
+
+        CHECK_HIP_ERROR(hipHostFree(asyncResidual));
+        CHECK_HIP_ERROR(hipHostFree(asyncSweeps));
+    }
+
     // (We expect the used input matrices to always converge. Testing
     // implicitly the equivalent non-converged matrix is very complicated and it boils
     // down to essentially run the algorithm again and until convergence is achieved).
@@ -750,7 +813,7 @@ void testing_gesvdj(Arguments& argus)
     hipsolver_local_handle      handle;
     hipsolver_local_gesvdj_info params;
     char                        jobzC = argus.get<char>("jobz");
-    int                         econ  = !STRIDED ? argus.get<int>("econ", 0) : 0;
+    int                         econ  = !BATCHED && !STRIDED ? argus.get<int>("econ", 0) : 0;
     int                         m     = argus.get<int>("m");
     int                         n     = argus.get<int>("n", m);
     int                         lda   = argus.get<int>("lda", m);
@@ -810,30 +873,30 @@ void testing_gesvdj(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(API,
-            //                                       STRIDED,
-            //                                       handle,
-            //                                       jobz,
-            //                                       econ,
-            //                                       m,
-            //                                       n,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (S*)nullptr,
-            //                                       stS,
-            //                                       (T*)nullptr,
-            //                                       ldu,
-            //                                       stU,
-            //                                       (T*)nullptr,
-            //                                       ldv,
-            //                                       stV,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       params,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_gesvdj(API,
+                                                  STRIDED,
+                                                  handle,
+                                                  jobz,
+                                                  econ,
+                                                  m,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (S*)nullptr,
+                                                  stS,
+                                                  (T*)nullptr,
+                                                  ldu,
+                                                  stU,
+                                                  (T*)nullptr,
+                                                  ldv,
+                                                  stV,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  params,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
@@ -871,23 +934,42 @@ void testing_gesvdj(Arguments& argus)
 
     // memory size query is necessary
     int size_W;
-    hipsolver_gesvdj_bufferSize(API,
-                                STRIDED,
-                                handle,
-                                jobz,
-                                econ,
-                                m,
-                                n,
-                                (T*)nullptr,
-                                lda,
-                                (S*)nullptr,
-                                (T*)nullptr,
-                                ldu,
-                                (T*)nullptr,
-                                ldv,
-                                &size_W,
-                                params,
-                                bc);
+    if(BATCHED)
+        hipsolver_gesvdj_bufferSize(API,
+                                    STRIDED,
+                                    handle,
+                                    jobz,
+                                    econ,
+                                    m,
+                                    n,
+                                    (T**)nullptr,
+                                    lda,
+                                    (S*)nullptr,
+                                    (T*)nullptr,
+                                    ldu,
+                                    (T*)nullptr,
+                                    ldv,
+                                    &size_W,
+                                    params,
+                                    bc);
+    else
+        hipsolver_gesvdj_bufferSize(API,
+                                    STRIDED,
+                                    handle,
+                                    jobz,
+                                    econ,
+                                    m,
+                                    n,
+                                    (T*)nullptr,
+                                    lda,
+                                    (S*)nullptr,
+                                    (T*)nullptr,
+                                    ldu,
+                                    (T*)nullptr,
+                                    ldv,
+                                    &size_W,
+                                    params,
+                                    bc);
 
     if(argus.mem_query)
     {
@@ -925,86 +1007,86 @@ void testing_gesvdj(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>           hA(size_A, 1, bc);
-        // device_batch_vector<T>         dA(size_A, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        // {
-        //     gesvdj_getError<API, STRIDED, T>(handle,
-        //                                      jobz,
-        //                                      econ,
-        //                                      m,
-        //                                      n,
-        //                                      dA,
-        //                                      lda,
-        //                                      stA,
-        //                                      dS,
-        //                                      stS,
-        //                                      dU,
-        //                                      ldu,
-        //                                      stU,
-        //                                      dV,
-        //                                      ldv,
-        //                                      stV,
-        //                                      dWork,
-        //                                      size_W,
-        //                                      dinfo,
-        //                                      params,
-        //                                      abstol,
-        //                                      max_sweeps,
-        //                                      sort_eig,
-        //                                      bc,
-        //                                      hA,
-        //                                      hS,
-        //                                      hSres,
-        //                                      Ures,
-        //                                      Vres,
-        //                                      hinfo,
-        //                                      hinfoRes,
-        //                                      hResidualRes,
-        //                                      hSweepsRes,
-        //                                      &max_error,
-        //                                      &max_errorv);
-        // }
-
-        // // collect performance data
-        // if(argus.timing)
-        // {
-        //     gesvdj_getPerfData<API, STRIDED, T>(handle,
-        //                                         jobz,
-        //                                         econ,
-        //                                         m,
-        //                                         n,
-        //                                         dA,
-        //                                         lda,
-        //                                         stA,
-        //                                         dS,
-        //                                         stS,
-        //                                         dU,
-        //                                         ldu,
-        //                                         stU,
-        //                                         dV,
-        //                                         ldv,
-        //                                         stV,
-        //                                         dWork,
-        //                                         size_W,
-        //                                         dinfo,
-        //                                         params,
-        //                                         bc,
-        //                                         hA,
-        //                                         hS,
-        //                                         hU,
-        //                                         hV,
-        //                                         hinfo,
-        //                                         &gpu_time_used,
-        //                                         &cpu_time_used,
-        //                                         hot_calls,
-        //                                         argus.perf);
-        // }
+        // memory allocations
+        host_batch_vector<T>   hA(size_A, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            gesvdj_getError<API, BATCHED, STRIDED, T>(handle,
+                                                      jobz,
+                                                      econ,
+                                                      m,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dS,
+                                                      stS,
+                                                      dU,
+                                                      ldu,
+                                                      stU,
+                                                      dV,
+                                                      ldv,
+                                                      stV,
+                                                      dWork,
+                                                      size_W,
+                                                      dinfo,
+                                                      params,
+                                                      abstol,
+                                                      max_sweeps,
+                                                      sort_eig,
+                                                      bc,
+                                                      hA,
+                                                      hS,
+                                                      hSres,
+                                                      Ures,
+                                                      Vres,
+                                                      hinfo,
+                                                      hinfoRes,
+                                                      hResidualRes,
+                                                      hSweepsRes,
+                                                      &max_error,
+                                                      &max_errorv);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            gesvdj_getPerfData<API, STRIDED, T>(handle,
+                                                jobz,
+                                                econ,
+                                                m,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dS,
+                                                stS,
+                                                dU,
+                                                ldu,
+                                                stU,
+                                                dV,
+                                                ldv,
+                                                stV,
+                                                dWork,
+                                                size_W,
+                                                dinfo,
+                                                params,
+                                                bc,
+                                                hA,
+                                                hS,
+                                                hU,
+                                                hV,
+                                                hinfo,
+                                                &gpu_time_used,
+                                                &cpu_time_used,
+                                                hot_calls,
+                                                argus.perf);
+        }
     }
 
     else
@@ -1018,41 +1100,41 @@ void testing_gesvdj(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            gesvdj_getError<API, STRIDED, T>(handle,
-                                             jobz,
-                                             econ,
-                                             m,
-                                             n,
-                                             dA,
-                                             lda,
-                                             stA,
-                                             dS,
-                                             stS,
-                                             dU,
-                                             ldu,
-                                             stU,
-                                             dV,
-                                             ldv,
-                                             stV,
-                                             dWork,
-                                             size_W,
-                                             dinfo,
-                                             params,
-                                             abstol,
-                                             max_sweeps,
-                                             sort_eig,
-                                             bc,
-                                             hA,
-                                             hS,
-                                             hSres,
-                                             Ures,
-                                             Vres,
-                                             hinfo,
-                                             hinfoRes,
-                                             hResidualRes,
-                                             hSweepsRes,
-                                             &max_error,
-                                             &max_errorv);
+            gesvdj_getError<API, BATCHED, STRIDED, T>(handle,
+                                                      jobz,
+                                                      econ,
+                                                      m,
+                                                      n,
+                                                      dA,
+                                                      lda,
+                                                      stA,
+                                                      dS,
+                                                      stS,
+                                                      dU,
+                                                      ldu,
+                                                      stU,
+                                                      dV,
+                                                      ldv,
+                                                      stV,
+                                                      dWork,
+                                                      size_W,
+                                                      dinfo,
+                                                      params,
+                                                      abstol,
+                                                      max_sweeps,
+                                                      sort_eig,
+                                                      bc,
+                                                      hA,
+                                                      hS,
+                                                      hSres,
+                                                      Ures,
+                                                      Vres,
+                                                      hinfo,
+                                                      hinfoRes,
+                                                      hResidualRes,
+                                                      hSweepsRes,
+                                                      &max_error,
+                                                      &max_errorv);
         }
 
         // collect performance data
@@ -0,0 +1,929 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, typename I, typename SIZE, typename T, typename S, typename INTd>
+void gesvdr_checkBadArgs(const hipsolverHandle_t   handle,
+                         const hipsolverDnParams_t params,
+                         const signed char         jobu,
+                         const signed char         jobv,
+                         const I                   m,
+                         const I                   n,
+                         const I                   k,
+                         const I                   p,
+                         const I                   niters,
+                         T                         dA,
+                         const I                   lda,
+                         S                         dS,
+                         T                         dU,
+                         const I                   ldu,
+                         T                         dV,
+                         const I                   ldv,
+                         T                         dWork,
+                         const SIZE                dlwork,
+                         T                         hWork,
+                         const SIZE                hlwork,
+                         INTd                      dinfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           nullptr,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           dinfo),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           handle,
+                                           params,
+                                           'A',
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           'A',
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           (T) nullptr,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           (S) nullptr,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           (T) nullptr,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           (T) nullptr,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           dinfo),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                           handle,
+                                           params,
+                                           jobu,
+                                           jobv,
+                                           m,
+                                           n,
+                                           k,
+                                           p,
+                                           niters,
+                                           dA,
+                                           lda,
+                                           dS,
+                                           dU,
+                                           ldu,
+                                           dV,
+                                           ldv,
+                                           dWork,
+                                           dlwork,
+                                           hWork,
+                                           hlwork,
+                                           (INTd) nullptr),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T, typename I, typename SIZE>
+void testing_gesvdr_bad_arg()
+{
+    using S = decltype(std::real(T{}));
+
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    signed char            jobu   = 'S';
+    signed char            jobv   = 'S';
+    I                      m      = 2;
+    I                      n      = 2;
+    I                      k      = 1;
+    I                      p      = 1;
+    I                      niters = 1;
+    I                      lda    = 2;
+    I                      ldu    = 2;
+    I                      ldv    = 2;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<S>   dS(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dU(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dV(1, 1, 1, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dS.memcheck());
+    CHECK_HIP_ERROR(dU.memcheck());
+    CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+
+    SIZE size_dW, size_hW;
+    hipsolver_gesvdr_bufferSize(API,
+                                handle,
+                                params,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                k,
+                                p,
+                                niters,
+                                dA.data(),
+                                lda,
+                                dS.data(),
+                                dU.data(),
+                                ldu,
+                                dV.data(),
+                                ldv,
+                                &size_dW,
+                                &size_hW);
+    device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    gesvdr_checkBadArgs<API>(handle,
+                             params,
+                             jobu,
+                             jobv,
+                             m,
+                             n,
+                             k,
+                             p,
+                             niters,
+                             dA.data(),
+                             lda,
+                             dS.data(),
+                             dU.data(),
+                             ldu,
+                             dV.data(),
+                             ldv,
+                             dWork.data(),
+                             size_dW,
+                             hWork.data(),
+                             size_hW,
+                             dinfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Th>
+void gesvdr_initData(const hipsolverHandle_t handle,
+                     const I                 m,
+                     const I                 n,
+                     const I                 rank,
+                     Td&                     dA,
+                     const I                 lda,
+                     Th&                     hA,
+                     std::vector<T>&         A)
+{
+    if(CPU)
+    {
+        // A = X * Y^H has exactly the given rank, so that a sample of k + p >= rank columns
+        // spans its whole range and the leading singular triplets are recovered to
+        // working precision. The factors are centred at zero so that the singular values
+        // are not dominated by a single one.
+        std::vector<T> X(size_t(m) * rank);
+        std::vector<T> Y(size_t(n) * rank);
+        rocblas_init<T>(X, m, rank, m);
+        rocblas_init<T>(Y, n, rank, n);
+        for(T& x : X)
+            x -= T(5);
+        for(T& y : Y)
+            y -= T(5);
+
+        rocblas_init<T>(hA, true);
+        cpu_gemm(HIPSOLVER_OP_N,
+                 HIPSOLVER_OP_C,
+                 m,
+                 n,
+                 rank,
+                 T(1),
+                 X.data(),
+                 m,
+                 Y.data(),
+                 n,
+                 T(0),
+                 hA[0],
+                 lda);
+
+        // make copy of original data to test vectors if required
+        for(size_t i = 0; i < size_t(lda) * n; ++i)
+            A[i] = hA[0][i];
+    }
+
+    if(GPU)
+    {
+        // now copy to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename I,
+          typename SIZE,
+          typename Td,
+          typename Sd,
+          typename Id,
+          typename Th,
+          typename Sh,
+          typename Ih>
+void gesvdr_getError(const hipsolverHandle_t   handle,
+                     const hipsolverDnParams_t params,
+                     const signed char         jobu,
+                     const signed char         jobv,
+                     const I                   m,
+                     const I                   n,
+                     const I                   k,
+                     const I                   p,
+                     const I                   niters,
+                     Td&                       dA,
+                     const I                   lda,
+                     Sd&                       dS,
+                     Td&                       dU,
+                     const I                   ldu,
+                     Td&                       dV,
+                     const I                   ldv,
+                     Td&                       dWork,
+                     const SIZE                dlwork,
+                     Th&                       hWork,
+                     const SIZE                hlwork,
+                     Id&                       dinfo,
+                     Th&                       hA,
+                     Sh&                       hS,
+                     Sh&                       hSres,
+                     Th&                       hUres,
+                     Th&                       hVres,
+                     Ih&                       hinfoRes,
+                     double*                   max_err,
+                     double*                   max_errv)
+{
+    using S = decltype(std::real(T{}));
+
+    int            size_W = 5 * int(max(m, n));
+    std::vector<T> work(size_W);
+    std::vector<S> hE(size_W);
+    std::vector<T> A(size_t(lda) * n);
+    int            info;
+
+    // input data initialization
+    gesvdr_initData<true, true, T>(handle, m, n, k + p, dA, lda, hA, A);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_gesvdr(API,
+                                         handle,
+                                         params,
+                                         jobu,
+                                         jobv,
+                                         m,
+                                         n,
+                                         k,
+                                         p,
+                                         niters,
+                                         dA.data(),
+                                         lda,
+                                         dS.data(),
+                                         dU.data(),
+                                         ldu,
+                                         dV.data(),
+                                         ldv,
+                                         dWork.data(),
+                                         dlwork,
+                                         hWork.data(),
+                                         hlwork,
+                                         dinfo.data()));
+    CHECK_HIP_ERROR(hSres.transfer_from(dS));
+    CHECK_HIP_ERROR(hinfoRes.transfer_from(dinfo));
+    if(jobu == 'S')
+        CHECK_HIP_ERROR(hUres.transfer_from(dU));
+    if(jobv == 'S')
+        CHECK_HIP_ERROR(hVres.transfer_from(dV));
+
+    // CPU lapack
+    cpu_gesvd('N',
+              'N',
+              m,
+              n,
+              hA[0],
+              lda,
+              hS[0],
+              (T*)nullptr,
+              1,
+              (T*)nullptr,
+              1,
+              work.data(),
+              size_W,
+              hE.data(),
+              &info);
+
+    // check info for non-convergence
+    *max_err = 0;
+    EXPECT_EQ(info, hinfoRes[0][0]);
+    if(info != hinfoRes[0][0])
+        *max_err += 1;
+
+    // error is ||hS - hSres|| over the k leading singular values
+    double err = norm_error('F', 1, k, 1, hS[0], hSres[0]);
+    *max_err   = err > *max_err ? err : *max_err;
+
+    // check the singular vectors implicitly (A*v_j = s_j*u_j); when only one set is
+    // computed, check that its columns are orthonormal instead
+    *max_errv = 0;
+    if(hinfoRes[0][0] == 0 && jobu == 'S' && jobv == 'S')
+    {
+        err = 0;
+        for(int j = 0; j < k; ++j)
+        {
+            for(int i = 0; i < m; ++i)
+            {
+                T tmp = 0;
+                for(int l = 0; l < n; ++l)
+                    tmp += A[i + l * lda] * hVres[0][l + j * ldv];
+                tmp -= hSres[0][j] * hUres[0][i + j * ldu];
+                err += std::abs(tmp) * std::abs(tmp);
+            }
+        }
+        err       = std::sqrt(err) / double(snorm('F', m, n, A.data(), lda));
+        *max_errv = err > *max_errv ? err : *max_errv;
+    }
+    else if(hinfoRes[0][0] == 0 && (jobu == 'S' || jobv == 'S'))
+    {
+        I  rows = jobu == 'S' ? m : n;
+        I  ld   = jobu == 'S' ? ldu : ldv;
+        T* Q    = jobu == 'S' ? hUres[0] : hVres[0];
+        err     = 0;
+        for(int j1 = 0; j1 < k; ++j1)
+        {
+            for(int j2 = 0; j2 < k; ++j2)
+            {
+                T tmp = j1 == j2 ? T(-1) : T(0);
+                for(int i = 0; i < rows; ++i)
+                    tmp += std::conj(Q[i + j1 * ld]) * Q[i + j2 * ld];
+                err += std::abs(tmp) * std::abs(tmp);
+            }
+        }
+        err       = std::sqrt(err);
+        *max_errv = err > *max_errv ? err : *max_errv;
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename I,
+          typename SIZE,
+          typename Td,
+          typename Sd,
+          typename Id,
+          typename Th,
+          typename Sh>
+void gesvdr_getPerfData(const hipsolverHandle_t   handle,
+                        const hipsolverDnParams_t params,
+                        const signed char         jobu,
+                        const signed char         jobv,
+                        const I                   m,
+                        const I                   n,
+                        const I                   k,
+                        const I                   p,
+                        const I                   niters,
+                        Td&                       dA,
+                        const I                   lda,
+                        Sd&                       dS,
+                        Td&                       dU,
+                        const I                   ldu,
+                        Td&                       dV,
+                        const I                   ldv,
+                        Td&                       dWork,
+                        const SIZE                dlwork,
+                        Th&                       hWork,
+                        const SIZE                hlwork,
+                        Id&                       dinfo,
+                        Th&                       hA,
+                        Sh&                       hS,
+                        double*                   gpu_time_used,
+                        double*                   cpu_time_used,
+                        const int                 hot_calls,
+                        const bool                perf)
+{
+    using S = decltype(std::real(T{}));
+
+    int            size_W = 5 * int(max(m, n));
+    std::vector<T> work(size_W);
+    std::vector<S> hE(size_W);
+    std::vector<T> A(size_t(lda) * n);
+    int            info;
+
+    if(!perf)
+    {
+        gesvdr_initData<true, false, T>(handle, m, n, k + p, dA, lda, hA, A);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_gesvd('N',
+                  'N',
+                  m,
+                  n,
+                  hA[0],
+                  lda,
+                  hS[0],
+                  (T*)nullptr,
+                  1,
+                  (T*)nullptr,
+                  1,
+                  work.data(),
+                  size_W,
+                  hE.data(),
+                  &info);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    gesvdr_initData<true, false, T>(handle, m, n, k + p, dA, lda, hA, A);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        gesvdr_initData<false, true, T>(handle, m, n, k + p, dA, lda, hA, A);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_gesvdr(API,
+                                             handle,
+                                             params,
+                                             jobu,
+                                             jobv,
+                                             m,
+                                             n,
+                                             k,
+                                             p,
+                                             niters,
+                                             dA.data(),
+                                             lda,
+                                             dS.data(),
+                                             dU.data(),
+                                             ldu,
+                                             dV.data(),
+                                             ldv,
+                                             dWork.data(),
+                                             dlwork,
+                                             hWork.data(),
+                                             hlwork,
+                                             dinfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        gesvdr_initData<false, true, T>(handle, m, n, k + p, dA, lda, hA, A);
+
+        start = get_time_us_sync(stream);
+        hipsolver_gesvdr(API,
+                         handle,
+                         params,
+                         jobu,
+                         jobv,
+                         m,
+                         n,
+                         k,
+                         p,
+                         niters,
+                         dA.data(),
+                         lda,
+                         dS.data(),
+                         dU.data(),
+                         ldu,
+                         dV.data(),
+                         ldv,
+                         dWork.data(),
+                         dlwork,
+                         hWork.data(),
+                         hlwork,
+                         dinfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <testAPI_t API, typename T, typename I, typename SIZE>
+void testing_gesvdr(Arguments& argus)
+{
+    using S = decltype(std::real(T{}));
+
+    // get arguments
+    hipsolver_local_handle handle;
+    hipsolver_local_params params;
+    char                   jobuC  = argus.get<char>("jobu");
+    char                   jobvC  = argus.get<char>("jobv");
+    I                      m      = argus.get<int>("m");
+    I                      n      = argus.get<int>("n", m);
+    I                      k      = argus.get<int>("rank", 1);
+    I                      p      = argus.get<int>("p", 0);
+    I                      niters = argus.get<int>("niters", 2);
+    I                      lda    = argus.get<int>("lda", m);
+    I                      ldu    = argus.get<int>("ldu", m);
+    I                      ldv    = argus.get<int>("ldv", n);
+
+    signed char jobu      = jobuC;
+    signed char jobv      = jobvC;
+    int         hot_calls = argus.iters;
+
+    // check non-supported values
+    if((jobu != 'S' && jobu != 'N') || (jobv != 'S' && jobv != 'N'))
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                               handle,
+                                               params,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               k,
+                                               p,
+                                               niters,
+                                               (T*)nullptr,
+                                               lda,
+                                               (S*)nullptr,
+                                               (T*)nullptr,
+                                               ldu,
+                                               (T*)nullptr,
+                                               ldv,
+                                               (T*)nullptr,
+                                               (SIZE)0,
+                                               (T*)nullptr,
+                                               (SIZE)0,
+                                               (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_S    = size_t(k);
+    size_t size_U    = jobu == 'S' ? size_t(ldu) * k : 0;
+    size_t size_V    = jobv == 'S' ? size_t(ldv) * k : 0;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0, max_errorv = 0;
+
+    size_t size_Sres = (argus.unit_check || argus.norm_check) ? size_S : 0;
+    size_t size_SRef = (argus.unit_check || argus.norm_check) ? std::min(m, n) : 0;
+    size_t size_Ures = (argus.unit_check || argus.norm_check) ? size_U : 0;
+    size_t size_Vres = (argus.unit_check || argus.norm_check) ? size_V : 0;
+
+    // check invalid sizes
+    bool invalid_size = (m < 0 || n < 0 || k < 1 || p < 0 || niters < 0 || k + p > std::min(m, n)
+                         || lda < m || (jobu == 'S' && ldu < m) || (jobv == 'S' && ldv < n));
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_gesvdr(API,
+                                               handle,
+                                               params,
+                                               jobu,
+                                               jobv,
+                                               m,
+                                               n,
+                                               k,
+                                               p,
+                                               niters,
+                                               (T*)nullptr,
+                                               lda,
+                                               (S*)nullptr,
+                                               (T*)nullptr,
+                                               ldu,
+                                               (T*)nullptr,
+                                               ldv,
+                                               (T*)nullptr,
+                                               (SIZE)0,
+                                               (T*)nullptr,
+                                               (SIZE)0,
+                                               (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    SIZE size_dW, size_hW;
+    hipsolver_gesvdr_bufferSize(API,
+                                handle,
+                                params,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                k,
+                                p,
+                                niters,
+                                (T*)nullptr,
+                                lda,
+                                (S*)nullptr,
+                                (T*)nullptr,
+                                ldu,
+                                (T*)nullptr,
+                                ldv,
+                                &size_dW,
+                                &size_hW);
+
+    if(argus.mem_query)
+    {
+        rocsolver_bench_inform(inform_mem_query, size_dW);
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<S>     hS(size_SRef, 1, size_SRef, 1);
+    host_strided_batch_vector<S>     hSres(size_Sres, 1, size_Sres, 1);
+    host_strided_batch_vector<T>     hUres(size_Ures, 1, size_Ures, 1);
+    host_strided_batch_vector<T>     hVres(size_Vres, 1, size_Vres, 1);
+    host_strided_batch_vector<int>   hinfoRes(1, 1, 1, 1);
+    host_strided_batch_vector<T>     hWork(size_hW, 1, size_hW, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<S>   dS(size_S, 1, size_S, 1);
+    device_strided_batch_vector<T>   dU(size_U, 1, size_U, 1);
+    device_strided_batch_vector<T>   dV(size_V, 1, size_V, 1);
+    device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    if(size_S)
+        CHECK_HIP_ERROR(dS.memcheck());
+    if(size_U)
+        CHECK_HIP_ERROR(dU.memcheck());
+    if(size_V)
+        CHECK_HIP_ERROR(dV.memcheck());
+    CHECK_HIP_ERROR(dinfo.memcheck());
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        gesvdr_getError<API, T>(handle,
+                                params,
+                                jobu,
+                                jobv,
+                                m,
+                                n,
+                                k,
+                                p,
+                                niters,
+                                dA,
+                                lda,
+                                dS,
+                                dU,
+                                ldu,
+                                dV,
+                                ldv,
+                                dWork,
+                                size_dW,
+                                hWork,
+                                size_hW,
+                                dinfo,
+                                hA,
+                                hS,
+                                hSres,
+                                hUres,
+                                hVres,
+                                hinfoRes,
+                                &max_error,
+                                &max_errorv);
+
+    // collect performance data
+    if(argus.timing)
+        gesvdr_getPerfData<API, T>(handle,
+                                   params,
+                                   jobu,
+                                   jobv,
+                                   m,
+                                   n,
+                                   k,
+                                   p,
+                                   niters,
+                                   dA,
+                                   lda,
+                                   dS,
+                                   dU,
+                                   ldu,
+                                   dV,
+                                   ldv,
+                                   dWork,
+                                   size_dW,
+                                   hWork,
+                                   size_hW,
+                                   dinfo,
+                                   hA,
+                                   hS,
+                                   &gpu_time_used,
+                                   &cpu_time_used,
+                                   hot_calls,
+                                   argus.perf);
+
+    // validate results for rocsolver-test
+    // using max(m,n) * machine_precision as tolerance
+    if(argus.unit_check)
+    {
+        ROCSOLVER_TEST_CHECK(T, max_error, max(m, n));
+        if(jobu == 'S' || jobv == 'S')
+            ROCSOLVER_TEST_CHECK(T, max_errorv, max(m, n));
+    }
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(jobu == 'S' || jobv == 'S')
+            max_error = (max_error >= max_errorv) ? max_error : max_errorv;
+
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output(
+                "jobu", "jobv", "m", "n", "rank", "p", "niters", "lda", "ldu", "ldv");
+            rocsolver_bench_output(jobuC, jobvC, m, n, k, p, niters, lda, ldu, ldv);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -24,9 +24,11 @@
 #include "clientcommon.hpp"
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename I,
           typename SIZE,
           typename Td,
+          typename Wd,
           typename Id,
           typename INTd,
           typename Th>
@@ -39,7 +41,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
                         const I                   stA,
                         Id                        dIpiv,
                         const I                   stP,
-                        Td                        dWork,
+                        Wd                        dWork,
                         const SIZE                dlwork,
                         Th                        hWork,
                         const SIZE                hlwork,
@@ -49,6 +51,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                           false,
+                                          STRIDED,
                                           nullptr,
                                           params,
                                           m,
@@ -74,6 +77,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
     if constexpr(!std::is_same<I, int>::value)
         EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                               false,
+                                              STRIDED,
                                               handle,
                                               (hipsolverDnParams_t) nullptr,
                                               m,
@@ -92,6 +96,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
                               HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           params,
                                           m,
@@ -110,6 +115,7 @@ void getrf_checkBadArgs(const hipsolverHandle_t   handle,
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                           false,
+                                          STRIDED,
                                           handle,
                                           params,
                                           m,
@@ -144,24 +150,38 @@ void testing_getrf_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<I>   dIpiv(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // SIZE size_dW, size_hW;
-        // hipsolver_getrf_bufferSize(API, handle, params, m, n, dA.data(), lda, &size_dW, &size_hW);
-        // host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
-        // device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
-        // if(size_dW)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // getrf_checkBadArgs<API>(
-        //     handle, params, m, n, dA.data(), lda, stA, dIpiv.data(), stP, dWork.data(), size_dW, hWork.data(), size_hW, dInfo.data(), bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<I>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        SIZE size_dW, size_hW;
+        hipsolver_getrf_bufferSize(
+            API, STRIDED, handle, params, m, n, dA.data(), lda, stA, &size_dW, &size_hW, bc);
+        host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+        device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+        if(size_dW)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getrf_checkBadArgs<API, STRIDED>(handle,
+                                         params,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dWork.data(),
+                                         size_dW,
+                                         hWork.data(),
+                                         size_hW,
+                                         dInfo.data(),
+                                         bc);
     }
     else
     {
@@ -174,28 +194,29 @@ void testing_getrf_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         SIZE size_dW, size_hW;
-        hipsolver_getrf_bufferSize(API, handle, params, m, n, dA.data(), lda, &size_dW, &size_hW);
+        hipsolver_getrf_bufferSize(
+            API, STRIDED, handle, params, m, n, dA.data(), lda, stA, &size_dW, &size_hW, bc);
         host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
         device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
         if(size_dW)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        getrf_checkBadArgs<API>(handle,
-                                params,
-                                m,
-                                n,
-                                dA.data(),
-                                lda,
-                                stA,
-                                dIpiv.data(),
-                                stP,
-                                dWork.data(),
-                                size_dW,
-                                hWork.data(),
-                                size_hW,
-                                dInfo.data(),
-                                bc);
+        getrf_checkBadArgs<API, STRIDED>(handle,
+                                         params,
+                                         m,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dWork.data(),
+                                         size_dW,
+                                         hWork.data(),
+                                         size_hW,
+                                         dInfo.data(),
+                                         bc);
     }
 }
 
@@ -270,13 +291,16 @@ void getrf_initData(const hipsolverHandle_t   handle,
 
 template <testAPI_t API,
           bool      NPVT,
+          bool      STRIDED,
           typename T,
           typename I,
           typename SIZE,
           typename Td,
+          typename Wd,
           typename Id,
           typename INTd,
           typename Th,
+          typename Wh,
           typename Ih,
           typename INTh>
 void getrf_getError(const hipsolverHandle_t   handle,
@@ -288,9 +312,9 @@ void getrf_getError(const hipsolverHandle_t   handle,
                     const I                   stA,
                     Id&                       dIpiv,
                     const I                   stP,
-                    Td&                       dWork,
+                    Wd&                       dWork,
                     const SIZE                dlwork,
-                    Th&                       hWork,
+                    Wh&                       hWork,
                     const SIZE                hlwork,
                     INTd&                     dInfo,
                     const int                 bc,
@@ -310,6 +334,7 @@ void getrf_getError(const hipsolverHandle_t   handle,
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_getrf(API,
                                         NPVT,
+                                        STRIDED,
                                         handle,
                                         params,
                                         m,
@@ -372,13 +397,16 @@ void getrf_getError(const hipsolverHandle_t   handle,
 
 template <testAPI_t API,
           bool      NPVT,
+          bool      STRIDED,
           typename T,
           typename I,
           typename SIZE,
           typename Td,
+          typename Wd,
           typename Id,
           typename INTd,
           typename Th,
+          typename Wh,
           typename INTh>
 void getrf_getPerfData(const hipsolverHandle_t   handle,
                        const hipsolverDnParams_t params,
@@ -389,9 +417,9 @@ void getrf_getPerfData(const hipsolverHandle_t   handle,
                        const I                   stA,
                        Id&                       dIpiv,
                        const I                   stP,
-                       Td&                       dWork,
+                       Wd&                       dWork,
                        const SIZE                dlwork,
-                       Th&                       hWork,
+                       Wh&                       hWork,
                        const SIZE                hlwork,
                        INTd&                     dInfo,
                        const int                 bc,
@@ -426,6 +454,7 @@ void getrf_getPerfData(const hipsolverHandle_t   handle,
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrf(API,
                                             NPVT,
+                                            STRIDED,
                                             handle,
                                             params,
                                             m,
@@ -456,6 +485,7 @@ void getrf_getPerfData(const hipsolverHandle_t   handle,
         start = get_time_us_sync(stream);
         hipsolver_getrf(API,
                         NPVT,
+                        STRIDED,
                         handle,
                         params,
                         m,
@@ -518,29 +548,31 @@ void testing_getrf(Arguments& argus)
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
-            //                                       NPVT,
-            //                                       handle,
-            //                                       params,
-            //                                       m,
-            //                                       n,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (I*)nullptr,
-            //                                       stP,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
+                                                  NPVT,
+                                                  STRIDED,
+                                                  handle,
+                                                  params,
+                                                  m,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (I*)nullptr,
+                                                  stP,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_getrf(API,
                                                   NPVT,
+                                                  STRIDED,
                                                   handle,
                                                   params,
                                                   m,
@@ -568,7 +600,12 @@ void testing_getrf(Arguments& argus)
 
     // memory size query is necessary
     SIZE size_dW, size_hW;
-    hipsolver_getrf_bufferSize(API, handle, params, m, n, (T*)nullptr, lda, &size_dW, &size_hW);
+    if(BATCHED)
+        hipsolver_getrf_bufferSize(
+            API, STRIDED, handle, params, m, n, (T**)nullptr, lda, stA, &size_dW, &size_hW, bc);
+    else
+        hipsolver_getrf_bufferSize(
+            API, STRIDED, handle, params, m, n, (T*)nullptr, lda, stA, &size_dW, &size_hW, bc);
 
     if(argus.mem_query)
     {
@@ -578,75 +615,75 @@ void testing_getrf(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>             hA(size_A, 1, bc);
-        // host_batch_vector<T>             hARes(size_ARes, 1, bc);
-        // host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
-        // host_strided_batch_vector<I>     hIpivRes(size_PRes, 1, stPRes, bc);
-        // host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
-        // host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
-        // host_strided_batch_vector<T>     hWork(size_hW, 1, size_hW, 1); // size_hW accounts for bc
-        // device_batch_vector<T>           dA(size_A, 1, bc);
-        // device_strided_batch_vector<I>   dIpiv(size_P, 1, stP, bc);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
-        // device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1); // size_dW accounts for bc
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-        // if(size_P)
-        //     CHECK_HIP_ERROR(dIpiv.memcheck());
-        // if(size_dW)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     getrf_getError<API, NPVT, T>(handle,
-        //                                  params,
-        //                                  m,
-        //                                  n,
-        //                                  dA,
-        //                                  lda,
-        //                                  stA,
-        //                                  dIpiv,
-        //                                  stP,
-        //                                  dWork,
-        //                                  size_dW,
-        //                                  hWork,
-        //                                  size_hW,
-        //                                  dInfo,
-        //                                  bc,
-        //                                  hA,
-        //                                  hARes,
-        //                                  hIpiv,
-        //                                  hIpivRes,
-        //                                  hInfo,
-        //                                  hInfoRes,
-        //                                  &max_error);
-
-        // // collect performance data
-        // if(argus.timing)
-        //     getrf_getPerfData<API, NPVT, T>(handle,
-        //                                     params,
-        //                                     m,
-        //                                     n,
-        //                                     dA,
-        //                                     lda,
-        //                                     stA,
-        //                                     dIpiv,
-        //                                     stP,
-        //                                     dWork,
-        //                                     size_dW,
-        //                                     hWork,
-        //                                     size_hW,
-        //                                     dInfo,
-        //                                     bc,
-        //                                     hA,
-        //                                     hIpiv,
-        //                                     hInfo,
-        //                                     &gpu_time_used,
-        //                                     &cpu_time_used,
-        //                                     hot_calls,
-        //                                     argus.perf);
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<I>     hIpivRes(size_PRes, 1, stPRes, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        host_strided_batch_vector<T>     hWork(size_hW, 1, size_hW, 1); // size_hW accounts for bc
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_strided_batch_vector<I>   dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1); // size_dW accounts for bc
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        if(size_dW)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrf_getError<API, NPVT, STRIDED, T>(handle,
+                                                  params,
+                                                  m,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dIpiv,
+                                                  stP,
+                                                  dWork,
+                                                  size_dW,
+                                                  hWork,
+                                                  size_hW,
+                                                  dInfo,
+                                                  bc,
+                                                  hA,
+                                                  hARes,
+                                                  hIpiv,
+                                                  hIpivRes,
+                                                  hInfo,
+                                                  hInfoRes,
+                                                  &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrf_getPerfData<API, NPVT, STRIDED, T>(handle,
+                                                     params,
+                                                     m,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dIpiv,
+                                                     stP,
+                                                     dWork,
+                                                     size_dW,
+                                                     hWork,
+                                                     size_hW,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hIpiv,
+                                                     hInfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
     }
 
     else
@@ -673,53 +710,53 @@ void testing_getrf(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            getrf_getError<API, NPVT, T>(handle,
-                                         params,
-                                         m,
-                                         n,
-                                         dA,
-                                         lda,
-                                         stA,
-                                         dIpiv,
-                                         stP,
-                                         dWork,
-                                         size_dW,
-                                         hWork,
-                                         size_hW,
-                                         dInfo,
-                                         bc,
-                                         hA,
-                                         hARes,
-                                         hIpiv,
-                                         hIpivRes,
-                                         hInfo,
-                                         hInfoRes,
-                                         &max_error);
+            getrf_getError<API, NPVT, STRIDED, T>(handle,
+                                                  params,
+                                                  m,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dIpiv,
+                                                  stP,
+                                                  dWork,
+                                                  size_dW,
+                                                  hWork,
+                                                  size_hW,
+                                                  dInfo,
+                                                  bc,
+                                                  hA,
+                                                  hARes,
+                                                  hIpiv,
+                                                  hIpivRes,
+                                                  hInfo,
+                                                  hInfoRes,
+                                                  &max_error);
 
         // collect performance data
         if(argus.timing)
-            getrf_getPerfData<API, NPVT, T>(handle,
-                                            params,
-                                            m,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dIpiv,
-                                            stP,
-                                            dWork,
-                                            size_dW,
-                                            hWork,
-                                            size_hW,
-                                            dInfo,
-                                            bc,
-                                            hA,
-                                            hIpiv,
-                                            hInfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+            getrf_getPerfData<API, NPVT, STRIDED, T>(handle,
+                                                     params,
+                                                     m,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dIpiv,
+                                                     stP,
+                                                     dWork,
+                                                     size_dW,
+                                                     hWork,
+                                                     size_hW,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hIpiv,
+                                                     hInfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -0,0 +1,817 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, typename T, typename U, typename V>
+void getri_checkBadArgs(const hipsolverHandle_t handle,
+                        const int               n,
+                        T                       dA,
+                        const int               lda,
+                        const int               stA,
+                        U                       dIpiv,
+                        const int               stP,
+                        T                       dC,
+                        const int               ldc,
+                        const int               stC,
+                        V                       dWork,
+                        const int               lwork,
+                        U                       dInfo,
+                        const int               bc)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(API,
+                                          nullptr,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(API,
+                                          handle,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          -1),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(API,
+                                          handle,
+                                          n,
+                                          (T) nullptr,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(API,
+                                          handle,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          (U) nullptr,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          dInfo,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_getri(API,
+                                          handle,
+                                          n,
+                                          dA,
+                                          lda,
+                                          stA,
+                                          dIpiv,
+                                          stP,
+                                          dC,
+                                          ldc,
+                                          stC,
+                                          dWork,
+                                          lwork,
+                                          (U) nullptr,
+                                          bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_getri_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    int                    n   = 1;
+    int                    lda = 1;
+    int                    ldc = 1;
+    int                    stA = 1;
+    int                    stP = 1;
+    int                    stC = 1;
+    int                    bc  = 1;
+
+    if(BATCHED)
+    {
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_batch_vector<T>           dC(1, 1, 1);
+        device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getri_bufferSize(API,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dC.data(),
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getri_checkBadArgs<API>(handle,
+                                n,
+                                dA.data(),
+                                lda,
+                                stA,
+                                dIpiv.data(),
+                                stP,
+                                dC.data(),
+                                ldc,
+                                stC,
+                                dWork.data(),
+                                size_W,
+                                dInfo.data(),
+                                bc);
+    }
+    else
+    {
+        // memory allocations
+        device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+        device_strided_batch_vector<T>   dC(1, 1, 1, 1);
+        device_strided_batch_vector<int> dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dC.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        int size_W;
+        hipsolver_getri_bufferSize(API,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dC.data(),
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getri_checkBadArgs<API>(handle,
+                                n,
+                                dA.data(),
+                                lda,
+                                stA,
+                                dIpiv.data(),
+                                stP,
+                                dC.data(),
+                                ldc,
+                                stC,
+                                dWork.data(),
+                                size_W,
+                                dInfo.data(),
+                                bc);
+    }
+}
+
+template <bool CPU, bool GPU, typename T, typename Td, typename Ud, typename Th, typename Uh>
+void getri_initData(const hipsolverHandle_t handle,
+                    const int               n,
+                    Td&                     dA,
+                    const int               lda,
+                    const int               stA,
+                    Ud&                     dIpiv,
+                    const int               stP,
+                    const int               bc,
+                    Th&                     hA,
+                    Uh&                     hIpiv)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        for(int b = 0; b < bc; ++b)
+        {
+            // scale A to avoid singularities
+            for(int i = 0; i < n; i++)
+            {
+                for(int j = 0; j < n; j++)
+                {
+                    if(i == j)
+                        hA[b][i + j * lda] += 400;
+                    else
+                        hA[b][i + j * lda] -= 4;
+                }
+            }
+
+            // make some matrices singular
+            // (always the same elements for debugging purposes)
+            // the algorithm must detect the first zero pivot in those matrices
+            if(n > 20 && (b == bc / 4 || b == bc / 2))
+            {
+                int j = (b == bc / 4) ? n / 4 : n / 2;
+                for(int i = 0; i < n; i++)
+                    hA[b][i + j * lda] = 0;
+            }
+
+            // do the LU decomposition of matrix A w/ the reference LAPACK routine
+            int info;
+            cpu_getrf(n, n, hA[b], lda, hIpiv[b], &info);
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy the factors to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+        CHECK_HIP_ERROR(dIpiv.transfer_from(hIpiv));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void getri_getError(const hipsolverHandle_t handle,
+                    const int               n,
+                    Td&                     dA,
+                    const int               lda,
+                    const int               stA,
+                    Ud&                     dIpiv,
+                    const int               stP,
+                    Td&                     dC,
+                    const int               ldc,
+                    const int               stC,
+                    const bool              outplace,
+                    Vd&                     dWork,
+                    const int               lwork,
+                    Ud&                     dInfo,
+                    const int               bc,
+                    Th&                     hA,
+                    Th&                     hARes,
+                    Th&                     hCRes,
+                    Uh&                     hIpiv,
+                    Uh&                     hInfo,
+                    Uh&                     hInfoRes,
+                    double*                 max_err)
+{
+    int            size_W = std::max(n, 1);
+    std::vector<T> hW(size_W);
+
+    // input data initialization
+    getri_initData<true, true, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_getri(API,
+                                        handle,
+                                        n,
+                                        dA.data(),
+                                        lda,
+                                        stA,
+                                        dIpiv.data(),
+                                        stP,
+                                        outplace ? dC.data() : nullptr,
+                                        ldc,
+                                        stC,
+                                        dWork.data(),
+                                        lwork,
+                                        dInfo.data(),
+                                        bc));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    if(outplace)
+        CHECK_HIP_ERROR(hCRes.transfer_from(dC));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    double err;
+    *max_err = 0;
+
+    // the out-of-place version must leave the factors intact
+    if(outplace)
+    {
+        for(int b = 0; b < bc; ++b)
+        {
+            err      = norm_error('F', n, n, lda, hA[b], hARes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // CPU lapack
+    for(int b = 0; b < bc; ++b)
+        cpu_getri(n, hA[b], lda, hIpiv[b], hW.data(), size_W, hInfo[b]);
+
+    // error is ||hA - hARes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm.
+    // The inverse is only defined for the non-singular matrices.
+    for(int b = 0; b < bc; ++b)
+    {
+        if(hInfo[b][0] == 0)
+        {
+            err = outplace ? norm_error('F', n, n, lda, hA[b], hCRes[b], ldc)
+                           : norm_error('F', n, n, lda, hA[b], hARes[b]);
+            *max_err = err > *max_err ? err : *max_err;
+        }
+    }
+
+    // check info for singularities
+    err = 0;
+    for(int b = 0; b < bc; ++b)
+    {
+        EXPECT_EQ(hInfo[b][0], hInfoRes[b][0]) << "where b = " << b;
+        if(hInfo[b][0] != hInfoRes[b][0])
+            err++;
+    }
+    *max_err += err;
+}
+
+template <testAPI_t API,
+          typename T,
+          typename Td,
+          typename Ud,
+          typename Vd,
+          typename Th,
+          typename Uh>
+void getri_getPerfData(const hipsolverHandle_t handle,
+                       const int               n,
+                       Td&                     dA,
+                       const int               lda,
+                       const int               stA,
+                       Ud&                     dIpiv,
+                       const int               stP,
+                       Td&                     dC,
+                       const int               ldc,
+                       const int               stC,
+                       const bool              outplace,
+                       Vd&                     dWork,
+                       const int               lwork,
+                       Ud&                     dInfo,
+                       const int               bc,
+                       Th&                     hA,
+                       Uh&                     hIpiv,
+                       Uh&                     hInfo,
+                       double*                 gpu_time_used,
+                       double*                 cpu_time_used,
+                       const int               hot_calls,
+                       const bool              perf)
+{
+    int            size_W = std::max(n, 1);
+    std::vector<T> hW(size_W);
+
+    if(!perf)
+    {
+        getri_initData<true, false, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        for(int b = 0; b < bc; ++b)
+            cpu_getri(n, hA[b], lda, hIpiv[b], hW.data(), size_W, hInfo[b]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    getri_initData<true, false, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        getri_initData<false, true, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_getri(API,
+                                            handle,
+                                            n,
+                                            dA.data(),
+                                            lda,
+                                            stA,
+                                            dIpiv.data(),
+                                            stP,
+                                            outplace ? dC.data() : nullptr,
+                                            ldc,
+                                            stC,
+                                            dWork.data(),
+                                            lwork,
+                                            dInfo.data(),
+                                            bc));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        getri_initData<false, true, T>(handle, n, dA, lda, stA, dIpiv, stP, bc, hA, hIpiv);
+
+        start = get_time_us_sync(stream);
+        hipsolver_getri(API,
+                        handle,
+                        n,
+                        dA.data(),
+                        lda,
+                        stA,
+                        dIpiv.data(),
+                        stP,
+                        outplace ? dC.data() : nullptr,
+                        ldc,
+                        stC,
+                        dWork.data(),
+                        lwork,
+                        dInfo.data(),
+                        bc);
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+void testing_getri(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    int                    n        = argus.get<int>("n");
+    int                    lda      = argus.get<int>("lda", n);
+    int                    ldc      = argus.get<int>("ldc", n);
+    int                    stA      = argus.get<int>("strideA", lda * n);
+    int                    stP      = argus.get<int>("strideP", n);
+    int                    stC      = argus.get<int>("strideC", ldc * n);
+    char                   fast_alg = argus.get<char>("fast_alg", 'I');
+
+    bool outplace  = (fast_alg == 'O');
+    int  bc        = argus.batch_count;
+    int  hot_calls = argus.iters;
+
+    int stARes = (argus.unit_check || argus.norm_check) ? stA : 0;
+    int stCRes = (argus.unit_check || argus.norm_check) && outplace ? stC : 0;
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    size_t size_P    = size_t(n);
+    size_t size_C    = outplace ? size_t(ldc) * n : 0;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+    size_t size_CRes = (argus.unit_check || argus.norm_check) ? size_C : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n || (outplace && ldc < n) || bc < 0);
+    if(invalid_size)
+    {
+        if(BATCHED)
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_getri(API,
+                                                  handle,
+                                                  n,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (int*)nullptr,
+                                                  stP,
+                                                  (T**)nullptr,
+                                                  ldc,
+                                                  stC,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+        else
+        {
+            EXPECT_ROCBLAS_STATUS(hipsolver_getri(API,
+                                                  handle,
+                                                  n,
+                                                  (T*)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (int*)nullptr,
+                                                  stP,
+                                                  (T*)nullptr,
+                                                  ldc,
+                                                  stC,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
+        }
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    if(BATCHED)
+    {
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hARes(size_ARes, 1, bc);
+        host_batch_vector<T>             hCRes(size_CRes, 1, bc);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_batch_vector<T>           dC(size_C, 1, bc);
+        device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // memory size query is necessary
+        int size_W;
+        hipsolver_getri_bufferSize(API,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   outplace ? dC.data() : nullptr,
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size_W);
+            return;
+        }
+
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1); // size_W accounts for bc
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getri_getError<API, T>(handle,
+                                   n,
+                                   dA,
+                                   lda,
+                                   stA,
+                                   dIpiv,
+                                   stP,
+                                   dC,
+                                   ldc,
+                                   stC,
+                                   outplace,
+                                   dWork,
+                                   size_W,
+                                   dInfo,
+                                   bc,
+                                   hA,
+                                   hARes,
+                                   hCRes,
+                                   hIpiv,
+                                   hInfo,
+                                   hInfoRes,
+                                   &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getri_getPerfData<API, T>(handle,
+                                      n,
+                                      dA,
+                                      lda,
+                                      stA,
+                                      dIpiv,
+                                      stP,
+                                      dC,
+                                      ldc,
+                                      stC,
+                                      outplace,
+                                      dWork,
+                                      size_W,
+                                      dInfo,
+                                      bc,
+                                      hA,
+                                      hIpiv,
+                                      hInfo,
+                                      &gpu_time_used,
+                                      &cpu_time_used,
+                                      hot_calls,
+                                      argus.perf);
+    }
+
+    else
+    {
+        // memory allocations
+        host_strided_batch_vector<T>     hA(size_A, 1, stA, bc);
+        host_strided_batch_vector<T>     hARes(size_ARes, 1, stARes, bc);
+        host_strided_batch_vector<T>     hCRes(size_CRes, 1, stCRes, bc);
+        host_strided_batch_vector<int>   hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_strided_batch_vector<T>   dA(size_A, 1, stA, bc);
+        device_strided_batch_vector<T>   dC(size_C, 1, stC, bc);
+        device_strided_batch_vector<int> dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_C)
+            CHECK_HIP_ERROR(dC.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        // memory size query is necessary
+        int size_W;
+        hipsolver_getri_bufferSize(API,
+                                   handle,
+                                   n,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   outplace ? dC.data() : nullptr,
+                                   ldc,
+                                   stC,
+                                   &size_W,
+                                   bc);
+
+        if(argus.mem_query)
+        {
+            rocsolver_bench_inform(inform_mem_query, size_W);
+            return;
+        }
+
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1); // size_W accounts for bc
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getri_getError<API, T>(handle,
+                                   n,
+                                   dA,
+                                   lda,
+                                   stA,
+                                   dIpiv,
+                                   stP,
+                                   dC,
+                                   ldc,
+                                   stC,
+                                   outplace,
+                                   dWork,
+                                   size_W,
+                                   dInfo,
+                                   bc,
+                                   hA,
+                                   hARes,
+                                   hCRes,
+                                   hIpiv,
+                                   hInfo,
+                                   hInfoRes,
+                                   &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getri_getPerfData<API, T>(handle,
+                                      n,
+                                      dA,
+                                      lda,
+                                      stA,
+                                      dIpiv,
+                                      stP,
+                                      dC,
+                                      ldc,
+                                      stC,
+                                      outplace,
+                                      dWork,
+                                      size_W,
+                                      dInfo,
+                                      bc,
+                                      hA,
+                                      hIpiv,
+                                      hInfo,
+                                      &gpu_time_used,
+                                      &cpu_time_used,
+                                      hot_calls,
+                                      argus.perf);
+    }
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            if(BATCHED)
+            {
+                rocsolver_bench_output("fast_alg", "n", "lda", "strideP", "ldc", "batch_c");
+                rocsolver_bench_output(fast_alg, n, lda, stP, ldc, bc);
+            }
+            else
+            {
+                rocsolver_bench_output(
+                    "fast_alg", "n", "lda", "strideA", "strideP", "ldc", "strideC", "batch_c");
+                rocsolver_bench_output(fast_alg, n, lda, stA, stP, ldc, stC, bc);
+            }
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+
+    // ensure all arguments were consumed
+    argus.validate_consumed();
+}
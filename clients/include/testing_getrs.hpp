@@ -25,7 +25,14 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename I, typename SIZE, typename Td, typename Id, typename INTd>
+template <testAPI_t API,
+          bool      STRIDED,
+          typename I,
+          typename SIZE,
+          typename Td,
+          typename Wd,
+          typename Id,
+          typename INTd>
 void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                         const hipsolverDnParams_t  params,
                         const hipsolverOperation_t trans,
@@ -39,13 +46,14 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                         Td                         dB,
                         const I                    ldb,
                         const I                    stB,
-                        Td                         dWork,
+                        Wd                         dWork,
                         const SIZE                 lwork,
                         INTd                       dInfo,
                         const int                  bc)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           nullptr,
                                           params,
                                           trans,
@@ -67,6 +75,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           hipsolverOperation_t(-1),
@@ -90,6 +99,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
     // pointers
     if constexpr(!std::is_same<I, int>::value)
         EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                              STRIDED,
                                               handle,
                                               (hipsolverDnParams_t) nullptr,
                                               trans,
@@ -109,6 +119,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                               bc),
                               HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -128,6 +139,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -147,6 +159,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -166,6 +179,7 @@ void getrs_checkBadArgs(const hipsolverHandle_t    handle,
                                           bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                          STRIDED,
                                           handle,
                                           params,
                                           trans,
@@ -205,38 +219,56 @@ void testing_getrs_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_batch_vector<T>           dB(1, 1, 1);
-        // device_strided_batch_vector<I>   dIpiv(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dB.memcheck());
-        // CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-
-        // SIZE size_W;
-        // hipsolver_getrs_bufferSize(API, handle, params, trans, m, nrhs, dA.data(), lda, dIpiv.data(), dB.data(), ldb, &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // getrs_checkBadArgs<API>(handle,
-        //                             params,
-        //                             trans,
-        //                             m,
-        //                             nrhs,
-        //                             dA.data(),
-        //                             lda,
-        //                             stA,
-        //                             dIpiv.data(),
-        //                             stP,
-        //                             dB.data(),
-        //                             ldb,
-        //                             stB,
-        //                             dInfo.data(),
-        //                             bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_batch_vector<T>           dB(1, 1, 1);
+        device_strided_batch_vector<I>   dIpiv(1, 1, 1, 1);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dB.memcheck());
+        CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+
+        SIZE size_W;
+        hipsolver_getrs_bufferSize(API,
+                                   STRIDED,
+                                   handle,
+                                   params,
+                                   trans,
+                                   m,
+                                   nrhs,
+                                   dA.data(),
+                                   lda,
+                                   stA,
+                                   dIpiv.data(),
+                                   stP,
+                                   dB.data(),
+                                   ldb,
+                                   stB,
+                                   &size_W,
+                                   bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        getrs_checkBadArgs<API, STRIDED>(handle,
+                                         params,
+                                         trans,
+                                         m,
+                                         nrhs,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dB.data(),
+                                         ldb,
+                                         stB,
+                                         dWork.data(),
+                                         size_W,
+                                         dInfo.data(),
+                                         bc);
     }
     else
     {
@@ -252,6 +284,7 @@ void testing_getrs_bad_arg()
 
         SIZE size_W;
         hipsolver_getrs_bufferSize(API,
+                                   STRIDED,
                                    handle,
                                    params,
                                    trans,
@@ -259,32 +292,37 @@ void testing_getrs_bad_arg()
                                    nrhs,
                                    dA.data(),
                                    lda,
+                                   stA,
                                    dIpiv.data(),
+                                   stP,
                                    dB.data(),
                                    ldb,
-                                   &size_W);
+                                   stB,
+                                   &size_W,
+                                   bc);
+
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        getrs_checkBadArgs<API>(handle,
-                                params,
-                                trans,
-                                m,
-                                nrhs,
-                                dA.data(),
-                                lda,
-                                stA,
-                                dIpiv.data(),
-                                stP,
-                                dB.data(),
-                                ldb,
-                                stB,
-                                dWork.data(),
-                                size_W,
-                                dInfo.data(),
-                                bc);
+        getrs_checkBadArgs<API, STRIDED>(handle,
+                                         params,
+                                         trans,
+                                         m,
+                                         nrhs,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dIpiv.data(),
+                                         stP,
+                                         dB.data(),
+                                         ldb,
+                                         stB,
+                                         dWork.data(),
+                                         size_W,
+                                         dInfo.data(),
+                                         bc);
     }
 }
 
@@ -357,10 +395,12 @@ void getrs_initData(const hipsolverHandle_t    handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
           typename I,
           typename SIZE,
           typename Td,
+          typename Wd,
           typename Id,
           typename INTd,
           typename Th,
@@ -379,7 +419,7 @@ void getrs_getError(const hipsolverHandle_t    handle,
                     Td&                        dB,
                     const I                    ldb,
                     const I                    stB,
-                    Td&                        dWork,
+                    Wd&                        dWork,
                     const SIZE                 lwork,
                     INTd&                      dInfo,
                     const int                  bc,
@@ -415,6 +455,7 @@ void getrs_getError(const hipsolverHandle_t    handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_getrs(API,
+                                        STRIDED,
                                         handle,
                                         params,
                                         trans,
@@ -465,10 +506,12 @@ void getrs_getError(const hipsolverHandle_t    handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
           typename I,
           typename SIZE,
           typename Td,
+          typename Wd,
           typename Id,
           typename INTd,
           typename Th,
@@ -487,7 +530,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
                        Td&                        dB,
                        const I                    ldb,
                        const I                    stB,
-                       Td&                        dWork,
+                       Wd&                        dWork,
                        const SIZE                 lwork,
                        INTd&                      dInfo,
                        const int                  bc,
@@ -573,6 +616,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
                                        hB);
 
         CHECK_ROCBLAS_ERROR(hipsolver_getrs(API,
+                                            STRIDED,
                                             handle,
                                             params,
                                             trans,
@@ -620,6 +664,7 @@ void getrs_getPerfData(const hipsolverHandle_t    handle,
 
         start = get_time_us_sync(stream);
         hipsolver_getrs(API,
+                        STRIDED,
                         handle,
                         params,
                         trans,
@@ -680,29 +725,31 @@ void testing_getrs(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
-            //                                       handle,
-            //                                       params,
-            //                                       trans,
-            //                                       m,
-            //                                       nrhs,
-            //                                       (T* const*)nullptr,
-            //                                       lda,
-            //                                       stA,
-            //                                       (I*)nullptr,
-            //                                       stP,
-            //                                       (T* const*)nullptr,
-            //                                       ldb,
-            //                                       stB,
-            //                                       (T*)nullptr,
-            //                                       0,
-            //                                       (int*)nullptr,
-            //                                       bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                                  STRIDED,
+                                                  handle,
+                                                  params,
+                                                  trans,
+                                                  m,
+                                                  nrhs,
+                                                  (T**)nullptr,
+                                                  lda,
+                                                  stA,
+                                                  (I*)nullptr,
+                                                  stP,
+                                                  (T**)nullptr,
+                                                  ldb,
+                                                  stB,
+                                                  (T*)nullptr,
+                                                  0,
+                                                  (int*)nullptr,
+                                                  bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_getrs(API,
+                                                  STRIDED,
                                                   handle,
                                                   params,
                                                   trans,
@@ -731,18 +778,42 @@ void testing_getrs(Arguments& argus)
 
     // memory size query is necessary
     SIZE size_W;
-    hipsolver_getrs_bufferSize(API,
-                               handle,
-                               params,
-                               trans,
-                               m,
-                               nrhs,
-                               (T*)nullptr,
-                               lda,
-                               (I*)nullptr,
-                               (T*)nullptr,
-                               ldb,
-                               &size_W);
+    if(BATCHED)
+        hipsolver_getrs_bufferSize(API,
+                                   STRIDED,
+                                   handle,
+                                   params,
+                                   trans,
+                                   m,
+                                   nrhs,
+                                   (T**)nullptr,
+                                   lda,
+                                   stA,
+                                   (I*)nullptr,
+                                   stP,
+                                   (T**)nullptr,
+                                   ldb,
+                                   stB,
+                                   &size_W,
+                                   bc);
+    else
+        hipsolver_getrs_bufferSize(API,
+                                   STRIDED,
+                                   handle,
+                                   params,
+                                   trans,
+                                   m,
+                                   nrhs,
+                                   (T*)nullptr,
+                                   lda,
+                                   stA,
+                                   (I*)nullptr,
+                                   stP,
+                                   (T*)nullptr,
+                                   ldb,
+                                   stB,
+                                   &size_W,
+                                   bc);
 
     if(argus.mem_query)
     {
@@ -752,85 +823,85 @@ void testing_getrs(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>             hA(size_A, 1, bc);
-        // host_batch_vector<T>             hB(size_B, 1, bc);
-        // host_batch_vector<T>             hBRes(size_BRes, 1, bc);
-        // host_strided_batch_vector<I>     hIpiv(size_P, 1, stP, bc);
-        // host_strided_batch_vector<int>   hIpiv_cpu(size_P, 1, stP, bc);
-        // host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
-        // host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
-        // device_batch_vector<T>           dA(size_A, 1, bc);
-        // device_batch_vector<T>           dB(size_B, 1, bc);
-        // device_strided_batch_vector<I>   dIpiv(size_P, 1, stP, bc);
-        // device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
-        // device_strided_batch_vector<T>   dWork(size_W, 1, size_W, 1); // size_W accounts for bc
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-        // if(size_B)
-        //     CHECK_HIP_ERROR(dB.memcheck());
-        // if(size_P)
-        //     CHECK_HIP_ERROR(dIpiv.memcheck());
-        // CHECK_HIP_ERROR(dInfo.memcheck());
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        //     getrs_getError<API, T>(handle,
-        //                                params,
-        //                                trans,
-        //                                m,
-        //                                nrhs,
-        //                                dA,
-        //                                lda,
-        //                                stA,
-        //                                dIpiv,
-        //                                stP,
-        //                                dB,
-        //                                ldb,
-        //                                stB,
-        //                                dWork,
-        //                                size_W,
-        //                                dInfo,
-        //                                bc,
-        //                                hA,
-        //                                hIpiv,
-        //                                hIpiv_cpu,
-        //                                hB,
-        //                                hBRes,
-        //                                hInfo,
-        //                                hInfoRes,
-        //                                &max_error);
-
-        // // collect performance data
-        // if(argus.timing)
-        //     getrs_getPerfData<API, T>(handle,
-        //                                   params,
-        //                                   trans,
-        //                                   m,
-        //                                   nrhs,
-        //                                   dA,
-        //                                   lda,
-        //                                   stA,
-        //                                   dIpiv,
-        //                                   stP,
-        //                                   dB,
-        //                                   ldb,
-        //                                   stB,
-        //                                   dWork,
-        //                                   size_W,
-        //                                   dInfo,
-        //                                   bc,
-        //                                   hA,
-        //                                   hIpiv,
-        //                                   hIpiv_cpu,
-        //                                   hB,
-        //                                   hInfo,
-        //                                   &gpu_time_used,
-        //                                   &cpu_time_used,
-        //                                   hot_calls,
-        //                                   argus.perf);
+        // memory allocations
+        host_batch_vector<T>             hA(size_A, 1, bc);
+        host_batch_vector<T>             hB(size_B, 1, bc);
+        host_batch_vector<T>             hBRes(size_BRes, 1, bc);
+        host_strided_batch_vector<I>     hIpiv(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hIpiv_cpu(size_P, 1, stP, bc);
+        host_strided_batch_vector<int>   hInfo(1, 1, 1, bc);
+        host_strided_batch_vector<int>   hInfoRes(1, 1, 1, bc);
+        device_batch_vector<T>           dA(size_A, 1, bc);
+        device_batch_vector<T>           dB(size_B, 1, bc);
+        device_strided_batch_vector<I>   dIpiv(size_P, 1, stP, bc);
+        device_strided_batch_vector<int> dInfo(1, 1, 1, bc);
+        device_strided_batch_vector<T>   dWork(size_W, 1, size_W, 1); // size_W accounts for bc
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+        if(size_B)
+            CHECK_HIP_ERROR(dB.memcheck());
+        if(size_P)
+            CHECK_HIP_ERROR(dIpiv.memcheck());
+        CHECK_HIP_ERROR(dInfo.memcheck());
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+            getrs_getError<API, STRIDED, T>(handle,
+                                            params,
+                                            trans,
+                                            m,
+                                            nrhs,
+                                            dA,
+                                            lda,
+                                            stA,
+                                            dIpiv,
+                                            stP,
+                                            dB,
+                                            ldb,
+                                            stB,
+                                            dWork,
+                                            size_W,
+                                            dInfo,
+                                            bc,
+                                            hA,
+                                            hIpiv,
+                                            hIpiv_cpu,
+                                            hB,
+                                            hBRes,
+                                            hInfo,
+                                            hInfoRes,
+                                            &max_error);
+
+        // collect performance data
+        if(argus.timing)
+            getrs_getPerfData<API, STRIDED, T>(handle,
+                                               params,
+                                               trans,
+                                               m,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               stA,
+                                               dIpiv,
+                                               stP,
+                                               dB,
+                                               ldb,
+                                               stB,
+                                               dWork,
+                                               size_W,
+                                               dInfo,
+                                               bc,
+                                               hA,
+                                               hIpiv,
+                                               hIpiv_cpu,
+                                               hB,
+                                               hInfo,
+                                               &gpu_time_used,
+                                               &cpu_time_used,
+                                               hot_calls,
+                                               argus.perf);
     }
 
     else
@@ -860,60 +931,60 @@ void testing_getrs(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            getrs_getError<API, T>(handle,
-                                   params,
-                                   trans,
-                                   m,
-                                   nrhs,
-                                   dA,
-                                   lda,
-                                   stA,
-                                   dIpiv,
-                                   stP,
-                                   dB,
-                                   ldb,
-                                   stB,
-                                   dWork,
-                                   size_W,
-                                   dInfo,
-                                   bc,
-                                   hA,
-                                   hIpiv,
-                                   hIpiv_cpu,
-                                   hB,
-                                   hBRes,
-                                   hInfo,
-                                   hInfoRes,
-                                   &max_error);
+            getrs_getError<API, STRIDED, T>(handle,
+                                            params,
+                                            trans,
+                                            m,
+                                            nrhs,
+                                            dA,
+                                            lda,
+                                            stA,
+                                            dIpiv,
+                                            stP,
+                                            dB,
+                                            ldb,
+                                            stB,
+                                            dWork,
+                                            size_W,
+                                            dInfo,
+                                            bc,
+                                            hA,
+                                            hIpiv,
+                                            hIpiv_cpu,
+                                            hB,
+                                            hBRes,
+                                            hInfo,
+                                            hInfoRes,
+                                            &max_error);
 
         // collect performance data
         if(argus.timing)
-            getrs_getPerfData<API, T>(handle,
-                                      params,
-                                      trans,
-                                      m,
-                                      nrhs,
-                                      dA,
-                                      lda,
-                                      stA,
-                                      dIpiv,
-                                      stP,
-                                      dB,
-                                      ldb,
-                                      stB,
-                                      dWork,
-                                      size_W,
-                                      dInfo,
-                                      bc,
-                                      hA,
-                                      hIpiv,
-                                      hIpiv_cpu,
-                                      hB,
-                                      hInfo,
-                                      &gpu_time_used,
-                                      &cpu_time_used,
-                                      hot_calls,
-                                      argus.perf);
+            getrs_getPerfData<API, STRIDED, T>(handle,
+                                               params,
+                                               trans,
+                                               m,
+                                               nrhs,
+                                               dA,
+                                               lda,
+                                               stA,
+                                               dIpiv,
+                                               stP,
+                                               dB,
+                                               ldb,
+                                               stB,
+                                               dWork,
+                                               size_W,
+                                               dInfo,
+                                               bc,
+                                               hA,
+                                               hIpiv,
+                                               hIpiv_cpu,
+                                               hB,
+                                               hInfo,
+                                               &gpu_time_used,
+                                               &cpu_time_used,
+                                               hot_calls,
+                                               argus.perf);
     }
 
     // validate results for rocsolver-test
@@ -25,30 +25,56 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename S, typename U>
+template <testAPI_t API,
+          bool      STRIDED,
+          typename I,
+          typename SIZE,
+          typename T,
+          typename S,
+          typename U>
 void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
+                              const hipsolverDnParams_t params,
                               const hipsolverEigMode_t  evect,
                               const hipsolverFillMode_t uplo,
-                              const int                 n,
+                              const I                   n,
                               T                         dA,
-                              const int                 lda,
-                              const int                 stA,
+                              const I                   lda,
+                              const I                   stA,
                               S                         dD,
-                              const int                 stD,
+                              const I                   stD,
                               T                         dWork,
-                              const int                 lwork,
+                              const SIZE                dlwork,
+                              T                         hWork,
+                              const SIZE                hlwork,
                               U                         dinfo,
                               const int                 bc)
 {
     // handle
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            API, nullptr, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, dinfo, bc),
-        HIPSOLVER_STATUS_NOT_INITIALIZED);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
+                                                nullptr,
+                                                params,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dD,
+                                                stD,
+                                                dWork,
+                                                dlwork,
+                                                hWork,
+                                                hlwork,
+                                                dinfo,
+                                                bc),
+                          HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
                                                 handle,
+                                                params,
                                                 hipsolverEigMode_t(-1),
                                                 uplo,
                                                 n,
@@ -58,12 +84,16 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 dD,
                                                 stD,
                                                 dWork,
-                                                lwork,
+                                                dlwork,
+                                                hWork,
+                                                hlwork,
                                                 dinfo,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
                                                 handle,
+                                                params,
                                                 evect,
                                                 hipsolverFillMode_t(-1),
                                                 n,
@@ -73,41 +103,109 @@ void syevd_heevd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 dD,
                                                 stD,
                                                 dWork,
-                                                lwork,
+                                                dlwork,
+                                                hWork,
+                                                hlwork,
                                                 dinfo,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
 
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            API, handle, evect, uplo, n, (T) nullptr, lda, stA, dD, stD, dWork, lwork, dinfo, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            API, handle, evect, uplo, n, dA, lda, stA, (S) nullptr, stD, dWork, lwork, dinfo, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
-    EXPECT_ROCBLAS_STATUS(
-        hipsolver_syevd_heevd(
-            API, handle, evect, uplo, n, dA, lda, stA, dD, stD, dWork, lwork, (U) nullptr, bc),
-        HIPSOLVER_STATUS_INVALID_VALUE);
+    if constexpr(!std::is_same<I, int>::value)
+        EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                    STRIDED,
+                                                    handle,
+                                                    (hipsolverDnParams_t) nullptr,
+                                                    evect,
+                                                    uplo,
+                                                    n,
+                                                    dA,
+                                                    lda,
+                                                    stA,
+                                                    dD,
+                                                    stD,
+                                                    dWork,
+                                                    dlwork,
+                                                    hWork,
+                                                    hlwork,
+                                                    dinfo,
+                                                    bc),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
+                                                handle,
+                                                params,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                (T) nullptr,
+                                                lda,
+                                                stA,
+                                                dD,
+                                                stD,
+                                                dWork,
+                                                dlwork,
+                                                hWork,
+                                                hlwork,
+                                                dinfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
+                                                handle,
+                                                params,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                (S) nullptr,
+                                                stD,
+                                                dWork,
+                                                dlwork,
+                                                hWork,
+                                                hlwork,
+                                                dinfo,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                STRIDED,
+                                                handle,
+                                                params,
+                                                evect,
+                                                uplo,
+                                                n,
+                                                dA,
+                                                lda,
+                                                stA,
+                                                dD,
+                                                stD,
+                                                dWork,
+                                                dlwork,
+                                                hWork,
+                                                hlwork,
+                                                (U) nullptr,
+                                                bc),
+                          HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T, typename I, typename SIZE>
 void testing_syevd_heevd_bad_arg()
 {
     using S = decltype(std::real(T{}));
 
     // safe arguments
     hipsolver_local_handle handle;
+    hipsolver_local_params params;
     hipsolverEigMode_t     evect = HIPSOLVER_EIG_MODE_NOVECTOR;
     hipsolverFillMode_t    uplo  = HIPSOLVER_FILL_MODE_LOWER;
-    int                    n     = 1;
-    int                    lda   = 1;
-    int                    stA   = 1;
-    int                    stD   = 1;
+    I                      n     = 1;
+    I                      lda   = 1;
+    I                      stA   = 1;
+    I                      stD   = 1;
     int                    bc    = 1;
 
     if(BATCHED)
@@ -120,27 +218,44 @@ void testing_syevd_heevd_bad_arg()
         // CHECK_HIP_ERROR(dD.memcheck());
         // CHECK_HIP_ERROR(dinfo.memcheck());
 
-        // int size_W;
-        // hipsolver_syevd_heevd_bufferSize(
-        //     API, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-        // if(size_W)
+        // SIZE size_dW, size_hW;
+        // hipsolver_syevd_heevd_bufferSize(API,
+        //                                  STRIDED,
+        //                                  handle,
+        //                                  params,
+        //                                  evect,
+        //                                  uplo,
+        //                                  n,
+        //                                  dA.data(),
+        //                                  lda,
+        //                                  stA,
+        //                                  dD.data(),
+        //                                  stD,
+        //                                  &size_dW,
+        //                                  &size_hW,
+        //                                  bc);
+        // host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+        // device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+        // if(size_dW)
         //     CHECK_HIP_ERROR(dWork.memcheck());
 
         // // check bad arguments
-        // syevd_heevd_checkBadArgs<API>(handle,
-        //                                   evect,
-        //                                   uplo,
-        //                                   n,
-        //                                   dA.data(),
-        //                                   lda,
-        //                                   stA,
-        //                                   dD.data(),
-        //                                   stD,
-        //                                   dWork.data(),
-        //                                   size_W,
-        //                                   dinfo.data(),
-        //                                   bc);
+        // syevd_heevd_checkBadArgs<API, STRIDED>(handle,
+        //                                        params,
+        //                                        evect,
+        //                                        uplo,
+        //                                        n,
+        //                                        dA.data(),
+        //                                        lda,
+        //                                        stA,
+        //                                        dD.data(),
+        //                                        stD,
+        //                                        dWork.data(),
+        //                                        size_dW,
+        //                                        hWork.data(),
+        //                                        size_hW,
+        //                                        dinfo.data(),
+        //                                        bc);
     }
     else
     {
@@ -152,36 +267,53 @@ void testing_syevd_heevd_bad_arg()
         CHECK_HIP_ERROR(dD.memcheck());
         CHECK_HIP_ERROR(dinfo.memcheck());
 
-        int size_W;
-        hipsolver_syevd_heevd_bufferSize(
-            API, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W);
-        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-        if(size_W)
+        SIZE size_dW, size_hW;
+        hipsolver_syevd_heevd_bufferSize(API,
+                                         STRIDED,
+                                         handle,
+                                         params,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dD.data(),
+                                         stD,
+                                         &size_dW,
+                                         &size_hW,
+                                         bc);
+        host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+        device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+        if(size_dW)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        syevd_heevd_checkBadArgs<API>(handle,
-                                      evect,
-                                      uplo,
-                                      n,
-                                      dA.data(),
-                                      lda,
-                                      stA,
-                                      dD.data(),
-                                      stD,
-                                      dWork.data(),
-                                      size_W,
-                                      dinfo.data(),
-                                      bc);
+        syevd_heevd_checkBadArgs<API, STRIDED>(handle,
+                                               params,
+                                               evect,
+                                               uplo,
+                                               n,
+                                               dA.data(),
+                                               lda,
+                                               stA,
+                                               dD.data(),
+                                               stD,
+                                               dWork.data(),
+                                               size_dW,
+                                               hWork.data(),
+                                               size_hW,
+                                               dinfo.data(),
+                                               bc);
     }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Th>
 void syevd_heevd_initData(const hipsolverHandle_t  handle,
                           const hipsolverEigMode_t evect,
-                          const int                n,
+                          const I                  n,
                           Td&                      dA,
-                          const int                lda,
+                          const I                  lda,
                           const int                bc,
                           Th&                      hA,
                           std::vector<T>&          A,
@@ -194,9 +326,9 @@ void syevd_heevd_initData(const hipsolverHandle_t  handle,
         // scale A to avoid singularities
         for(int b = 0; b < bc; ++b)
         {
-            for(int i = 0; i < n; i++)
+            for(I i = 0; i < n; i++)
             {
-                for(int j = 0; j < n; j++)
+                for(I j = 0; j < n; j++)
                 {
                     if(i == j)
                         hA[b][i + j * lda] += 400;
@@ -208,9 +340,9 @@ void syevd_heevd_initData(const hipsolverHandle_t  handle,
             // make copy of original data to test vectors if required
             if(test && evect == HIPSOLVER_EIG_MODE_VECTOR)
             {
-                for(int i = 0; i < n; i++)
+                for(I i = 0; i < n; i++)
                 {
-                    for(int j = 0; j < n; j++)
+                    for(I j = 0; j < n; j++)
                         A[b * lda * n + i + j * lda] = hA[b][i + j * lda];
                 }
             }
@@ -225,7 +357,10 @@ void syevd_heevd_initData(const hipsolverHandle_t  handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
+          typename I,
+          typename SIZE,
           typename Sd,
           typename Td,
           typename Id,
@@ -233,16 +368,19 @@ template <testAPI_t API,
           typename Th,
           typename Ih>
 void syevd_heevd_getError(const hipsolverHandle_t   handle,
+                          const hipsolverDnParams_t params,
                           const hipsolverEigMode_t  evect,
                           const hipsolverFillMode_t uplo,
-                          const int                 n,
+                          const I                   n,
                           Td&                       dA,
-                          const int                 lda,
-                          const int                 stA,
+                          const I                   lda,
+                          const I                   stA,
                           Sd&                       dD,
-                          const int                 stD,
+                          const I                   stD,
                           Td&                       dWork,
-                          const int                 lwork,
+                          const SIZE                dlwork,
+                          Th&                       hWork,
+                          const SIZE                hlwork,
                           Id&                       dinfo,
                           const int                 bc,
                           Th&                       hA,
@@ -280,7 +418,9 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(API,
+                                              STRIDED,
                                               handle,
+                                              params,
                                               evect,
                                               uplo,
                                               n,
@@ -290,7 +430,9 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
                                               dD.data(),
                                               stD,
                                               dWork.data(),
-                                              lwork,
+                                              dlwork,
+                                              hWork.data(),
+                                              hlwork,
                                               dinfo.data(),
                                               bc));
 
@@ -377,7 +519,10 @@ void syevd_heevd_getError(const hipsolverHandle_t   handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
+          typename I,
+          typename SIZE,
           typename Sd,
           typename Td,
           typename Id,
@@ -385,16 +530,19 @@ template <testAPI_t API,
           typename Th,
           typename Ih>
 void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
+                             const hipsolverDnParams_t params,
                              const hipsolverEigMode_t  evect,
                              const hipsolverFillMode_t uplo,
-                             const int                 n,
+                             const I                   n,
                              Td&                       dA,
-                             const int                 lda,
-                             const int                 stA,
+                             const I                   lda,
+                             const I                   stA,
                              Sd&                       dD,
-                             const int                 stD,
+                             const I                   stD,
                              Td&                       dWork,
-                             const int                 lwork,
+                             const SIZE                dlwork,
+                             Th&                       hWork,
+                             const SIZE                hlwork,
                              Id&                       dinfo,
                              const int                 bc,
                              Th&                       hA,
@@ -457,7 +605,9 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
         syevd_heevd_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
         CHECK_ROCBLAS_ERROR(hipsolver_syevd_heevd(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   evect,
                                                   uplo,
                                                   n,
@@ -467,7 +617,9 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
                                                   dD.data(),
                                                   stD,
                                                   dWork.data(),
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork.data(),
+                                                  hlwork,
                                                   dinfo.data(),
                                                   bc));
     }
@@ -483,7 +635,9 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
 
         start = get_time_us_sync(stream);
         hipsolver_syevd_heevd(API,
+                              STRIDED,
                               handle,
+                              params,
                               evect,
                               uplo,
                               n,
@@ -493,7 +647,9 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
                               dD.data(),
                               stD,
                               dWork.data(),
-                              lwork,
+                              dlwork,
+                              hWork.data(),
+                              hlwork,
                               dinfo.data(),
                               bc);
         *gpu_time_used += get_time_us_sync(stream) - start;
@@ -501,25 +657,33 @@ void syevd_heevd_getPerfData(const hipsolverHandle_t   handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T, typename I, typename SIZE>
 void testing_syevd_heevd(Arguments& argus)
 {
     using S = decltype(std::real(T{}));
 
     // get arguments
     hipsolver_local_handle handle;
+    hipsolver_local_params params;
     char                   evectC = argus.get<char>("jobz");
     char                   uploC  = argus.get<char>("uplo");
-    int                    n      = argus.get<int>("n");
-    int                    lda    = argus.get<int>("lda", n);
-    int                    stA    = argus.get<int>("strideA", lda * n);
-    int                    stD    = argus.get<int>("strideD", n);
+    I                      n      = argus.get<int>("n");
+    I                      lda    = argus.get<int>("lda", n);
+    I                      stA    = argus.get<int>("strideA", lda * n);
+    I                      stD    = argus.get<int>("strideD", n);
+    int                    alg    = argus.get<int>("alg", 0);
 
     hipsolverEigMode_t  evect     = char2hipsolver_evect(evectC);
     hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
     int                 bc        = argus.batch_count;
     int                 hot_calls = argus.iters;
 
+    // algorithm used by the 64-bit API
+    if(alg == 1)
+        EXPECT_ROCBLAS_STATUS(
+            hipsolverDnSetAdvOptions(params, HIPSOLVERDN_EXT_SYEVD, HIPSOLVER_ALG_1),
+            HIPSOLVER_STATUS_SUCCESS);
+
     // determine sizes
     size_t size_A    = size_t(lda) * n;
     size_t size_D    = n;
@@ -535,7 +699,9 @@ void testing_syevd_heevd(Arguments& argus)
         if(BATCHED)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+            //                                             STRIDED,
             //                                             handle,
+            //                                             params,
             //                                             evect,
             //                                             uplo,
             //                                             n,
@@ -545,7 +711,9 @@ void testing_syevd_heevd(Arguments& argus)
             //                                             (S*)nullptr,
             //                                             stD,
             //                                             (T*)nullptr,
-            //                                             0,
+            //                                             (SIZE)0,
+            //                                             (T*)nullptr,
+            //                                             (SIZE)0,
             //                                             (int*)nullptr,
             //                                             bc),
             //                       HIPSOLVER_STATUS_INVALID_VALUE);
@@ -553,7 +721,9 @@ void testing_syevd_heevd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_syevd_heevd(API,
+                                                        STRIDED,
                                                         handle,
+                                                        params,
                                                         evect,
                                                         uplo,
                                                         n,
@@ -563,7 +733,9 @@ void testing_syevd_heevd(Arguments& argus)
                                                         (S*)nullptr,
                                                         stD,
                                                         (T*)nullptr,
-                                                        0,
+                                                        (SIZE)0,
+                                                        (T*)nullptr,
+                                                        (SIZE)0,
                                                         (int*)nullptr,
                                                         bc),
                                   HIPSOLVER_STATUS_INVALID_VALUE);
@@ -576,13 +748,26 @@ void testing_syevd_heevd(Arguments& argus)
     }
 
     // memory size query is necessary
-    int size_W;
-    hipsolver_syevd_heevd_bufferSize(
-        API, handle, evect, uplo, n, (T*)nullptr, lda, (S*)nullptr, &size_W);
+    SIZE size_dW, size_hW;
+    hipsolver_syevd_heevd_bufferSize(API,
+                                     STRIDED,
+                                     handle,
+                                     params,
+                                     evect,
+                                     uplo,
+                                     n,
+                                     (T*)nullptr,
+                                     lda,
+                                     stA,
+                                     (S*)nullptr,
+                                     stD,
+                                     &size_dW,
+                                     &size_hW,
+                                     bc);
 
     if(argus.mem_query)
     {
-        rocsolver_bench_inform(inform_mem_query, size_W);
+        rocsolver_bench_inform(inform_mem_query, size_dW);
         return;
     }
 
@@ -592,14 +777,15 @@ void testing_syevd_heevd(Arguments& argus)
     host_strided_batch_vector<int> hinfo(1, 1, 1, bc);
     host_strided_batch_vector<int> hinfoRes(1, 1, 1, bc);
     host_strided_batch_vector<S>   hDres(size_Dres, 1, stD, bc);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1); // size_hW accounts for bc
     // device
     device_strided_batch_vector<S>   dD(size_D, 1, stD, bc);
     device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
-    device_strided_batch_vector<T>   dWork(size_W, 1, size_W, 1); // size_W accounts for bc
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1); // size_dW accounts for bc
     if(size_D)
         CHECK_HIP_ERROR(dD.memcheck());
     CHECK_HIP_ERROR(dinfo.memcheck());
-    if(size_W)
+    if(size_dW)
         CHECK_HIP_ERROR(dWork.memcheck());
 
     if(BATCHED)
@@ -614,51 +800,57 @@ void testing_syevd_heevd(Arguments& argus)
         // // check computations
         // if(argus.unit_check || argus.norm_check)
         // {
-        //     syevd_heevd_getError<API, T>(handle,
-        //                                      evect,
-        //                                      uplo,
-        //                                      n,
-        //                                      dA,
-        //                                      lda,
-        //                                      stA,
-        //                                      dD,
-        //                                      stD,
-        //                                      dWork,
-        //                                      size_W,
-        //                                      dinfo,
-        //                                      bc,
-        //                                      hA,
-        //                                      hAres,
-        //                                      hD,
-        //                                      hDres,
-        //                                      hinfo,
-        //                                      hinfoRes,
-        //                                      &max_error);
+        //     syevd_heevd_getError<API, STRIDED, T>(handle,
+        //                                               params,
+        //                                               evect,
+        //                                               uplo,
+        //                                               n,
+        //                                               dA,
+        //                                               lda,
+        //                                               stA,
+        //                                               dD,
+        //                                               stD,
+        //                                               dWork,
+        //                                               size_dW,
+        //                                               hWork,
+        //                                               size_hW,
+        //                                               dinfo,
+        //                                               bc,
+        //                                               hA,
+        //                                               hAres,
+        //                                               hD,
+        //                                               hDres,
+        //                                               hinfo,
+        //                                               hinfoRes,
+        //                                               &max_error);
         // }
 
         // // collect performance data
         // if(argus.timing)
         // {
-        //     syevd_heevd_getPerfData<API, T>(handle,
-        //                                         evect,
-        //                                         uplo,
-        //                                         n,
-        //                                         dA,
-        //                                         lda,
-        //                                         stA,
-        //                                         dD,
-        //                                         stD,
-        //                                         dWork,
-        //                                         size_W,
-        //                                         dinfo,
-        //                                         bc,
-        //                                         hA,
-        //                                         hD,
-        //                                         hinfo,
-        //                                         &gpu_time_used,
-        //                                         &cpu_time_used,
-        //                                         hot_calls,
-        //                                         argus.perf);
+        //     syevd_heevd_getPerfData<API, STRIDED, T>(handle,
+        //                                                  params,
+        //                                                  evect,
+        //                                                  uplo,
+        //                                                  n,
+        //                                                  dA,
+        //                                                  lda,
+        //                                                  stA,
+        //                                                  dD,
+        //                                                  stD,
+        //                                                  dWork,
+        //                                                  size_dW,
+        //                                                  hWork,
+        //                                                  size_hW,
+        //                                                  dinfo,
+        //                                                  bc,
+        //                                                  hA,
+        //                                                  hD,
+        //                                                  hinfo,
+        //                                                  &gpu_time_used,
+        //                                                  &cpu_time_used,
+        //                                                  hot_calls,
+        //                                                  argus.perf);
         // }
     }
 
@@ -674,51 +866,57 @@ void testing_syevd_heevd(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            syevd_heevd_getError<API, T>(handle,
-                                         evect,
-                                         uplo,
-                                         n,
-                                         dA,
-                                         lda,
-                                         stA,
-                                         dD,
-                                         stD,
-                                         dWork,
-                                         size_W,
-                                         dinfo,
-                                         bc,
-                                         hA,
-                                         hAres,
-                                         hD,
-                                         hDres,
-                                         hinfo,
-                                         hinfoRes,
-                                         &max_error);
+            syevd_heevd_getError<API, STRIDED, T>(handle,
+                                                  params,
+                                                  evect,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dD,
+                                                  stD,
+                                                  dWork,
+                                                  size_dW,
+                                                  hWork,
+                                                  size_hW,
+                                                  dinfo,
+                                                  bc,
+                                                  hA,
+                                                  hAres,
+                                                  hD,
+                                                  hDres,
+                                                  hinfo,
+                                                  hinfoRes,
+                                                  &max_error);
         }
 
         // collect performance data
         if(argus.timing)
         {
-            syevd_heevd_getPerfData<API, T>(handle,
-                                            evect,
-                                            uplo,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dD,
-                                            stD,
-                                            dWork,
-                                            size_W,
-                                            dinfo,
-                                            bc,
-                                            hA,
-                                            hD,
-                                            hinfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf);
+            syevd_heevd_getPerfData<API, STRIDED, T>(handle,
+                                                     params,
+                                                     evect,
+                                                     uplo,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dD,
+                                                     stD,
+                                                     dWork,
+                                                     size_dW,
+                                                     hWork,
+                                                     size_hW,
+                                                     dinfo,
+                                                     bc,
+                                                     hA,
+                                                     hD,
+                                                     hinfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
         }
     }
 
@@ -25,30 +25,43 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename S, typename SS, typename U>
+template <testAPI_t API,
+          bool      STRIDED,
+          typename I,
+          typename SIZE,
+          typename T,
+          typename S,
+          typename SS,
+          typename U,
+          typename INTd>
 void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
+                                const hipsolverDnParams_t params,
                                 const hipsolverEigMode_t  evect,
                                 const hipsolverEigRange_t erange,
                                 const hipsolverFillMode_t uplo,
-                                const int                 n,
+                                const I                   n,
                                 T                         dA,
-                                const int                 lda,
-                                const int                 stA,
+                                const I                   lda,
+                                const I                   stA,
                                 const SS                  vl,
                                 const SS                  vu,
-                                const int                 il,
-                                const int                 iu,
+                                const I                   il,
+                                const I                   iu,
                                 U                         hNev,
                                 S                         dW,
-                                const int                 stW,
+                                const I                   stW,
                                 T                         dWork,
-                                const int                 lwork,
-                                U                         dinfo,
+                                const SIZE                dlwork,
+                                T                         hWork,
+                                const SIZE                hlwork,
+                                INTd                      dinfo,
                                 const int                 bc)
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   nullptr,
+                                                  params,
                                                   evect,
                                                   erange,
                                                   uplo,
@@ -64,14 +77,18 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   dW,
                                                   stW,
                                                   dWork,
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
                                                   dinfo,
                                                   bc),
                           HIPSOLVER_STATUS_NOT_INITIALIZED);
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   hipsolverEigMode_t(-1),
                                                   erange,
                                                   uplo,
@@ -87,12 +104,16 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   dW,
                                                   stW,
                                                   dWork,
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
                                                   dinfo,
                                                   bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   evect,
                                                   hipsolverEigRange_t(-1),
                                                   uplo,
@@ -108,12 +129,16 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   dW,
                                                   stW,
                                                   dWork,
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
                                                   dinfo,
                                                   bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   evect,
                                                   erange,
                                                   hipsolverFillMode_t(-1),
@@ -129,7 +154,9 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   dW,
                                                   stW,
                                                   dWork,
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
                                                   dinfo,
                                                   bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
@@ -137,7 +164,9 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   evect,
                                                   erange,
                                                   uplo,
@@ -153,12 +182,16 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   dW,
                                                   stW,
                                                   dWork,
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
                                                   dinfo,
                                                   bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   evect,
                                                   erange,
                                                   uplo,
@@ -174,12 +207,16 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   dW,
                                                   stW,
                                                   dWork,
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
                                                   dinfo,
                                                   bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   evect,
                                                   erange,
                                                   uplo,
@@ -195,12 +232,16 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   (S) nullptr,
                                                   stW,
                                                   dWork,
-                                                  lwork,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
                                                   dinfo,
                                                   bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                  STRIDED,
                                                   handle,
+                                                  params,
                                                   evect,
                                                   erange,
                                                   uplo,
@@ -216,33 +257,36 @@ void syevdx_heevdx_checkBadArgs(const hipsolverHandle_t   handle,
                                                   dW,
                                                   stW,
                                                   dWork,
-                                                  lwork,
-                                                  (U) nullptr,
+                                                  dlwork,
+                                                  hWork,
+                                                  hlwork,
+                                                  (INTd) nullptr,
                                                   bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
 #endif
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T, typename I, typename SIZE>
 void testing_syevdx_heevdx_bad_arg()
 {
     using S = decltype(std::real(T{}));
 
     // safe arguments
     hipsolver_local_handle handle;
+    hipsolver_local_params params;
     hipsolverEigMode_t     evect  = HIPSOLVER_EIG_MODE_VECTOR;
     hipsolverEigRange_t    erange = HIPSOLVER_EIG_RANGE_V;
     hipsolverFillMode_t    uplo   = HIPSOLVER_FILL_MODE_LOWER;
-    int                    n      = 1;
-    int                    lda    = 1;
-    int                    stA    = 1;
-    int                    stW    = 1;
+    I                      n      = 1;
+    I                      lda    = 1;
+    I                      stA    = 1;
+    I                      stW    = 1;
     int                    bc     = 1;
 
-    S   vl = 0.0;
-    S   vu = 1.0;
-    int il = 0;
-    int iu = 0;
+    S vl = 0.0;
+    S vu = 1.0;
+    I il = 0;
+    I iu = 0;
 
     if(BATCHED)
     {
@@ -257,6 +301,7 @@ void testing_syevdx_heevdx_bad_arg()
 
         // int size_W;
         // hipsolver_syevdx_heevdx_bufferSize(API,
+        //                                    STRIDED,
         //                                    handle,
         //                                    evect,
         //                                    erange,
@@ -264,42 +309,45 @@ void testing_syevdx_heevdx_bad_arg()
         //                                    n,
         //                                    dA.data(),
         //                                    lda,
+        //                                    stA,
         //                                    vl,
         //                                    vu,
         //                                    il,
         //                                    iu,
         //                                    hNev.data(),
         //                                    dW.data(),
-        //                                    &size_W);
+        //                                    stW,
+        //                                    &size_W,
+        //                                    bc);
         // device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         // if(size_W)
         //     CHECK_HIP_ERROR(dWork.memcheck());
 
         // // check bad arguments
-        // syevdx_heevdx_checkBadArgs<API>(handle,
-        //                                     evect,
-        //                                     erange,
-        //                                     uplo,
-        //                                     n,
-        //                                     dA.data(),
-        //                                     lda,
-        //                                     stA,
-        //                                     vl,
-        //                                     vu,
-        //                                     il,
-        //                                     iu,
-        //                                     hNev.data(),
-        //                                     dW.data(),
-        //                                     stW,
-        //                                     dWork.data(),
-        //                                     size_W,
-        //                                     dinfo.data(),
-        //                                     bc);
+        // syevdx_heevdx_checkBadArgs<API, STRIDED>(handle,
+        //                                              evect,
+        //                                              erange,
+        //                                              uplo,
+        //                                              n,
+        //                                              dA.data(),
+        //                                              lda,
+        //                                              stA,
+        //                                              vl,
+        //                                              vu,
+        //                                              il,
+        //                                              iu,
+        //                                              hNev.data(),
+        //                                              dW.data(),
+        //                                              stW,
+        //                                              dWork.data(),
+        //                                              size_W,
+        //                                              dinfo.data(),
+        //                                              bc);
     }
     else
     {
         // memory allocations
-        host_strided_batch_vector<int>   hNev(1, 1, 1, 1);
+        host_strided_batch_vector<I>     hNev(1, 1, 1, 1);
         device_strided_batch_vector<T>   dA(1, 1, 1, 1);
         device_strided_batch_vector<S>   dW(1, 1, 1, 1);
         device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
@@ -307,59 +355,69 @@ void testing_syevdx_heevdx_bad_arg()
         CHECK_HIP_ERROR(dW.memcheck());
         CHECK_HIP_ERROR(dinfo.memcheck());
 
-        int size_W;
+        SIZE size_dW, size_hW;
         hipsolver_syevdx_heevdx_bufferSize(API,
+                                           STRIDED,
                                            handle,
+                                           params,
                                            evect,
                                            erange,
                                            uplo,
                                            n,
                                            dA.data(),
                                            lda,
+                                           stA,
                                            vl,
                                            vu,
                                            il,
                                            iu,
                                            hNev.data(),
                                            dW.data(),
-                                           &size_W);
-        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-        if(size_W)
+                                           stW,
+                                           &size_dW,
+                                           &size_hW,
+                                           bc);
+        device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+        host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+        if(size_dW)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        syevdx_heevdx_checkBadArgs<API>(handle,
-                                        evect,
-                                        erange,
-                                        uplo,
-                                        n,
-                                        dA.data(),
-                                        lda,
-                                        stA,
-                                        vl,
-                                        vu,
-                                        il,
-                                        iu,
-                                        hNev.data(),
-                                        dW.data(),
-                                        stW,
-                                        dWork.data(),
-                                        size_W,
-                                        dinfo.data(),
-                                        bc);
+        syevdx_heevdx_checkBadArgs<API, STRIDED>(handle,
+                                                 params,
+                                                 evect,
+                                                 erange,
+                                                 uplo,
+                                                 n,
+                                                 dA.data(),
+                                                 lda,
+                                                 stA,
+                                                 vl,
+                                                 vu,
+                                                 il,
+                                                 iu,
+                                                 hNev.data(),
+                                                 dW.data(),
+                                                 stW,
+                                                 dWork.data(),
+                                                 size_dW,
+                                                 hWork.data(),
+                                                 size_hW,
+                                                 dinfo.data(),
+                                                 bc);
     }
 }
 
-template <bool CPU, bool GPU, typename T, typename Td, typename Th>
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Th>
 void syevdx_heevdx_initData(const hipsolverHandle_t  handle,
                             const hipsolverEigMode_t evect,
-                            const int                n,
+                            const I                  n,
                             Td&                      dA,
-                            const int                lda,
+                            const I                  lda,
                             const int                bc,
                             Th&                      hA,
                             std::vector<T>&          A,
-                            bool                     test = true)
+                            bool test =              true)
 {
     if(CPU)
     {
@@ -409,31 +467,38 @@ void syevdx_heevdx_initData(const hipsolverHandle_t  handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
+          typename I,
+          typename SIZE,
           typename S,
           typename Sd,
           typename Td,
           typename Id,
           typename Sh,
           typename Th,
+          typename Nh,
           typename Ih>
 void syevdx_heevdx_getError(const hipsolverHandle_t   handle,
+                            const hipsolverDnParams_t params,
                             const hipsolverEigMode_t  evect,
                             const hipsolverEigRange_t erange,
                             const hipsolverFillMode_t uplo,
-                            const int                 n,
+                            const I                   n,
                             Td&                       dA,
-                            const int                 lda,
-                            const int                 stA,
+                            const I                   lda,
+                            const I                   stA,
                             const S                   vl,
                             const S                   vu,
-                            const int                 il,
-                            const int                 iu,
-                            Ih&                       hNevRes,
+                            const I                   il,
+                            const I                   iu,
+                            Nh&                       hNevRes,
                             Sd&                       dW,
-                            const int                 stW,
+                            const I                   stW,
                             Td&                       dWork,
-                            const int                 lwork,
+                            const SIZE                dlwork,
+                            Th&                       hWork,
+                            const SIZE                hlwork,
                             Id&                       dinfo,
                             const int                 bc,
                             Th&                       hA,
@@ -466,7 +531,9 @@ void syevdx_heevdx_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_syevdx_heevdx(API,
+                                                STRIDED,
                                                 handle,
+                                                params,
                                                 evect,
                                                 erange,
                                                 uplo,
@@ -482,7 +549,9 @@ void syevdx_heevdx_getError(const hipsolverHandle_t   handle,
                                                 dW.data(),
                                                 stW,
                                                 dWork.data(),
-                                                lwork,
+                                                dlwork,
+                                                hWork.data(),
+                                                hlwork,
                                                 dinfo.data(),
                                                 bc));
 
@@ -586,31 +655,38 @@ void syevdx_heevdx_getError(const hipsolverHandle_t   handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
+          typename I,
+          typename SIZE,
           typename S,
           typename Sd,
           typename Td,
           typename Id,
           typename Sh,
           typename Th,
+          typename Nh,
           typename Ih>
 void syevdx_heevdx_getPerfData(const hipsolverHandle_t   handle,
+                               const hipsolverDnParams_t params,
                                const hipsolverEigMode_t  evect,
                                const hipsolverEigRange_t erange,
                                const hipsolverFillMode_t uplo,
-                               const int                 n,
+                               const I                   n,
                                Td&                       dA,
-                               const int                 lda,
-                               const int                 stA,
+                               const I                   lda,
+                               const I                   stA,
                                const S                   vl,
                                const S                   vu,
-                               const int                 il,
-                               const int                 iu,
-                               Ih&                       hNevRes,
+                               const I                   il,
+                               const I                   iu,
+                               Nh&                       hNevRes,
                                Sd&                       dW,
-                               const int                 stW,
+                               const I                   stW,
                                Td&                       dWork,
-                               const int                 lwork,
+                               const SIZE                dlwork,
+                               Th&                       hWork,
+                               const SIZE                hlwork,
                                Id&                       dinfo,
                                const int                 bc,
                                Th&                       hA,
@@ -676,7 +752,9 @@ void syevdx_heevdx_getPerfData(const hipsolverHandle_t   handle,
         syevdx_heevdx_initData<false, true, T>(handle, evect, n, dA, lda, bc, hA, A, 0);
 
         CHECK_ROCBLAS_ERROR(hipsolver_syevdx_heevdx(API,
+                                                    STRIDED,
                                                     handle,
+                                                    params,
                                                     evect,
                                                     erange,
                                                     uplo,
@@ -692,7 +770,9 @@ void syevdx_heevdx_getPerfData(const hipsolverHandle_t   handle,
                                                     dW.data(),
                                                     stW,
                                                     dWork.data(),
-                                                    lwork,
+                                                    dlwork,
+                                                    hWork.data(),
+                                                    hlwork,
                                                     dinfo.data(),
                                                     bc));
     }
@@ -708,7 +788,9 @@ void syevdx_heevdx_getPerfData(const hipsolverHandle_t   handle,
 
         start = get_time_us_sync(stream);
         hipsolver_syevdx_heevdx(API,
+                                STRIDED,
                                 handle,
+                                params,
                                 evect,
                                 erange,
                                 uplo,
@@ -724,7 +806,9 @@ void syevdx_heevdx_getPerfData(const hipsolverHandle_t   handle,
                                 dW.data(),
                                 stW,
                                 dWork.data(),
-                                lwork,
+                                dlwork,
+                                hWork.data(),
+                                hlwork,
                                 dinfo.data(),
                                 bc);
         *gpu_time_used += get_time_us_sync(stream) - start;
@@ -732,25 +816,26 @@ void syevdx_heevdx_getPerfData(const hipsolverHandle_t   handle,
     *gpu_time_used /= hot_calls;
 }
 
-template <testAPI_t API, bool BATCHED, bool STRIDED, typename T>
+template <testAPI_t API, bool BATCHED, bool STRIDED, typename T, typename I, typename SIZE>
 void testing_syevdx_heevdx(Arguments& argus)
 {
     using S = decltype(std::real(T{}));
 
     // get arguments
     hipsolver_local_handle handle;
+    hipsolver_local_params params;
     char                   evectC  = argus.get<char>("jobz");
     char                   erangeC = argus.get<char>("range");
     char                   uploC   = argus.get<char>("uplo");
-    int                    n       = argus.get<int>("n");
-    int                    lda     = argus.get<int>("lda", n);
-    int                    stA     = argus.get<int>("strideA", lda * n);
-    int                    stW     = argus.get<int>("strideW", n);
+    I                      n       = argus.get<int>("n");
+    I                      lda     = argus.get<int>("lda", n);
+    I                      stA     = argus.get<int>("strideA", lda * n);
+    I                      stW     = argus.get<int>("strideW", n);
 
-    S   vl = S(argus.get<double>("vl", 0));
-    S   vu = S(argus.get<double>("vu", erangeC == 'V' ? 1 : 0));
-    int il = argus.get<int>("il", erangeC == 'I' ? 1 : 0);
-    int iu = argus.get<int>("iu", erangeC == 'I' ? 1 : 0);
+    S vl = S(argus.get<double>("vl", 0));
+    S vu = S(argus.get<double>("vu", erangeC == 'V' ? 1 : 0));
+    I il = argus.get<int>("il", erangeC == 'I' ? 1 : 0);
+    I iu = argus.get<int>("iu", erangeC == 'I' ? 1 : 0);
 
     hipsolverEigMode_t  evect     = char2hipsolver_evect(evectC);
     hipsolverEigRange_t erange    = char2hipsolver_erange(erangeC);
@@ -775,6 +860,7 @@ void testing_syevdx_heevdx(Arguments& argus)
         if(BATCHED)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+            //                                               STRIDED,
             //                                               handle,
             //                                               evect,
             //                                               erange,
@@ -799,7 +885,9 @@ void testing_syevdx_heevdx(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_syevdx_heevdx(API,
+                                                          STRIDED,
                                                           handle,
+                                                          params,
                                                           evect,
                                                           erange,
                                                           uplo,
@@ -811,11 +899,13 @@ void testing_syevdx_heevdx(Arguments& argus)
                                                           vu,
                                                           il,
                                                           iu,
-                                                          (int*)nullptr,
+                                                          (I*)nullptr,
                                                           (S*)nullptr,
                                                           stW,
                                                           (T*)nullptr,
-                                                          0,
+                                                          (SIZE)0,
+                                                          (T*)nullptr,
+                                                          (SIZE)0,
                                                           (int*)nullptr,
                                                           bc),
                                   HIPSOLVER_STATUS_INVALID_VALUE);
@@ -828,45 +918,52 @@ void testing_syevdx_heevdx(Arguments& argus)
     }
 
     // memory size query is necessary
-    int size_Work;
+    SIZE size_dW, size_hW;
     hipsolver_syevdx_heevdx_bufferSize(API,
+                                       STRIDED,
                                        handle,
+                                       params,
                                        evect,
                                        erange,
                                        uplo,
                                        n,
                                        (T*)nullptr,
                                        lda,
+                                       stA,
                                        vl,
                                        vu,
                                        il,
                                        iu,
-                                       (int*)nullptr,
+                                       (I*)nullptr,
                                        (S*)nullptr,
-                                       &size_Work);
+                                       stW,
+                                       &size_dW,
+                                       &size_hW,
+                                       bc);
 
     if(argus.mem_query)
     {
-        rocsolver_bench_inform(inform_mem_query, size_Work);
+        rocsolver_bench_inform(inform_mem_query, size_dW);
         return;
     }
 
     // memory allocations (all cases)
     // host
     host_strided_batch_vector<int> hNev(1, 1, 1, bc);
-    host_strided_batch_vector<int> hNevRes(1, 1, 1, bc);
+    host_strided_batch_vector<I>   hNevRes(1, 1, 1, bc);
     host_strided_batch_vector<S>   hW(size_W, 1, stW, bc);
     host_strided_batch_vector<int> hinfo(1, 1, 1, bc);
     host_strided_batch_vector<int> hinfoRes(1, 1, 1, bc);
     host_strided_batch_vector<S>   hWres(size_WRes, 1, stW, bc);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
     // device
     device_strided_batch_vector<S>   dW(size_W, 1, stW, bc);
     device_strided_batch_vector<int> dinfo(1, 1, 1, bc);
-    device_strided_batch_vector<T>   dWork(size_Work, 1, size_Work, 1); // size_W accounts for bc
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1); // size_dW accounts for bc
     if(size_W)
         CHECK_HIP_ERROR(dW.memcheck());
     CHECK_HIP_ERROR(dinfo.memcheck());
-    if(size_Work)
+    if(size_dW)
         CHECK_HIP_ERROR(dWork.memcheck());
 
     if(BATCHED)
@@ -881,65 +978,65 @@ void testing_syevdx_heevdx(Arguments& argus)
         // // check computations
         // if(argus.unit_check || argus.norm_check)
         // {
-        //     syevdx_heevdx_getError<API, T>(handle,
-        //                                        evect,
-        //                                        erange,
-        //                                        uplo,
-        //                                        n,
-        //                                        dA,
-        //                                        lda,
-        //                                        stA,
-        //                                        vl,
-        //                                        vu,
-        //                                        il,
-        //                                        iu,
-        //                                        hNevRes,
-        //                                        dW,
-        //                                        stW,
-        //                                        dWork,
-        //                                        size_Work,
-        //                                        dinfo,
-        //                                        bc,
-        //                                        hA,
-        //                                        hARes,
-        //                                        hNev,
-        //                                        hW,
-        //                                        hWres,
-        //                                        hinfo,
-        //                                        hinfoRes,
-        //                                        &max_error);
+        //     syevdx_heevdx_getError<API, STRIDED, T>(handle,
+        //                                                 evect,
+        //                                                 erange,
+        //                                                 uplo,
+        //                                                 n,
+        //                                                 dA,
+        //                                                 lda,
+        //                                                 stA,
+        //                                                 vl,
+        //                                                 vu,
+        //                                                 il,
+        //                                                 iu,
+        //                                                 hNevRes,
+        //                                                 dW,
+        //                                                 stW,
+        //                                                 dWork,
+        //                                                 size_Work,
+        //                                                 dinfo,
+        //                                                 bc,
+        //                                                 hA,
+        //                                                 hARes,
+        //                                                 hNev,
+        //                                                 hW,
+        //                                                 hWres,
+        //                                                 hinfo,
+        //                                                 hinfoRes,
+        //                                                 &max_error);
         // }
 
         // // collect performance data
         // if(argus.timing)
         // {
-        //     syevdx_heevdx_getPerfData<API, T>(handle,
-        //                                           evect,
-        //                                           erange,
-        //                                           uplo,
-        //                                           n,
-        //                                           dA,
-        //                                           lda,
-        //                                           stA,
-        //                                           vl,
-        //                                           vu,
-        //                                           il,
-        //                                           iu,
-        //                                           hNevRes,
-        //                                           dW,
-        //                                           stW,
-        //                                           dWork,
-        //                                           size_Work,
-        //                                           dinfo,
-        //                                           bc,
-        //                                           hA,
-        //                                           hNev,
-        //                                           hW,
-        //                                           hinfo,
-        //                                           &gpu_time_used,
-        //                                           &cpu_time_used,
-        //                                           hot_calls,
-        //                                           argus.perf);
+        //     syevdx_heevdx_getPerfData<API, STRIDED, T>(handle,
+        //                                                    evect,
+        //                                                    erange,
+        //                                                    uplo,
+        //                                                    n,
+        //                                                    dA,
+        //                                                    lda,
+        //                                                    stA,
+        //                                                    vl,
+        //                                                    vu,
+        //                                                    il,
+        //                                                    iu,
+        //                                                    hNevRes,
+        //                                                    dW,
+        //                                                    stW,
+        //                                                    dWork,
+        //                                                    size_Work,
+        //                                                    dinfo,
+        //                                                    bc,
+        //                                                    hA,
+        //                                                    hNev,
+        //                                                    hW,
+        //                                                    hinfo,
+        //                                                    &gpu_time_used,
+        //                                                    &cpu_time_used,
+        //                                                    hot_calls,
+        //                                                    argus.perf);
         // }
     }
 
@@ -955,65 +1052,71 @@ void testing_syevdx_heevdx(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            syevdx_heevdx_getError<API, T>(handle,
-                                           evect,
-                                           erange,
-                                           uplo,
-                                           n,
-                                           dA,
-                                           lda,
-                                           stA,
-                                           vl,
-                                           vu,
-                                           il,
-                                           iu,
-                                           hNevRes,
-                                           dW,
-                                           stW,
-                                           dWork,
-                                           size_Work,
-                                           dinfo,
-                                           bc,
-                                           hA,
-                                           hARes,
-                                           hNev,
-                                           hW,
-                                           hWres,
-                                           hinfo,
-                                           hinfoRes,
-                                           &max_error);
+            syevdx_heevdx_getError<API, STRIDED, T>(handle,
+                                                    params,
+                                                    evect,
+                                                    erange,
+                                                    uplo,
+                                                    n,
+                                                    dA,
+                                                    lda,
+                                                    stA,
+                                                    vl,
+                                                    vu,
+                                                    il,
+                                                    iu,
+                                                    hNevRes,
+                                                    dW,
+                                                    stW,
+                                                    dWork,
+                                                    size_dW,
+                                                    hWork,
+                                                    size_hW,
+                                                    dinfo,
+                                                    bc,
+                                                    hA,
+                                                    hARes,
+                                                    hNev,
+                                                    hW,
+                                                    hWres,
+                                                    hinfo,
+                                                    hinfoRes,
+                                                    &max_error);
         }
 
         // collect performance data
         if(argus.timing)
         {
-            syevdx_heevdx_getPerfData<API, T>(handle,
-                                              evect,
-                                              erange,
-                                              uplo,
-                                              n,
-                                              dA,
-                                              lda,
-                                              stA,
-                                              vl,
-                                              vu,
-                                              il,
-                                              iu,
-                                              hNevRes,
-                                              dW,
-                                              stW,
-                                              dWork,
-                                              size_Work,
-                                              dinfo,
-                                              bc,
-                                              hA,
-                                              hNev,
-                                              hW,
-                                              hinfo,
-                                              &gpu_time_used,
-                                              &cpu_time_used,
-                                              hot_calls,
-                                              argus.perf);
+            syevdx_heevdx_getPerfData<API, STRIDED, T>(handle,
+                                                       params,
+                                                       evect,
+                                                       erange,
+                                                       uplo,
+                                                       n,
+                                                       dA,
+                                                       lda,
+                                                       stA,
+                                                       vl,
+                                                       vu,
+                                                       il,
+                                                       iu,
+                                                       hNevRes,
+                                                       dW,
+                                                       stW,
+                                                       dWork,
+                                                       size_dW,
+                                                       hWork,
+                                                       size_hW,
+                                                       dinfo,
+                                                       bc,
+                                                       hA,
+                                                       hNev,
+                                                       hW,
+                                                       hinfo,
+                                                       &gpu_time_used,
+                                                       &cpu_time_used,
+                                                       hot_calls,
+                                                       argus.perf);
         }
     }
 
@@ -25,12 +25,12 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, bool STRIDED, typename T, typename S, typename U>
+template <testAPI_t API, bool STRIDED, typename W, typename T, typename S, typename U>
 void syevj_heevj_checkBadArgs(const hipsolverHandle_t    handle,
                               const hipsolverEigMode_t   evect,
                               const hipsolverFillMode_t  uplo,
                               const int                  n,
-                              T                          dA,
+                              W                          dA,
                               const int                  lda,
                               const int                  stA,
                               S                          dD,
@@ -104,7 +104,7 @@ void syevj_heevj_checkBadArgs(const hipsolverHandle_t    handle,
                                                 evect,
                                                 uplo,
                                                 n,
-                                                (T) nullptr,
+                                                (W) nullptr,
                                                 lda,
                                                 stA,
                                                 dD,
@@ -170,36 +170,36 @@ void testing_syevj_heevj_bad_arg()
 
     if(BATCHED)
     {
-        // // memory allocations
-        // device_batch_vector<T>           dA(1, 1, 1);
-        // device_strided_batch_vector<S>   dD(1, 1, 1, 1);
-        // device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
-        // CHECK_HIP_ERROR(dA.memcheck());
-        // CHECK_HIP_ERROR(dD.memcheck());
-        // CHECK_HIP_ERROR(dinfo.memcheck());
-
-        // int size_W;
-        // hipsolver_syevj_heevj_bufferSize(
-        //     API, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W, params, bc);
-        // device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
-        // if(size_W)
-        //     CHECK_HIP_ERROR(dWork.memcheck());
-
-        // // check bad arguments
-        // syevj_heevj_checkBadArgs<API, STRIDED>(handle,
-        //                                        evect,
-        //                                        uplo,
-        //                                        n,
-        //                                        dA.data(),
-        //                                        lda,
-        //                                        stA,
-        //                                        dD.data(),
-        //                                        stD,
-        //                                        dWork.data(),
-        //                                        size_W,
-        //                                        dinfo.data(),
-        //                                        params,
-        //                                        bc);
+        // memory allocations
+        device_batch_vector<T>           dA(1, 1, 1);
+        device_strided_batch_vector<S>   dD(1, 1, 1, 1);
+        device_strided_batch_vector<int> dinfo(1, 1, 1, 1);
+        CHECK_HIP_ERROR(dA.memcheck());
+        CHECK_HIP_ERROR(dD.memcheck());
+        CHECK_HIP_ERROR(dinfo.memcheck());
+
+        int size_W;
+        hipsolver_syevj_heevj_bufferSize(
+            API, STRIDED, handle, evect, uplo, n, dA.data(), lda, dD.data(), &size_W, params, bc);
+        device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
+        if(size_W)
+            CHECK_HIP_ERROR(dWork.memcheck());
+
+        // check bad arguments
+        syevj_heevj_checkBadArgs<API, STRIDED>(handle,
+                                               evect,
+                                               uplo,
+                                               n,
+                                               dA.data(),
+                                               lda,
+                                               stA,
+                                               dD.data(),
+                                               stD,
+                                               dWork.data(),
+                                               size_W,
+                                               dinfo.data(),
+                                               params,
+                                               bc);
     }
     else
     {
@@ -285,10 +285,12 @@ void syevj_heevj_initData(const hipsolverHandle_t  handle,
 }
 
 template <testAPI_t API,
+          bool      BATCHED,
           bool      STRIDED,
           typename T,
           typename Sd,
           typename Td,
+          typename Wd,
           typename Id,
           typename Sh,
           typename Th,
@@ -303,7 +305,7 @@ void syevj_heevj_getError(const hipsolverHandle_t   handle,
                           const int                 stA,
                           Sd&                       dD,
                           const int                 stD,
-                          Td&                       dWork,
+                          Wd&                       dWork,
                           const int                 lwork,
                           Id&                       dinfo,
                           hipsolverSyevjInfo_t      params,
@@ -373,6 +375,18 @@ void syevj_heevj_getError(const hipsolverHandle_t   handle,
     hipsolverXsyevjGetResidual(handle, params, hResidualRes.data());
     hipsolverXsyevjGetSweeps(handle, params, hSweepsRes.data());
 
+    // The batched queries are not supported by the cuSOLVER backend
+    bool batched_queries = false;
+    if(BATCHED || STRIDED)
+    {
+        batched_queries
+            = hipsolverXsyevjGetResidualBatched(handle, params, hResidualRes.data(), bc)
+              == HIPSOLVER_STATUS_SUCCESS;
+        if(batched_queries)
+            CHECK_ROCBLAS_ERROR(
+                hipsolverXsyevjGetSweepsBatched(handle, params, hSweepsRes.data(), bc));
+    }
+
     // CPU lapack
     for(int b = 0; b < bc; ++b)
         cpu_syevd_heevd(evect,
@@ -398,7 +412,7 @@ void syevj_heevj_getError(const hipsolverHandle_t   handle,
             *max_err += 1;
     }
 
-    if(!STRIDED)
+    if((!BATCHED && !STRIDED) || batched_queries)
     {
         // Also check validity of residual
         for(rocblas_int b = 0; b < bc; ++b)
@@ -425,6 +439,56 @@ void syevj_heevj_getError(const hipsolverHandle_t   handle,
         }
     }
 
+    if(batched_queries)
+    {
+        // Exactly the matrices for which the solver returned a nonzero info must be reported
+        std::vector<int> unconverged(bc);
+        int              num_unconverged;
+        CHECK_ROCBLAS_ERROR(hipsolverXsyevjGetUnconverged(
+            handle, params, unconverged.data(), &num_unconverged, bc));
+
+        auto last = unconverged.begin() + num_unconverged;
+        for(rocblas_int b = 0; b < bc; ++b)
+        {
+            bool reported = std::find(unconverged.begin(), last, b) != last;
+            EXPECT_EQ(reported, hinfoRes[b][0] != 0) << "where b = " << b;
+            if(reported != (hinfoRes[b][0] != 0))
+                *max_err += 1;
+        }
+    }
+
+    if(!BATCHED && !STRIDED)
+    {
+        // The asynchronous queries must match once the stream has been synchronized. A
+        // second residual query is enqueued on another stream before either completes,
+        // so that the two cannot share their staging.
+        double*     asyncResidual;
+        int*        asyncSweeps;
+        hipStream_t stream, stream2;
+        CHECK_HIP_ERROR(hipHostMalloc(&asyncResidual, 2 * sizeof(double)));
+        CHECK_HIP_ERROR(hipHostMalloc(&asyncSweeps, sizeof(int)));
+        CHECK_HIP_ERROR(hipStreamCreate(&stream2));
+        CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+        CHECK_ROCBLAS_ERROR(hipsolverXsyevjGetResidualAsync(handle, params, asyncResidual));
+        CHECK_ROCBLAS_ERROR(hipsolverXsyevjGetSweepsAsync(handle, params, asyncSweeps));
+        CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, stream2));
+        CHECK_ROCBLAS_ERROR(hipsolverXsyevjGetResidualAsync(handle, params, asyncResidual + 1));
+        CHECK_ROCBLAS_ERROR(hipsolverSetStream(handle, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream2));
+        CHECK_HIP_ERROR(hipStreamDestroy(stream2));
+
+        EXPECT_EQ(asyncResidual[0], hResidualRes[0][0]);
+        EXPECT_EQ(asyncResidual[1], hResidualRes[0][0]);
+        EXPECT_EQ(*asyncSweeps, hSweepsRes[0][0]);
+        if(asyncResidual[0] != hResidualRes[0][0] || asyncResidual[1] != hResidualRes[0][0]
+           || *asyncSweeps != hSweepsRes[0][0])
+            *max_err += 1;
+
+        CHECK_HIP_ERROR(hipHostFree(asyncResidual));
+        CHECK_HIP_ERROR(hipHostFree(asyncSweeps));
+    }
+
     double err = 0;
 
     for(int b = 0; b < bc; ++b)
@@ -478,6 +542,7 @@ template <testAPI_t API,
           typename T,
           typename Sd,
           typename Td,
+          typename Wd,
           typename Id,
           typename Sh,
           typename Th,
@@ -491,7 +556,7 @@ void syevj_heevj_getPerfData(const hipsolverHandle_t   handle,
                              const int                 stA,
                              Sd&                       dD,
                              const int                 stD,
-                             Td&                       dWork,
+                             Wd&                       dWork,
                              const int                 lwork,
                              Id&                       dinfo,
                              hipsolverSyevjInfo_t      params,
@@ -645,23 +710,23 @@ void testing_syevj_heevj(Arguments& argus)
     {
         if(BATCHED)
         {
-            // EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(API,
-            //                                             STRIDED,
-            //                                             handle,
-            //                                             evect,
-            //                                             uplo,
-            //                                             n,
-            //                                             (T* const*)nullptr,
-            //                                             lda,
-            //                                             stA,
-            //                                             (S*)nullptr,
-            //                                             stD,
-            //                                             (T*)nullptr,
-            //                                             0,
-            //                                             (int*)nullptr,
-            //                                             params,
-            //                                             bc),
-            //                       HIPSOLVER_STATUS_INVALID_VALUE);
+            EXPECT_ROCBLAS_STATUS(hipsolver_syevj_heevj(API,
+                                                        STRIDED,
+                                                        handle,
+                                                        evect,
+                                                        uplo,
+                                                        n,
+                                                        (T**)nullptr,
+                                                        lda,
+                                                        stA,
+                                                        (S*)nullptr,
+                                                        stD,
+                                                        (T*)nullptr,
+                                                        0,
+                                                        (int*)nullptr,
+                                                        params,
+                                                        bc),
+                                  HIPSOLVER_STATUS_INVALID_VALUE);
         }
         else
         {
@@ -692,8 +757,32 @@ void testing_syevj_heevj(Arguments& argus)
 
     // memory size query is necessary
     int size_W;
-    hipsolver_syevj_heevj_bufferSize(
-        API, STRIDED, handle, evect, uplo, n, (T*)nullptr, lda, (S*)nullptr, &size_W, params, bc);
+    if(BATCHED)
+        hipsolver_syevj_heevj_bufferSize(API,
+                                         STRIDED,
+                                         handle,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         (T**)nullptr,
+                                         lda,
+                                         (S*)nullptr,
+                                         &size_W,
+                                         params,
+                                         bc);
+    else
+        hipsolver_syevj_heevj_bufferSize(API,
+                                         STRIDED,
+                                         handle,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         (T*)nullptr,
+                                         lda,
+                                         (S*)nullptr,
+                                         &size_W,
+                                         params,
+                                         bc);
 
     if(argus.mem_query)
     {
@@ -721,69 +810,69 @@ void testing_syevj_heevj(Arguments& argus)
 
     if(BATCHED)
     {
-        // // memory allocations
-        // host_batch_vector<T>           hA(size_A, 1, bc);
-        // host_batch_vector<T>           hAres(size_Ares, 1, bc);
-        // device_batch_vector<T>         dA(size_A, 1, bc);
-        // if(size_A)
-        //     CHECK_HIP_ERROR(dA.memcheck());
-
-        // // check computations
-        // if(argus.unit_check || argus.norm_check)
-        // {
-        //     syevj_heevj_getError<API, STRIDED, T>(handle,
-        //                                          evect,
-        //                                          uplo,
-        //                                          n,
-        //                                          dA,
-        //                                          lda,
-        //                                          stA,
-        //                                          dD,
-        //                                          stD,
-        //                                          dWork,
-        //                                          size_W,
-        //                                          dinfo,
-        //                                          params,
-        //                                          abstol,
-        //                                          max_sweeps,
-        //                                          sort_eig,
-        //                                          bc,
-        //                                          hA,
-        //                                          hAres,
-        //                                          hD,
-        //                                          hDres,
-        //                                          hinfo,
-        //                                          hinfoRes,
-        //                                          hResidualRes,
-        //                                          hSweepsRes,
-        //                                          &max_error);
-        // }
-
-        // // collect performance data
-        // if(argus.timing)
-        // {
-        //     syevj_heevj_getPerfData<API, STRIDED, T>(handle,
-        //                                              evect,
-        //                                              uplo,
-        //                                              n,
-        //                                              dA,
-        //                                              lda,
-        //                                              stA,
-        //                                              dD,
-        //                                              stD,
-        //                                              dWork,
-        //                                              size_W,
-        //                                              dinfo,
-        //                                              params,
-        //                                              bc,
-        //                                              hA,
-        //                                              hD,
-        //                                              hinfo,
-        //                                              &gpu_time_used,
-        //                                              &cpu_time_used,
-        //                                              hot_calls,
-        //                                              argus.perf);
-        // }
+        // memory allocations
+        host_batch_vector<T>   hA(size_A, 1, bc);
+        host_batch_vector<T>   hAres(size_Ares, 1, bc);
+        device_batch_vector<T> dA(size_A, 1, bc);
+        if(size_A)
+            CHECK_HIP_ERROR(dA.memcheck());
+
+        // check computations
+        if(argus.unit_check || argus.norm_check)
+        {
+            syevj_heevj_getError<API, BATCHED, STRIDED, T>(handle,
+                                                           evect,
+                                                           uplo,
+                                                           n,
+                                                           dA,
+                                                           lda,
+                                                           stA,
+                                                           dD,
+                                                           stD,
+                                                           dWork,
+                                                           size_W,
+                                                           dinfo,
+                                                           params,
+                                                           abstol,
+                                                           max_sweeps,
+                                                           sort_eig,
+                                                           bc,
+                                                           hA,
+                                                           hAres,
+                                                           hD,
+                                                           hDres,
+                                                           hinfo,
+                                                           hinfoRes,
+                                                           hResidualRes,
+                                                           hSweepsRes,
+                                                           &max_error);
+        }
+
+        // collect performance data
+        if(argus.timing)
+        {
+            syevj_heevj_getPerfData<API, STRIDED, T>(handle,
+                                                     evect,
+                                                     uplo,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dD,
+                                                     stD,
+                                                     dWork,
+                                                     size_W,
+                                                     dinfo,
+                                                     params,
+                                                     bc,
+                                                     hA,
+                                                     hD,
+                                                     hinfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf);
+        }
     }
 
     else
@@ -798,32 +887,32 @@ void testing_syevj_heevj(Arguments& argus)
         // check computations
         if(argus.unit_check || argus.norm_check)
         {
-            syevj_heevj_getError<API, STRIDED, T>(handle,
-                                                  evect,
-                                                  uplo,
-                                                  n,
-                                                  dA,
-                                                  lda,
-                                                  stA,
-                                                  dD,
-                                                  stD,
-                                                  dWork,
-                                                  size_W,
-                                                  dinfo,
-                                                  params,
-                                                  abstol,
-                                                  max_sweeps,
-                                                  sort_eig,
-                                                  bc,
-                                                  hA,
-                                                  hAres,
-                                                  hD,
-                                                  hDres,
-                                                  hinfo,
-                                                  hinfoRes,
-                                                  hResidualRes,
-                                                  hSweepsRes,
-                                                  &max_error);
+            syevj_heevj_getError<API, BATCHED, STRIDED, T>(handle,
+                                                           evect,
+                                                           uplo,
+                                                           n,
+                                                           dA,
+                                                           lda,
+                                                           stA,
+                                                           dD,
+                                                           stD,
+                                                           dWork,
+                                                           size_W,
+                                                           dinfo,
+                                                           params,
+                                                           abstol,
+                                                           max_sweeps,
+                                                           sort_eig,
+                                                           bc,
+                                                           hA,
+                                                           hAres,
+                                                           hD,
+                                                           hDres,
+                                                           hinfo,
+                                                           hinfoRes,
+                                                           hResidualRes,
+                                                           hSweepsRes,
+                                                           &max_error);
         }
 
         // collect performance data
@@ -25,7 +25,7 @@
 
 #include "clientcommon.hpp"
 
-template <testAPI_t API, typename T, typename U>
+template <testAPI_t API, bool STRIDED, typename T, typename U>
 void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                               const hipsolverEigType_t  itype,
                               const hipsolverEigMode_t  evect,
@@ -46,6 +46,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 {
     // handle
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 nullptr,
                                                 itype,
                                                 evect,
@@ -67,6 +68,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 
     // values
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 handle,
                                                 hipsolverEigType_t(-1),
                                                 evect,
@@ -86,6 +88,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 hipsolverEigMode_t(-1),
@@ -105,6 +108,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_ENUM);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -127,6 +131,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
 #if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
     // pointers
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -146,6 +151,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -165,6 +171,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -184,6 +191,7 @@ void sygvd_hegvd_checkBadArgs(const hipsolverHandle_t   handle,
                                                 bc),
                           HIPSOLVER_STATUS_INVALID_VALUE);
     EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                STRIDED,
                                                 handle,
                                                 itype,
                                                 evect,
@@ -237,6 +245,7 @@ void testing_sygvd_hegvd_bad_arg()
 
         // int size_W;
         // hipsolver_sygvd_hegvd_bufferSize(API,
+        //                                  STRIDED,
         //                                  handle,
         //                                  itype,
         //                                  evect,
@@ -244,32 +253,36 @@ void testing_sygvd_hegvd_bad_arg()
         //                                  n,
         //                                  dA.data(),
         //                                  lda,
+        //                                  stA,
         //                                  dB.data(),
         //                                  ldb,
+        //                                  stB,
         //                                  dD.data(),
-        //                                  &size_W);
+        //                                  stD,
+        //                                  &size_W,
+        //                                  bc);
         // device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         // if(size_W)
         //     CHECK_HIP_ERROR(dWork.memcheck());
 
         // // check bad arguments
-        // sygvd_hegvd_checkBadArgs<API>(handle,
-        //                                   itype,
-        //                                   evect,
-        //                                   uplo,
-        //                                   n,
-        //                                   dA.data(),
-        //                                   lda,
-        //                                   stA,
-        //                                   dB.data(),
-        //                                   ldb,
-        //                                   stB,
-        //                                   dD.data(),
-        //                                   stD,
-        //                                   dWork.data(),
-        //                                   size_W,
-        //                                   dInfo.data(),
-        //                                   bc);
+        // sygvd_hegvd_checkBadArgs<API, STRIDED>(handle,
+        //                                            itype,
+        //                                            evect,
+        //                                            uplo,
+        //                                            n,
+        //                                            dA.data(),
+        //                                            lda,
+        //                                            stA,
+        //                                            dB.data(),
+        //                                            ldb,
+        //                                            stB,
+        //                                            dD.data(),
+        //                                            stD,
+        //                                            dWork.data(),
+        //                                            size_W,
+        //                                            dInfo.data(),
+        //                                            bc);
     }
     else
     {
@@ -284,30 +297,45 @@ void testing_sygvd_hegvd_bad_arg()
         CHECK_HIP_ERROR(dInfo.memcheck());
 
         int size_W;
-        hipsolver_sygvd_hegvd_bufferSize(
-            API, handle, itype, evect, uplo, n, dA.data(), lda, dB.data(), ldb, dD.data(), &size_W);
+        hipsolver_sygvd_hegvd_bufferSize(API,
+                                         STRIDED,
+                                         handle,
+                                         itype,
+                                         evect,
+                                         uplo,
+                                         n,
+                                         dA.data(),
+                                         lda,
+                                         stA,
+                                         dB.data(),
+                                         ldb,
+                                         stB,
+                                         dD.data(),
+                                         stD,
+                                         &size_W,
+                                         bc);
         device_strided_batch_vector<T> dWork(size_W, 1, size_W, 1);
         if(size_W)
             CHECK_HIP_ERROR(dWork.memcheck());
 
         // check bad arguments
-        sygvd_hegvd_checkBadArgs<API>(handle,
-                                      itype,
-                                      evect,
-                                      uplo,
-                                      n,
-                                      dA.data(),
-                                      lda,
-                                      stA,
-                                      dB.data(),
-                                      ldb,
-                                      stB,
-                                      dD.data(),
-                                      stD,
-                                      dWork.data(),
-                                      size_W,
-                                      dInfo.data(),
-                                      bc);
+        sygvd_hegvd_checkBadArgs<API, STRIDED>(handle,
+                                               itype,
+                                               evect,
+                                               uplo,
+                                               n,
+                                               dA.data(),
+                                               lda,
+                                               stA,
+                                               dB.data(),
+                                               ldb,
+                                               stB,
+                                               dD.data(),
+                                               stD,
+                                               dWork.data(),
+                                               size_W,
+                                               dInfo.data(),
+                                               bc);
     }
 }
 
@@ -385,6 +413,7 @@ void sygvd_hegvd_initData(const hipsolverHandle_t       handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -448,6 +477,7 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
     // execute computations
     // GPU lapack
     CHECK_ROCBLAS_ERROR(hipsolver_sygvd_hegvd(API,
+                                              STRIDED,
                                               handle,
                                               itype,
                                               evect,
@@ -606,6 +636,7 @@ void sygvd_hegvd_getError(const hipsolverHandle_t   handle,
 }
 
 template <testAPI_t API,
+          bool      STRIDED,
           typename T,
           typename Td,
           typename Ud,
@@ -701,6 +732,7 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
             handle, itype, evect, n, dA, lda, stA, dB, ldb, stB, bc, hA, hB, A, B, false, singular);
 
         CHECK_ROCBLAS_ERROR(hipsolver_sygvd_hegvd(API,
+                                                  STRIDED,
                                                   handle,
                                                   itype,
                                                   evect,
@@ -732,6 +764,7 @@ void sygvd_hegvd_getPerfData(const hipsolverHandle_t   handle,
 
         start = get_time_us_sync(stream);
         hipsolver_sygvd_hegvd(API,
+                              STRIDED,
                               handle,
                               itype,
                               evect,
@@ -796,6 +829,7 @@ void testing_sygvd_hegvd(Arguments& argus)
         if(BATCHED)
         {
             // EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+            //                                             STRIDED,
             //                                             handle,
             //                                             itype,
             //                                             evect,
@@ -818,6 +852,7 @@ void testing_sygvd_hegvd(Arguments& argus)
         else
         {
             EXPECT_ROCBLAS_STATUS(hipsolver_sygvd_hegvd(API,
+                                                        STRIDED,
                                                         handle,
                                                         itype,
                                                         evect,
@@ -847,6 +882,7 @@ void testing_sygvd_hegvd(Arguments& argus)
     // memory size query is necessary
     int size_W;
     hipsolver_sygvd_hegvd_bufferSize(API,
+                                     STRIDED,
                                      handle,
                                      itype,
                                      evect,
@@ -854,10 +890,14 @@ void testing_sygvd_hegvd(Arguments& argus)
                                      n,
                                      (T*)nullptr,
                                      lda,
+                                     stA,
                                      (T*)nullptr,
                                      ldb,
+                                     stB,
                                      (S*)nullptr,
-                                     &size_W);
+                                     stD,
+                                     &size_W,
+                                     bc);
 
     if(argus.mem_query)
     {
@@ -892,61 +932,61 @@ void testing_sygvd_hegvd(Arguments& argus)
 
         // // check computations
         // if(argus.unit_check || argus.norm_check)
-        //     sygvd_hegvd_getError<API, T>(handle,
-        //                                      itype,
-        //                                      evect,
-        //                                      uplo,
-        //                                      n,
-        //                                      dA,
-        //                                      lda,
-        //                                      stA,
-        //                                      dB,
-        //                                      ldb,
-        //                                      stB,
-        //                                      dD,
-        //                                      stD,
-        //                                      dWork,
-        //                                      size_W,
-        //                                      dInfo,
-        //                                      bc,
-        //                                      hA,
-        //                                      hARes,
-        //                                      hB,
-        //                                      hD,
-        //                                      hDRes,
-        //                                      hInfo,
-        //                                      hInfoRes,
-        //                                      &max_error,
-        //                                      argus.singular);
+        //     sygvd_hegvd_getError<API, STRIDED, T>(handle,
+        //                                               itype,
+        //                                               evect,
+        //                                               uplo,
+        //                                               n,
+        //                                               dA,
+        //                                               lda,
+        //                                               stA,
+        //                                               dB,
+        //                                               ldb,
+        //                                               stB,
+        //                                               dD,
+        //                                               stD,
+        //                                               dWork,
+        //                                               size_W,
+        //                                               dInfo,
+        //                                               bc,
+        //                                               hA,
+        //                                               hARes,
+        //                                               hB,
+        //                                               hD,
+        //                                               hDRes,
+        //                                               hInfo,
+        //                                               hInfoRes,
+        //                                               &max_error,
+        //                                               argus.singular);
 
         // // collect performance data
         // if(argus.timing)
-        //     sygvd_hegvd_getPerfData<API, T>(handle,
-        //                                         itype,
-        //                                         evect,
-        //                                         uplo,
-        //                                         n,
-        //                                         dA,
-        //                                         lda,
-        //                                         stA,
-        //                                         dB,
-        //                                         ldb,
-        //                                         stB,
-        //                                         dD,
-        //                                         stD,
-        //                                         dWork,
-        //                                         size_W,
-        //                                         dInfo,
-        //                                         bc,
-        //                                         hA,
-        //                                         hB,
-        //                                         hD,
-        //                                         hInfo,
-        //                                         &gpu_time_used,
-        //                                         &cpu_time_used,
-        //                                         hot_calls,
-        //                                         argus.perf,
-        //                                         argus.singular);
+        //     sygvd_hegvd_getPerfData<API, STRIDED, T>(handle,
+        //                                                  itype,
+        //                                                  evect,
+        //                                                  uplo,
+        //                                                  n,
+        //                                                  dA,
+        //                                                  lda,
+        //                                                  stA,
+        //                                                  dB,
+        //                                                  ldb,
+        //                                                  stB,
+        //                                                  dD,
+        //                                                  stD,
+        //                                                  dWork,
+        //                                                  size_W,
+        //                                                  dInfo,
+        //                                                  bc,
+        //                                                  hA,
+        //                                                  hB,
+        //                                                  hD,
+        //                                                  hInfo,
+        //                                                  &gpu_time_used,
+        //                                                  &cpu_time_used,
+        //                                                  hot_calls,
+        //                                                  argus.perf,
+        //                                                  argus.singular);
     }
 
     else
@@ -976,61 +1016,61 @@ void testing_sygvd_hegvd(Arguments& argus)
 
         // check computations
         if(argus.unit_check || argus.norm_check)
-            sygvd_hegvd_getError<API, T>(handle,
-                                         itype,
-                                         evect,
-                                         uplo,
-                                         n,
-                                         dA,
-                                         lda,
-                                         stA,
-                                         dB,
-                                         ldb,
-                                         stB,
-                                         dD,
-                                         stD,
-                                         dWork,
-                                         size_W,
-                                         dInfo,
-                                         bc,
-                                         hA,
-                                         hARes,
-                                         hB,
-                                         hD,
-                                         hDRes,
-                                         hInfo,
-                                         hInfoRes,
-                                         &max_error,
-                                         argus.singular);
+            sygvd_hegvd_getError<API, STRIDED, T>(handle,
+                                                  itype,
+                                                  evect,
+                                                  uplo,
+                                                  n,
+                                                  dA,
+                                                  lda,
+                                                  stA,
+                                                  dB,
+                                                  ldb,
+                                                  stB,
+                                                  dD,
+                                                  stD,
+                                                  dWork,
+                                                  size_W,
+                                                  dInfo,
+                                                  bc,
+                                                  hA,
+                                                  hARes,
+                                                  hB,
+                                                  hD,
+                                                  hDRes,
+                                                  hInfo,
+                                                  hInfoRes,
+                                                  &max_error,
+                                                  argus.singular);
 
         // collect performance data
         if(argus.timing)
-            sygvd_hegvd_getPerfData<API, T>(handle,
-                                            itype,
-                                            evect,
-                                            uplo,
-                                            n,
-                                            dA,
-                                            lda,
-                                            stA,
-                                            dB,
-                                            ldb,
-                                            stB,
-                                            dD,
-                                            stD,
-                                            dWork,
-                                            size_W,
-                                            dInfo,
-                                            bc,
-                                            hA,
-                                            hB,
-                                            hD,
-                                            hInfo,
-                                            &gpu_time_used,
-                                            &cpu_time_used,
-                                            hot_calls,
-                                            argus.perf,
-                                            argus.singular);
+            sygvd_hegvd_getPerfData<API, STRIDED, T>(handle,
+                                                     itype,
+                                                     evect,
+                                                     uplo,
+                                                     n,
+                                                     dA,
+                                                     lda,
+                                                     stA,
+                                                     dB,
+                                                     ldb,
+                                                     stB,
+                                                     dD,
+                                                     stD,
+                                                     dWork,
+                                                     size_W,
+                                                     dInfo,
+                                                     bc,
+                                                     hA,
+                                                     hB,
+                                                     hD,
+                                                     hInfo,
+                                                     &gpu_time_used,
+                                                     &cpu_time_used,
+                                                     hot_calls,
+                                                     argus.perf,
+                                                     argus.singular);
     }
 
     // validate results for rocsolver-test
@@ -0,0 +1,487 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+#pragma once
+
+#include "clientcommon.hpp"
+
+template <testAPI_t API, typename I, typename SIZE, typename Td, typename Wd, typename INTd>
+void trtri_checkBadArgs(const hipsolverHandle_t   handle,
+                        const hipsolverFillMode_t uplo,
+                        const hipblasDiagType_t   diag,
+                        const I                   n,
+                        Td                        dA,
+                        const I                   lda,
+                        Wd                        dWork,
+                        const SIZE                dlwork,
+                        Wd                        hWork,
+                        const SIZE                hlwork,
+                        INTd                      dInfo)
+{
+    // handle
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_trtri(
+            API, nullptr, uplo, diag, n, dA, lda, dWork, dlwork, hWork, hlwork, dInfo),
+        HIPSOLVER_STATUS_NOT_INITIALIZED);
+
+    // values
+    EXPECT_ROCBLAS_STATUS(hipsolver_trtri(API,
+                                          handle,
+                                          hipsolverFillMode_t(-1),
+                                          diag,
+                                          n,
+                                          dA,
+                                          lda,
+                                          dWork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+    EXPECT_ROCBLAS_STATUS(hipsolver_trtri(API,
+                                          handle,
+                                          uplo,
+                                          hipblasDiagType_t(-1),
+                                          n,
+                                          dA,
+                                          lda,
+                                          dWork,
+                                          dlwork,
+                                          hWork,
+                                          hlwork,
+                                          dInfo),
+                          HIPSOLVER_STATUS_INVALID_ENUM);
+
+#if defined(__HIP_PLATFORM_HCC__) || defined(__HIP_PLATFORM_AMD__)
+    // pointers
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_trtri(
+            API, handle, uplo, diag, n, (Td) nullptr, lda, dWork, dlwork, hWork, hlwork, dInfo),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+    EXPECT_ROCBLAS_STATUS(
+        hipsolver_trtri(
+            API, handle, uplo, diag, n, dA, lda, dWork, dlwork, hWork, hlwork, (INTd) nullptr),
+        HIPSOLVER_STATUS_INVALID_VALUE);
+#endif
+}
+
+template <testAPI_t API, typename T, typename I, typename SIZE>
+void testing_trtri_bad_arg()
+{
+    // safe arguments
+    hipsolver_local_handle handle;
+    hipsolverFillMode_t    uplo = HIPSOLVER_FILL_MODE_UPPER;
+    hipblasDiagType_t      diag = HIPBLAS_DIAG_NON_UNIT;
+    I                      n    = 1;
+    I                      lda  = 1;
+
+    // memory allocations
+    device_strided_batch_vector<T>   dA(1, 1, 1, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+
+    SIZE size_dW, size_hW;
+    hipsolver_trtri_bufferSize(API, handle, uplo, diag, n, dA.data(), lda, &size_dW, &size_hW);
+    device_strided_batch_vector<T> dWork(size_dW, 1, size_dW, 1);
+    host_strided_batch_vector<T>   hWork(size_hW, 1, size_hW, 1);
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check bad arguments
+    trtri_checkBadArgs<API>(handle,
+                            uplo,
+                            diag,
+                            n,
+                            dA.data(),
+                            lda,
+                            dWork.data(),
+                            size_dW,
+                            hWork.data(),
+                            size_hW,
+                            dInfo.data());
+}
+
+template <bool CPU, bool GPU, typename T, typename I, typename Td, typename Th>
+void trtri_initData(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const hipblasDiagType_t   diag,
+                    const I                   n,
+                    Td&                       dA,
+                    const I                   lda,
+                    Th&                       hA)
+{
+    if(CPU)
+    {
+        rocblas_init<T>(hA, true);
+
+        // scale to keep the matrix well conditioned; the off-diagonal entries are shrunk so
+        // that a unit-diagonal matrix stays close to the identity as well
+        for(I i = 0; i < n; i++)
+        {
+            for(I j = 0; j < n; j++)
+            {
+                if(i == j)
+                    hA[0][i + j * lda] = hA[0][i + j * lda] + T(400);
+                else
+                    hA[0][i + j * lda] = (hA[0][i + j * lda] - T(4)) / T(400);
+            }
+        }
+    }
+
+    if(GPU)
+    {
+        // now copy data to the GPU
+        CHECK_HIP_ERROR(dA.transfer_from(hA));
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename I,
+          typename SIZE,
+          typename Td,
+          typename Wd,
+          typename INTd,
+          typename Th,
+          typename Wh,
+          typename INTh>
+void trtri_getError(const hipsolverHandle_t   handle,
+                    const hipsolverFillMode_t uplo,
+                    const hipblasDiagType_t   diag,
+                    const I                   n,
+                    Td&                       dA,
+                    const I                   lda,
+                    Wd&                       dWork,
+                    const SIZE                dlwork,
+                    Wh&                       hWork,
+                    const SIZE                hlwork,
+                    INTd&                     dInfo,
+                    Th&                       hA,
+                    Th&                       hARes,
+                    INTh&                     hInfo,
+                    INTh&                     hInfoRes,
+                    double*                   max_err)
+{
+    // input data initialization
+    trtri_initData<true, true, T>(handle, uplo, diag, n, dA, lda, hA);
+
+    // execute computations
+    // GPU lapack
+    CHECK_ROCBLAS_ERROR(hipsolver_trtri(API,
+                                        handle,
+                                        uplo,
+                                        diag,
+                                        n,
+                                        dA.data(),
+                                        lda,
+                                        dWork.data(),
+                                        dlwork,
+                                        hWork.data(),
+                                        hlwork,
+                                        dInfo.data()));
+    CHECK_HIP_ERROR(hARes.transfer_from(dA));
+    CHECK_HIP_ERROR(hInfoRes.transfer_from(dInfo));
+
+    // CPU lapack
+    cpu_trtri(uplo, diag, n, hA[0], lda, hInfo[0]);
+
+    // check info for singularities
+    double err = 0;
+    *max_err   = 0;
+    EXPECT_EQ(hInfo[0][0], hInfoRes[0][0]);
+    if(hInfo[0][0] != hInfoRes[0][0])
+        err++;
+    *max_err += err;
+
+    // error is ||hA - hARes|| / ||hA||
+    // (THIS DOES NOT ACCOUNT FOR NUMERICAL REPRODUCIBILITY ISSUES.
+    // IT MIGHT BE REVISITED IN THE FUTURE)
+    // using frobenius norm
+    if(hInfoRes[0][0] == 0)
+    {
+        if(uplo == HIPSOLVER_FILL_MODE_UPPER)
+            err = norm_error_upperTr('F', n, n, lda, hA[0], hARes[0]);
+        else
+            err = norm_error_lowerTr('F', n, n, lda, hA[0], hARes[0]);
+        *max_err = err > *max_err ? err : *max_err;
+    }
+}
+
+template <testAPI_t API,
+          typename T,
+          typename I,
+          typename SIZE,
+          typename Td,
+          typename Wd,
+          typename INTd,
+          typename Th,
+          typename Wh,
+          typename INTh>
+void trtri_getPerfData(const hipsolverHandle_t   handle,
+                       const hipsolverFillMode_t uplo,
+                       const hipblasDiagType_t   diag,
+                       const I                   n,
+                       Td&                       dA,
+                       const I                   lda,
+                       Wd&                       dWork,
+                       const SIZE                dlwork,
+                       Wh&                       hWork,
+                       const SIZE                hlwork,
+                       INTd&                     dInfo,
+                       Th&                       hA,
+                       INTh&                     hInfo,
+                       double*                   gpu_time_used,
+                       double*                   cpu_time_used,
+                       const int                 hot_calls,
+                       const bool                perf)
+{
+    if(!perf)
+    {
+        trtri_initData<true, false, T>(handle, uplo, diag, n, dA, lda, hA);
+
+        // cpu-lapack performance (only if not in perf mode)
+        *cpu_time_used = get_time_us_no_sync();
+        cpu_trtri(uplo, diag, n, hA[0], lda, hInfo[0]);
+        *cpu_time_used = get_time_us_no_sync() - *cpu_time_used;
+    }
+
+    trtri_initData<true, false, T>(handle, uplo, diag, n, dA, lda, hA);
+
+    // cold calls
+    for(int iter = 0; iter < 2; iter++)
+    {
+        trtri_initData<false, true, T>(handle, uplo, diag, n, dA, lda, hA);
+
+        CHECK_ROCBLAS_ERROR(hipsolver_trtri(API,
+                                            handle,
+                                            uplo,
+                                            diag,
+                                            n,
+                                            dA.data(),
+                                            lda,
+                                            dWork.data(),
+                                            dlwork,
+                                            hWork.data(),
+                                            hlwork,
+                                            dInfo.data()));
+    }
+
+    // gpu-lapack performance
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(hipsolverGetStream(handle, &stream));
+    double start;
+
+    for(int iter = 0; iter < hot_calls; iter++)
+    {
+        trtri_initData<false, true, T>(handle, uplo, diag, n, dA, lda, hA);
+
+        start = get_time_us_sync(stream);
+        hipsolver_trtri(API,
+                        handle,
+                        uplo,
+                        diag,
+                        n,
+                        dA.data(),
+                        lda,
+                        dWork.data(),
+                        dlwork,
+                        hWork.data(),
+                        hlwork,
+                        dInfo.data());
+        *gpu_time_used += get_time_us_sync(stream) - start;
+    }
+    *gpu_time_used /= hot_calls;
+}
+
+template <testAPI_t API, typename T, typename I, typename SIZE>
+void testing_trtri(Arguments& argus)
+{
+    // get arguments
+    hipsolver_local_handle handle;
+    char                   uploC = argus.get<char>("uplo");
+    char                   diagC = argus.get<char>("diag");
+    I                      n     = argus.get<int>("n");
+    I                      lda   = argus.get<int>("lda", n);
+
+    hipsolverFillMode_t uplo      = char2hipsolver_fill(uploC);
+    hipblasDiagType_t   diag      = char2hipblas_diag(diagC);
+    int                 hot_calls = argus.iters;
+
+    // check non-supported values
+    if(uplo != HIPSOLVER_FILL_MODE_UPPER && uplo != HIPSOLVER_FILL_MODE_LOWER)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_trtri(API,
+                                              handle,
+                                              uplo,
+                                              diag,
+                                              n,
+                                              (T*)nullptr,
+                                              lda,
+                                              (T*)nullptr,
+                                              (SIZE)0,
+                                              (T*)nullptr,
+                                              (SIZE)0,
+                                              (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_args);
+
+        return;
+    }
+
+    // determine sizes
+    size_t size_A    = size_t(lda) * n;
+    double max_error = 0, gpu_time_used = 0, cpu_time_used = 0;
+
+    size_t size_ARes = (argus.unit_check || argus.norm_check) ? size_A : 0;
+
+    // check invalid sizes
+    bool invalid_size = (n < 0 || lda < n);
+    if(invalid_size)
+    {
+        EXPECT_ROCBLAS_STATUS(hipsolver_trtri(API,
+                                              handle,
+                                              uplo,
+                                              diag,
+                                              n,
+                                              (T*)nullptr,
+                                              lda,
+                                              (T*)nullptr,
+                                              (SIZE)0,
+                                              (T*)nullptr,
+                                              (SIZE)0,
+                                              (int*)nullptr),
+                              HIPSOLVER_STATUS_INVALID_VALUE);
+
+        if(argus.timing)
+            rocsolver_bench_inform(inform_invalid_size);
+
+        return;
+    }
+
+    // memory size query is necessary
+    SIZE size_dW, size_hW;
+    hipsolver_trtri_bufferSize(API, handle, uplo, diag, n, (T*)nullptr, lda, &size_dW, &size_hW);
+
+    if(argus.mem_query)
+    {
+        rocsolver_bench_inform(inform_mem_query, size_dW);
+        return;
+    }
+
+    // memory allocations
+    host_strided_batch_vector<T>     hA(size_A, 1, size_A, 1);
+    host_strided_batch_vector<T>     hARes(size_ARes, 1, size_ARes, 1);
+    host_strided_batch_vector<int>   hInfo(1, 1, 1, 1);
+    host_strided_batch_vector<int>   hInfoRes(1, 1, 1, 1);
+    host_strided_batch_vector<T>     hWork(size_hW, 1, size_hW, 1);
+    device_strided_batch_vector<T>   dA(size_A, 1, size_A, 1);
+    device_strided_batch_vector<int> dInfo(1, 1, 1, 1);
+    device_strided_batch_vector<T>   dWork(size_dW, 1, size_dW, 1);
+    if(size_A)
+        CHECK_HIP_ERROR(dA.memcheck());
+    CHECK_HIP_ERROR(dInfo.memcheck());
+    if(size_dW)
+        CHECK_HIP_ERROR(dWork.memcheck());
+
+    // check computations
+    if(argus.unit_check || argus.norm_check)
+        trtri_getError<API, T>(handle,
+                               uplo,
+                               diag,
+                               n,
+                               dA,
+                               lda,
+                               dWork,
+                               size_dW,
+                               hWork,
+                               size_hW,
+                               dInfo,
+                               hA,
+                               hARes,
+                               hInfo,
+                               hInfoRes,
+                               &max_error);
+
+    // collect performance data
+    if(argus.timing)
+        trtri_getPerfData<API, T>(handle,
+                                  uplo,
+                                  diag,
+                                  n,
+                                  dA,
+                                  lda,
+                                  dWork,
+                                  size_dW,
+                                  hWork,
+                                  size_hW,
+                                  dInfo,
+                                  hA,
+                                  hInfo,
+                                  &gpu_time_used,
+                                  &cpu_time_used,
+                                  hot_calls,
+                                  argus.perf);
+
+    // validate results for rocsolver-test
+    // using n * machine_precision as tolerance
+    if(argus.unit_check)
+        ROCSOLVER_TEST_CHECK(T, max_error, n);
+
+    // output results for rocsolver-bench
+    if(argus.timing)
+    {
+        if(!argus.perf)
+        {
+            std::cerr << "\n============================================\n";
+            std::cerr << "Arguments:\n";
+            std::cerr << "============================================\n";
+            rocsolver_bench_output("uplo", "diag", "n", "lda");
+            rocsolver_bench_output(uploC, diagC, n, lda);
+            std::cerr << "\n============================================\n";
+            std::cerr << "Results:\n";
+            std::cerr << "============================================\n";
+            if(argus.norm_check)
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time", "error");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used, max_error);
+            }
+            else
+            {
+                rocsolver_bench_output("cpu_time", "gpu_time");
+                rocsolver_bench_output(cpu_time_used, gpu_time_used);
+            }
+            std::cerr << std::endl;
+        }
+        else
+        {
+            if(argus.norm_check)
+                rocsolver_bench_output(gpu_time_used, max_error);
+            else
+                rocsolver_bench_output(gpu_time_used);
+        }
+    }
+}
@@ -159,6 +159,17 @@ public:
             throw std::invalid_argument("Invalid value for " + name);
     }
 
+    void validate_diag(const std::string& name) const
+    {
+        auto val = find(name);
+        if(val == end())
+            return;
+
+        char diag = val->second.as<char>();
+        if(diag != 'N' && diag != 'U')
+            throw std::invalid_argument("Invalid value for " + name);
+    }
+
     void validate_direct(const std::string& name) const
     {
         auto val = find(name);
@@ -243,6 +243,12 @@ install_packages( )
         fi
       fi
 
+      # rocrand generates the random test matrices of gesvdr
+      library_dependencies_ubuntu+=( "rocrand" )
+      library_dependencies_centos+=( "rocrand" )
+      library_dependencies_fedora+=( "rocrand" )
+      library_dependencies_sles+=( "rocrand" )
+
       if [[ "${build_sparse}" == true ]]; then
         # Custom rocsparse installation
         # Do not install rocsparse if --rocsparse_path flag is set,
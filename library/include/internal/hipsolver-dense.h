@@ -19,6 +19,8 @@
  ********************************************************************************/
 typedef hipsolverHandle_t hipsolverDnHandle_t;
 
+typedef void* hipsolverDnPlan_t;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -95,6 +97,27 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevjGetSweeps(hipsolverDnHandle_
                                                               hipsolverSyevjInfo_t info,
                                                               int*                 executed_sweeps);
 
+// plans
+/*! \brief Creates a plan for the routine described by desc on the given handle.
+    The plan must be destroyed before the handle.
+ ********************************************************************************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnCreatePlan(hipsolverDnHandle_t           handle,
+                                                         const hipsolverWorkspaceOp_t* desc,
+                                                         hipsolverDnPlan_t*            plan);
+
+/*! \brief Destroys a plan and releases its workspace. The handle of the plan must not
+    have been destroyed yet.
+ ********************************************************************************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDestroyPlan(hipsolverDnPlan_t plan);
+
+/*! \brief Launches the routine of a plan on the stream of its handle. The workspace of
+    the plan is bound to the handle, and other functions called on the handle get back
+    the workspace the handle used before. As in hipsolverXgetrf, getrf plans executed with
+    a null devIpiv compute the factorization without pivoting.
+ ********************************************************************************/
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnExecutePlan(
+    hipsolverDnPlan_t plan, void* A, void* B, void* C, int* devIpiv, int* devInfo);
+
 // orgbr/ungbr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSorgbr_bufferSize(hipsolverHandle_t handle,
                                                                 hipblasSideMode_t side,
@@ -690,6 +713,58 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZZgels_bufferSize(hipsolverHandle_
                                                                 void*             work,
                                                                 size_t*           lwork);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgels_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgels_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgels_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZKgels_bufferSize(hipsolverHandle_t handle,
+                                                                int               m,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSSgels(hipsolverHandle_t handle,
                                                      int               m,
                                                      int               n,
@@ -750,6 +825,66 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZZgels(hipsolverHandle_t handle,
                                                      int*              niters,
                                                      int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgels(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgels(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgels(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     hipDoubleComplex* B,
+                                                     int               ldb,
+                                                     hipDoubleComplex* X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZKgels(hipsolverHandle_t handle,
+                                                     int               m,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     hipDoubleComplex* B,
+                                                     int               ldb,
+                                                     hipDoubleComplex* X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
 // geqrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSgeqrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -856,6 +991,58 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZZgesv_bufferSize(hipsolverHandle_
                                                                 void*             work,
                                                                 size_t*           lwork);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                double*           A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                double*           B,
+                                                                int               ldb,
+                                                                double*           X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZKgesv_bufferSize(hipsolverHandle_t handle,
+                                                                int               n,
+                                                                int               nrhs,
+                                                                hipDoubleComplex* A,
+                                                                int               lda,
+                                                                int*              devIpiv,
+                                                                hipDoubleComplex* B,
+                                                                int               ldb,
+                                                                hipDoubleComplex* X,
+                                                                int               ldx,
+                                                                void*             work,
+                                                                size_t*           lwork);
+
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSSgesv(hipsolverHandle_t handle,
                                                      int               n,
                                                      int               nrhs,
@@ -916,6 +1103,66 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZZgesv(hipsolverHandle_t handle,
                                                      int*              niters,
                                                      int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDSgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnDHgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     double*           A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     double*           B,
+                                                     int               ldb,
+                                                     double*           X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZCgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     hipDoubleComplex* B,
+                                                     int               ldb,
+                                                     hipDoubleComplex* X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnZKgesv(hipsolverHandle_t handle,
+                                                     int               n,
+                                                     int               nrhs,
+                                                     hipDoubleComplex* A,
+                                                     int               lda,
+                                                     int*              devIpiv,
+                                                     hipDoubleComplex* B,
+                                                     int               ldb,
+                                                     hipDoubleComplex* X,
+                                                     int               ldx,
+                                                     void*             work,
+                                                     size_t            lwork,
+                                                     int*              niters,
+                                                     int*              devInfo);
+
 // gesvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnSgesvd_bufferSize(hipsolverHandle_t handle,
                                                                 int               m,
@@ -19,6 +19,12 @@ typedef enum
 typedef enum
 {
     HIPSOLVERDN_GETRF = 0,
+
+    // hipSOLVER extensions, selecting between rocSOLVER algorithms. They have no
+    // cuSOLVER equivalent, and the cuSOLVER backend returns HIPSOLVER_STATUS_NOT_SUPPORTED.
+    HIPSOLVERDN_EXT_SYEVD = 1001,
+    HIPSOLVERDN_EXT_GESVD = 1002,
+    HIPSOLVERDN_EXT_GEQRF = 1003,
 } hipsolverDnFunction_t;
 
 #ifdef __cplusplus
@@ -145,6 +151,236 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
                                                      int64_t             ldb,
                                                      int*                info);
 
+// syevd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevd_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverDnParams_t params,
+                                                                hipsolverEigMode_t  jobz,
+                                                                hipsolverFillMode_t uplo,
+                                                                int64_t             n,
+                                                                hipDataType         dataTypeA,
+                                                                const void*         A,
+                                                                int64_t             lda,
+                                                                hipDataType         dataTypeW,
+                                                                const void*         W,
+                                                                hipDataType         computeType,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevd(hipsolverDnHandle_t handle,
+                                                     hipsolverDnParams_t params,
+                                                     hipsolverEigMode_t  jobz,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     hipDataType         dataTypeW,
+                                                     void*               W,
+                                                     hipDataType         computeType,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
+// syevdx
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevdx_bufferSize(hipsolverDnHandle_t handle,
+                                                                 hipsolverDnParams_t params,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverEigRange_t range,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int64_t             n,
+                                                                 hipDataType         dataTypeA,
+                                                                 const void*         A,
+                                                                 int64_t             lda,
+                                                                 void*               vl,
+                                                                 void*               vu,
+                                                                 int64_t             il,
+                                                                 int64_t             iu,
+                                                                 int64_t*            nev,
+                                                                 hipDataType         dataTypeW,
+                                                                 const void*         W,
+                                                                 hipDataType         computeType,
+                                                                 size_t*             lworkOnDevice,
+                                                                 size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsyevdx(hipsolverDnHandle_t handle,
+                                                      hipsolverDnParams_t params,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverEigRange_t range,
+                                                      hipsolverFillMode_t uplo,
+                                                      int64_t             n,
+                                                      hipDataType         dataTypeA,
+                                                      void*               A,
+                                                      int64_t             lda,
+                                                      void*               vl,
+                                                      void*               vu,
+                                                      int64_t             il,
+                                                      int64_t             iu,
+                                                      int64_t*            nev,
+                                                      hipDataType         dataTypeW,
+                                                      void*               W,
+                                                      hipDataType         computeType,
+                                                      void*               workOnDevice,
+                                                      size_t              lworkOnDevice,
+                                                      void*               workOnHost,
+                                                      size_t              lworkOnHost,
+                                                      int*                info);
+
+// gesvd
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvd_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverDnParams_t params,
+                                                                signed char         jobu,
+                                                                signed char         jobv,
+                                                                int64_t             m,
+                                                                int64_t             n,
+                                                                hipDataType         dataTypeA,
+                                                                const void*         A,
+                                                                int64_t             lda,
+                                                                hipDataType         dataTypeS,
+                                                                const void*         S,
+                                                                hipDataType         dataTypeU,
+                                                                const void*         U,
+                                                                int64_t             ldu,
+                                                                hipDataType         dataTypeV,
+                                                                const void*         V,
+                                                                int64_t             ldv,
+                                                                hipDataType         computeType,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvd(hipsolverDnHandle_t handle,
+                                                     hipsolverDnParams_t params,
+                                                     signed char         jobu,
+                                                     signed char         jobv,
+                                                     int64_t             m,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     hipDataType         dataTypeS,
+                                                     void*               S,
+                                                     hipDataType         dataTypeU,
+                                                     void*               U,
+                                                     int64_t             ldu,
+                                                     hipDataType         dataTypeV,
+                                                     void*               V,
+                                                     int64_t             ldv,
+                                                     hipDataType         computeType,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
+// sytrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsytrs_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int64_t             n,
+                                                                int64_t             nrhs,
+                                                                hipDataType         dataTypeA,
+                                                                const void*         A,
+                                                                int64_t             lda,
+                                                                const int64_t*      ipiv,
+                                                                hipDataType         dataTypeB,
+                                                                void*               B,
+                                                                int64_t             ldb,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXsytrs(hipsolverDnHandle_t handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int64_t             n,
+                                                     int64_t             nrhs,
+                                                     hipDataType         dataTypeA,
+                                                     const void*         A,
+                                                     int64_t             lda,
+                                                     const int64_t*      ipiv,
+                                                     hipDataType         dataTypeB,
+                                                     void*               B,
+                                                     int64_t             ldb,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
+// trtri
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXtrtri_bufferSize(hipsolverDnHandle_t handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                hipblasDiagType_t   diag,
+                                                                int64_t             n,
+                                                                hipDataType         dataTypeA,
+                                                                void*               A,
+                                                                int64_t             lda,
+                                                                size_t*             lworkOnDevice,
+                                                                size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXtrtri(hipsolverDnHandle_t handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     hipblasDiagType_t   diag,
+                                                     int64_t             n,
+                                                     hipDataType         dataTypeA,
+                                                     void*               A,
+                                                     int64_t             lda,
+                                                     void*               workOnDevice,
+                                                     size_t              lworkOnDevice,
+                                                     void*               workOnHost,
+                                                     size_t              lworkOnHost,
+                                                     int*                info);
+
+// gesvdr
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvdr_bufferSize(hipsolverDnHandle_t handle,
+                                                                 hipsolverDnParams_t params,
+                                                                 signed char         jobu,
+                                                                 signed char         jobv,
+                                                                 int64_t             m,
+                                                                 int64_t             n,
+                                                                 int64_t             k,
+                                                                 int64_t             p,
+                                                                 int64_t             niters,
+                                                                 hipDataType         dataTypeA,
+                                                                 const void*         A,
+                                                                 int64_t             lda,
+                                                                 hipDataType         dataTypeSrand,
+                                                                 const void*         Srand,
+                                                                 hipDataType         dataTypeUrand,
+                                                                 const void*         Urand,
+                                                                 int64_t             ldUrand,
+                                                                 hipDataType         dataTypeVrand,
+                                                                 const void*         Vrand,
+                                                                 int64_t             ldVrand,
+                                                                 hipDataType         computeType,
+                                                                 size_t*             lworkOnDevice,
+                                                                 size_t*             lworkOnHost);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXgesvdr(hipsolverDnHandle_t handle,
+                                                      hipsolverDnParams_t params,
+                                                      signed char         jobu,
+                                                      signed char         jobv,
+                                                      int64_t             m,
+                                                      int64_t             n,
+                                                      int64_t             k,
+                                                      int64_t             p,
+                                                      int64_t             niters,
+                                                      hipDataType         dataTypeA,
+                                                      void*               A,
+                                                      int64_t             lda,
+                                                      hipDataType         dataTypeSrand,
+                                                      void*               Srand,
+                                                      hipDataType         dataTypeUrand,
+                                                      void*               Urand,
+                                                      int64_t             ldUrand,
+                                                      hipDataType         dataTypeVrand,
+                                                      void*               Vrand,
+                                                      int64_t             ldVrand,
+                                                      hipDataType         computeType,
+                                                      void*               workOnDevice,
+                                                      size_t              lworkOnDevice,
+                                                      void*               workOnHost,
+                                                      size_t              lworkOnHost,
+                                                      int*                info);
+
 #ifdef __cplusplus
 }
 #endif
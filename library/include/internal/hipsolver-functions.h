@@ -33,6 +33,69 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetDeterministicMode(hipsolverHandle
 HIPSOLVER_EXPORT hipsolverStatus_t
     hipsolverGetDeterministicMode(hipsolverHandle_t handle, hipsolverDeterministicMode_t* mode);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetWorkspaceCacheInfo(hipsolverHandle_t handle,
+                                                                  size_t*           hits,
+                                                                  size_t*           misses);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetMemoryPoolInfo(hipsolverHandle_t          handle,
+                                                              hipsolverMemoryPoolInfo_t* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverTrimMemoryPool(hipsolverHandle_t handle,
+                                                           size_t            max_cached_bytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetMemoryPoolLimit(hipsolverHandle_t handle,
+                                                               size_t            max_cached_bytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetMemoryPoolLimit(hipsolverHandle_t handle,
+                                                               size_t*           max_cached_bytes);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t             handle,
+                                                             const hipsolverWorkspaceOp_t* ops,
+                                                             int                           count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetHandleStatistics(hipsolverHandle_t            handle,
+                                                                hipsolverHandleStatistics_t* stats);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetHandleCallCounts(hipsolverHandle_t handle,
+                                                                int               max_routines,
+                                                                const char**      names,
+                                                                size_t*           counts,
+                                                                int*              num_routines);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverResetHandleStatistics(hipsolverHandle_t handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolCreate(
+    hipsolverHandlePool_t* pool, int num_handles, size_t workspace_budget);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolDestroy(hipsolverHandlePool_t pool);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolAcquire(hipsolverHandlePool_t pool,
+                                                              hipsolverHandle_t*    handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolRelease(hipsolverHandlePool_t pool,
+                                                              hipsolverHandle_t     handle);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverHandlePoolGetInfo(hipsolverHandlePool_t      pool,
+                                                              hipsolverHandlePoolInfo_t* info);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetRefinementMaxIters(hipsolverHandle_t handle,
+                                                                  int               max_iters);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetRefinementMaxIters(hipsolverHandle_t handle,
+                                                                  int*              max_iters);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetBatchStreams(hipsolverHandle_t handle,
+                                                            int               num_streams);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetBatchStreams(hipsolverHandle_t handle,
+                                                            int*              num_streams);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSetAutotuneMode(hipsolverHandle_t       handle,
+                                                            hipsolverAutotuneMode_t mode);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverGetAutotuneMode(hipsolverHandle_t        handle,
+                                                            hipsolverAutotuneMode_t* mode);
+
 // gesvdj params
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateGesvdjInfo(hipsolverGesvdjInfo_t* info);
 
@@ -55,6 +118,25 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetSweeps(hipsolverHandle_t
                                                              hipsolverGesvdjInfo_t info,
                                                              int*                  executed_sweeps);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetResidualAsync(
+    hipsolverHandle_t handle, hipsolverGesvdjInfo_t info, double* residual);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetSweepsAsync(
+    hipsolverHandle_t handle, hipsolverGesvdjInfo_t info, int* executed_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetResidualBatched(
+    hipsolverHandle_t handle, hipsolverGesvdjInfo_t info, double* residual, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXgesvdjGetSweepsBatched(
+    hipsolverHandle_t handle, hipsolverGesvdjInfo_t info, int* executed_sweeps, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverXgesvdjGetUnconverged(hipsolverHandle_t     handle,
+                                   hipsolverGesvdjInfo_t info,
+                                   int*                  indices,
+                                   int*                  num_indices,
+                                   int                   batch_count);
+
 // syevj params
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCreateSyevjInfo(hipsolverSyevjInfo_t* info);
 
@@ -77,6 +159,24 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetSweeps(hipsolverHandle_t
                                                             hipsolverSyevjInfo_t info,
                                                             int*                 executed_sweeps);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetResidualAsync(
+    hipsolverHandle_t handle, hipsolverSyevjInfo_t info, double* residual);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetSweepsAsync(
+    hipsolverHandle_t handle, hipsolverSyevjInfo_t info, int* executed_sweeps);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetResidualBatched(
+    hipsolverHandle_t handle, hipsolverSyevjInfo_t info, double* residual, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetSweepsBatched(
+    hipsolverHandle_t handle, hipsolverSyevjInfo_t info, int* executed_sweeps, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverXsyevjGetUnconverged(hipsolverHandle_t    handle,
+                                                                 hipsolverSyevjInfo_t info,
+                                                                 int*                 indices,
+                                                                 int*                 num_indices,
+                                                                 int                  batch_count);
+
 // orgbr/ungbr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbr_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverSideMode_t side,
@@ -166,6 +266,94 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungbr(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 float*              tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgbrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 double*             tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungbrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 hipFloatComplex*    tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungbrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverSideMode_t side,
+                                                                 int                 m,
+                                                                 int                 n,
+                                                                 int                 k,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 hipDoubleComplex*   tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgbrExt(hipsolverHandle_t   handle,
+                                                      hipsolverSideMode_t side,
+                                                      int                 m,
+                                                      int                 n,
+                                                      int                 k,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              tau,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgbrExt(hipsolverHandle_t   handle,
+                                                      hipsolverSideMode_t side,
+                                                      int                 m,
+                                                      int                 n,
+                                                      int                 k,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             tau,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungbrExt(hipsolverHandle_t   handle,
+                                                      hipsolverSideMode_t side,
+                                                      int                 m,
+                                                      int                 n,
+                                                      int                 k,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    tau,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungbrExt(hipsolverHandle_t   handle,
+                                                      hipsolverSideMode_t side,
+                                                      int                 m,
+                                                      int                 n,
+                                                      int                 k,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   tau,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
 // orgqr/ungqr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqr_bufferSize(
     hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, int* lwork);
@@ -235,6 +423,74 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungqr(hipsolverHandle_t handle,
                                                    int               lwork,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqrExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, float* A, int lda, float* tau, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgqrExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, int k, double* A, int lda, double* tau, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungqrExt_bufferSize(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 hipFloatComplex*  A,
+                                                                 int               lda,
+                                                                 hipFloatComplex*  tau,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungqrExt_bufferSize(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 int               k,
+                                                                 hipDoubleComplex* A,
+                                                                 int               lda,
+                                                                 hipDoubleComplex* tau,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgqrExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      int               k,
+                                                      float*            A,
+                                                      int               lda,
+                                                      float*            tau,
+                                                      float*            work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgqrExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      int               k,
+                                                      double*           A,
+                                                      int               lda,
+                                                      double*           tau,
+                                                      double*           work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungqrExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      int               k,
+                                                      hipFloatComplex*  A,
+                                                      int               lda,
+                                                      hipFloatComplex*  tau,
+                                                      hipFloatComplex*  work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungqrExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      int               k,
+                                                      hipDoubleComplex* A,
+                                                      int               lda,
+                                                      hipDoubleComplex* tau,
+                                                      hipDoubleComplex* work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
 // orgtr/ungtr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtr_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverFillMode_t uplo,
@@ -308,6 +564,78 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungtr(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 float*              tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgtrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 double*             tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungtrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 hipFloatComplex*    tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungtrExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 hipDoubleComplex*   tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSorgtrExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              tau,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDorgtrExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             tau,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCungtrExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    tau,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZungtrExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   tau,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
 // ormqr/unmqr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqr_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverSideMode_t  side,
@@ -421,6 +749,118 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmqr(hipsolverHandle_t    handle,
                                                    int                  lwork,
                                                    int*                 devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 float*               tau,
+                                                                 float*               C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDormqrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 double*              tau,
+                                                                 double*              C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunmqrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 hipFloatComplex*     A,
+                                                                 int                  lda,
+                                                                 hipFloatComplex*     tau,
+                                                                 hipFloatComplex*     C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmqrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 int                  k,
+                                                                 hipDoubleComplex*    A,
+                                                                 int                  lda,
+                                                                 hipDoubleComplex*    tau,
+                                                                 hipDoubleComplex*    C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormqrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      float*               A,
+                                                      int                  lda,
+                                                      float*               tau,
+                                                      float*               C,
+                                                      int                  ldc,
+                                                      float*               work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDormqrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      double*              A,
+                                                      int                  lda,
+                                                      double*              tau,
+                                                      double*              C,
+                                                      int                  ldc,
+                                                      double*              work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunmqrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      hipFloatComplex*     A,
+                                                      int                  lda,
+                                                      hipFloatComplex*     tau,
+                                                      hipFloatComplex*     C,
+                                                      int                  ldc,
+                                                      hipFloatComplex*     work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmqrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      int                  k,
+                                                      hipDoubleComplex*    A,
+                                                      int                  lda,
+                                                      hipDoubleComplex*    tau,
+                                                      hipDoubleComplex*    C,
+                                                      int                  ldc,
+                                                      hipDoubleComplex*    work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
 // ormtr/unmtr
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormtr_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverSideMode_t  side,
@@ -534,6 +974,118 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmtr(hipsolverHandle_t    handle,
                                                    int                  lwork,
                                                    int*                 devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormtrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 float*               tau,
+                                                                 float*               C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDormtrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 double*              tau,
+                                                                 double*              C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunmtrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 hipFloatComplex*     A,
+                                                                 int                  lda,
+                                                                 hipFloatComplex*     tau,
+                                                                 hipFloatComplex*     C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmtrExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverSideMode_t  side,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  m,
+                                                                 int                  n,
+                                                                 hipDoubleComplex*    A,
+                                                                 int                  lda,
+                                                                 hipDoubleComplex*    tau,
+                                                                 hipDoubleComplex*    C,
+                                                                 int                  ldc,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSormtrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverFillMode_t  uplo,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      float*               A,
+                                                      int                  lda,
+                                                      float*               tau,
+                                                      float*               C,
+                                                      int                  ldc,
+                                                      float*               work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDormtrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverFillMode_t  uplo,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      double*              A,
+                                                      int                  lda,
+                                                      double*              tau,
+                                                      double*              C,
+                                                      int                  ldc,
+                                                      double*              work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCunmtrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverFillMode_t  uplo,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      hipFloatComplex*     A,
+                                                      int                  lda,
+                                                      hipFloatComplex*     tau,
+                                                      hipFloatComplex*     C,
+                                                      int                  ldc,
+                                                      hipFloatComplex*     work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZunmtrExt(hipsolverHandle_t    handle,
+                                                      hipsolverSideMode_t  side,
+                                                      hipsolverFillMode_t  uplo,
+                                                      hipsolverOperation_t trans,
+                                                      int                  m,
+                                                      int                  n,
+                                                      hipDoubleComplex*    A,
+                                                      int                  lda,
+                                                      hipDoubleComplex*    tau,
+                                                      hipDoubleComplex*    C,
+                                                      int                  ldc,
+                                                      hipDoubleComplex*    work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
 // gebrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrd_bufferSize(hipsolverHandle_t handle,
                                                               int               m,
@@ -607,6 +1159,78 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrd(hipsolverHandle_t handle,
                                                    int               lwork,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrdExt_bufferSize(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgebrdExt_bufferSize(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgebrdExt_bufferSize(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrdExt_bufferSize(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgebrdExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      float*            A,
+                                                      int               lda,
+                                                      float*            D,
+                                                      float*            E,
+                                                      float*            tauq,
+                                                      float*            taup,
+                                                      float*            work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgebrdExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      double*           A,
+                                                      int               lda,
+                                                      double*           D,
+                                                      double*           E,
+                                                      double*           tauq,
+                                                      double*           taup,
+                                                      double*           work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgebrdExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      hipFloatComplex*  A,
+                                                      int               lda,
+                                                      float*            D,
+                                                      float*            E,
+                                                      hipFloatComplex*  tauq,
+                                                      hipFloatComplex*  taup,
+                                                      hipFloatComplex*  work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgebrdExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      hipDoubleComplex* A,
+                                                      int               lda,
+                                                      double*           D,
+                                                      double*           E,
+                                                      hipDoubleComplex* tauq,
+                                                      hipDoubleComplex* taup,
+                                                      hipDoubleComplex* work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
 // gels
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgels_bufferSize(hipsolverHandle_t handle,
                                                               int               m,
@@ -656,6 +1280,54 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels_bufferSize(hipsolverHandle_t
                                                               int               ldx,
                                                               size_t*           lwork);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgels_bufferSize(hipsolverHandle_t handle,
+                                                              int               m,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgels(hipsolverHandle_t handle,
                                                    int               m,
                                                    int               n,
@@ -716,6 +1388,66 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgels(hipsolverHandle_t handle,
                                                    int*              niters,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgels(hipsolverHandle_t handle,
+                                                   int               m,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
 // geqrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
@@ -769,6 +1501,58 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrf(hipsolverHandle_t handle,
                                                    int               lwork,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgeqrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      float*            A,
+                                                      int               lda,
+                                                      float*            tau,
+                                                      float*            work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgeqrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      double*           A,
+                                                      int               lda,
+                                                      double*           tau,
+                                                      double*           work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgeqrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      hipFloatComplex*  A,
+                                                      int               lda,
+                                                      hipFloatComplex*  tau,
+                                                      hipFloatComplex*  work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgeqrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      hipDoubleComplex* A,
+                                                      int               lda,
+                                                      hipDoubleComplex* tau,
+                                                      hipDoubleComplex* work,
+                                                      size_t            lwork,
+                                                      int*              devInfo);
+
 // gesv
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv_bufferSize(hipsolverHandle_t handle,
                                                               int               n,
@@ -818,6 +1602,54 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgesv_bufferSize(hipsolverHandle_t
                                                               int               ldx,
                                                               size_t*           lwork);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              double*           A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              double*           B,
+                                                              int               ldb,
+                                                              double*           X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgesv_bufferSize(hipsolverHandle_t handle,
+                                                              int               n,
+                                                              int               nrhs,
+                                                              hipDoubleComplex* A,
+                                                              int               lda,
+                                                              int*              devIpiv,
+                                                              hipDoubleComplex* B,
+                                                              int               ldb,
+                                                              hipDoubleComplex* X,
+                                                              int               ldx,
+                                                              size_t*           lwork);
+
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSSgesv(hipsolverHandle_t handle,
                                                    int               n,
                                                    int               nrhs,
@@ -878,6 +1710,66 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZZgesv(hipsolverHandle_t handle,
                                                    int*              niters,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDSgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDHgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   double*           A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   double*           B,
+                                                   int               ldb,
+                                                   double*           X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZCgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZKgesv(hipsolverHandle_t handle,
+                                                   int               n,
+                                                   int               nrhs,
+                                                   hipDoubleComplex* A,
+                                                   int               lda,
+                                                   int*              devIpiv,
+                                                   hipDoubleComplex* B,
+                                                   int               ldb,
+                                                   hipDoubleComplex* X,
+                                                   int               ldx,
+                                                   void*             work,
+                                                   size_t            lwork,
+                                                   int*              niters,
+                                                   int*              devInfo);
+
 // gesvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvd_bufferSize(
     hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, int* lwork);
@@ -959,6 +1851,86 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvd(hipsolverHandle_t handle,
                                                    double*           rwork,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdExt_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdExt_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdExt_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdExt_bufferSize(
+    hipsolverHandle_t handle, signed char jobu, signed char jobv, int m, int n, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdExt(hipsolverHandle_t handle,
+                                                      signed char       jobu,
+                                                      signed char       jobv,
+                                                      int               m,
+                                                      int               n,
+                                                      float*            A,
+                                                      int               lda,
+                                                      float*            S,
+                                                      float*            U,
+                                                      int               ldu,
+                                                      float*            V,
+                                                      int               ldv,
+                                                      float*            work,
+                                                      size_t            lwork,
+                                                      float*            rwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdExt(hipsolverHandle_t handle,
+                                                      signed char       jobu,
+                                                      signed char       jobv,
+                                                      int               m,
+                                                      int               n,
+                                                      double*           A,
+                                                      int               lda,
+                                                      double*           S,
+                                                      double*           U,
+                                                      int               ldu,
+                                                      double*           V,
+                                                      int               ldv,
+                                                      double*           work,
+                                                      size_t            lwork,
+                                                      double*           rwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdExt(hipsolverHandle_t handle,
+                                                      signed char       jobu,
+                                                      signed char       jobv,
+                                                      int               m,
+                                                      int               n,
+                                                      hipFloatComplex*  A,
+                                                      int               lda,
+                                                      float*            S,
+                                                      hipFloatComplex*  U,
+                                                      int               ldu,
+                                                      hipFloatComplex*  V,
+                                                      int               ldv,
+                                                      hipFloatComplex*  work,
+                                                      size_t            lwork,
+                                                      float*            rwork,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdExt(hipsolverHandle_t handle,
+                                                      signed char       jobu,
+                                                      signed char       jobv,
+                                                      int               m,
+                                                      int               n,
+                                                      hipDoubleComplex* A,
+                                                      int               lda,
+                                                      double*           S,
+                                                      hipDoubleComplex* U,
+                                                      int               ldu,
+                                                      hipDoubleComplex* V,
+                                                      int               ldv,
+                                                      hipDoubleComplex* work,
+                                                      size_t            lwork,
+                                                      double*           rwork,
+                                                      int*              devInfo);
+
 // gesvdj
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdj_bufferSize(hipsolverHandle_t     handle,
                                                                hipsolverEigMode_t    jobz,
@@ -1088,6 +2060,134 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdj(hipsolverHandle_t     handle
                                                     int*                  devInfo,
                                                     hipsolverGesvdjInfo_t params);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdjExt_bufferSize(hipsolverHandle_t     handle,
+                                                                  hipsolverEigMode_t    jobz,
+                                                                  int                   econ,
+                                                                  int                   m,
+                                                                  int                   n,
+                                                                  const float*          A,
+                                                                  int                   lda,
+                                                                  const float*          S,
+                                                                  const float*          U,
+                                                                  int                   ldu,
+                                                                  const float*          V,
+                                                                  int                   ldv,
+                                                                  size_t*               lwork,
+                                                                  hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdjExt_bufferSize(hipsolverHandle_t     handle,
+                                                                  hipsolverEigMode_t    jobz,
+                                                                  int                   econ,
+                                                                  int                   m,
+                                                                  int                   n,
+                                                                  const double*         A,
+                                                                  int                   lda,
+                                                                  const double*         S,
+                                                                  const double*         U,
+                                                                  int                   ldu,
+                                                                  const double*         V,
+                                                                  int                   ldv,
+                                                                  size_t*               lwork,
+                                                                  hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdjExt_bufferSize(hipsolverHandle_t      handle,
+                                                                  hipsolverEigMode_t     jobz,
+                                                                  int                    econ,
+                                                                  int                    m,
+                                                                  int                    n,
+                                                                  const hipFloatComplex* A,
+                                                                  int                    lda,
+                                                                  const float*           S,
+                                                                  const hipFloatComplex* U,
+                                                                  int                    ldu,
+                                                                  const hipFloatComplex* V,
+                                                                  int                    ldv,
+                                                                  size_t*                lwork,
+                                                                  hipsolverGesvdjInfo_t  params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdjExt_bufferSize(hipsolverHandle_t       handle,
+                                                                  hipsolverEigMode_t      jobz,
+                                                                  int                     econ,
+                                                                  int                     m,
+                                                                  int                     n,
+                                                                  const hipDoubleComplex* A,
+                                                                  int                     lda,
+                                                                  const double*           S,
+                                                                  const hipDoubleComplex* U,
+                                                                  int                     ldu,
+                                                                  const hipDoubleComplex* V,
+                                                                  int                     ldv,
+                                                                  size_t*                 lwork,
+                                                                  hipsolverGesvdjInfo_t   params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdjExt(hipsolverHandle_t     handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   econ,
+                                                       int                   m,
+                                                       int                   n,
+                                                       float*                A,
+                                                       int                   lda,
+                                                       float*                S,
+                                                       float*                U,
+                                                       int                   ldu,
+                                                       float*                V,
+                                                       int                   ldv,
+                                                       float*                work,
+                                                       size_t                lwork,
+                                                       int*                  devInfo,
+                                                       hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdjExt(hipsolverHandle_t     handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   econ,
+                                                       int                   m,
+                                                       int                   n,
+                                                       double*               A,
+                                                       int                   lda,
+                                                       double*               S,
+                                                       double*               U,
+                                                       int                   ldu,
+                                                       double*               V,
+                                                       int                   ldv,
+                                                       double*               work,
+                                                       size_t                lwork,
+                                                       int*                  devInfo,
+                                                       hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdjExt(hipsolverHandle_t     handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   econ,
+                                                       int                   m,
+                                                       int                   n,
+                                                       hipFloatComplex*      A,
+                                                       int                   lda,
+                                                       float*                S,
+                                                       hipFloatComplex*      U,
+                                                       int                   ldu,
+                                                       hipFloatComplex*      V,
+                                                       int                   ldv,
+                                                       hipFloatComplex*      work,
+                                                       size_t                lwork,
+                                                       int*                  devInfo,
+                                                       hipsolverGesvdjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdjExt(hipsolverHandle_t     handle,
+                                                       hipsolverEigMode_t    jobz,
+                                                       int                   econ,
+                                                       int                   m,
+                                                       int                   n,
+                                                       hipDoubleComplex*     A,
+                                                       int                   lda,
+                                                       double*               S,
+                                                       hipDoubleComplex*     U,
+                                                       int                   ldu,
+                                                       hipDoubleComplex*     V,
+                                                       int                   ldv,
+                                                       hipDoubleComplex*     work,
+                                                       size_t                lwork,
+                                                       int*                  devInfo,
+                                                       hipsolverGesvdjInfo_t params);
+
 // gesvdj_batched
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdjBatched_bufferSize(hipsolverHandle_t     handle,
                                                                       hipsolverEigMode_t    jobz,
@@ -1217,21 +2317,466 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdjBatched(hipsolverHandle_t
                                                            hipsolverGesvdjInfo_t params,
                                                            int                   batch_count);
 
-// getrf
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdjBatchedExt_bufferSize(hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          const float*          A,
+                                          int                   lda,
+                                          const float*          S,
+                                          const float*          U,
+                                          int                   ldu,
+                                          const float*          V,
+                                          int                   ldv,
+                                          size_t*               lwork,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdjBatchedExt_bufferSize(hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          const double*         A,
+                                          int                   lda,
+                                          const double*         S,
+                                          const double*         U,
+                                          int                   ldu,
+                                          const double*         V,
+                                          int                   ldv,
+                                          size_t*               lwork,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdjBatchedExt_bufferSize(hipsolverHandle_t      handle,
+                                          hipsolverEigMode_t     jobz,
+                                          int                    m,
+                                          int                    n,
+                                          const hipFloatComplex* A,
+                                          int                    lda,
+                                          const float*           S,
+                                          const hipFloatComplex* U,
+                                          int                    ldu,
+                                          const hipFloatComplex* V,
+                                          int                    ldv,
+                                          size_t*                lwork,
+                                          hipsolverGesvdjInfo_t  params,
+                                          int                    batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf_bufferSize(
-    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdjBatchedExt_bufferSize(hipsolverHandle_t       handle,
+                                          hipsolverEigMode_t      jobz,
+                                          int                     m,
+                                          int                     n,
+                                          const hipDoubleComplex* A,
+                                          int                     lda,
+                                          const double*           S,
+                                          const hipDoubleComplex* U,
+                                          int                     ldu,
+                                          const hipDoubleComplex* V,
+                                          int                     ldv,
+                                          size_t*                 lwork,
+                                          hipsolverGesvdjInfo_t   params,
+                                          int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdjBatchedExt(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              float*                A,
+                                                              int                   lda,
+                                                              float*                S,
+                                                              float*                U,
+                                                              int                   ldu,
+                                                              float*                V,
+                                                              int                   ldv,
+                                                              float*                work,
+                                                              size_t                lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdjBatchedExt(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              double*               A,
+                                                              int                   lda,
+                                                              double*               S,
+                                                              double*               U,
+                                                              int                   ldu,
+                                                              double*               V,
+                                                              int                   ldv,
+                                                              double*               work,
+                                                              size_t                lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdjBatchedExt(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              hipFloatComplex*      A,
+                                                              int                   lda,
+                                                              float*                S,
+                                                              hipFloatComplex*      U,
+                                                              int                   ldu,
+                                                              hipFloatComplex*      V,
+                                                              int                   ldv,
+                                                              hipFloatComplex*      work,
+                                                              size_t                lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdjBatchedExt(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              hipDoubleComplex*     A,
+                                                              int                   lda,
+                                                              double*               S,
+                                                              hipDoubleComplex*     U,
+                                                              int                   ldu,
+                                                              hipDoubleComplex*     V,
+                                                              int                   ldv,
+                                                              hipDoubleComplex*     work,
+                                                              size_t                lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+// gesvdj_ptr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdjPtrBatched_bufferSize(hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          float*                A[],
+                                          int                   lda,
+                                          const float*          S,
+                                          int                   strideS,
+                                          const float*          U,
+                                          int                   ldu,
+                                          int                   strideU,
+                                          const float*          V,
+                                          int                   ldv,
+                                          int                   strideV,
+                                          int*                  lwork,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   batch_count);
 
-HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
-                                                   int               m,
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdjPtrBatched_bufferSize(hipsolverHandle_t     handle,
+                                          hipsolverEigMode_t    jobz,
+                                          int                   m,
+                                          int                   n,
+                                          double*               A[],
+                                          int                   lda,
+                                          const double*         S,
+                                          int                   strideS,
+                                          const double*         U,
+                                          int                   ldu,
+                                          int                   strideU,
+                                          const double*         V,
+                                          int                   ldv,
+                                          int                   strideV,
+                                          int*                  lwork,
+                                          hipsolverGesvdjInfo_t params,
+                                          int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdjPtrBatched_bufferSize(hipsolverHandle_t      handle,
+                                          hipsolverEigMode_t     jobz,
+                                          int                    m,
+                                          int                    n,
+                                          hipFloatComplex*       A[],
+                                          int                    lda,
+                                          const float*           S,
+                                          int                    strideS,
+                                          const hipFloatComplex* U,
+                                          int                    ldu,
+                                          int                    strideU,
+                                          const hipFloatComplex* V,
+                                          int                    ldv,
+                                          int                    strideV,
+                                          int*                   lwork,
+                                          hipsolverGesvdjInfo_t  params,
+                                          int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdjPtrBatched_bufferSize(hipsolverHandle_t       handle,
+                                          hipsolverEigMode_t      jobz,
+                                          int                     m,
+                                          int                     n,
+                                          hipDoubleComplex*       A[],
+                                          int                     lda,
+                                          const double*           S,
+                                          int                     strideS,
+                                          const hipDoubleComplex* U,
+                                          int                     ldu,
+                                          int                     strideU,
+                                          const hipDoubleComplex* V,
+                                          int                     ldv,
+                                          int                     strideV,
+                                          int*                    lwork,
+                                          hipsolverGesvdjInfo_t   params,
+                                          int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdjPtrBatched(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              float*                A[],
+                                                              int                   lda,
+                                                              float*                S,
+                                                              int                   strideS,
+                                                              float*                U,
+                                                              int                   ldu,
+                                                              int                   strideU,
+                                                              float*                V,
+                                                              int                   ldv,
+                                                              int                   strideV,
+                                                              float*                work,
+                                                              int                   lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdjPtrBatched(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              double*               A[],
+                                                              int                   lda,
+                                                              double*               S,
+                                                              int                   strideS,
+                                                              double*               U,
+                                                              int                   ldu,
+                                                              int                   strideU,
+                                                              double*               V,
+                                                              int                   ldv,
+                                                              int                   strideV,
+                                                              double*               work,
+                                                              int                   lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdjPtrBatched(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              hipFloatComplex*      A[],
+                                                              int                   lda,
+                                                              float*                S,
+                                                              int                   strideS,
+                                                              hipFloatComplex*      U,
+                                                              int                   ldu,
+                                                              int                   strideU,
+                                                              hipFloatComplex*      V,
+                                                              int                   ldv,
+                                                              int                   strideV,
+                                                              hipFloatComplex*      work,
+                                                              int                   lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdjPtrBatched(hipsolverHandle_t     handle,
+                                                              hipsolverEigMode_t    jobz,
+                                                              int                   m,
+                                                              int                   n,
+                                                              hipDoubleComplex*     A[],
+                                                              int                   lda,
+                                                              double*               S,
+                                                              int                   strideS,
+                                                              hipDoubleComplex*     U,
+                                                              int                   ldu,
+                                                              int                   strideU,
+                                                              hipDoubleComplex*     V,
+                                                              int                   ldv,
+                                                              int                   strideV,
+                                                              hipDoubleComplex*     work,
+                                                              int                   lwork,
+                                                              int*                  devInfo,
+                                                              hipsolverGesvdjInfo_t params,
+                                                              int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgesvdjPtrBatchedExt_bufferSize(hipsolverHandle_t     handle,
+                                             hipsolverEigMode_t    jobz,
+                                             int                   m,
+                                             int                   n,
+                                             float*                A[],
+                                             int                   lda,
+                                             const float*          S,
+                                             int                   strideS,
+                                             const float*          U,
+                                             int                   ldu,
+                                             int                   strideU,
+                                             const float*          V,
+                                             int                   ldv,
+                                             int                   strideV,
+                                             size_t*               lwork,
+                                             hipsolverGesvdjInfo_t params,
+                                             int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgesvdjPtrBatchedExt_bufferSize(hipsolverHandle_t     handle,
+                                             hipsolverEigMode_t    jobz,
+                                             int                   m,
+                                             int                   n,
+                                             double*               A[],
+                                             int                   lda,
+                                             const double*         S,
+                                             int                   strideS,
+                                             const double*         U,
+                                             int                   ldu,
+                                             int                   strideU,
+                                             const double*         V,
+                                             int                   ldv,
+                                             int                   strideV,
+                                             size_t*               lwork,
+                                             hipsolverGesvdjInfo_t params,
+                                             int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgesvdjPtrBatchedExt_bufferSize(hipsolverHandle_t      handle,
+                                             hipsolverEigMode_t     jobz,
+                                             int                    m,
+                                             int                    n,
+                                             hipFloatComplex*       A[],
+                                             int                    lda,
+                                             const float*           S,
+                                             int                    strideS,
+                                             const hipFloatComplex* U,
+                                             int                    ldu,
+                                             int                    strideU,
+                                             const hipFloatComplex* V,
+                                             int                    ldv,
+                                             int                    strideV,
+                                             size_t*                lwork,
+                                             hipsolverGesvdjInfo_t  params,
+                                             int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgesvdjPtrBatchedExt_bufferSize(hipsolverHandle_t       handle,
+                                             hipsolverEigMode_t      jobz,
+                                             int                     m,
+                                             int                     n,
+                                             hipDoubleComplex*       A[],
+                                             int                     lda,
+                                             const double*           S,
+                                             int                     strideS,
+                                             const hipDoubleComplex* U,
+                                             int                     ldu,
+                                             int                     strideU,
+                                             const hipDoubleComplex* V,
+                                             int                     ldv,
+                                             int                     strideV,
+                                             size_t*                 lwork,
+                                             hipsolverGesvdjInfo_t   params,
+                                             int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgesvdjPtrBatchedExt(hipsolverHandle_t     handle,
+                                                                 hipsolverEigMode_t    jobz,
+                                                                 int                   m,
+                                                                 int                   n,
+                                                                 float*                A[],
+                                                                 int                   lda,
+                                                                 float*                S,
+                                                                 int                   strideS,
+                                                                 float*                U,
+                                                                 int                   ldu,
+                                                                 int                   strideU,
+                                                                 float*                V,
+                                                                 int                   ldv,
+                                                                 int                   strideV,
+                                                                 float*                work,
+                                                                 size_t                lwork,
+                                                                 int*                  devInfo,
+                                                                 hipsolverGesvdjInfo_t params,
+                                                                 int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgesvdjPtrBatchedExt(hipsolverHandle_t     handle,
+                                                                 hipsolverEigMode_t    jobz,
+                                                                 int                   m,
+                                                                 int                   n,
+                                                                 double*               A[],
+                                                                 int                   lda,
+                                                                 double*               S,
+                                                                 int                   strideS,
+                                                                 double*               U,
+                                                                 int                   ldu,
+                                                                 int                   strideU,
+                                                                 double*               V,
+                                                                 int                   ldv,
+                                                                 int                   strideV,
+                                                                 double*               work,
+                                                                 size_t                lwork,
+                                                                 int*                  devInfo,
+                                                                 hipsolverGesvdjInfo_t params,
+                                                                 int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgesvdjPtrBatchedExt(hipsolverHandle_t     handle,
+                                                                 hipsolverEigMode_t    jobz,
+                                                                 int                   m,
+                                                                 int                   n,
+                                                                 hipFloatComplex*      A[],
+                                                                 int                   lda,
+                                                                 float*                S,
+                                                                 int                   strideS,
+                                                                 hipFloatComplex*      U,
+                                                                 int                   ldu,
+                                                                 int                   strideU,
+                                                                 hipFloatComplex*      V,
+                                                                 int                   ldv,
+                                                                 int                   strideV,
+                                                                 hipFloatComplex*      work,
+                                                                 size_t                lwork,
+                                                                 int*                  devInfo,
+                                                                 hipsolverGesvdjInfo_t params,
+                                                                 int                   batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgesvdjPtrBatchedExt(hipsolverHandle_t     handle,
+                                                                 hipsolverEigMode_t    jobz,
+                                                                 int                   m,
+                                                                 int                   n,
+                                                                 hipDoubleComplex*     A[],
+                                                                 int                   lda,
+                                                                 double*               S,
+                                                                 int                   strideS,
+                                                                 hipDoubleComplex*     U,
+                                                                 int                   ldu,
+                                                                 int                   strideU,
+                                                                 hipDoubleComplex*     V,
+                                                                 int                   ldv,
+                                                                 int                   strideV,
+                                                                 hipDoubleComplex*     work,
+                                                                 size_t                lwork,
+                                                                 int*                  devInfo,
+                                                                 hipsolverGesvdjInfo_t params,
+                                                                 int                   batch_count);
+
+// getrf
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, int* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrf(hipsolverHandle_t handle,
+                                                   int               m,
                                                    int               n,
                                                    float*            A,
                                                    int               lda,
@@ -1270,6 +2815,816 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrf(hipsolverHandle_t handle,
                                                    int*              devIpiv,
                                                    int*              devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipFloatComplex* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, hipDoubleComplex* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      float*            A,
+                                                      int               lda,
+                                                      float*            work,
+                                                      size_t            lwork,
+                                                      int*              devIpiv,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      double*           A,
+                                                      int               lda,
+                                                      double*           work,
+                                                      size_t            lwork,
+                                                      int*              devIpiv,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      hipFloatComplex*  A,
+                                                      int               lda,
+                                                      hipFloatComplex*  work,
+                                                      size_t            lwork,
+                                                      int*              devIpiv,
+                                                      int*              devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfExt(hipsolverHandle_t handle,
+                                                      int               m,
+                                                      int               n,
+                                                      hipDoubleComplex* A,
+                                                      int               lda,
+                                                      hipDoubleComplex* work,
+                                                      size_t            lwork,
+                                                      int*              devIpiv,
+                                                      int*              devInfo);
+
+// getrf_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatched_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A[], int lda, int* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipFloatComplex*  A[],
+                                                                     int               lda,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               m,
+                                                                     int               n,
+                                                                     hipDoubleComplex* A[],
+                                                                     int               lda,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          float*            work,
+                                                          int               lwork,
+                                                          int*              devIpiv,
+                                                          int               strideP,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          double*           work,
+                                                          int               lwork,
+                                                          int*              devIpiv,
+                                                          int               strideP,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          hipFloatComplex*  A[],
+                                                          int               lda,
+                                                          hipFloatComplex*  work,
+                                                          int               lwork,
+                                                          int*              devIpiv,
+                                                          int               strideP,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfBatched(hipsolverHandle_t handle,
+                                                          int               m,
+                                                          int               n,
+                                                          hipDoubleComplex* A[],
+                                                          int               lda,
+                                                          hipDoubleComplex* work,
+                                                          int               lwork,
+                                                          int*              devIpiv,
+                                                          int               strideP,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatchedExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, float* A[], int lda, size_t* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatchedExt_bufferSize(
+    hipsolverHandle_t handle, int m, int n, double* A[], int lda, size_t* lwork, int batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipFloatComplex*  A[],
+                                         int               lda,
+                                         size_t*           lwork,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                         int               m,
+                                         int               n,
+                                         hipDoubleComplex* A[],
+                                         int               lda,
+                                         size_t*           lwork,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfBatchedExt(hipsolverHandle_t handle,
+                                                             int               m,
+                                                             int               n,
+                                                             float*            A[],
+                                                             int               lda,
+                                                             float*            work,
+                                                             size_t            lwork,
+                                                             int*              devIpiv,
+                                                             int               strideP,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfBatchedExt(hipsolverHandle_t handle,
+                                                             int               m,
+                                                             int               n,
+                                                             double*           A[],
+                                                             int               lda,
+                                                             double*           work,
+                                                             size_t            lwork,
+                                                             int*              devIpiv,
+                                                             int               strideP,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfBatchedExt(hipsolverHandle_t handle,
+                                                             int               m,
+                                                             int               n,
+                                                             hipFloatComplex*  A[],
+                                                             int               lda,
+                                                             hipFloatComplex*  work,
+                                                             size_t            lwork,
+                                                             int*              devIpiv,
+                                                             int               strideP,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfBatchedExt(hipsolverHandle_t handle,
+                                                             int               m,
+                                                             int               n,
+                                                             hipDoubleComplex* A[],
+                                                             int               lda,
+                                                             hipDoubleComplex* work,
+                                                             size_t            lwork,
+                                                             int*              devIpiv,
+                                                             int               strideP,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+// getrf_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               m,
+                                             int               n,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipFloatComplex*  A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 hipFloatComplex*  work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfStridedBatched(hipsolverHandle_t handle,
+                                                                 int               m,
+                                                                 int               n,
+                                                                 hipDoubleComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 hipDoubleComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devIpiv,
+                                                                 int               strideP,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrfStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                int               strideA,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrfStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                int               strideA,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrfStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                hipFloatComplex*  A,
+                                                int               lda,
+                                                int               strideA,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrfStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               m,
+                                                int               n,
+                                                hipDoubleComplex* A,
+                                                int               lda,
+                                                int               strideA,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrfStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               m,
+                                                                    int               n,
+                                                                    float*            A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    float*            work,
+                                                                    size_t            lwork,
+                                                                    int*              devIpiv,
+                                                                    int               strideP,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrfStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               m,
+                                                                    int               n,
+                                                                    double*           A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    double*           work,
+                                                                    size_t            lwork,
+                                                                    int*              devIpiv,
+                                                                    int               strideP,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrfStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               m,
+                                                                    int               n,
+                                                                    hipFloatComplex*  A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    hipFloatComplex*  work,
+                                                                    size_t            lwork,
+                                                                    int*              devIpiv,
+                                                                    int               strideP,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrfStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               m,
+                                                                    int               n,
+                                                                    hipDoubleComplex* A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    hipDoubleComplex* work,
+                                                                    size_t            lwork,
+                                                                    int*              devIpiv,
+                                                                    int               strideP,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+// getri_batched
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetriBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               n,
+                                                                     float*            A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     float*            C[],
+                                                                     int               ldc,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetriBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               n,
+                                                                     double*           A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     double*           C[],
+                                                                     int               ldc,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetriBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               n,
+                                                                     hipFloatComplex*  A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     hipFloatComplex*  C[],
+                                                                     int               ldc,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetriBatched_bufferSize(hipsolverHandle_t handle,
+                                                                     int               n,
+                                                                     hipDoubleComplex* A[],
+                                                                     int               lda,
+                                                                     int*              ipiv,
+                                                                     int               strideP,
+                                                                     hipDoubleComplex* C[],
+                                                                     int               ldc,
+                                                                     int*              lwork,
+                                                                     int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetriBatched(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          float*            A[],
+                                                          int               lda,
+                                                          int*              ipiv,
+                                                          int               strideP,
+                                                          float*            C[],
+                                                          int               ldc,
+                                                          float*            work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetriBatched(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          double*           A[],
+                                                          int               lda,
+                                                          int*              ipiv,
+                                                          int               strideP,
+                                                          double*           C[],
+                                                          int               ldc,
+                                                          double*           work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetriBatched(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          hipFloatComplex*  A[],
+                                                          int               lda,
+                                                          int*              ipiv,
+                                                          int               strideP,
+                                                          hipFloatComplex*  C[],
+                                                          int               ldc,
+                                                          hipFloatComplex*  work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetriBatched(hipsolverHandle_t handle,
+                                                          int               n,
+                                                          hipDoubleComplex* A[],
+                                                          int               lda,
+                                                          int*              ipiv,
+                                                          int               strideP,
+                                                          hipDoubleComplex* C[],
+                                                          int               ldc,
+                                                          hipDoubleComplex* work,
+                                                          int               lwork,
+                                                          int*              devInfo,
+                                                          int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                         int               n,
+                                         float*            A[],
+                                         int               lda,
+                                         int*              ipiv,
+                                         int               strideP,
+                                         float*            C[],
+                                         int               ldc,
+                                         size_t*           lwork,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                         int               n,
+                                         double*           A[],
+                                         int               lda,
+                                         int*              ipiv,
+                                         int               strideP,
+                                         double*           C[],
+                                         int               ldc,
+                                         size_t*           lwork,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipFloatComplex*  A[],
+                                         int               lda,
+                                         int*              ipiv,
+                                         int               strideP,
+                                         hipFloatComplex*  C[],
+                                         int               ldc,
+                                         size_t*           lwork,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                         int               n,
+                                         hipDoubleComplex* A[],
+                                         int               lda,
+                                         int*              ipiv,
+                                         int               strideP,
+                                         hipDoubleComplex* C[],
+                                         int               ldc,
+                                         size_t*           lwork,
+                                         int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetriBatchedExt(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             float*            A[],
+                                                             int               lda,
+                                                             int*              ipiv,
+                                                             int               strideP,
+                                                             float*            C[],
+                                                             int               ldc,
+                                                             float*            work,
+                                                             size_t            lwork,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetriBatchedExt(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             double*           A[],
+                                                             int               lda,
+                                                             int*              ipiv,
+                                                             int               strideP,
+                                                             double*           C[],
+                                                             int               ldc,
+                                                             double*           work,
+                                                             size_t            lwork,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetriBatchedExt(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             hipFloatComplex*  A[],
+                                                             int               lda,
+                                                             int*              ipiv,
+                                                             int               strideP,
+                                                             hipFloatComplex*  C[],
+                                                             int               ldc,
+                                                             hipFloatComplex*  work,
+                                                             size_t            lwork,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetriBatchedExt(hipsolverHandle_t handle,
+                                                             int               n,
+                                                             hipDoubleComplex* A[],
+                                                             int               lda,
+                                                             int*              ipiv,
+                                                             int               strideP,
+                                                             hipDoubleComplex* C[],
+                                                             int               ldc,
+                                                             hipDoubleComplex* work,
+                                                             size_t            lwork,
+                                                             int*              devInfo,
+                                                             int               batch_count);
+
+// getri_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             float*            A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             float*            C,
+                                             int               ldc,
+                                             int               strideC,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             double*           A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             double*           C,
+                                             int               ldc,
+                                             int               strideC,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             hipFloatComplex*  A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             hipFloatComplex*  C,
+                                             int               ldc,
+                                             int               strideC,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriStridedBatched_bufferSize(hipsolverHandle_t handle,
+                                             int               n,
+                                             hipDoubleComplex* A,
+                                             int               lda,
+                                             int               strideA,
+                                             int*              ipiv,
+                                             int               strideP,
+                                             hipDoubleComplex* C,
+                                             int               ldc,
+                                             int               strideC,
+                                             int*              lwork,
+                                             int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetriStridedBatched(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 float*            A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 int*              ipiv,
+                                                                 int               strideP,
+                                                                 float*            C,
+                                                                 int               ldc,
+                                                                 int               strideC,
+                                                                 float*            work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetriStridedBatched(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 double*           A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 int*              ipiv,
+                                                                 int               strideP,
+                                                                 double*           C,
+                                                                 int               ldc,
+                                                                 int               strideC,
+                                                                 double*           work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetriStridedBatched(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 hipFloatComplex*  A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 int*              ipiv,
+                                                                 int               strideP,
+                                                                 hipFloatComplex*  C,
+                                                                 int               ldc,
+                                                                 int               strideC,
+                                                                 hipFloatComplex*  work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetriStridedBatched(hipsolverHandle_t handle,
+                                                                 int               n,
+                                                                 hipDoubleComplex* A,
+                                                                 int               lda,
+                                                                 int               strideA,
+                                                                 int*              ipiv,
+                                                                 int               strideP,
+                                                                 hipDoubleComplex* C,
+                                                                 int               ldc,
+                                                                 int               strideC,
+                                                                 hipDoubleComplex* work,
+                                                                 int               lwork,
+                                                                 int*              devInfo,
+                                                                 int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetriStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               n,
+                                                float*            A,
+                                                int               lda,
+                                                int               strideA,
+                                                int*              ipiv,
+                                                int               strideP,
+                                                float*            C,
+                                                int               ldc,
+                                                int               strideC,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetriStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               n,
+                                                double*           A,
+                                                int               lda,
+                                                int               strideA,
+                                                int*              ipiv,
+                                                int               strideP,
+                                                double*           C,
+                                                int               ldc,
+                                                int               strideC,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetriStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               n,
+                                                hipFloatComplex*  A,
+                                                int               lda,
+                                                int               strideA,
+                                                int*              ipiv,
+                                                int               strideP,
+                                                hipFloatComplex*  C,
+                                                int               ldc,
+                                                int               strideC,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetriStridedBatchedExt_bufferSize(hipsolverHandle_t handle,
+                                                int               n,
+                                                hipDoubleComplex* A,
+                                                int               lda,
+                                                int               strideA,
+                                                int*              ipiv,
+                                                int               strideP,
+                                                hipDoubleComplex* C,
+                                                int               ldc,
+                                                int               strideC,
+                                                size_t*           lwork,
+                                                int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetriStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    float*            A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    int*              ipiv,
+                                                                    int               strideP,
+                                                                    float*            C,
+                                                                    int               ldc,
+                                                                    int               strideC,
+                                                                    float*            work,
+                                                                    size_t            lwork,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetriStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    double*           A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    int*              ipiv,
+                                                                    int               strideP,
+                                                                    double*           C,
+                                                                    int               ldc,
+                                                                    int               strideC,
+                                                                    double*           work,
+                                                                    size_t            lwork,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetriStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    hipFloatComplex*  A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    int*              ipiv,
+                                                                    int               strideP,
+                                                                    hipFloatComplex*  C,
+                                                                    int               ldc,
+                                                                    int               strideC,
+                                                                    hipFloatComplex*  work,
+                                                                    size_t            lwork,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetriStridedBatchedExt(hipsolverHandle_t handle,
+                                                                    int               n,
+                                                                    hipDoubleComplex* A,
+                                                                    int               lda,
+                                                                    int               strideA,
+                                                                    int*              ipiv,
+                                                                    int               strideP,
+                                                                    hipDoubleComplex* C,
+                                                                    int               ldc,
+                                                                    int               strideC,
+                                                                    hipDoubleComplex* work,
+                                                                    size_t            lwork,
+                                                                    int*              devInfo,
+                                                                    int               batch_count);
+
 // getrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrs_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverOperation_t trans,
@@ -1367,6 +3722,1215 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrs(hipsolverHandle_t    handle,
                                                    int                  lwork,
                                                    int*                 devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 int*                 devIpiv,
+                                                                 float*               B,
+                                                                 int                  ldb,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 int*                 devIpiv,
+                                                                 double*              B,
+                                                                 int                  ldb,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipFloatComplex*     A,
+                                                                 int                  lda,
+                                                                 int*                 devIpiv,
+                                                                 hipFloatComplex*     B,
+                                                                 int                  ldb,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipDoubleComplex*    A,
+                                                                 int                  lda,
+                                                                 int*                 devIpiv,
+                                                                 hipDoubleComplex*    B,
+                                                                 int                  ldb,
+                                                                 size_t*              lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsExt(hipsolverHandle_t    handle,
+                                                      hipsolverOperation_t trans,
+                                                      int                  n,
+                                                      int                  nrhs,
+                                                      float*               A,
+                                                      int                  lda,
+                                                      int*                 devIpiv,
+                                                      float*               B,
+                                                      int                  ldb,
+                                                      float*               work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsExt(hipsolverHandle_t    handle,
+                                                      hipsolverOperation_t trans,
+                                                      int                  n,
+                                                      int                  nrhs,
+                                                      double*              A,
+                                                      int                  lda,
+                                                      int*                 devIpiv,
+                                                      double*              B,
+                                                      int                  ldb,
+                                                      double*              work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsExt(hipsolverHandle_t    handle,
+                                                      hipsolverOperation_t trans,
+                                                      int                  n,
+                                                      int                  nrhs,
+                                                      hipFloatComplex*     A,
+                                                      int                  lda,
+                                                      int*                 devIpiv,
+                                                      hipFloatComplex*     B,
+                                                      int                  ldb,
+                                                      hipFloatComplex*     work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsExt(hipsolverHandle_t    handle,
+                                                      hipsolverOperation_t trans,
+                                                      int                  n,
+                                                      int                  nrhs,
+                                                      hipDoubleComplex*    A,
+                                                      int                  lda,
+                                                      int*                 devIpiv,
+                                                      hipDoubleComplex*    B,
+                                                      int                  ldb,
+                                                      hipDoubleComplex*    work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo);
+
+// getrs_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      float*               A[],
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      int                  strideP,
+                                      float*               B[],
+                                      int                  ldb,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      double*              A[],
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      int                  strideP,
+                                      double*              B[],
+                                      int                  ldb,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      hipFloatComplex*     A[],
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      int                  strideP,
+                                      hipFloatComplex*     B[],
+                                      int                  ldb,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsBatched_bufferSize(hipsolverHandle_t    handle,
+                                      hipsolverOperation_t trans,
+                                      int                  n,
+                                      int                  nrhs,
+                                      hipDoubleComplex*    A[],
+                                      int                  lda,
+                                      int*                 devIpiv,
+                                      int                  strideP,
+                                      hipDoubleComplex*    B[],
+                                      int                  ldb,
+                                      int*                 lwork,
+                                      int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsBatched(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          float*               A[],
+                                                          int                  lda,
+                                                          int*                 devIpiv,
+                                                          int                  strideP,
+                                                          float*               B[],
+                                                          int                  ldb,
+                                                          float*               work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsBatched(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          double*              A[],
+                                                          int                  lda,
+                                                          int*                 devIpiv,
+                                                          int                  strideP,
+                                                          double*              B[],
+                                                          int                  ldb,
+                                                          double*              work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsBatched(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          hipFloatComplex*     A[],
+                                                          int                  lda,
+                                                          int*                 devIpiv,
+                                                          int                  strideP,
+                                                          hipFloatComplex*     B[],
+                                                          int                  ldb,
+                                                          hipFloatComplex*     work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsBatched(hipsolverHandle_t    handle,
+                                                          hipsolverOperation_t trans,
+                                                          int                  n,
+                                                          int                  nrhs,
+                                                          hipDoubleComplex*    A[],
+                                                          int                  lda,
+                                                          int*                 devIpiv,
+                                                          int                  strideP,
+                                                          hipDoubleComplex*    B[],
+                                                          int                  ldb,
+                                                          hipDoubleComplex*    work,
+                                                          int                  lwork,
+                                                          int*                 devInfo,
+                                                          int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         float*               A[],
+                                         int                  lda,
+                                         int*                 devIpiv,
+                                         int                  strideP,
+                                         float*               B[],
+                                         int                  ldb,
+                                         size_t*              lwork,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         double*              A[],
+                                         int                  lda,
+                                         int*                 devIpiv,
+                                         int                  strideP,
+                                         double*              B[],
+                                         int                  ldb,
+                                         size_t*              lwork,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipFloatComplex*     A[],
+                                         int                  lda,
+                                         int*                 devIpiv,
+                                         int                  strideP,
+                                         hipFloatComplex*     B[],
+                                         int                  ldb,
+                                         size_t*              lwork,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverOperation_t trans,
+                                         int                  n,
+                                         int                  nrhs,
+                                         hipDoubleComplex*    A[],
+                                         int                  lda,
+                                         int*                 devIpiv,
+                                         int                  strideP,
+                                         hipDoubleComplex*    B[],
+                                         int                  ldb,
+                                         size_t*              lwork,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverOperation_t trans,
+                                                             int                  n,
+                                                             int                  nrhs,
+                                                             float*               A[],
+                                                             int                  lda,
+                                                             int*                 devIpiv,
+                                                             int                  strideP,
+                                                             float*               B[],
+                                                             int                  ldb,
+                                                             float*               work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverOperation_t trans,
+                                                             int                  n,
+                                                             int                  nrhs,
+                                                             double*              A[],
+                                                             int                  lda,
+                                                             int*                 devIpiv,
+                                                             int                  strideP,
+                                                             double*              B[],
+                                                             int                  ldb,
+                                                             double*              work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverOperation_t trans,
+                                                             int                  n,
+                                                             int                  nrhs,
+                                                             hipFloatComplex*     A[],
+                                                             int                  lda,
+                                                             int*                 devIpiv,
+                                                             int                  strideP,
+                                                             hipFloatComplex*     B[],
+                                                             int                  ldb,
+                                                             hipFloatComplex*     work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverOperation_t trans,
+                                                             int                  n,
+                                                             int                  nrhs,
+                                                             hipDoubleComplex*    A[],
+                                                             int                  lda,
+                                                             int*                 devIpiv,
+                                                             int                  strideP,
+                                                             hipDoubleComplex*    B[],
+                                                             int                  ldb,
+                                                             hipDoubleComplex*    work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             int                  batch_count);
+
+// getrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             float*               A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             float*               B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             double*              A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             double*              B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipFloatComplex*     A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             hipFloatComplex*     B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatched_bufferSize(hipsolverHandle_t    handle,
+                                             hipsolverOperation_t trans,
+                                             int                  n,
+                                             int                  nrhs,
+                                             hipDoubleComplex*    A,
+                                             int                  lda,
+                                             int                  strideA,
+                                             int*                 devIpiv,
+                                             int                  strideP,
+                                             hipDoubleComplex*    B,
+                                             int                  ldb,
+                                             int                  strideB,
+                                             int*                 lwork,
+                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 float*               B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 float*               work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 double*              B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 double*              work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipFloatComplex*     A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 hipFloatComplex*     B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 hipFloatComplex*     work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZgetrsStridedBatched(hipsolverHandle_t    handle,
+                                                                 hipsolverOperation_t trans,
+                                                                 int                  n,
+                                                                 int                  nrhs,
+                                                                 hipDoubleComplex*    A,
+                                                                 int                  lda,
+                                                                 int                  strideA,
+                                                                 int*                 devIpiv,
+                                                                 int                  strideP,
+                                                                 hipDoubleComplex*    B,
+                                                                 int                  ldb,
+                                                                 int                  strideB,
+                                                                 hipDoubleComplex*    work,
+                                                                 int                  lwork,
+                                                                 int*                 devInfo,
+                                                                 int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsStridedBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                float*               A,
+                                                int                  lda,
+                                                int                  strideA,
+                                                int*                 devIpiv,
+                                                int                  strideP,
+                                                float*               B,
+                                                int                  ldb,
+                                                int                  strideB,
+                                                size_t*              lwork,
+                                                int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsStridedBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                double*              A,
+                                                int                  lda,
+                                                int                  strideA,
+                                                int*                 devIpiv,
+                                                int                  strideP,
+                                                double*              B,
+                                                int                  ldb,
+                                                int                  strideB,
+                                                size_t*              lwork,
+                                                int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsStridedBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                hipFloatComplex*     A,
+                                                int                  lda,
+                                                int                  strideA,
+                                                int*                 devIpiv,
+                                                int                  strideP,
+                                                hipFloatComplex*     B,
+                                                int                  ldb,
+                                                int                  strideB,
+                                                size_t*              lwork,
+                                                int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                                hipsolverOperation_t trans,
+                                                int                  n,
+                                                int                  nrhs,
+                                                hipDoubleComplex*    A,
+                                                int                  lda,
+                                                int                  strideA,
+                                                int*                 devIpiv,
+                                                int                  strideP,
+                                                hipDoubleComplex*    B,
+                                                int                  ldb,
+                                                int                  strideB,
+                                                size_t*              lwork,
+                                                int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSgetrsStridedBatchedExt(hipsolverHandle_t    handle,
+                                     hipsolverOperation_t trans,
+                                     int                  n,
+                                     int                  nrhs,
+                                     float*               A,
+                                     int                  lda,
+                                     int                  strideA,
+                                     int*                 devIpiv,
+                                     int                  strideP,
+                                     float*               B,
+                                     int                  ldb,
+                                     int                  strideB,
+                                     float*               work,
+                                     size_t               lwork,
+                                     int*                 devInfo,
+                                     int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDgetrsStridedBatchedExt(hipsolverHandle_t    handle,
+                                     hipsolverOperation_t trans,
+                                     int                  n,
+                                     int                  nrhs,
+                                     double*              A,
+                                     int                  lda,
+                                     int                  strideA,
+                                     int*                 devIpiv,
+                                     int                  strideP,
+                                     double*              B,
+                                     int                  ldb,
+                                     int                  strideB,
+                                     double*              work,
+                                     size_t               lwork,
+                                     int*                 devInfo,
+                                     int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCgetrsStridedBatchedExt(hipsolverHandle_t    handle,
+                                     hipsolverOperation_t trans,
+                                     int                  n,
+                                     int                  nrhs,
+                                     hipFloatComplex*     A,
+                                     int                  lda,
+                                     int                  strideA,
+                                     int*                 devIpiv,
+                                     int                  strideP,
+                                     hipFloatComplex*     B,
+                                     int                  ldb,
+                                     int                  strideB,
+                                     hipFloatComplex*     work,
+                                     size_t               lwork,
+                                     int*                 devInfo,
+                                     int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZgetrsStridedBatchedExt(hipsolverHandle_t    handle,
+                                     hipsolverOperation_t trans,
+                                     int                  n,
+                                     int                  nrhs,
+                                     hipDoubleComplex*    A,
+                                     int                  lda,
+                                     int                  strideA,
+                                     int*                 devIpiv,
+                                     int                  strideP,
+                                     hipDoubleComplex*    B,
+                                     int                  ldb,
+                                     int                  strideB,
+                                     hipDoubleComplex*    work,
+                                     size_t               lwork,
+                                     int*                 devInfo,
+                                     int                  batch_count);
+
+// posv
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             float*              A,
+                                                             int                 lda,
+                                                             float*              B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             double*             A,
+                                                             int                 lda,
+                                                             double*             B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipFloatComplex*    A,
+                                                             int                 lda,
+                                                             hipFloatComplex*    B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipDoubleComplex*   A,
+                                                             int                 lda,
+                                                             hipDoubleComplex*   B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  float*              A,
+                                                  int                 lda,
+                                                  float*              B,
+                                                  int                 ldb,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  double*             A,
+                                                  int                 lda,
+                                                  double*             B,
+                                                  int                 ldb,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  hipFloatComplex*    A,
+                                                  int                 lda,
+                                                  hipFloatComplex*    B,
+                                                  int                 ldb,
+                                                  hipFloatComplex*    work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  hipDoubleComplex*   A,
+                                                  int                 lda,
+                                                  hipDoubleComplex*   B,
+                                                  int                 ldb,
+                                                  hipDoubleComplex*   work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                float*              A,
+                                                                int                 lda,
+                                                                float*              B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                double*             A,
+                                                                int                 lda,
+                                                                double*             B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipFloatComplex*    A,
+                                                                int                 lda,
+                                                                hipFloatComplex*    B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipDoubleComplex*   A,
+                                                                int                 lda,
+                                                                hipDoubleComplex*   B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     float*              B,
+                                                     int                 ldb,
+                                                     float*              work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     double*             B,
+                                                     int                 ldb,
+                                                     double*             work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     hipFloatComplex*    A,
+                                                     int                 lda,
+                                                     hipFloatComplex*    B,
+                                                     int                 ldb,
+                                                     hipFloatComplex*    work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     hipDoubleComplex*   A,
+                                                     int                 lda,
+                                                     hipDoubleComplex*   B,
+                                                     int                 ldb,
+                                                     hipDoubleComplex*   work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+// posv_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     float*              A[],
+                                     int                 lda,
+                                     float*              B[],
+                                     int                 ldb,
+                                     int*                lwork,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     double*             A[],
+                                     int                 lda,
+                                     double*             B[],
+                                     int                 ldb,
+                                     int*                lwork,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     hipFloatComplex*    A[],
+                                     int                 lda,
+                                     hipFloatComplex*    B[],
+                                     int                 ldb,
+                                     int*                lwork,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposvBatched_bufferSize(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     hipDoubleComplex*   A[],
+                                     int                 lda,
+                                     hipDoubleComplex*   B[],
+                                     int                 ldb,
+                                     int*                lwork,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         float*              A[],
+                                                         int                 lda,
+                                                         float*              B[],
+                                                         int                 ldb,
+                                                         float*              work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         double*             A[],
+                                                         int                 lda,
+                                                         double*             B[],
+                                                         int                 ldb,
+                                                         double*             work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         hipFloatComplex*    A[],
+                                                         int                 lda,
+                                                         hipFloatComplex*    B[],
+                                                         int                 ldb,
+                                                         hipFloatComplex*    work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvBatched(hipsolverHandle_t   handle,
+                                                         hipsolverFillMode_t uplo,
+                                                         int                 n,
+                                                         int                 nrhs,
+                                                         hipDoubleComplex*   A[],
+                                                         int                 lda,
+                                                         hipDoubleComplex*   B[],
+                                                         int                 ldb,
+                                                         hipDoubleComplex*   work,
+                                                         int                 lwork,
+                                                         int*                devInfo,
+                                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSposvBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        float*              A[],
+                                        int                 lda,
+                                        float*              B[],
+                                        int                 ldb,
+                                        size_t*             lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDposvBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        double*             A[],
+                                        int                 lda,
+                                        double*             B[],
+                                        int                 ldb,
+                                        size_t*             lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCposvBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipFloatComplex*    A[],
+                                        int                 lda,
+                                        hipFloatComplex*    B[],
+                                        int                 ldb,
+                                        size_t*             lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposvBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                        hipsolverFillMode_t uplo,
+                                        int                 n,
+                                        int                 nrhs,
+                                        hipDoubleComplex*   A[],
+                                        int                 lda,
+                                        hipDoubleComplex*   B[],
+                                        int                 ldb,
+                                        size_t*             lwork,
+                                        int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvBatchedExt(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            float*              A[],
+                                                            int                 lda,
+                                                            float*              B[],
+                                                            int                 ldb,
+                                                            float*              work,
+                                                            size_t              lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvBatchedExt(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            double*             A[],
+                                                            int                 lda,
+                                                            double*             B[],
+                                                            int                 ldb,
+                                                            double*             work,
+                                                            size_t              lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvBatchedExt(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            hipFloatComplex*    A[],
+                                                            int                 lda,
+                                                            hipFloatComplex*    B[],
+                                                            int                 ldb,
+                                                            hipFloatComplex*    work,
+                                                            size_t              lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvBatchedExt(hipsolverHandle_t   handle,
+                                                            hipsolverFillMode_t uplo,
+                                                            int                 n,
+                                                            int                 nrhs,
+                                                            hipDoubleComplex*   A[],
+                                                            int                 lda,
+                                                            hipDoubleComplex*   B[],
+                                                            int                 ldb,
+                                                            hipDoubleComplex*   work,
+                                                            size_t              lwork,
+                                                            int*                devInfo,
+                                                            int                 batch_count);
+
+// posv_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            float*              A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            float*              B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            double*             A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            double*             B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipFloatComplex*    A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            hipFloatComplex*    B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipDoubleComplex*   A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            hipDoubleComplex*   B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                float*              A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                float*              B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                float*              work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                double*             A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                double*             B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                double*             work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipFloatComplex*    A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                hipFloatComplex*    B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                hipFloatComplex*    work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipDoubleComplex*   A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                hipDoubleComplex*   B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                hipDoubleComplex*   work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSposvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDposvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCposvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipFloatComplex*    A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipFloatComplex*    B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZposvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipDoubleComplex*   A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               hipDoubleComplex*   B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSposvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   float*              A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   float*              B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   float*              work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDposvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   double*             A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   double*             B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   double*             work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCposvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   hipFloatComplex*    A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   hipFloatComplex*    B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   hipFloatComplex*    work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZposvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   hipDoubleComplex*   A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   hipDoubleComplex*   B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   hipDoubleComplex*   work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
 // potrf
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrf_bufferSize(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1424,6 +4988,62 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrf(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfExt_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfExt_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
 // potrf_batched
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfBatched_bufferSize(hipsolverHandle_t   handle,
                                                                      hipsolverFillMode_t uplo,
@@ -1497,6 +5117,82 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatched(hipsolverHandle_t   ha
                                                           int*                devInfo,
                                                           int                 batch_count);
 
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrfBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrfBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrfBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrfBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrfBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             float*              A[],
+                                                             int                 lda,
+                                                             float*              work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrfBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             double*             A[],
+                                                             int                 lda,
+                                                             double*             work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrfBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             hipFloatComplex*    A[],
+                                                             int                 lda,
+                                                             hipFloatComplex*    work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrfBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             hipDoubleComplex*   A[],
+                                                             int                 lda,
+                                                             hipDoubleComplex*   work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
 // potri
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotri_bufferSize(
     hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, int* lwork);
@@ -1554,6 +5250,468 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotri(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotriExt_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, float* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotriExt_bufferSize(
+    hipsolverHandle_t handle, hipsolverFillMode_t uplo, int n, double* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotriExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotriExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotriExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotriExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotriExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotriExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+// potri_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotriBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      float*              A[],
+                                      int                 lda,
+                                      float*              C[],
+                                      int                 ldc,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotriBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      double*             A[],
+                                      int                 lda,
+                                      double*             C[],
+                                      int                 ldc,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotriBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipFloatComplex*    A[],
+                                      int                 lda,
+                                      hipFloatComplex*    C[],
+                                      int                 ldc,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotriBatched_bufferSize(hipsolverHandle_t   handle,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipDoubleComplex*   A[],
+                                      int                 lda,
+                                      hipDoubleComplex*   C[],
+                                      int                 ldc,
+                                      int*                lwork,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotriBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          float*              A[],
+                                                          int                 lda,
+                                                          float*              C[],
+                                                          int                 ldc,
+                                                          float*              work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotriBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          double*             A[],
+                                                          int                 lda,
+                                                          double*             C[],
+                                                          int                 ldc,
+                                                          double*             work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotriBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipFloatComplex*    A[],
+                                                          int                 lda,
+                                                          hipFloatComplex*    C[],
+                                                          int                 ldc,
+                                                          hipFloatComplex*    work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotriBatched(hipsolverHandle_t   handle,
+                                                          hipsolverFillMode_t uplo,
+                                                          int                 n,
+                                                          hipDoubleComplex*   A[],
+                                                          int                 lda,
+                                                          hipDoubleComplex*   C[],
+                                                          int                 ldc,
+                                                          hipDoubleComplex*   work,
+                                                          int                 lwork,
+                                                          int*                devInfo,
+                                                          int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotriBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              C[],
+                                         int                 ldc,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotriBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             C[],
+                                         int                 ldc,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotriBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    C[],
+                                         int                 ldc,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotriBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   C[],
+                                         int                 ldc,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotriBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             float*              A[],
+                                                             int                 lda,
+                                                             float*              C[],
+                                                             int                 ldc,
+                                                             float*              work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotriBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             double*             A[],
+                                                             int                 lda,
+                                                             double*             C[],
+                                                             int                 ldc,
+                                                             double*             work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotriBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             hipFloatComplex*    A[],
+                                                             int                 lda,
+                                                             hipFloatComplex*    C[],
+                                                             int                 ldc,
+                                                             hipFloatComplex*    work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotriBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             hipDoubleComplex*   A[],
+                                                             int                 lda,
+                                                             hipDoubleComplex*   C[],
+                                                             int                 ldc,
+                                                             hipDoubleComplex*   work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+// potri_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotriStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              C,
+                                             int                 ldc,
+                                             int                 strideC,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotriStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             C,
+                                             int                 ldc,
+                                             int                 strideC,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotriStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             hipFloatComplex*    C,
+                                             int                 ldc,
+                                             int                 strideC,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotriStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             hipDoubleComplex*   C,
+                                             int                 ldc,
+                                             int                 strideC,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotriStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              C,
+                                                                 int                 ldc,
+                                                                 int                 strideC,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotriStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             C,
+                                                                 int                 ldc,
+                                                                 int                 strideC,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotriStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipFloatComplex*    C,
+                                                                 int                 ldc,
+                                                                 int                 strideC,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotriStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipDoubleComplex*   C,
+                                                                 int                 ldc,
+                                                                 int                 strideC,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotriStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                float*              A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                float*              C,
+                                                int                 ldc,
+                                                int                 strideC,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotriStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                double*             A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                double*             C,
+                                                int                 ldc,
+                                                int                 strideC,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotriStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipFloatComplex*    A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                hipFloatComplex*    C,
+                                                int                 ldc,
+                                                int                 strideC,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotriStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipDoubleComplex*   A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                hipDoubleComplex*   C,
+                                                int                 ldc,
+                                                int                 strideC,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotriStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     float*              A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     float*              C,
+                                     int                 ldc,
+                                     int                 strideC,
+                                     float*              work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotriStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     double*             A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     double*             C,
+                                     int                 ldc,
+                                     int                 strideC,
+                                     double*             work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotriStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     hipFloatComplex*    A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     hipFloatComplex*    C,
+                                     int                 ldc,
+                                     int                 strideC,
+                                     hipFloatComplex*    work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotriStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     hipDoubleComplex*   A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     hipDoubleComplex*   C,
+                                     int                 ldc,
+                                     int                 strideC,
+                                     hipDoubleComplex*   work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
 // potrs
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrs_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverFillMode_t uplo,
@@ -1643,6 +5801,94 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrs(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              B,
+                                                      int                 ldb,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             B,
+                                                      int                 ldb,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    B,
+                                                      int                 ldb,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   B,
+                                                      int                 ldb,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
 // potrs_batched
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsBatched_bufferSize(hipsolverHandle_t   handle,
                                                                      hipsolverFillMode_t uplo,
@@ -1740,6 +5986,106 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsBatched(hipsolverHandle_t   ha
                                                           int*                devInfo,
                                                           int                 batch_count);
 
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSpotrsBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         float*              A[],
+                                         int                 lda,
+                                         float*              B[],
+                                         int                 ldb,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDpotrsBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         double*             A[],
+                                         int                 lda,
+                                         double*             B[],
+                                         int                 ldb,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCpotrsBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipFloatComplex*    A[],
+                                         int                 lda,
+                                         hipFloatComplex*    B[],
+                                         int                 ldb,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZpotrsBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                         hipsolverFillMode_t uplo,
+                                         int                 n,
+                                         int                 nrhs,
+                                         hipDoubleComplex*   A[],
+                                         int                 lda,
+                                         hipDoubleComplex*   B[],
+                                         int                 ldb,
+                                         size_t*             lwork,
+                                         int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSpotrsBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             float*              A[],
+                                                             int                 lda,
+                                                             float*              B[],
+                                                             int                 ldb,
+                                                             float*              work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDpotrsBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             double*             A[],
+                                                             int                 lda,
+                                                             double*             B[],
+                                                             int                 ldb,
+                                                             double*             work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCpotrsBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipFloatComplex*    A[],
+                                                             int                 lda,
+                                                             hipFloatComplex*    B[],
+                                                             int                 ldb,
+                                                             hipFloatComplex*    work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZpotrsBatchedExt(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipDoubleComplex*   A[],
+                                                             int                 lda,
+                                                             hipDoubleComplex*   B[],
+                                                             int                 ldb,
+                                                             hipDoubleComplex*   work,
+                                                             size_t              lwork,
+                                                             int*                devInfo,
+                                                             int                 batch_count);
+
 // syevd/heevd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverEigMode_t  jobz,
@@ -1821,6 +6167,307 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 double*             D,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 double*             D,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              D,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             D,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      float*              D,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      double*             D,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+// syevd_strided_batched/heevd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              W,
+                                                                 int                 strideW,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             W,
+                                                                 int                 strideW,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              W,
+                                                                 int                 strideW,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             W,
+                                                                 int                 strideW,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                float*              A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                float*              W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                double*             A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                double*             W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipFloatComplex*    A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                float*              W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipDoubleComplex*   A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                double*             W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     float*              A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     float*              W,
+                                     int                 strideW,
+                                     float*              work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     double*             A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     double*             W,
+                                     int                 strideW,
+                                     double*             work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     hipFloatComplex*    A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     float*              W,
+                                     int                 strideW,
+                                     hipFloatComplex*    work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     hipDoubleComplex*   A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     double*             W,
+                                     int                 strideW,
+                                     hipDoubleComplex*   work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
 // syevdx/heevdx
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdx_bufferSize(hipsolverHandle_t   handle,
                                                                hipsolverEigMode_t  jobz,
@@ -1950,6 +6597,451 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdx(hipsolverHandle_t   handle,
                                                     int                 lwork,
                                                     int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdxExt_bufferSize(hipsolverHandle_t   handle,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipblasFillMode_t   uplo,
+                                                                  int                 n,
+                                                                  const float*        A,
+                                                                  int                 lda,
+                                                                  float               vl,
+                                                                  float               vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  const float*        W,
+                                                                  size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdxExt_bufferSize(hipsolverHandle_t   handle,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipblasFillMode_t   uplo,
+                                                                  int                 n,
+                                                                  const double*       A,
+                                                                  int                 lda,
+                                                                  double              vl,
+                                                                  double              vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  const double*       W,
+                                                                  size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdxExt_bufferSize(hipsolverHandle_t      handle,
+                                                                  hipsolverEigMode_t     jobz,
+                                                                  hipsolverEigRange_t    range,
+                                                                  hipblasFillMode_t      uplo,
+                                                                  int                    n,
+                                                                  const hipFloatComplex* A,
+                                                                  int                    lda,
+                                                                  float                  vl,
+                                                                  float                  vu,
+                                                                  int                    il,
+                                                                  int                    iu,
+                                                                  int*                   nev,
+                                                                  const float*           W,
+                                                                  size_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdxExt_bufferSize(hipsolverHandle_t       handle,
+                                                                  hipsolverEigMode_t      jobz,
+                                                                  hipsolverEigRange_t     range,
+                                                                  hipblasFillMode_t       uplo,
+                                                                  int                     n,
+                                                                  const hipDoubleComplex* A,
+                                                                  int                     lda,
+                                                                  double                  vl,
+                                                                  double                  vu,
+                                                                  int                     il,
+                                                                  int                     iu,
+                                                                  int*                    nev,
+                                                                  const double*           W,
+                                                                  size_t*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       float*              A,
+                                                       int                 lda,
+                                                       float               vl,
+                                                       float               vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       float*              W,
+                                                       float*              work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       double*             A,
+                                                       int                 lda,
+                                                       double              vl,
+                                                       double              vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       double*             W,
+                                                       double*             work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       hipFloatComplex*    A,
+                                                       int                 lda,
+                                                       float               vl,
+                                                       float               vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       float*              W,
+                                                       hipFloatComplex*    work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       hipDoubleComplex*   A,
+                                                       int                 lda,
+                                                       double              vl,
+                                                       double              vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       double*             W,
+                                                       hipDoubleComplex*   work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
+// syevdx_strided_batched/heevdx_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdxStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverEigRange_t range,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              const float*        A,
+                                              int                 lda,
+                                              int                 strideA,
+                                              float               vl,
+                                              float               vu,
+                                              int                 il,
+                                              int                 iu,
+                                              int*                nev,
+                                              const float*        W,
+                                              int                 strideW,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdxStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverEigRange_t range,
+                                              hipsolverFillMode_t uplo,
+                                              int                 n,
+                                              const double*       A,
+                                              int                 lda,
+                                              int                 strideA,
+                                              double              vl,
+                                              double              vu,
+                                              int                 il,
+                                              int                 iu,
+                                              int*                nev,
+                                              const double*       W,
+                                              int                 strideW,
+                                              int*                lwork,
+                                              int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdxStridedBatched_bufferSize(hipsolverHandle_t      handle,
+                                              hipsolverEigMode_t     jobz,
+                                              hipsolverEigRange_t    range,
+                                              hipsolverFillMode_t    uplo,
+                                              int                    n,
+                                              const hipFloatComplex* A,
+                                              int                    lda,
+                                              int                    strideA,
+                                              float                  vl,
+                                              float                  vu,
+                                              int                    il,
+                                              int                    iu,
+                                              int*                   nev,
+                                              const float*           W,
+                                              int                    strideW,
+                                              int*                   lwork,
+                                              int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdxStridedBatched_bufferSize(hipsolverHandle_t       handle,
+                                              hipsolverEigMode_t      jobz,
+                                              hipsolverEigRange_t     range,
+                                              hipsolverFillMode_t     uplo,
+                                              int                     n,
+                                              const hipDoubleComplex* A,
+                                              int                     lda,
+                                              int                     strideA,
+                                              double                  vl,
+                                              double                  vu,
+                                              int                     il,
+                                              int                     iu,
+                                              int*                    nev,
+                                              const double*           W,
+                                              int                     strideW,
+                                              int*                    lwork,
+                                              int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevdxStridedBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  float*              A,
+                                                                  int                 lda,
+                                                                  int                 strideA,
+                                                                  float               vl,
+                                                                  float               vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  float*              W,
+                                                                  int                 strideW,
+                                                                  float*              work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevdxStridedBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  double*             A,
+                                                                  int                 lda,
+                                                                  int                 strideA,
+                                                                  double              vl,
+                                                                  double              vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  double*             W,
+                                                                  int                 strideW,
+                                                                  double*             work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevdxStridedBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  hipFloatComplex*    A,
+                                                                  int                 lda,
+                                                                  int                 strideA,
+                                                                  float               vl,
+                                                                  float               vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  float*              W,
+                                                                  int                 strideW,
+                                                                  hipFloatComplex*    work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevdxStridedBatched(hipsolverHandle_t   handle,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipsolverFillMode_t uplo,
+                                                                  int                 n,
+                                                                  hipDoubleComplex*   A,
+                                                                  int                 lda,
+                                                                  int                 strideA,
+                                                                  double              vl,
+                                                                  double              vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  double*             W,
+                                                                  int                 strideW,
+                                                                  hipDoubleComplex*   work,
+                                                                  int                 lwork,
+                                                                  int*                devInfo,
+                                                                  int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdxStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 const float*        A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 float               vl,
+                                                 float               vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 const float*        W,
+                                                 int                 strideW,
+                                                 size_t*             lwork,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdxStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                 hipsolverEigMode_t  jobz,
+                                                 hipsolverEigRange_t range,
+                                                 hipsolverFillMode_t uplo,
+                                                 int                 n,
+                                                 const double*       A,
+                                                 int                 lda,
+                                                 int                 strideA,
+                                                 double              vl,
+                                                 double              vu,
+                                                 int                 il,
+                                                 int                 iu,
+                                                 int*                nev,
+                                                 const double*       W,
+                                                 int                 strideW,
+                                                 size_t*             lwork,
+                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdxStridedBatchedExt_bufferSize(hipsolverHandle_t      handle,
+                                                 hipsolverEigMode_t     jobz,
+                                                 hipsolverEigRange_t    range,
+                                                 hipsolverFillMode_t    uplo,
+                                                 int                    n,
+                                                 const hipFloatComplex* A,
+                                                 int                    lda,
+                                                 int                    strideA,
+                                                 float                  vl,
+                                                 float                  vu,
+                                                 int                    il,
+                                                 int                    iu,
+                                                 int*                   nev,
+                                                 const float*           W,
+                                                 int                    strideW,
+                                                 size_t*                lwork,
+                                                 int                    batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdxStridedBatchedExt_bufferSize(hipsolverHandle_t       handle,
+                                                 hipsolverEigMode_t      jobz,
+                                                 hipsolverEigRange_t     range,
+                                                 hipsolverFillMode_t     uplo,
+                                                 int                     n,
+                                                 const hipDoubleComplex* A,
+                                                 int                     lda,
+                                                 int                     strideA,
+                                                 double                  vl,
+                                                 double                  vu,
+                                                 int                     il,
+                                                 int                     iu,
+                                                 int*                    nev,
+                                                 const double*           W,
+                                                 int                     strideW,
+                                                 size_t*                 lwork,
+                                                 int                     batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevdxStridedBatchedExt(hipsolverHandle_t   handle,
+                                      hipsolverEigMode_t  jobz,
+                                      hipsolverEigRange_t range,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      float*              A,
+                                      int                 lda,
+                                      int                 strideA,
+                                      float               vl,
+                                      float               vu,
+                                      int                 il,
+                                      int                 iu,
+                                      int*                nev,
+                                      float*              W,
+                                      int                 strideW,
+                                      float*              work,
+                                      size_t              lwork,
+                                      int*                devInfo,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevdxStridedBatchedExt(hipsolverHandle_t   handle,
+                                      hipsolverEigMode_t  jobz,
+                                      hipsolverEigRange_t range,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      double*             A,
+                                      int                 lda,
+                                      int                 strideA,
+                                      double              vl,
+                                      double              vu,
+                                      int                 il,
+                                      int                 iu,
+                                      int*                nev,
+                                      double*             W,
+                                      int                 strideW,
+                                      double*             work,
+                                      size_t              lwork,
+                                      int*                devInfo,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevdxStridedBatchedExt(hipsolverHandle_t   handle,
+                                      hipsolverEigMode_t  jobz,
+                                      hipsolverEigRange_t range,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipFloatComplex*    A,
+                                      int                 lda,
+                                      int                 strideA,
+                                      float               vl,
+                                      float               vu,
+                                      int                 il,
+                                      int                 iu,
+                                      int*                nev,
+                                      float*              W,
+                                      int                 strideW,
+                                      hipFloatComplex*    work,
+                                      size_t              lwork,
+                                      int*                devInfo,
+                                      int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevdxStridedBatchedExt(hipsolverHandle_t   handle,
+                                      hipsolverEigMode_t  jobz,
+                                      hipsolverEigRange_t range,
+                                      hipsolverFillMode_t uplo,
+                                      int                 n,
+                                      hipDoubleComplex*   A,
+                                      int                 lda,
+                                      int                 strideA,
+                                      double              vl,
+                                      double              vu,
+                                      int                 il,
+                                      int                 iu,
+                                      int*                nev,
+                                      double*             W,
+                                      int                 strideW,
+                                      hipDoubleComplex*   work,
+                                      size_t              lwork,
+                                      int*                devInfo,
+                                      int                 batch_count);
+
 // syevj/heevj
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevj_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverEigMode_t   jobz,
@@ -2039,6 +7131,94 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevj(hipsolverHandle_t    handle,
                                                    int*                 devInfo,
                                                    hipsolverSyevjInfo_t params);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 float*               W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 double*              W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 hipFloatComplex*     A,
+                                                                 int                  lda,
+                                                                 float*               W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 hipDoubleComplex*    A,
+                                                                 int                  lda,
+                                                                 double*              W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      float*               A,
+                                                      int                  lda,
+                                                      float*               W,
+                                                      float*               work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      double*              A,
+                                                      int                  lda,
+                                                      double*              W,
+                                                      double*              work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      hipFloatComplex*     A,
+                                                      int                  lda,
+                                                      float*               W,
+                                                      hipFloatComplex*     work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      hipDoubleComplex*    A,
+                                                      int                  lda,
+                                                      double*              W,
+                                                      hipDoubleComplex*    work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
 // syevj_batched/heevj_batched
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjBatched_bufferSize(hipsolverHandle_t    handle,
                                                                      hipsolverEigMode_t   jobz,
@@ -2136,6 +7316,452 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjBatched(hipsolverHandle_t    h
                                                           hipsolverSyevjInfo_t params,
                                                           int                  batch_count);
 
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevjBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         float*               A,
+                                         int                  lda,
+                                         float*               W,
+                                         size_t*              lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevjBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         double*              A,
+                                         int                  lda,
+                                         double*              W,
+                                         size_t*              lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevjBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         hipFloatComplex*     A,
+                                         int                  lda,
+                                         float*               W,
+                                         size_t*              lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         hipDoubleComplex*    A,
+                                         int                  lda,
+                                         double*              W,
+                                         size_t*              lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             float*               A,
+                                                             int                  lda,
+                                                             float*               W,
+                                                             float*               work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             double*              A,
+                                                             int                  lda,
+                                                             double*              W,
+                                                             double*              work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             hipFloatComplex*     A,
+                                                             int                  lda,
+                                                             float*               W,
+                                                             hipFloatComplex*     work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjBatchedExt(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             hipDoubleComplex*    A,
+                                                             int                  lda,
+                                                             double*              W,
+                                                             hipDoubleComplex*    work,
+                                                             size_t               lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+// syevj_ptr_batched/heevj_ptr_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevjPtrBatched_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         float*               A[],
+                                         int                  lda,
+                                         float*               W,
+                                         int                  strideW,
+                                         int*                 lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevjPtrBatched_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         double*              A[],
+                                         int                  lda,
+                                         double*              W,
+                                         int                  strideW,
+                                         int*                 lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevjPtrBatched_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         hipFloatComplex*     A[],
+                                         int                  lda,
+                                         float*               W,
+                                         int                  strideW,
+                                         int*                 lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjPtrBatched_bufferSize(hipsolverHandle_t    handle,
+                                         hipsolverEigMode_t   jobz,
+                                         hipsolverFillMode_t  uplo,
+                                         int                  n,
+                                         hipDoubleComplex*    A[],
+                                         int                  lda,
+                                         double*              W,
+                                         int                  strideW,
+                                         int*                 lwork,
+                                         hipsolverSyevjInfo_t params,
+                                         int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjPtrBatched(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             float*               A[],
+                                                             int                  lda,
+                                                             float*               W,
+                                                             int                  strideW,
+                                                             float*               work,
+                                                             int                  lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjPtrBatched(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             double*              A[],
+                                                             int                  lda,
+                                                             double*              W,
+                                                             int                  strideW,
+                                                             double*              work,
+                                                             int                  lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjPtrBatched(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             hipFloatComplex*     A[],
+                                                             int                  lda,
+                                                             float*               W,
+                                                             int                  strideW,
+                                                             hipFloatComplex*     work,
+                                                             int                  lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjPtrBatched(hipsolverHandle_t    handle,
+                                                             hipsolverEigMode_t   jobz,
+                                                             hipsolverFillMode_t  uplo,
+                                                             int                  n,
+                                                             hipDoubleComplex*    A[],
+                                                             int                  lda,
+                                                             double*              W,
+                                                             int                  strideW,
+                                                             hipDoubleComplex*    work,
+                                                             int                  lwork,
+                                                             int*                 devInfo,
+                                                             hipsolverSyevjInfo_t params,
+                                                             int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsyevjPtrBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                            hipsolverEigMode_t   jobz,
+                                            hipsolverFillMode_t  uplo,
+                                            int                  n,
+                                            float*               A[],
+                                            int                  lda,
+                                            float*               W,
+                                            int                  strideW,
+                                            size_t*              lwork,
+                                            hipsolverSyevjInfo_t params,
+                                            int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsyevjPtrBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                            hipsolverEigMode_t   jobz,
+                                            hipsolverFillMode_t  uplo,
+                                            int                  n,
+                                            double*              A[],
+                                            int                  lda,
+                                            double*              W,
+                                            int                  strideW,
+                                            size_t*              lwork,
+                                            hipsolverSyevjInfo_t params,
+                                            int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCheevjPtrBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                            hipsolverEigMode_t   jobz,
+                                            hipsolverFillMode_t  uplo,
+                                            int                  n,
+                                            hipFloatComplex*     A[],
+                                            int                  lda,
+                                            float*               W,
+                                            int                  strideW,
+                                            size_t*              lwork,
+                                            hipsolverSyevjInfo_t params,
+                                            int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZheevjPtrBatchedExt_bufferSize(hipsolverHandle_t    handle,
+                                            hipsolverEigMode_t   jobz,
+                                            hipsolverFillMode_t  uplo,
+                                            int                  n,
+                                            hipDoubleComplex*    A[],
+                                            int                  lda,
+                                            double*              W,
+                                            int                  strideW,
+                                            size_t*              lwork,
+                                            hipsolverSyevjInfo_t params,
+                                            int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevjPtrBatchedExt(hipsolverHandle_t    handle,
+                                                                hipsolverEigMode_t   jobz,
+                                                                hipsolverFillMode_t  uplo,
+                                                                int                  n,
+                                                                float*               A[],
+                                                                int                  lda,
+                                                                float*               W,
+                                                                int                  strideW,
+                                                                float*               work,
+                                                                size_t               lwork,
+                                                                int*                 devInfo,
+                                                                hipsolverSyevjInfo_t params,
+                                                                int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevjPtrBatchedExt(hipsolverHandle_t    handle,
+                                                                hipsolverEigMode_t   jobz,
+                                                                hipsolverFillMode_t  uplo,
+                                                                int                  n,
+                                                                double*              A[],
+                                                                int                  lda,
+                                                                double*              W,
+                                                                int                  strideW,
+                                                                double*              work,
+                                                                size_t               lwork,
+                                                                int*                 devInfo,
+                                                                hipsolverSyevjInfo_t params,
+                                                                int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevjPtrBatchedExt(hipsolverHandle_t    handle,
+                                                                hipsolverEigMode_t   jobz,
+                                                                hipsolverFillMode_t  uplo,
+                                                                int                  n,
+                                                                hipFloatComplex*     A[],
+                                                                int                  lda,
+                                                                float*               W,
+                                                                int                  strideW,
+                                                                hipFloatComplex*     work,
+                                                                size_t               lwork,
+                                                                int*                 devInfo,
+                                                                hipsolverSyevjInfo_t params,
+                                                                int                  batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevjPtrBatchedExt(hipsolverHandle_t    handle,
+                                                                hipsolverEigMode_t   jobz,
+                                                                hipsolverFillMode_t  uplo,
+                                                                int                  n,
+                                                                hipDoubleComplex*    A[],
+                                                                int                  lda,
+                                                                double*              W,
+                                                                int                  strideW,
+                                                                hipDoubleComplex*    work,
+                                                                size_t               lwork,
+                                                                int*                 devInfo,
+                                                                hipsolverSyevjInfo_t params,
+                                                                int                  batch_count);
+
+// syevAuto/heevAuto
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevAuto_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverEigRange_t range,
+                                                                 hipblasFillMode_t   uplo,
+                                                                 int                 n,
+                                                                 const float*        A,
+                                                                 int                 lda,
+                                                                 float               vl,
+                                                                 float               vu,
+                                                                 int                 il,
+                                                                 int                 iu,
+                                                                 int*                nev,
+                                                                 const float*        W,
+                                                                 int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevAuto_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverEigRange_t range,
+                                                                 hipblasFillMode_t   uplo,
+                                                                 int                 n,
+                                                                 const double*       A,
+                                                                 int                 lda,
+                                                                 double              vl,
+                                                                 double              vu,
+                                                                 int                 il,
+                                                                 int                 iu,
+                                                                 int*                nev,
+                                                                 const double*       W,
+                                                                 int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevAuto_bufferSize(hipsolverHandle_t      handle,
+                                                                 hipsolverEigMode_t     jobz,
+                                                                 hipsolverEigRange_t    range,
+                                                                 hipblasFillMode_t      uplo,
+                                                                 int                    n,
+                                                                 const hipFloatComplex* A,
+                                                                 int                    lda,
+                                                                 float                  vl,
+                                                                 float                  vu,
+                                                                 int                    il,
+                                                                 int                    iu,
+                                                                 int*                   nev,
+                                                                 const float*           W,
+                                                                 int*                   lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevAuto_bufferSize(hipsolverHandle_t       handle,
+                                                                 hipsolverEigMode_t      jobz,
+                                                                 hipsolverEigRange_t     range,
+                                                                 hipblasFillMode_t       uplo,
+                                                                 int                     n,
+                                                                 const hipDoubleComplex* A,
+                                                                 int                     lda,
+                                                                 double                  vl,
+                                                                 double                  vu,
+                                                                 int                     il,
+                                                                 int                     iu,
+                                                                 int*                    nev,
+                                                                 const double*           W,
+                                                                 int*                    lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsyevAuto(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverEigRange_t range,
+                                                      hipblasFillMode_t   uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float               vl,
+                                                      float               vu,
+                                                      int                 il,
+                                                      int                 iu,
+                                                      int*                nev,
+                                                      float*              W,
+                                                      float*              work,
+                                                      int                 lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsyevAuto(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverEigRange_t range,
+                                                      hipblasFillMode_t   uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double              vl,
+                                                      double              vu,
+                                                      int                 il,
+                                                      int                 iu,
+                                                      int*                nev,
+                                                      double*             W,
+                                                      double*             work,
+                                                      int                 lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCheevAuto(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverEigRange_t range,
+                                                      hipblasFillMode_t   uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      float               vl,
+                                                      float               vu,
+                                                      int                 il,
+                                                      int                 iu,
+                                                      int*                nev,
+                                                      float*              W,
+                                                      hipFloatComplex*    work,
+                                                      int                 lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZheevAuto(hipsolverHandle_t   handle,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverEigRange_t range,
+                                                      hipblasFillMode_t   uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      double              vl,
+                                                      double              vu,
+                                                      int                 il,
+                                                      int                 iu,
+                                                      int*                nev,
+                                                      double*             W,
+                                                      hipDoubleComplex*   work,
+                                                      int                 lwork,
+                                                      int*                devInfo);
+
 // sygvd/hegvd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverEigType_t  itype,
@@ -2241,6 +7867,395 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 float*              W,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 double*             W,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 float*              W,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 double*             W,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              B,
+                                                      int                 ldb,
+                                                      float*              W,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             B,
+                                                      int                 ldb,
+                                                      double*             W,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      hipFloatComplex*    B,
+                                                      int                 ldb,
+                                                      float*              W,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdExt(hipsolverHandle_t   handle,
+                                                      hipsolverEigType_t  itype,
+                                                      hipsolverEigMode_t  jobz,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      hipDoubleComplex*   B,
+                                                      int                 ldb,
+                                                      double*             W,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+// sygvd_strided_batched/hegvd_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             float*              B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             float*              W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             double*             B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             double*             W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             float*              W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverEigType_t  itype,
+                                             hipsolverEigMode_t  jobz,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             double*             W,
+                                             int                 strideW,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 float*              W,
+                                                                 int                 strideW,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 double*             W,
+                                                                 int                 strideW,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 float*              W,
+                                                                 int                 strideW,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverEigType_t  itype,
+                                                                 hipsolverEigMode_t  jobz,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 double*             W,
+                                                                 int                 strideW,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                float*              A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                float*              B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                float*              W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                double*             A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                double*             B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                double*             W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipFloatComplex*    A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                hipFloatComplex*    B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                float*              W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigType_t  itype,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                hipDoubleComplex*   A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                hipDoubleComplex*   B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                double*             W,
+                                                int                 strideW,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsygvdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigType_t  itype,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     float*              A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     float*              B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     float*              W,
+                                     int                 strideW,
+                                     float*              work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsygvdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigType_t  itype,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     double*             A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     double*             B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     double*             W,
+                                     int                 strideW,
+                                     double*             work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverChegvdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigType_t  itype,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     hipFloatComplex*    A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     hipFloatComplex*    B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     float*              W,
+                                     int                 strideW,
+                                     hipFloatComplex*    work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZhegvdStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverEigType_t  itype,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     hipDoubleComplex*   A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     hipDoubleComplex*   B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     double*             W,
+                                     int                 strideW,
+                                     hipDoubleComplex*   work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
 // sygvdx/hegvdx
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdx_bufferSize(hipsolverHandle_t   handle,
                                                                hipsolverEigType_t  itype,
@@ -2394,6 +8409,158 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdx(hipsolverHandle_t   handle,
                                                     int                 lwork,
                                                     int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdxExt_bufferSize(hipsolverHandle_t   handle,
+                                                                  hipsolverEigType_t  itype,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipblasFillMode_t   uplo,
+                                                                  int                 n,
+                                                                  const float*        A,
+                                                                  int                 lda,
+                                                                  const float*        B,
+                                                                  int                 ldb,
+                                                                  float               vl,
+                                                                  float               vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  const float*        W,
+                                                                  size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdxExt_bufferSize(hipsolverHandle_t   handle,
+                                                                  hipsolverEigType_t  itype,
+                                                                  hipsolverEigMode_t  jobz,
+                                                                  hipsolverEigRange_t range,
+                                                                  hipblasFillMode_t   uplo,
+                                                                  int                 n,
+                                                                  const double*       A,
+                                                                  int                 lda,
+                                                                  const double*       B,
+                                                                  int                 ldb,
+                                                                  double              vl,
+                                                                  double              vu,
+                                                                  int                 il,
+                                                                  int                 iu,
+                                                                  int*                nev,
+                                                                  const double*       W,
+                                                                  size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdxExt_bufferSize(hipsolverHandle_t      handle,
+                                                                  hipsolverEigType_t     itype,
+                                                                  hipsolverEigMode_t     jobz,
+                                                                  hipsolverEigRange_t    range,
+                                                                  hipblasFillMode_t      uplo,
+                                                                  int                    n,
+                                                                  const hipFloatComplex* A,
+                                                                  int                    lda,
+                                                                  const hipFloatComplex* B,
+                                                                  int                    ldb,
+                                                                  float                  vl,
+                                                                  float                  vu,
+                                                                  int                    il,
+                                                                  int                    iu,
+                                                                  int*                   nev,
+                                                                  const float*           W,
+                                                                  size_t*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdxExt_bufferSize(hipsolverHandle_t       handle,
+                                                                  hipsolverEigType_t      itype,
+                                                                  hipsolverEigMode_t      jobz,
+                                                                  hipsolverEigRange_t     range,
+                                                                  hipblasFillMode_t       uplo,
+                                                                  int                     n,
+                                                                  const hipDoubleComplex* A,
+                                                                  int                     lda,
+                                                                  const hipDoubleComplex* B,
+                                                                  int                     ldb,
+                                                                  double                  vl,
+                                                                  double                  vu,
+                                                                  int                     il,
+                                                                  int                     iu,
+                                                                  int*                    nev,
+                                                                  const double*           W,
+                                                                  size_t*                 lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigType_t  itype,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       float*              A,
+                                                       int                 lda,
+                                                       float*              B,
+                                                       int                 ldb,
+                                                       float               vl,
+                                                       float               vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       float*              W,
+                                                       float*              work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigType_t  itype,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       double*             A,
+                                                       int                 lda,
+                                                       double*             B,
+                                                       int                 ldb,
+                                                       double              vl,
+                                                       double              vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       double*             W,
+                                                       double*             work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigType_t  itype,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       hipFloatComplex*    A,
+                                                       int                 lda,
+                                                       hipFloatComplex*    B,
+                                                       int                 ldb,
+                                                       float               vl,
+                                                       float               vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       float*              W,
+                                                       hipFloatComplex*    work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvdxExt(hipsolverHandle_t   handle,
+                                                       hipsolverEigType_t  itype,
+                                                       hipsolverEigMode_t  jobz,
+                                                       hipsolverEigRange_t range,
+                                                       hipblasFillMode_t   uplo,
+                                                       int                 n,
+                                                       hipDoubleComplex*   A,
+                                                       int                 lda,
+                                                       hipDoubleComplex*   B,
+                                                       int                 ldb,
+                                                       double              vl,
+                                                       double              vu,
+                                                       int                 il,
+                                                       int                 iu,
+                                                       int*                nev,
+                                                       double*             W,
+                                                       hipDoubleComplex*   work,
+                                                       size_t              lwork,
+                                                       int*                devInfo);
+
 // sygvj/hegvj
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvj_bufferSize(hipsolverHandle_t    handle,
                                                               hipsolverEigType_t   itype,
@@ -2507,6 +8674,118 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvj(hipsolverHandle_t    handle,
                                                    int*                 devInfo,
                                                    hipsolverSyevjInfo_t params);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigType_t   itype,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 float*               A,
+                                                                 int                  lda,
+                                                                 float*               B,
+                                                                 int                  ldb,
+                                                                 float*               W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigType_t   itype,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 double*              A,
+                                                                 int                  lda,
+                                                                 double*              B,
+                                                                 int                  ldb,
+                                                                 double*              W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigType_t   itype,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 hipFloatComplex*     A,
+                                                                 int                  lda,
+                                                                 hipFloatComplex*     B,
+                                                                 int                  ldb,
+                                                                 float*               W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvjExt_bufferSize(hipsolverHandle_t    handle,
+                                                                 hipsolverEigType_t   itype,
+                                                                 hipsolverEigMode_t   jobz,
+                                                                 hipsolverFillMode_t  uplo,
+                                                                 int                  n,
+                                                                 hipDoubleComplex*    A,
+                                                                 int                  lda,
+                                                                 hipDoubleComplex*    B,
+                                                                 int                  ldb,
+                                                                 double*              W,
+                                                                 size_t*              lwork,
+                                                                 hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsygvjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigType_t   itype,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      float*               A,
+                                                      int                  lda,
+                                                      float*               B,
+                                                      int                  ldb,
+                                                      float*               W,
+                                                      float*               work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsygvjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigType_t   itype,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      double*              A,
+                                                      int                  lda,
+                                                      double*              B,
+                                                      int                  ldb,
+                                                      double*              W,
+                                                      double*              work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChegvjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigType_t   itype,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      hipFloatComplex*     A,
+                                                      int                  lda,
+                                                      hipFloatComplex*     B,
+                                                      int                  ldb,
+                                                      float*               W,
+                                                      hipFloatComplex*     work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhegvjExt(hipsolverHandle_t    handle,
+                                                      hipsolverEigType_t   itype,
+                                                      hipsolverEigMode_t   jobz,
+                                                      hipsolverFillMode_t  uplo,
+                                                      int                  n,
+                                                      hipDoubleComplex*    A,
+                                                      int                  lda,
+                                                      hipDoubleComplex*    B,
+                                                      int                  ldb,
+                                                      double*              W,
+                                                      hipDoubleComplex*    work,
+                                                      size_t               lwork,
+                                                      int*                 devInfo,
+                                                      hipsolverSyevjInfo_t params);
+
 // sytrd/hetrd
 HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrd_bufferSize(hipsolverHandle_t   handle,
                                                               hipsolverFillMode_t uplo,
@@ -2596,6 +8875,94 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrd(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 float*              E,
+                                                                 float*              tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 double*             D,
+                                                                 double*             E,
+                                                                 double*             tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChetrdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 float*              D,
+                                                                 float*              E,
+                                                                 hipFloatComplex*    tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrdExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 double*             D,
+                                                                 double*             E,
+                                                                 hipDoubleComplex*   tau,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrdExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      float*              D,
+                                                      float*              E,
+                                                      float*              tau,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrdExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      double*             D,
+                                                      double*             E,
+                                                      double*             tau,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverChetrdExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      float*              D,
+                                                      float*              E,
+                                                      hipFloatComplex*    tau,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZhetrdExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      double*             D,
+                                                      double*             E,
+                                                      hipDoubleComplex*   tau,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
 // sytrf
 HIPSOLVER_EXPORT hipsolverStatus_t
     hipsolverSsytrf_bufferSize(hipsolverHandle_t handle, int n, float* A, int lda, int* lwork);
@@ -2649,6 +9016,978 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrf(hipsolverHandle_t   handle,
                                                    int                 lwork,
                                                    int*                devInfo);
 
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrfExt_bufferSize(
+    hipsolverHandle_t handle, int n, float* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrfExt_bufferSize(
+    hipsolverHandle_t handle, int n, double* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrfExt_bufferSize(
+    hipsolverHandle_t handle, int n, hipFloatComplex* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrfExt_bufferSize(
+    hipsolverHandle_t handle, int n, hipDoubleComplex* A, int lda, size_t* lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrfExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+// sytrs
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              float*              A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              float*              B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              double*             A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              double*             B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipFloatComplex*    A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              hipFloatComplex*    B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs_bufferSize(hipsolverHandle_t   handle,
+                                                              hipsolverFillMode_t uplo,
+                                                              int                 n,
+                                                              int                 nrhs,
+                                                              hipDoubleComplex*   A,
+                                                              int                 lda,
+                                                              int*                ipiv,
+                                                              hipDoubleComplex*   B,
+                                                              int                 ldb,
+                                                              int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   float*              A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   float*              B,
+                                                   int                 ldb,
+                                                   float*              work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   double*             A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   double*             B,
+                                                   int                 ldb,
+                                                   double*             work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipFloatComplex*    A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   hipFloatComplex*    B,
+                                                   int                 ldb,
+                                                   hipFloatComplex*    work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrs(hipsolverHandle_t   handle,
+                                                   hipsolverFillMode_t uplo,
+                                                   int                 n,
+                                                   int                 nrhs,
+                                                   hipDoubleComplex*   A,
+                                                   int                 lda,
+                                                   int*                ipiv,
+                                                   hipDoubleComplex*   B,
+                                                   int                 ldb,
+                                                   hipDoubleComplex*   work,
+                                                   int                 lwork,
+                                                   int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int*                ipiv,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int*                ipiv,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 int*                ipiv,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrsExt_bufferSize(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 int*                ipiv,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      float*              A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      float*              B,
+                                                      int                 ldb,
+                                                      float*              work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      double*             A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      double*             B,
+                                                      int                 ldb,
+                                                      double*             work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      hipFloatComplex*    A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      hipFloatComplex*    B,
+                                                      int                 ldb,
+                                                      hipFloatComplex*    work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrsExt(hipsolverHandle_t   handle,
+                                                      hipsolverFillMode_t uplo,
+                                                      int                 n,
+                                                      int                 nrhs,
+                                                      hipDoubleComplex*   A,
+                                                      int                 lda,
+                                                      int*                ipiv,
+                                                      hipDoubleComplex*   B,
+                                                      int                 ldb,
+                                                      hipDoubleComplex*   work,
+                                                      size_t              lwork,
+                                                      int*                devInfo);
+
+// sytrs_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             float*              A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             int*                ipiv,
+                                             int                 strideP,
+                                             float*              B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             double*             A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             int*                ipiv,
+                                             int                 strideP,
+                                             double*             B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipFloatComplex*    A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             int*                ipiv,
+                                             int                 strideP,
+                                             hipFloatComplex*    B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZsytrsStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                             hipsolverFillMode_t uplo,
+                                             int                 n,
+                                             int                 nrhs,
+                                             hipDoubleComplex*   A,
+                                             int                 lda,
+                                             int                 strideA,
+                                             int*                ipiv,
+                                             int                 strideP,
+                                             hipDoubleComplex*   B,
+                                             int                 ldb,
+                                             int                 strideB,
+                                             int*                lwork,
+                                             int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 float*              A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 int*                ipiv,
+                                                                 int                 strideP,
+                                                                 float*              B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 float*              work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 double*             A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 int*                ipiv,
+                                                                 int                 strideP,
+                                                                 double*             B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 double*             work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipFloatComplex*    A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 int*                ipiv,
+                                                                 int                 strideP,
+                                                                 hipFloatComplex*    B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 hipFloatComplex*    work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsytrsStridedBatched(hipsolverHandle_t   handle,
+                                                                 hipsolverFillMode_t uplo,
+                                                                 int                 n,
+                                                                 int                 nrhs,
+                                                                 hipDoubleComplex*   A,
+                                                                 int                 lda,
+                                                                 int                 strideA,
+                                                                 int*                ipiv,
+                                                                 int                 strideP,
+                                                                 hipDoubleComplex*   B,
+                                                                 int                 ldb,
+                                                                 int                 strideB,
+                                                                 hipDoubleComplex*   work,
+                                                                 int                 lwork,
+                                                                 int*                devInfo,
+                                                                 int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrsStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                float*              A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                int*                ipiv,
+                                                int                 strideP,
+                                                float*              B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrsStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                double*             A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                int*                ipiv,
+                                                int                 strideP,
+                                                double*             B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCsytrsStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                hipFloatComplex*    A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                int*                ipiv,
+                                                int                 strideP,
+                                                hipFloatComplex*    B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZsytrsStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverFillMode_t uplo,
+                                                int                 n,
+                                                int                 nrhs,
+                                                hipDoubleComplex*   A,
+                                                int                 lda,
+                                                int                 strideA,
+                                                int*                ipiv,
+                                                int                 strideP,
+                                                hipDoubleComplex*   B,
+                                                int                 ldb,
+                                                int                 strideB,
+                                                size_t*             lwork,
+                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsytrsStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     float*              A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     int*                ipiv,
+                                     int                 strideP,
+                                     float*              B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     float*              work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsytrsStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     double*             A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     int*                ipiv,
+                                     int                 strideP,
+                                     double*             B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     double*             work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCsytrsStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     hipFloatComplex*    A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     int*                ipiv,
+                                     int                 strideP,
+                                     hipFloatComplex*    B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     hipFloatComplex*    work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZsytrsStridedBatchedExt(hipsolverHandle_t   handle,
+                                     hipsolverFillMode_t uplo,
+                                     int                 n,
+                                     int                 nrhs,
+                                     hipDoubleComplex*   A,
+                                     int                 lda,
+                                     int                 strideA,
+                                     int*                ipiv,
+                                     int                 strideP,
+                                     hipDoubleComplex*   B,
+                                     int                 ldb,
+                                     int                 strideB,
+                                     hipDoubleComplex*   work,
+                                     size_t              lwork,
+                                     int*                devInfo,
+                                     int                 batch_count);
+
+// sysv
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsysv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             float*              A,
+                                                             int                 lda,
+                                                             int*                ipiv,
+                                                             float*              B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsysv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             double*             A,
+                                                             int                 lda,
+                                                             int*                ipiv,
+                                                             double*             B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsysv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipFloatComplex*    A,
+                                                             int                 lda,
+                                                             int*                ipiv,
+                                                             hipFloatComplex*    B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsysv_bufferSize(hipsolverHandle_t   handle,
+                                                             hipsolverFillMode_t uplo,
+                                                             int                 n,
+                                                             int                 nrhs,
+                                                             hipDoubleComplex*   A,
+                                                             int                 lda,
+                                                             int*                ipiv,
+                                                             hipDoubleComplex*   B,
+                                                             int                 ldb,
+                                                             int*                lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsysv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  float*              A,
+                                                  int                 lda,
+                                                  int*                ipiv,
+                                                  float*              B,
+                                                  int                 ldb,
+                                                  float*              work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsysv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  double*             A,
+                                                  int                 lda,
+                                                  int*                ipiv,
+                                                  double*             B,
+                                                  int                 ldb,
+                                                  double*             work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsysv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  hipFloatComplex*    A,
+                                                  int                 lda,
+                                                  int*                ipiv,
+                                                  hipFloatComplex*    B,
+                                                  int                 ldb,
+                                                  hipFloatComplex*    work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsysv(hipsolverHandle_t   handle,
+                                                  hipsolverFillMode_t uplo,
+                                                  int                 n,
+                                                  int                 nrhs,
+                                                  hipDoubleComplex*   A,
+                                                  int                 lda,
+                                                  int*                ipiv,
+                                                  hipDoubleComplex*   B,
+                                                  int                 ldb,
+                                                  hipDoubleComplex*   work,
+                                                  int                 lwork,
+                                                  int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsysvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                float*              A,
+                                                                int                 lda,
+                                                                int*                ipiv,
+                                                                float*              B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsysvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                double*             A,
+                                                                int                 lda,
+                                                                int*                ipiv,
+                                                                double*             B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsysvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipFloatComplex*    A,
+                                                                int                 lda,
+                                                                int*                ipiv,
+                                                                hipFloatComplex*    B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsysvExt_bufferSize(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipDoubleComplex*   A,
+                                                                int                 lda,
+                                                                int*                ipiv,
+                                                                hipDoubleComplex*   B,
+                                                                int                 ldb,
+                                                                size_t*             lwork);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsysvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     float*              A,
+                                                     int                 lda,
+                                                     int*                ipiv,
+                                                     float*              B,
+                                                     int                 ldb,
+                                                     float*              work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsysvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     double*             A,
+                                                     int                 lda,
+                                                     int*                ipiv,
+                                                     double*             B,
+                                                     int                 ldb,
+                                                     double*             work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsysvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     hipFloatComplex*    A,
+                                                     int                 lda,
+                                                     int*                ipiv,
+                                                     hipFloatComplex*    B,
+                                                     int                 ldb,
+                                                     hipFloatComplex*    work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsysvExt(hipsolverHandle_t   handle,
+                                                     hipsolverFillMode_t uplo,
+                                                     int                 n,
+                                                     int                 nrhs,
+                                                     hipDoubleComplex*   A,
+                                                     int                 lda,
+                                                     int*                ipiv,
+                                                     hipDoubleComplex*   B,
+                                                     int                 ldb,
+                                                     hipDoubleComplex*   work,
+                                                     size_t              lwork,
+                                                     int*                devInfo);
+
+// sysv_strided_batched
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsysvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            float*              A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            int*                ipiv,
+                                            int                 strideP,
+                                            float*              B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsysvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            double*             A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            int*                ipiv,
+                                            int                 strideP,
+                                            double*             B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCsysvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipFloatComplex*    A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            int*                ipiv,
+                                            int                 strideP,
+                                            hipFloatComplex*    B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZsysvStridedBatched_bufferSize(hipsolverHandle_t   handle,
+                                            hipsolverFillMode_t uplo,
+                                            int                 n,
+                                            int                 nrhs,
+                                            hipDoubleComplex*   A,
+                                            int                 lda,
+                                            int                 strideA,
+                                            int*                ipiv,
+                                            int                 strideP,
+                                            hipDoubleComplex*   B,
+                                            int                 ldb,
+                                            int                 strideB,
+                                            int*                lwork,
+                                            int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsysvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                float*              A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                int*                ipiv,
+                                                                int                 strideP,
+                                                                float*              B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                float*              work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsysvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                double*             A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                int*                ipiv,
+                                                                int                 strideP,
+                                                                double*             B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                double*             work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsysvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipFloatComplex*    A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                int*                ipiv,
+                                                                int                 strideP,
+                                                                hipFloatComplex*    B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                hipFloatComplex*    work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsysvStridedBatched(hipsolverHandle_t   handle,
+                                                                hipsolverFillMode_t uplo,
+                                                                int                 n,
+                                                                int                 nrhs,
+                                                                hipDoubleComplex*   A,
+                                                                int                 lda,
+                                                                int                 strideA,
+                                                                int*                ipiv,
+                                                                int                 strideP,
+                                                                hipDoubleComplex*   B,
+                                                                int                 ldb,
+                                                                int                 strideB,
+                                                                hipDoubleComplex*   work,
+                                                                int                 lwork,
+                                                                int*                devInfo,
+                                                                int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverSsysvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               float*              A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               int*                ipiv,
+                                               int                 strideP,
+                                               float*              B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverDsysvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               double*             A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               int*                ipiv,
+                                               int                 strideP,
+                                               double*             B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverCsysvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipFloatComplex*    A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               int*                ipiv,
+                                               int                 strideP,
+                                               hipFloatComplex*    B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t
+    hipsolverZsysvStridedBatchedExt_bufferSize(hipsolverHandle_t   handle,
+                                               hipsolverFillMode_t uplo,
+                                               int                 n,
+                                               int                 nrhs,
+                                               hipDoubleComplex*   A,
+                                               int                 lda,
+                                               int                 strideA,
+                                               int*                ipiv,
+                                               int                 strideP,
+                                               hipDoubleComplex*   B,
+                                               int                 ldb,
+                                               int                 strideB,
+                                               size_t*             lwork,
+                                               int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverSsysvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   float*              A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   int*                ipiv,
+                                                                   int                 strideP,
+                                                                   float*              B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   float*              work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDsysvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   double*             A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   int*                ipiv,
+                                                                   int                 strideP,
+                                                                   double*             B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   double*             work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverCsysvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   hipFloatComplex*    A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   int*                ipiv,
+                                                                   int                 strideP,
+                                                                   hipFloatComplex*    B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   hipFloatComplex*    work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
+HIPSOLVER_EXPORT hipsolverStatus_t hipsolverZsysvStridedBatchedExt(hipsolverHandle_t   handle,
+                                                                   hipsolverFillMode_t uplo,
+                                                                   int                 n,
+                                                                   int                 nrhs,
+                                                                   hipDoubleComplex*   A,
+                                                                   int                 lda,
+                                                                   int                 strideA,
+                                                                   int*                ipiv,
+                                                                   int                 strideP,
+                                                                   hipDoubleComplex*   B,
+                                                                   int                 ldb,
+                                                                   int                 strideB,
+                                                                   hipDoubleComplex*   work,
+                                                                   size_t              lwork,
+                                                                   int*                devInfo,
+                                                                   int                 batch_count);
+
 #ifdef __cplusplus
 }
 #endif
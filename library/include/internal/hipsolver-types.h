@@ -21,6 +21,7 @@ typedef void* hipsolverHandle_t;
 
 typedef void* hipsolverGesvdjInfo_t;
 typedef void* hipsolverSyevjInfo_t;
+typedef void* hipsolverHandlePool_t;
 
 typedef enum
 {
@@ -132,6 +133,84 @@ typedef enum
     HIPSOLVER_ALLOW_NON_DETERMINISTIC_RESULTS = 242,
 } hipsolverDeterministicMode_t;
 
+/*! \brief Selects whether the generic eigensolvers time the available algorithms the
+ *  first time a problem shape is seen and dispatch to the fastest one.
+ ********************************************************************************/
+typedef enum
+{
+    HIPSOLVER_AUTOTUNE_DISABLED = 251,
+    HIPSOLVER_AUTOTUNE_ENABLED  = 252,
+} hipsolverAutotuneMode_t;
+
+/*! \brief Solver functions whose workspace can be reserved with hipsolverReserveWorkspace.
+ ********************************************************************************/
+typedef enum
+{
+    HIPSOLVER_ROUTINE_GETRF                 = 261,
+    HIPSOLVER_ROUTINE_GETRF_BATCHED         = 262,
+    HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED = 263,
+    HIPSOLVER_ROUTINE_GETRS                 = 264,
+    HIPSOLVER_ROUTINE_GETRS_BATCHED         = 265,
+    HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED = 266,
+    HIPSOLVER_ROUTINE_POTRF                 = 267,
+    HIPSOLVER_ROUTINE_POTRF_BATCHED         = 268,
+    HIPSOLVER_ROUTINE_POTRS                 = 269,
+    HIPSOLVER_ROUTINE_POTRS_BATCHED         = 270,
+    HIPSOLVER_ROUTINE_POTRI                 = 271,
+    HIPSOLVER_ROUTINE_GEQRF                 = 272,
+    HIPSOLVER_ROUTINE_GESV                  = 273,
+    HIPSOLVER_ROUTINE_GELS                  = 274,
+    HIPSOLVER_ROUTINE_GESVD                 = 275,
+    HIPSOLVER_ROUTINE_SYEVD                 = 276,
+    HIPSOLVER_ROUTINE_SYGVD                 = 277,
+    HIPSOLVER_ROUTINE_SYTRD                 = 278,
+    HIPSOLVER_ROUTINE_SYTRF                 = 279,
+} hipsolverRoutine_t;
+
+/*! \brief Usage statistics of the device memory pool associated with a handle.
+ ********************************************************************************/
+typedef struct
+{
+    size_t reserved_bytes; // device memory currently held by the pool
+    size_t used_bytes; // device memory currently handed out by the pool
+    size_t peak_reserved_bytes; // high-water mark of reserved_bytes
+    size_t peak_used_bytes; // high-water mark of used_bytes
+    size_t num_allocations; // number of device allocations performed by the pool
+    size_t num_reuses; // number of requests served with a previously released block
+    size_t num_releases; // number of released blocks returned to the device
+} hipsolverMemoryPoolInfo_t;
+
+/*! \brief Usage statistics of a handle pool.
+ ********************************************************************************/
+typedef struct
+{
+    size_t num_handles; // number of handles owned by the pool
+    size_t handles_in_use; // handles currently checked out
+    size_t peak_handles_in_use; // high-water mark of handles_in_use
+    size_t num_acquires; // number of handles checked out since the pool was created
+    size_t num_contended_acquires; // checkouts that had to wait for a handle to be returned
+    size_t num_retries; // updates of the free list repeated because of a concurrent update
+    size_t workspace_budget; // bound on the workspace held by the handles, or 0 if unbounded
+    size_t workspace_used_bytes; // workspace currently held by the handles
+    size_t peak_workspace_used_bytes; // high-water mark of workspace_used_bytes
+    size_t num_workspace_failures; // workspace requests refused because of the budget
+} hipsolverHandlePoolInfo_t;
+
+/*! \brief Usage statistics of a handle, accumulated since the handle was created or
+ *  the statistics were last reset.
+ ********************************************************************************/
+typedef struct
+{
+    size_t num_calls; // calls to solver functions made with the handle
+    size_t num_routines; // distinct solver functions called
+    size_t num_workspace_grows; // times hipSOLVER had to enlarge the device workspace
+    size_t peak_workspace_bytes; // largest device workspace held by the handle
+    size_t num_workspace_queries; // workspace sizes computed by the backend
+    size_t num_workspace_query_hits; // workspace sizes served from the cache of the handle
+    size_t num_internal_allocations; // temporary device arrays requested outside the workspace
+    double internal_allocation_ms; // host time spent obtaining those arrays
+} hipsolverHandleStatistics_t;
+
 // Aliases for hipBLAS enums
 
 /*! \brief Alias of hipblasOperation_t. HIPSOLVER_OP_N, HIPSOLVER_OP_T, and HIPSOLVER_OP_C
@@ -156,4 +235,27 @@ typedef hipblasSideMode_t hipsolverSideMode_t;
 #define HIPSOLVER_SIDE_LEFT HIPBLAS_SIDE_LEFT
 #define HIPSOLVER_SIDE_RIGHT HIPBLAS_SIDE_RIGHT
 
+/*! \brief Describes a call whose workspace is reserved with hipsolverReserveWorkspace.
+ *  Each field has the meaning of the argument of the same name in the _bufferSize
+ *  function of the routine, and fields that the routine does not take are ignored.
+ *  For gesv and gels, ldb is also used as ldx.
+ ********************************************************************************/
+typedef struct
+{
+    hipsolverRoutine_t   routine;
+    hipDataType          precision; // HIP_R_32F, HIP_R_64F, HIP_C_32F, or HIP_C_64F
+    int                  m;
+    int                  n;
+    int                  nrhs;
+    int                  lda;
+    int                  ldb;
+    int                  batch_count;
+    hipsolverOperation_t trans;
+    hipsolverFillMode_t  uplo;
+    hipsolverEigMode_t   jobz;
+    hipsolverEigType_t   itype;
+    signed char          jobu;
+    signed char          jobv;
+} hipsolverWorkspaceOp_t;
+
 #endif // HIPSOLVER_TYPES_H
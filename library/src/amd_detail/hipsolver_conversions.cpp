@@ -111,6 +111,19 @@ hipsolverSideMode_t rocblas2hip_side(rocblas_side_ side)
     }
 }
 
+rocblas_diagonal_ hip2rocblas_diag(hipblasDiagType_t diag)
+{
+    switch(diag)
+    {
+    case HIPBLAS_DIAG_NON_UNIT:
+        return rocblas_diagonal_non_unit;
+    case HIPBLAS_DIAG_UNIT:
+        return rocblas_diagonal_unit;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
 rocblas_evect_ hip2rocblas_evect(hipsolverEigMode_t eig)
 {
     switch(eig)
@@ -268,6 +281,19 @@ hipsolverDeterministicMode_t rocblas2hip_deterministic(rocblas_atomics_mode_ mod
     }
 }
 
+rocsolver_alg_mode_ hip2rocsolver_algmode(hipsolverAlgMode_t alg)
+{
+    switch(alg)
+    {
+    case HIPSOLVER_ALG_0:
+        return rocsolver_alg_mode_gpu;
+    case HIPSOLVER_ALG_1:
+        return rocsolver_alg_mode_hybrid;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
 rocblas_svect_ char2rocblas_svect(signed char svect)
 {
     switch(svect)
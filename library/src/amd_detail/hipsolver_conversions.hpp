@@ -42,6 +42,8 @@ rocblas_side_ hip2rocblas_side(hipsolverSideMode_t side);
 
 hipsolverSideMode_t rocblas2hip_side(rocblas_side_ side);
 
+rocblas_diagonal_ hip2rocblas_diag(hipblasDiagType_t diag);
+
 rocblas_evect_ hip2rocblas_evect(hipsolverEigMode_t eig);
 
 hipsolverEigMode_t rocblas2hip_evect(rocblas_evect_ eig);
@@ -64,6 +66,8 @@ rocblas_atomics_mode_ hip2rocblas_deterministic(hipsolverDeterministicMode_t mod
 
 hipsolverDeterministicMode_t rocblas2hip_deterministic(rocblas_atomics_mode_ mode);
 
+rocsolver_alg_mode_ hip2rocsolver_algmode(hipsolverAlgMode_t alg);
+
 rocblas_svect_ char2rocblas_svect(signed char svect);
 
 hipsolverStatus_t rocblas2hip_status(rocblas_status_ error);
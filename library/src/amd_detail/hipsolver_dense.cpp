@@ -26,173 +26,185 @@
  *  to hipSOLVER on the rocSOLVER side.
  */
 
+#include "exceptions.hpp"
 #include "hipsolver.h"
+#include "hipsolver_handle.hpp"
 #include "lib_macros.hpp"
+#include "logging.hpp"
 #include <algorithm>
 #include <iostream>
 
 extern "C" {
 
 // gesvd
+// combinations of jobu and jobv accepted by gesvd
+static const signed char gesvd_jobs[15][2] = {{'N', 'N'},
+                                              {'N', 'A'},
+                                              {'N', 'S'},
+                                              {'N', 'O'},
+                                              {'A', 'N'},
+                                              {'A', 'A'},
+                                              {'A', 'S'},
+                                              {'A', 'O'},
+                                              {'S', 'N'},
+                                              {'S', 'A'},
+                                              {'S', 'S'},
+                                              {'S', 'O'},
+                                              {'O', 'N'},
+                                              {'O', 'A'},
+                                              {'O', 'S'}};
+
 hipsolverStatus_t hipsolverDnSgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverSgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the worst case over all job combinations only depends on m and n
+    size_t sz;
+    hipsolver::workspace_key key(__func__, m, n);
+    if(hipsolver::workspace_cache_lookup((rocblas_handle)handle, key, sz))
+        return hipsolver::workspace_size_to_lwork(sz, lwork);
+
+    // the probe counts as a single query, and its steps are not cached on their own
+    sz = 0;
+    {
+        hipsolver::workspace_cache_bypass bypass((rocblas_handle)handle);
+
+        int temp;
+        for(const auto& jobs : gesvd_jobs)
+        {
+            CHECK_HIPSOLVER_ERROR(
+                hipsolverSgesvd_bufferSize(handle, jobs[0], jobs[1], m, n, &temp));
+            sz = std::max(sz, size_t(temp));
+        }
+    }
+
+    hipsolver::workspace_cache_store((rocblas_handle)handle, key, sz);
 
+    *lwork = (int)sz;
     return HIPSOLVER_STATUS_SUCCESS;
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnDgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverDgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the worst case over all job combinations only depends on m and n
+    size_t sz;
+    hipsolver::workspace_key key(__func__, m, n);
+    if(hipsolver::workspace_cache_lookup((rocblas_handle)handle, key, sz))
+        return hipsolver::workspace_size_to_lwork(sz, lwork);
+
+    // the probe counts as a single query, and its steps are not cached on their own
+    sz = 0;
+    {
+        hipsolver::workspace_cache_bypass bypass((rocblas_handle)handle);
+
+        int temp;
+        for(const auto& jobs : gesvd_jobs)
+        {
+            CHECK_HIPSOLVER_ERROR(
+                hipsolverDgesvd_bufferSize(handle, jobs[0], jobs[1], m, n, &temp));
+            sz = std::max(sz, size_t(temp));
+        }
+    }
 
+    hipsolver::workspace_cache_store((rocblas_handle)handle, key, sz);
+
+    *lwork = (int)sz;
     return HIPSOLVER_STATUS_SUCCESS;
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnCgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverCgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // the worst case over all job combinations only depends on m and n
+    size_t sz;
+    hipsolver::workspace_key key(__func__, m, n);
+    if(hipsolver::workspace_cache_lookup((rocblas_handle)handle, key, sz))
+        return hipsolver::workspace_size_to_lwork(sz, lwork);
+
+    // the probe counts as a single query, and its steps are not cached on their own
+    sz = 0;
+    {
+        hipsolver::workspace_cache_bypass bypass((rocblas_handle)handle);
 
+        int temp;
+        for(const auto& jobs : gesvd_jobs)
+        {
+            CHECK_HIPSOLVER_ERROR(
+                hipsolverCgesvd_bufferSize(handle, jobs[0], jobs[1], m, n, &temp));
+            sz = std::max(sz, size_t(temp));
+        }
+    }
+
+    hipsolver::workspace_cache_store((rocblas_handle)handle, key, sz);
+
+    *lwork = (int)sz;
     return HIPSOLVER_STATUS_SUCCESS;
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnZgesvd_bufferSize(hipsolverHandle_t handle, int m, int n, int* lwork)
+try
 {
-    int temp1, temp2, temp3, temp4, temp5, temp6, temp7, temp8, temp9, temp10, temp11, temp12,
-        temp13, temp14, temp15;
-
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'N', m, n, &temp1));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'A', m, n, &temp2));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'S', m, n, &temp3));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'N', 'O', m, n, &temp4));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'N', m, n, &temp5));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'A', m, n, &temp6));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'S', m, n, &temp7));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'A', 'O', m, n, &temp8));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'N', m, n, &temp9));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'A', m, n, &temp10));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'S', m, n, &temp11));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'S', 'O', m, n, &temp12));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'O', 'N', m, n, &temp13));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'O', 'A', m, n, &temp14));
-    CHECK_HIPSOLVER_ERROR(hipsolverZgesvd_bufferSize(handle, 'O', 'S', m, n, &temp15));
-
-    *lwork = std::max({temp1,
-                       temp2,
-                       temp3,
-                       temp4,
-                       temp5,
-                       temp6,
-                       temp7,
-                       temp8,
-                       temp9,
-                       temp10,
-                       temp11,
-                       temp12,
-                       temp13,
-                       temp14,
-                       temp15});
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
 
+    // the worst case over all job combinations only depends on m and n
+    size_t sz;
+    hipsolver::workspace_key key(__func__, m, n);
+    if(hipsolver::workspace_cache_lookup((rocblas_handle)handle, key, sz))
+        return hipsolver::workspace_size_to_lwork(sz, lwork);
+
+    // the probe counts as a single query, and its steps are not cached on their own
+    sz = 0;
+    {
+        hipsolver::workspace_cache_bypass bypass((rocblas_handle)handle);
+
+        int temp;
+        for(const auto& jobs : gesvd_jobs)
+        {
+            CHECK_HIPSOLVER_ERROR(
+                hipsolverZgesvd_bufferSize(handle, jobs[0], jobs[1], m, n, &temp));
+            sz = std::max(sz, size_t(temp));
+        }
+    }
+
+    hipsolver::workspace_cache_store((rocblas_handle)handle, key, sz);
+
+    *lwork = (int)sz;
     return HIPSOLVER_STATUS_SUCCESS;
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 // getrf
 hipsolverStatus_t hipsolverDnSgetrf(hipsolverHandle_t handle,
@@ -203,11 +215,18 @@ hipsolverStatus_t hipsolverDnSgetrf(hipsolverHandle_t handle,
                                     float*            work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     int lwork;
     CHECK_HIPSOLVER_ERROR(hipsolverSgetrf_bufferSize(handle, m, n, A, lda, &lwork));
     return hipsolverSgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnDgetrf(hipsolverHandle_t handle,
                                     int               m,
@@ -217,11 +236,18 @@ hipsolverStatus_t hipsolverDnDgetrf(hipsolverHandle_t handle,
                                     double*           work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     int lwork;
     CHECK_HIPSOLVER_ERROR(hipsolverDgetrf_bufferSize(handle, m, n, A, lda, &lwork));
     return hipsolverDgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnCgetrf(hipsolverHandle_t handle,
                                     int               m,
@@ -231,11 +257,18 @@ hipsolverStatus_t hipsolverDnCgetrf(hipsolverHandle_t handle,
                                     hipFloatComplex*  work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     int lwork;
     CHECK_HIPSOLVER_ERROR(hipsolverCgetrf_bufferSize(handle, m, n, A, lda, &lwork));
     return hipsolverCgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnZgetrf(hipsolverHandle_t handle,
                                     int               m,
@@ -245,10 +278,17 @@ hipsolverStatus_t hipsolverDnZgetrf(hipsolverHandle_t handle,
                                     hipDoubleComplex* work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     int lwork;
     CHECK_HIPSOLVER_ERROR(hipsolverZgetrf_bufferSize(handle, m, n, A, lda, &lwork));
     return hipsolverZgetrf(handle, m, n, A, lda, work, lwork, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 } //extern C
@@ -29,7 +29,12 @@
 #include "exceptions.hpp"
 #include "hipsolver.h"
 #include "hipsolver_conversions.hpp"
+#include "hipsolver_gesvdr.hpp"
+#include "hipsolver_memory_pool.hpp"
+#include "hipsolver_sytrs.hpp"
+#include "hipsolver_tsqr.hpp"
 #include "lib_macros.hpp"
+#include "logging.hpp"
 #include "utility.hpp"
 
 #include "rocblas/internal/rocblas_device_malloc.hpp"
@@ -38,9 +43,93 @@
 #include <algorithm>
 #include <climits>
 #include <functional>
+#include <initializer_list>
 #include <iostream>
 #include <math.h>
 
+// rocSOLVER provides 64-bit variants for only some of its functions. The others are
+// called through the 32-bit interface, provided that the sizes fit.
+static bool fits_rocblas_int(std::initializer_list<int64_t> values)
+{
+    for(int64_t value : values)
+    {
+        if(value < INT_MIN || value > INT_MAX)
+            return false;
+    }
+    return true;
+}
+
+// Runs gesvdr with its temporary arrays carved from the front of the user workspace, or
+// taken from the memory pool of the handle when no workspace is given
+template <typename T, typename S>
+static hipsolverStatus_t gesvdr_execute(rocblas_handle handle,
+                                        rocblas_svect  left_svect,
+                                        rocblas_svect  right_svect,
+                                        rocblas_int    m,
+                                        rocblas_int    n,
+                                        rocblas_int    k,
+                                        rocblas_int    p,
+                                        rocblas_int    niters,
+                                        void*          A,
+                                        rocblas_int    lda,
+                                        void*          Srand,
+                                        void*          Urand,
+                                        rocblas_int    ldu,
+                                        void*          Vrand,
+                                        rocblas_int    ldv,
+                                        void*          workOnDevice,
+                                        size_t         lworkOnDevice,
+                                        int*           info)
+{
+    auto   sizes      = hipsolver::gesvdr_temp_sizes<T, S>(m, n, k + p);
+    size_t size_temps = hipsolver::gesvdr_temp_total(sizes);
+
+    hipsolver::pool_device_malloc mem(handle);
+    void*                         temps[hipsolver::gesvdr_num_temps];
+
+    if(workOnDevice && lworkOnDevice)
+    {
+        if(lworkOnDevice < size_temps)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        hipsolver::gesvdr_carve_temps(workOnDevice, sizes, temps);
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace(
+            handle, (char*)workOnDevice + size_temps, lworkOnDevice - size_temps));
+    }
+    else
+    {
+        size_t            size_work;
+        hipsolverStatus_t status
+            = hipsolver::gesvdr_workspace_size<T, S>(handle, m, n, k + p, &size_work);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, size_work));
+
+        mem = hipsolver::pool_device_malloc(handle, size_temps);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        hipsolver::gesvdr_carve_temps(mem[0], sizes, temps);
+    }
+
+    return hipsolver::gesvdr_template(handle,
+                                      left_svect,
+                                      right_svect,
+                                      m,
+                                      n,
+                                      k,
+                                      p,
+                                      niters,
+                                      (T*)A,
+                                      lda,
+                                      (S*)Srand,
+                                      (T*)Urand,
+                                      ldu,
+                                      (T*)Vrand,
+                                      ldv,
+                                      temps,
+                                      info);
+}
+
 extern "C" {
 
 // The following functions are not included in the public API of rocSOLVER and must be declared
@@ -133,18 +222,124 @@ rocblas_status rocsolver_zpotrf_info32(rocblas_handle          handle,
                                        const int64_t           lda,
                                        rocblas_int*            info);
 
+rocblas_status rocsolver_ssyevdx_inplace(rocblas_handle       handle,
+                                         const rocblas_evect  evect,
+                                         const rocblas_erange erange,
+                                         const rocblas_fill   uplo,
+                                         const rocblas_int    n,
+                                         float*               A,
+                                         const rocblas_int    lda,
+                                         const float          vl,
+                                         const float          vu,
+                                         const rocblas_int    il,
+                                         const rocblas_int    iu,
+                                         const float          abstol,
+                                         rocblas_int*         nev,
+                                         float*               W,
+                                         rocblas_int*         info);
+
+rocblas_status rocsolver_dsyevdx_inplace(rocblas_handle       handle,
+                                         const rocblas_evect  evect,
+                                         const rocblas_erange erange,
+                                         const rocblas_fill   uplo,
+                                         const rocblas_int    n,
+                                         double*              A,
+                                         const rocblas_int    lda,
+                                         const double         vl,
+                                         const double         vu,
+                                         const rocblas_int    il,
+                                         const rocblas_int    iu,
+                                         const double         abstol,
+                                         rocblas_int*         nev,
+                                         double*              W,
+                                         rocblas_int*         info);
+
+rocblas_status rocsolver_cheevdx_inplace(rocblas_handle         handle,
+                                         const rocblas_evect    evect,
+                                         const rocblas_erange   erange,
+                                         const rocblas_fill     uplo,
+                                         const rocblas_int      n,
+                                         rocblas_float_complex* A,
+                                         const rocblas_int      lda,
+                                         const float            vl,
+                                         const float            vu,
+                                         const rocblas_int      il,
+                                         const rocblas_int      iu,
+                                         const float            abstol,
+                                         rocblas_int*           nev,
+                                         float*                 W,
+                                         rocblas_int*           info);
+
+rocblas_status rocsolver_zheevdx_inplace(rocblas_handle          handle,
+                                         const rocblas_evect     evect,
+                                         const rocblas_erange    erange,
+                                         const rocblas_fill      uplo,
+                                         const rocblas_int       n,
+                                         rocblas_double_complex* A,
+                                         const rocblas_int       lda,
+                                         const double            vl,
+                                         const double            vu,
+                                         const rocblas_int       il,
+                                         const rocblas_int       iu,
+                                         const double            abstol,
+                                         rocblas_int*            nev,
+                                         double*                 W,
+                                         rocblas_int*            info);
+
 /******************** PARAMS ********************/
 struct hipsolverParams
 {
-    hipsolverDnFunction_t func;
-    hipsolverAlgMode_t    alg;
+    static constexpr int num_ext_functions = HIPSOLVERDN_EXT_GEQRF - HIPSOLVERDN_EXT_SYEVD + 1;
+
+    // Algorithm selected for each extension function, indexed from HIPSOLVERDN_EXT_SYEVD
+    hipsolverAlgMode_t ext_algs[num_ext_functions];
 
     // Constructor
     explicit hipsolverParams()
-        : func(HIPSOLVERDN_GETRF)
-        , alg(HIPSOLVER_ALG_0)
     {
+        for(int i = 0; i < num_ext_functions; i++)
+            ext_algs[i] = HIPSOLVER_ALG_0;
+    }
+};
+
+// Returns the algorithm selected for the extension function func with
+// hipsolverDnSetAdvOptions. The choices are:
+// - HIPSOLVERDN_EXT_SYEVD: divide and conquer (ALG_0) or implicit QL/QR iteration (ALG_1)
+//   on the tridiagonal form.
+// - HIPSOLVERDN_EXT_GESVD: bidiagonal QR iteration on the device (ALG_0) or split between
+//   the host and the device (ALG_1).
+// - HIPSOLVERDN_EXT_GEQRF: the tall-skinny QR factorization when the matrix is tall and
+//   narrow enough (ALG_0), or whenever m >= n (ALG_1).
+// HIPSOLVERDN_GETRF only accepts ALG_0, as rocSOLVER provides a single LU factorization.
+static hipsolverAlgMode_t get_alg(hipsolverDnParams_t params, hipsolverDnFunction_t func)
+{
+    return ((hipsolverParams*)params)->ext_algs[func - HIPSOLVERDN_EXT_SYEVD];
+}
+
+// Sets the rocSOLVER algorithm mode of func while in scope
+class scoped_alg_mode
+{
+public:
+    scoped_alg_mode(rocblas_handle handle, rocsolver_function func, hipsolverAlgMode_t alg)
+        : handle(handle)
+        , func(func)
+    {
+        rocblas_status status = rocsolver_get_alg_mode(handle, func, &prev_mode);
+        if(status == rocblas_status_success)
+            status = rocsolver_set_alg_mode(handle, func, hipsolver::hip2rocsolver_algmode(alg));
+        if(status != rocblas_status_success)
+            throw hipsolver::rocblas2hip_status(status);
     }
+
+    ~scoped_alg_mode()
+    {
+        rocsolver_set_alg_mode(handle, func, prev_mode);
+    }
+
+private:
+    rocblas_handle     handle;
+    rocsolver_function func;
+    rocsolver_alg_mode prev_mode;
 };
 
 hipsolverStatus_t hipsolverDnCreateParams(hipsolverDnParams_t* info)
@@ -183,7 +378,20 @@ hipsolverStatus_t hipsolverDnSetAdvOptions(hipsolverDnParams_t   params,
                                            hipsolverAlgMode_t    alg)
 try
 {
-    return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(func != HIPSOLVERDN_GETRF && (func < HIPSOLVERDN_EXT_SYEVD || func > HIPSOLVERDN_EXT_GEQRF))
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(alg != HIPSOLVER_ALG_0 && alg != HIPSOLVER_ALG_1)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    // rocSOLVER provides a single LU factorization
+    if(func == HIPSOLVERDN_GETRF)
+        return alg == HIPSOLVER_ALG_0 ? HIPSOLVER_STATUS_SUCCESS : HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    ((hipsolverParams*)params)->ext_algs[func - HIPSOLVERDN_EXT_SYEVD] = alg;
+
+    return HIPSOLVER_STATUS_SUCCESS;
 }
 catch(...)
 {
@@ -191,6 +399,36 @@ catch(...)
 }
 
 /******************** GEQRF ********************/
+// Returns true if hipsolverDnXgeqrf uses the tall-skinny QR factorization, which is only
+// the case when it is requested with HIPSOLVER_ALG_1. It is called through the 32-bit
+// interface, so the sizes must fit.
+static bool geqrf_use_tsqr(hipsolverDnParams_t params,
+                           int64_t             m,
+                           int64_t             n,
+                           int64_t             lda,
+                           hipDataType         dataTypeA,
+                           hipDataType         dataTypeTau,
+                           hipDataType         computeType)
+{
+    if(get_alg(params, HIPSOLVERDN_EXT_GEQRF) != HIPSOLVER_ALG_1)
+        return false;
+    if(dataTypeTau != dataTypeA || computeType != dataTypeA)
+        return false;
+    if(!fits_rocblas_int({m, n, lda}) || n < 1 || m < n)
+        return false;
+
+    switch(dataTypeA)
+    {
+    case HIP_R_32F:
+    case HIP_R_64F:
+    case HIP_C_32F:
+    case HIP_C_64F:
+        return true;
+    default:
+        return false;
+    }
+}
+
 hipsolverStatus_t hipsolverDnXgeqrf_bufferSize(hipsolverDnHandle_t handle,
                                                hipsolverDnParams_t params,
                                                int64_t             m,
@@ -215,6 +453,25 @@ try
     *lworkOnDevice = 0;
     *lworkOnHost   = 0;
 
+    if(geqrf_use_tsqr(params, m, n, lda, dataTypeA, dataTypeTau, computeType))
+    {
+        switch(dataTypeA)
+        {
+        case HIP_R_32F:
+            return hipsolver::tsqr_device_size<float>((rocblas_handle)handle, m, n, lworkOnDevice);
+        case HIP_R_64F:
+            return hipsolver::tsqr_device_size<double>((rocblas_handle)handle, m, n, lworkOnDevice);
+        case HIP_C_32F:
+            return hipsolver::tsqr_device_size<rocblas_float_complex>(
+                (rocblas_handle)handle, m, n, lworkOnDevice);
+        case HIP_C_64F:
+            return hipsolver::tsqr_device_size<rocblas_double_complex>(
+                (rocblas_handle)handle, m, n, lworkOnDevice);
+        default:
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+        }
+    }
+
     rocblas_start_device_memory_size_query((rocblas_handle)handle);
     hipsolverStatus_t status;
     if(dataTypeA == HIP_R_32F && dataTypeTau == HIP_R_32F && computeType == HIP_R_32F)
@@ -265,11 +522,64 @@ hipsolverStatus_t hipsolverDnXgeqrf(hipsolverDnHandle_t handle,
                                     int*                devInfo)
 try
 {
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"m", m}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "geqrf_64");
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
+    if(geqrf_use_tsqr(params, m, n, lda, dataTypeA, dataTypeTau, computeType))
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverZeroInfo((rocblas_handle)handle, devInfo, 1));
+
+        switch(dataTypeA)
+        {
+        case HIP_R_32F:
+            return hipsolver::tsqr_geqrf_execute((rocblas_handle)handle,
+                                                 m,
+                                                 n,
+                                                 (float*)A,
+                                                 lda,
+                                                 (float*)tau,
+                                                 workOnDevice,
+                                                 lworkOnDevice);
+        case HIP_R_64F:
+            return hipsolver::tsqr_geqrf_execute((rocblas_handle)handle,
+                                                 m,
+                                                 n,
+                                                 (double*)A,
+                                                 lda,
+                                                 (double*)tau,
+                                                 workOnDevice,
+                                                 lworkOnDevice);
+        case HIP_C_32F:
+            return hipsolver::tsqr_geqrf_execute((rocblas_handle)handle,
+                                                 m,
+                                                 n,
+                                                 (rocblas_float_complex*)A,
+                                                 lda,
+                                                 (rocblas_float_complex*)tau,
+                                                 workOnDevice,
+                                                 lworkOnDevice);
+        case HIP_C_64F:
+            return hipsolver::tsqr_geqrf_execute((rocblas_handle)handle,
+                                                 m,
+                                                 n,
+                                                 (rocblas_double_complex*)A,
+                                                 lda,
+                                                 (rocblas_double_complex*)tau,
+                                                 workOnDevice,
+                                                 lworkOnDevice);
+        default:
+            return HIPSOLVER_STATUS_INVALID_ENUM;
+        }
+    }
+
     if(workOnDevice && lworkOnDevice)
         CHECK_ROCBLAS_ERROR(
             rocblas_set_workspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
@@ -404,6 +714,12 @@ hipsolverStatus_t hipsolverDnXgetrf(hipsolverDnHandle_t handle,
                                     int*                devInfo)
 try
 {
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"m", m}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "getrf_64");
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -588,6 +904,16 @@ hipsolverStatus_t hipsolverDnXgetrs(hipsolverDnHandle_t  handle,
                                     int*                 devInfo)
 try
 {
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"trans", trans},
+                                  {"n", n},
+                                  {"nrhs", nrhs},
+                                  {"lda", lda},
+                                  {"ldb", ldb}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "getrs_64");
+
     size_t lwork;
     CHECK_HIPSOLVER_ERROR(hipsolverInternalXgetrs_bufferSize((rocblas_handle)handle,
                                                              params,
@@ -737,6 +1063,8 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrf(hipsolverDnHandle_t handle,
                                                      int*                info)
 try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"uplo", uplo}, {"n", n}, {"lda", lda}});
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -813,6 +1141,9 @@ HIPSOLVER_EXPORT hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
                                                      int*                info)
 try
 {
+    hipsolver::api_logger logger(
+        handle, __func__, {{"uplo", uplo}, {"n", n}, {"nrhs", nrhs}, {"lda", lda}, {"ldb", ldb}});
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -870,4 +1201,1391 @@ catch(...)
     return hipsolver::exception2hip_status();
 }
 
+/******************** SYEVD ********************/
+hipsolverStatus_t hipsolverDnXsyevd_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeW,
+                                               const void*         W,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(!fits_rocblas_int({n, lda}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    bool use_qr = get_alg(params, HIPSOLVERDN_EXT_SYEVD) == HIPSOLVER_ALG_1;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+    size_t            size_E = 0;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        auto syevd = use_qr ? rocsolver_ssyev : rocsolver_ssyevd;
+
+        status = hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                     hipsolver::hip2rocblas_evect(jobz),
+                                                     hipsolver::hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr));
+        size_E = sizeof(float) * n;
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        auto syevd = use_qr ? rocsolver_dsyev : rocsolver_dsyevd;
+
+        status = hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                     hipsolver::hip2rocblas_evect(jobz),
+                                                     hipsolver::hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr));
+        size_E = sizeof(double) * n;
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        auto syevd = use_qr ? rocsolver_cheev : rocsolver_cheevd;
+
+        status = hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                     hipsolver::hip2rocblas_evect(jobz),
+                                                     hipsolver::hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr));
+        size_E = sizeof(float) * n;
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        auto syevd = use_qr ? rocsolver_zheev : rocsolver_zheevd;
+
+        status = hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                     hipsolver::hip2rocblas_evect(jobz),
+                                                     hipsolver::hip2rocblas_fill(uplo),
+                                                     n,
+                                                     nullptr,
+                                                     lda,
+                                                     nullptr,
+                                                     nullptr,
+                                                     nullptr));
+        size_E = sizeof(double) * n;
+    }
+    else
+        status = HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // space for E array
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, *lworkOnDevice, size_E);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevd(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    hipsolverEigMode_t  jobz,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeW,
+                                    void*               W,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz}, {"uplo", uplo}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 dataTypeA == HIP_C_32F || dataTypeA == HIP_C_64F ? "heevd_64"
+                                                                                  : "syevd_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!fits_rocblas_int({n, lda}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    size_t size_E;
+    if(dataTypeW == HIP_R_32F)
+        size_E = n > 0 ? sizeof(float) * n : 0;
+    else if(dataTypeW == HIP_R_64F)
+        size_E = n > 0 ? sizeof(double) * n : 0;
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver::pool_device_malloc mem((rocblas_handle)handle);
+    void*                         E;
+
+    if(workOnDevice && lworkOnDevice)
+    {
+        if(lworkOnDevice < size_E)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        E = workOnDevice;
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace(
+            (rocblas_handle)handle, (char*)workOnDevice + size_E, lworkOnDevice - size_E));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXsyevd_bufferSize((rocblas_handle)handle,
+                                                           params,
+                                                           jobz,
+                                                           uplo,
+                                                           n,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           dataTypeW,
+                                                           W,
+                                                           computeType,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+
+        // E is taken from the memory pool, so the workspace is grown without room for it
+        mem = hipsolver::pool_device_malloc((rocblas_handle)handle, size_E);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E = mem[0];
+        lworkOnDevice -= size_E;
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+    }
+
+    bool use_qr = get_alg(params, HIPSOLVERDN_EXT_SYEVD) == HIPSOLVER_ALG_1;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        auto syevd = use_qr ? rocsolver_ssyev : rocsolver_ssyevd;
+        return hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                   hipsolver::hip2rocblas_evect(jobz),
+                                                   hipsolver::hip2rocblas_fill(uplo),
+                                                   n,
+                                                   (float*)A,
+                                                   lda,
+                                                   (float*)W,
+                                                   (float*)E,
+                                                   info));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        auto syevd = use_qr ? rocsolver_dsyev : rocsolver_dsyevd;
+        return hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                   hipsolver::hip2rocblas_evect(jobz),
+                                                   hipsolver::hip2rocblas_fill(uplo),
+                                                   n,
+                                                   (double*)A,
+                                                   lda,
+                                                   (double*)W,
+                                                   (double*)E,
+                                                   info));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        auto syevd = use_qr ? rocsolver_cheev : rocsolver_cheevd;
+        return hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                   hipsolver::hip2rocblas_evect(jobz),
+                                                   hipsolver::hip2rocblas_fill(uplo),
+                                                   n,
+                                                   (rocblas_float_complex*)A,
+                                                   lda,
+                                                   (float*)W,
+                                                   (float*)E,
+                                                   info));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        auto syevd = use_qr ? rocsolver_zheev : rocsolver_zheevd;
+        return hipsolver::rocblas2hip_status(syevd((rocblas_handle)handle,
+                                                   hipsolver::hip2rocblas_evect(jobz),
+                                                   hipsolver::hip2rocblas_fill(uplo),
+                                                   n,
+                                                   (rocblas_double_complex*)A,
+                                                   lda,
+                                                   (double*)W,
+                                                   (double*)E,
+                                                   info));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVDX ********************/
+hipsolverStatus_t hipsolverDnXsyevdx_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverEigRange_t range,
+                                                hipsolverFillMode_t uplo,
+                                                int64_t             n,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                void*               vl,
+                                                void*               vu,
+                                                int64_t             il,
+                                                int64_t             iu,
+                                                int64_t*            nev,
+                                                hipDataType         dataTypeW,
+                                                const void*         W,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(!fits_rocblas_int({n, lda, il, iu}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_ssyevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      nullptr,
+                                      lda,
+                                      vl ? *(float*)vl : 0,
+                                      vu ? *(float*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_dsyevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      nullptr,
+                                      lda,
+                                      vl ? *(double*)vl : 0,
+                                      vu ? *(double*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_cheevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      nullptr,
+                                      lda,
+                                      vl ? *(float*)vl : 0,
+                                      vu ? *(float*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_zheevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      nullptr,
+                                      lda,
+                                      vl ? *(double*)vl : 0,
+                                      vu ? *(double*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nullptr,
+                                      nullptr,
+                                      nullptr));
+    }
+    else
+        status = HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevdx(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipsolverFillMode_t uplo,
+                                     int64_t             n,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     void*               vl,
+                                     void*               vu,
+                                     int64_t             il,
+                                     int64_t             iu,
+                                     int64_t*            nev,
+                                     hipDataType         dataTypeW,
+                                     void*               W,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz},
+                                  {"range", range},
+                                  {"uplo", uplo},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"vl", hipsolver::log_real(dataTypeW, vl)},
+                                  {"vu", hipsolver::log_real(dataTypeW, vu)},
+                                  {"il", il},
+                                  {"iu", iu}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 dataTypeA == HIP_C_32F || dataTypeA == HIP_C_64F ? "heevdx_64"
+                                                                                  : "syevdx_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!fits_rocblas_int({n, lda, il, iu}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    if(workOnDevice && lworkOnDevice)
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_workspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXsyevdx_bufferSize((rocblas_handle)handle,
+                                                            params,
+                                                            jobz,
+                                                            range,
+                                                            uplo,
+                                                            n,
+                                                            dataTypeA,
+                                                            A,
+                                                            lda,
+                                                            vl,
+                                                            vu,
+                                                            il,
+                                                            iu,
+                                                            nev,
+                                                            dataTypeW,
+                                                            W,
+                                                            computeType,
+                                                            &lworkOnDevice,
+                                                            &lworkOnHost));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+    }
+
+    rocblas_int       nev32 = 0;
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeW == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_ssyevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      (float*)A,
+                                      lda,
+                                      vl ? *(float*)vl : 0,
+                                      vu ? *(float*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nev ? &nev32 : nullptr,
+                                      (float*)W,
+                                      info));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeW == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_dsyevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      (double*)A,
+                                      lda,
+                                      vl ? *(double*)vl : 0,
+                                      vu ? *(double*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nev ? &nev32 : nullptr,
+                                      (double*)W,
+                                      info));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeW == HIP_R_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_cheevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      (rocblas_float_complex*)A,
+                                      lda,
+                                      vl ? *(float*)vl : 0,
+                                      vu ? *(float*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nev ? &nev32 : nullptr,
+                                      (float*)W,
+                                      info));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeW == HIP_R_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(
+            rocsolver_zheevdx_inplace((rocblas_handle)handle,
+                                      hipsolver::hip2rocblas_evect(jobz),
+                                      hipsolver::hip2rocblas_erange(range),
+                                      hipsolver::hip2rocblas_fill(uplo),
+                                      n,
+                                      (rocblas_double_complex*)A,
+                                      lda,
+                                      vl ? *(double*)vl : 0,
+                                      vu ? *(double*)vu : 0,
+                                      il,
+                                      iu,
+                                      0,
+                                      nev ? &nev32 : nullptr,
+                                      (double*)W,
+                                      info));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    if(nev)
+        *nev = nev32;
+
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverDnXgesvd_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               signed char         jobu,
+                                               signed char         jobv,
+                                               int64_t             m,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeS,
+                                               const void*         S,
+                                               hipDataType         dataTypeU,
+                                               const void*         U,
+                                               int64_t             ldu,
+                                               hipDataType         dataTypeV,
+                                               const void*         V,
+                                               int64_t             ldv,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(!fits_rocblas_int({m, n, lda, ldu, ldv}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    scoped_alg_mode alg_mode(
+        (rocblas_handle)handle, rocsolver_function_gesvd, get_alg(params, HIPSOLVERDN_EXT_GESVD));
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+    size_t            size_E = 0;
+    if(dataTypeA == HIP_R_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_R_32F
+       && dataTypeV == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
+                                                                hipsolver::char2rocblas_svect(jobu),
+                                                                hipsolver::char2rocblas_svect(jobv),
+                                                                m,
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr,
+                                                                nullptr,
+                                                                ldu,
+                                                                nullptr,
+                                                                ldv,
+                                                                nullptr,
+                                                                rocblas_outofplace,
+                                                                nullptr));
+        size_E = sizeof(float) * std::min(m, n);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_R_64F
+            && dataTypeV == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
+                                                                hipsolver::char2rocblas_svect(jobu),
+                                                                hipsolver::char2rocblas_svect(jobv),
+                                                                m,
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr,
+                                                                nullptr,
+                                                                ldu,
+                                                                nullptr,
+                                                                ldv,
+                                                                nullptr,
+                                                                rocblas_outofplace,
+                                                                nullptr));
+        size_E = sizeof(double) * std::min(m, n);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_C_32F
+            && dataTypeV == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
+                                                                hipsolver::char2rocblas_svect(jobu),
+                                                                hipsolver::char2rocblas_svect(jobv),
+                                                                m,
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr,
+                                                                nullptr,
+                                                                ldu,
+                                                                nullptr,
+                                                                ldv,
+                                                                nullptr,
+                                                                rocblas_outofplace,
+                                                                nullptr));
+        size_E = sizeof(float) * std::min(m, n);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_C_64F
+            && dataTypeV == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
+                                                                hipsolver::char2rocblas_svect(jobu),
+                                                                hipsolver::char2rocblas_svect(jobv),
+                                                                m,
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr,
+                                                                nullptr,
+                                                                ldu,
+                                                                nullptr,
+                                                                ldv,
+                                                                nullptr,
+                                                                rocblas_outofplace,
+                                                                nullptr));
+        size_E = sizeof(double) * std::min(m, n);
+    }
+    else
+        status = HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    // space for E array
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    rocblas_set_optimal_device_memory_size((rocblas_handle)handle, *lworkOnDevice, size_E);
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvd(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    signed char         jobu,
+                                    signed char         jobv,
+                                    int64_t             m,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeS,
+                                    void*               S,
+                                    hipDataType         dataTypeU,
+                                    void*               U,
+                                    int64_t             ldu,
+                                    hipDataType         dataTypeV,
+                                    void*               V,
+                                    int64_t             ldv,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobu", jobu},
+                                  {"jobv", jobv},
+                                  {"m", m},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"ldu", ldu},
+                                  {"ldv", ldv}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "gesvd_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!fits_rocblas_int({m, n, lda, ldu, ldv}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    size_t size_E;
+    if(dataTypeS == HIP_R_32F)
+        size_E = std::min(m, n) > 0 ? sizeof(float) * std::min(m, n) : 0;
+    else if(dataTypeS == HIP_R_64F)
+        size_E = std::min(m, n) > 0 ? sizeof(double) * std::min(m, n) : 0;
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver::pool_device_malloc mem((rocblas_handle)handle);
+    void*                         E;
+
+    if(workOnDevice && lworkOnDevice)
+    {
+        if(lworkOnDevice < size_E)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        E = workOnDevice;
+        CHECK_ROCBLAS_ERROR(rocblas_set_workspace(
+            (rocblas_handle)handle, (char*)workOnDevice + size_E, lworkOnDevice - size_E));
+    }
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXgesvd_bufferSize((rocblas_handle)handle,
+                                                           params,
+                                                           jobu,
+                                                           jobv,
+                                                           m,
+                                                           n,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           dataTypeS,
+                                                           S,
+                                                           dataTypeU,
+                                                           U,
+                                                           ldu,
+                                                           dataTypeV,
+                                                           V,
+                                                           ldv,
+                                                           computeType,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+
+        // E is taken from the memory pool, so the workspace is grown without room for it
+        mem = hipsolver::pool_device_malloc((rocblas_handle)handle, size_E);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        E = mem[0];
+        lworkOnDevice -= size_E;
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+    }
+
+    scoped_alg_mode alg_mode(
+        (rocblas_handle)handle, rocsolver_function_gesvd, get_alg(params, HIPSOLVERDN_EXT_GESVD));
+
+    if(dataTypeA == HIP_R_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_R_32F
+       && dataTypeV == HIP_R_32F && computeType == HIP_R_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_sgesvd((rocblas_handle)handle,
+                                                              hipsolver::char2rocblas_svect(jobu),
+                                                              hipsolver::char2rocblas_svect(jobv),
+                                                              m,
+                                                              n,
+                                                              (float*)A,
+                                                              lda,
+                                                              (float*)S,
+                                                              (float*)U,
+                                                              ldu,
+                                                              (float*)V,
+                                                              ldv,
+                                                              (float*)E,
+                                                              rocblas_outofplace,
+                                                              info));
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_R_64F
+            && dataTypeV == HIP_R_64F && computeType == HIP_R_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_dgesvd((rocblas_handle)handle,
+                                                              hipsolver::char2rocblas_svect(jobu),
+                                                              hipsolver::char2rocblas_svect(jobv),
+                                                              m,
+                                                              n,
+                                                              (double*)A,
+                                                              lda,
+                                                              (double*)S,
+                                                              (double*)U,
+                                                              ldu,
+                                                              (double*)V,
+                                                              ldv,
+                                                              (double*)E,
+                                                              rocblas_outofplace,
+                                                              info));
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeS == HIP_R_32F && dataTypeU == HIP_C_32F
+            && dataTypeV == HIP_C_32F && computeType == HIP_C_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_cgesvd((rocblas_handle)handle,
+                                                              hipsolver::char2rocblas_svect(jobu),
+                                                              hipsolver::char2rocblas_svect(jobv),
+                                                              m,
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              (float*)S,
+                                                              (rocblas_float_complex*)U,
+                                                              ldu,
+                                                              (rocblas_float_complex*)V,
+                                                              ldv,
+                                                              (float*)E,
+                                                              rocblas_outofplace,
+                                                              info));
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeS == HIP_R_64F && dataTypeU == HIP_C_64F
+            && dataTypeV == HIP_C_64F && computeType == HIP_C_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_zgesvd((rocblas_handle)handle,
+                                                              hipsolver::char2rocblas_svect(jobu),
+                                                              hipsolver::char2rocblas_svect(jobv),
+                                                              m,
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              (double*)S,
+                                                              (rocblas_double_complex*)U,
+                                                              ldu,
+                                                              (rocblas_double_complex*)V,
+                                                              ldv,
+                                                              (double*)E,
+                                                              rocblas_outofplace,
+                                                              info));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+
+/******************** SYTRS ********************/
+hipsolverStatus_t hipsolverDnXsytrs_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               int64_t             nrhs,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               const int64_t*      ipiv,
+                                               hipDataType         dataTypeB,
+                                               void*               B,
+                                               int64_t             ldb,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(!fits_rocblas_int({n, nrhs, lda, ldb}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    // the solve runs in a kernel that needs no workspace
+    if(!(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
+       && !(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
+       && !(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
+       && !(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F))
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsytrs(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    int64_t             nrhs,
+                                    hipDataType         dataTypeA,
+                                    const void*         A,
+                                    int64_t             lda,
+                                    const int64_t*      ipiv,
+                                    hipDataType         dataTypeB,
+                                    void*               B,
+                                    int64_t             ldb,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"uplo", uplo},
+                                  {"n", n},
+                                  {"nrhs", nrhs},
+                                  {"lda", lda},
+                                  {"ldb", ldb}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "sytrs_64");
+
+    size_t size_W, size_hW;
+    CHECK_HIPSOLVER_ERROR(hipsolverDnXsytrs_bufferSize((rocblas_handle)handle,
+                                                       uplo,
+                                                       n,
+                                                       nrhs,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       ipiv,
+                                                       dataTypeB,
+                                                       B,
+                                                       ldb,
+                                                       &size_W,
+                                                       &size_hW));
+
+    CHECK_ROCBLAS_ERROR(hipsolverZeroInfo((rocblas_handle)handle, info, 1));
+
+    if(dataTypeA == HIP_R_32F && dataTypeB == HIP_R_32F)
+    {
+        return hipsolver::sytrs_template((rocblas_handle)handle,
+                                         hipsolver::hip2rocblas_fill(uplo),
+                                         n,
+                                         nrhs,
+                                         (float*)const_cast<void*>(A),
+                                         lda,
+                                         ipiv,
+                                         (float*)B,
+                                         ldb);
+    }
+    else if(dataTypeA == HIP_R_64F && dataTypeB == HIP_R_64F)
+    {
+        return hipsolver::sytrs_template((rocblas_handle)handle,
+                                         hipsolver::hip2rocblas_fill(uplo),
+                                         n,
+                                         nrhs,
+                                         (double*)const_cast<void*>(A),
+                                         lda,
+                                         ipiv,
+                                         (double*)B,
+                                         ldb);
+    }
+    else if(dataTypeA == HIP_C_32F && dataTypeB == HIP_C_32F)
+    {
+        return hipsolver::sytrs_template((rocblas_handle)handle,
+                                         hipsolver::hip2rocblas_fill(uplo),
+                                         n,
+                                         nrhs,
+                                         (rocblas_float_complex*)const_cast<void*>(A),
+                                         lda,
+                                         ipiv,
+                                         (rocblas_float_complex*)B,
+                                         ldb);
+    }
+    else if(dataTypeA == HIP_C_64F && dataTypeB == HIP_C_64F)
+    {
+        return hipsolver::sytrs_template((rocblas_handle)handle,
+                                         hipsolver::hip2rocblas_fill(uplo),
+                                         n,
+                                         nrhs,
+                                         (rocblas_double_complex*)const_cast<void*>(A),
+                                         lda,
+                                         ipiv,
+                                         (rocblas_double_complex*)B,
+                                         ldb);
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+
+/******************** TRTRI ********************/
+hipsolverStatus_t hipsolverDnXtrtri_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               hipblasDiagType_t   diag,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               void*               A,
+                                               int64_t             lda,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(!fits_rocblas_int({n, lda}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    rocblas_start_device_memory_size_query((rocblas_handle)handle);
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_strtri((rocblas_handle)handle,
+                                                                hipsolver::hip2rocblas_fill(uplo),
+                                                                hipsolver::hip2rocblas_diag(diag),
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr));
+    }
+    else if(dataTypeA == HIP_R_64F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_dtrtri((rocblas_handle)handle,
+                                                                hipsolver::hip2rocblas_fill(uplo),
+                                                                hipsolver::hip2rocblas_diag(diag),
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr));
+    }
+    else if(dataTypeA == HIP_C_32F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_ctrtri((rocblas_handle)handle,
+                                                                hipsolver::hip2rocblas_fill(uplo),
+                                                                hipsolver::hip2rocblas_diag(diag),
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr));
+    }
+    else if(dataTypeA == HIP_C_64F)
+    {
+        status = hipsolver::rocblas2hip_status(rocsolver_ztrtri((rocblas_handle)handle,
+                                                                hipsolver::hip2rocblas_fill(uplo),
+                                                                hipsolver::hip2rocblas_diag(diag),
+                                                                n,
+                                                                nullptr,
+                                                                lda,
+                                                                nullptr));
+    }
+    else
+        status = HIPSOLVER_STATUS_INVALID_ENUM;
+    rocblas_stop_device_memory_size_query((rocblas_handle)handle, lworkOnDevice);
+
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXtrtri(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    hipblasDiagType_t   diag,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"uplo", uplo}, {"diag", diag}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "trtri_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!fits_rocblas_int({n, lda}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
+    if(workOnDevice && lworkOnDevice)
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_workspace((rocblas_handle)handle, workOnDevice, lworkOnDevice));
+    else
+    {
+        CHECK_HIPSOLVER_ERROR(hipsolverDnXtrtri_bufferSize((rocblas_handle)handle,
+                                                           uplo,
+                                                           diag,
+                                                           n,
+                                                           dataTypeA,
+                                                           A,
+                                                           lda,
+                                                           &lworkOnDevice,
+                                                           &lworkOnHost));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace((rocblas_handle)handle, lworkOnDevice));
+    }
+
+    if(dataTypeA == HIP_R_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_strtri((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              hipsolver::hip2rocblas_diag(diag),
+                                                              n,
+                                                              (float*)A,
+                                                              lda,
+                                                              info));
+    }
+    else if(dataTypeA == HIP_R_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_dtrtri((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              hipsolver::hip2rocblas_diag(diag),
+                                                              n,
+                                                              (double*)A,
+                                                              lda,
+                                                              info));
+    }
+    else if(dataTypeA == HIP_C_32F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_ctrtri((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              hipsolver::hip2rocblas_diag(diag),
+                                                              n,
+                                                              (rocblas_float_complex*)A,
+                                                              lda,
+                                                              info));
+    }
+    else if(dataTypeA == HIP_C_64F)
+    {
+        return hipsolver::rocblas2hip_status(rocsolver_ztrtri((rocblas_handle)handle,
+                                                              hipsolver::hip2rocblas_fill(uplo),
+                                                              hipsolver::hip2rocblas_diag(diag),
+                                                              n,
+                                                              (rocblas_double_complex*)A,
+                                                              lda,
+                                                              info));
+    }
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVDR ********************/
+hipsolverStatus_t hipsolverDnXgesvdr_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                signed char         jobu,
+                                                signed char         jobv,
+                                                int64_t             m,
+                                                int64_t             n,
+                                                int64_t             k,
+                                                int64_t             p,
+                                                int64_t             niters,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                hipDataType         dataTypeSrand,
+                                                const void*         Srand,
+                                                hipDataType         dataTypeUrand,
+                                                const void*         Urand,
+                                                int64_t             ldUrand,
+                                                hipDataType         dataTypeVrand,
+                                                const void*         Vrand,
+                                                int64_t             ldVrand,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!lworkOnDevice || !lworkOnHost)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *lworkOnDevice = 0;
+    *lworkOnHost   = 0;
+
+    if(!fits_rocblas_int({m, n, k, p, niters, lda, ldUrand, ldVrand}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(k < 1 || p < 0 || k + p > std::min(m, n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverStatus_t status;
+    if(dataTypeA == HIP_R_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_R_32F
+       && dataTypeVrand == HIP_R_32F && computeType == HIP_R_32F)
+        status = hipsolver::gesvdr_device_size<float, float>(
+            (rocblas_handle)handle, m, n, k + p, lworkOnDevice);
+    else if(dataTypeA == HIP_R_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_R_64F
+            && dataTypeVrand == HIP_R_64F && computeType == HIP_R_64F)
+        status = hipsolver::gesvdr_device_size<double, double>(
+            (rocblas_handle)handle, m, n, k + p, lworkOnDevice);
+    else if(dataTypeA == HIP_C_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_C_32F
+            && dataTypeVrand == HIP_C_32F && computeType == HIP_C_32F)
+        status = hipsolver::gesvdr_device_size<rocblas_float_complex, float>(
+            (rocblas_handle)handle, m, n, k + p, lworkOnDevice);
+    else if(dataTypeA == HIP_C_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_C_64F
+            && dataTypeVrand == HIP_C_64F && computeType == HIP_C_64F)
+        status = hipsolver::gesvdr_device_size<rocblas_double_complex, double>(
+            (rocblas_handle)handle, m, n, k + p, lworkOnDevice);
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    return status;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvdr(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     signed char         jobu,
+                                     signed char         jobv,
+                                     int64_t             m,
+                                     int64_t             n,
+                                     int64_t             k,
+                                     int64_t             p,
+                                     int64_t             niters,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     hipDataType         dataTypeSrand,
+                                     void*               Srand,
+                                     hipDataType         dataTypeUrand,
+                                     void*               Urand,
+                                     int64_t             ldUrand,
+                                     hipDataType         dataTypeVrand,
+                                     void*               Vrand,
+                                     int64_t             ldVrand,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobu", jobu},
+                                  {"jobv", jobv},
+                                  {"m", m},
+                                  {"n", n},
+                                  {"rank", k},
+                                  {"p", p},
+                                  {"niters", niters},
+                                  {"lda", lda},
+                                  {"ldu", ldUrand},
+                                  {"ldv", ldVrand}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "gesvdr_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((jobu != 'S' && jobu != 'N') || (jobv != 'S' && jobv != 'N'))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!fits_rocblas_int({m, n, k, p, niters, lda, ldUrand, ldVrand}))
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    if(k < 1 || p < 0 || k + p > std::min(m, n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocblas_svect left_svect  = jobu == 'S' ? rocblas_svect_singular : rocblas_svect_none;
+    rocblas_svect right_svect = jobv == 'S' ? rocblas_svect_singular : rocblas_svect_none;
+
+    if(dataTypeA == HIP_R_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_R_32F
+       && dataTypeVrand == HIP_R_32F && computeType == HIP_R_32F)
+        return gesvdr_execute<float, float>((rocblas_handle)handle,
+                                            left_svect,
+                                            right_svect,
+                                            m,
+                                            n,
+                                            k,
+                                            p,
+                                            niters,
+                                            A,
+                                            lda,
+                                            Srand,
+                                            Urand,
+                                            ldUrand,
+                                            Vrand,
+                                            ldVrand,
+                                            workOnDevice,
+                                            lworkOnDevice,
+                                            info);
+    else if(dataTypeA == HIP_R_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_R_64F
+            && dataTypeVrand == HIP_R_64F && computeType == HIP_R_64F)
+        return gesvdr_execute<double, double>((rocblas_handle)handle,
+                                              left_svect,
+                                              right_svect,
+                                              m,
+                                              n,
+                                              k,
+                                              p,
+                                              niters,
+                                              A,
+                                              lda,
+                                              Srand,
+                                              Urand,
+                                              ldUrand,
+                                              Vrand,
+                                              ldVrand,
+                                              workOnDevice,
+                                              lworkOnDevice,
+                                              info);
+    else if(dataTypeA == HIP_C_32F && dataTypeSrand == HIP_R_32F && dataTypeUrand == HIP_C_32F
+            && dataTypeVrand == HIP_C_32F && computeType == HIP_C_32F)
+        return gesvdr_execute<rocblas_float_complex, float>((rocblas_handle)handle,
+                                                            left_svect,
+                                                            right_svect,
+                                                            m,
+                                                            n,
+                                                            k,
+                                                            p,
+                                                            niters,
+                                                            A,
+                                                            lda,
+                                                            Srand,
+                                                            Urand,
+                                                            ldUrand,
+                                                            Vrand,
+                                                            ldVrand,
+                                                            workOnDevice,
+                                                            lworkOnDevice,
+                                                            info);
+    else if(dataTypeA == HIP_C_64F && dataTypeSrand == HIP_R_64F && dataTypeUrand == HIP_C_64F
+            && dataTypeVrand == HIP_C_64F && computeType == HIP_C_64F)
+        return gesvdr_execute<rocblas_double_complex, double>((rocblas_handle)handle,
+                                                              left_svect,
+                                                              right_svect,
+                                                              m,
+                                                              n,
+                                                              k,
+                                                              p,
+                                                              niters,
+                                                              A,
+                                                              lda,
+                                                              Srand,
+                                                              Urand,
+                                                              ldUrand,
+                                                              Vrand,
+                                                              ldVrand,
+                                                              workOnDevice,
+                                                              lworkOnDevice,
+                                                              info);
+    else
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
 } //extern C
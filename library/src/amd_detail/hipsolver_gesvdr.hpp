@@ -0,0 +1,713 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Randomized low-rank singular value decomposition. The range of A is sampled
+ *  with a Gaussian test matrix generated on the device by rocRAND, refined with power
+ *  iterations, and the SVD of the projection of A onto that range is computed with
+ *  rocsolver_?gesvd.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
+#include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+#include "rocsolver/rocsolver.h"
+#include <rocrand/rocrand.h>
+
+#include <array>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** ROCBLAS/ROCSOLVER/ROCRAND OVERLOADS ********************/
+// normal distribution
+inline rocrand_status gesvdr_normal(rocrand_generator gen, float* x, size_t n)
+{
+    return rocrand_generate_normal(gen, x, n, 0.0f, 1.0f);
+}
+
+inline rocrand_status gesvdr_normal(rocrand_generator gen, double* x, size_t n)
+{
+    return rocrand_generate_normal_double(gen, x, n, 0.0, 1.0);
+}
+
+// gemm
+inline rocblas_status gesvdr_gemm(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  rocblas_int       k,
+                                  const float*      alpha,
+                                  const float*      A,
+                                  rocblas_int       lda,
+                                  const float*      B,
+                                  rocblas_int       ldb,
+                                  const float*      beta,
+                                  float*            C,
+                                  rocblas_int       ldc)
+{
+    return rocblas_sgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+inline rocblas_status gesvdr_gemm(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  rocblas_int       k,
+                                  const double*     alpha,
+                                  const double*     A,
+                                  rocblas_int       lda,
+                                  const double*     B,
+                                  rocblas_int       ldb,
+                                  const double*     beta,
+                                  double*           C,
+                                  rocblas_int       ldc)
+{
+    return rocblas_dgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+inline rocblas_status gesvdr_gemm(rocblas_handle               handle,
+                                  rocblas_operation            transA,
+                                  rocblas_operation            transB,
+                                  rocblas_int                  m,
+                                  rocblas_int                  n,
+                                  rocblas_int                  k,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* A,
+                                  rocblas_int                  lda,
+                                  const rocblas_float_complex* B,
+                                  rocblas_int                  ldb,
+                                  const rocblas_float_complex* beta,
+                                  rocblas_float_complex*       C,
+                                  rocblas_int                  ldc)
+{
+    return rocblas_cgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+inline rocblas_status gesvdr_gemm(rocblas_handle                handle,
+                                  rocblas_operation             transA,
+                                  rocblas_operation             transB,
+                                  rocblas_int                   m,
+                                  rocblas_int                   n,
+                                  rocblas_int                   k,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* A,
+                                  rocblas_int                   lda,
+                                  const rocblas_double_complex* B,
+                                  rocblas_int                   ldb,
+                                  const rocblas_double_complex* beta,
+                                  rocblas_double_complex*       C,
+                                  rocblas_int                   ldc)
+{
+    return rocblas_zgemm(handle, transA, transB, m, n, k, alpha, A, lda, B, ldb, beta, C, ldc);
+}
+
+// geam
+inline rocblas_status gesvdr_geam(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  const float*      alpha,
+                                  const float*      A,
+                                  rocblas_int       lda,
+                                  const float*      beta,
+                                  const float*      B,
+                                  rocblas_int       ldb,
+                                  float*            C,
+                                  rocblas_int       ldc)
+{
+    return rocblas_sgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+inline rocblas_status gesvdr_geam(rocblas_handle    handle,
+                                  rocblas_operation transA,
+                                  rocblas_operation transB,
+                                  rocblas_int       m,
+                                  rocblas_int       n,
+                                  const double*     alpha,
+                                  const double*     A,
+                                  rocblas_int       lda,
+                                  const double*     beta,
+                                  const double*     B,
+                                  rocblas_int       ldb,
+                                  double*           C,
+                                  rocblas_int       ldc)
+{
+    return rocblas_dgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+inline rocblas_status gesvdr_geam(rocblas_handle               handle,
+                                  rocblas_operation            transA,
+                                  rocblas_operation            transB,
+                                  rocblas_int                  m,
+                                  rocblas_int                  n,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* A,
+                                  rocblas_int                  lda,
+                                  const rocblas_float_complex* beta,
+                                  const rocblas_float_complex* B,
+                                  rocblas_int                  ldb,
+                                  rocblas_float_complex*       C,
+                                  rocblas_int                  ldc)
+{
+    return rocblas_cgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+inline rocblas_status gesvdr_geam(rocblas_handle                handle,
+                                  rocblas_operation             transA,
+                                  rocblas_operation             transB,
+                                  rocblas_int                   m,
+                                  rocblas_int                   n,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* A,
+                                  rocblas_int                   lda,
+                                  const rocblas_double_complex* beta,
+                                  const rocblas_double_complex* B,
+                                  rocblas_int                   ldb,
+                                  rocblas_double_complex*       C,
+                                  rocblas_int                   ldc)
+{
+    return rocblas_zgeam(handle, transA, transB, m, n, alpha, A, lda, beta, B, ldb, C, ldc);
+}
+
+// geqrf
+inline rocblas_status gesvdr_geqrf(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* tau)
+{
+    return rocsolver_sgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status gesvdr_geqrf(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, double* A, rocblas_int lda, double* tau)
+{
+    return rocsolver_dgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status gesvdr_geqrf(rocblas_handle         handle,
+                                   rocblas_int            m,
+                                   rocblas_int            n,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   rocblas_float_complex* tau)
+{
+    return rocsolver_cgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status gesvdr_geqrf(rocblas_handle          handle,
+                                   rocblas_int             m,
+                                   rocblas_int             n,
+                                   rocblas_double_complex* A,
+                                   rocblas_int             lda,
+                                   rocblas_double_complex* tau)
+{
+    return rocsolver_zgeqrf(handle, m, n, A, lda, tau);
+}
+
+// orgqr/ungqr
+inline rocblas_status gesvdr_orgqr(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    k,
+                                   float*         A,
+                                   rocblas_int    lda,
+                                   float*         tau)
+{
+    return rocsolver_sorgqr(handle, m, n, k, A, lda, tau);
+}
+
+inline rocblas_status gesvdr_orgqr(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    k,
+                                   double*        A,
+                                   rocblas_int    lda,
+                                   double*        tau)
+{
+    return rocsolver_dorgqr(handle, m, n, k, A, lda, tau);
+}
+
+inline rocblas_status gesvdr_orgqr(rocblas_handle         handle,
+                                   rocblas_int            m,
+                                   rocblas_int            n,
+                                   rocblas_int            k,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   rocblas_float_complex* tau)
+{
+    return rocsolver_cungqr(handle, m, n, k, A, lda, tau);
+}
+
+inline rocblas_status gesvdr_orgqr(rocblas_handle          handle,
+                                   rocblas_int             m,
+                                   rocblas_int             n,
+                                   rocblas_int             k,
+                                   rocblas_double_complex* A,
+                                   rocblas_int             lda,
+                                   rocblas_double_complex* tau)
+{
+    return rocsolver_zungqr(handle, m, n, k, A, lda, tau);
+}
+
+// gesvd
+inline rocblas_status gesvdr_gesvd(rocblas_handle handle,
+                                   rocblas_svect  left_svect,
+                                   rocblas_svect  right_svect,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   float*         A,
+                                   rocblas_int    lda,
+                                   float*         S,
+                                   float*         U,
+                                   rocblas_int    ldu,
+                                   float*         V,
+                                   rocblas_int    ldv,
+                                   float*         E,
+                                   rocblas_int*   info)
+{
+    return rocsolver_sgesvd(handle,
+                            left_svect,
+                            right_svect,
+                            m,
+                            n,
+                            A,
+                            lda,
+                            S,
+                            U,
+                            ldu,
+                            V,
+                            ldv,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+inline rocblas_status gesvdr_gesvd(rocblas_handle handle,
+                                   rocblas_svect  left_svect,
+                                   rocblas_svect  right_svect,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   double*        A,
+                                   rocblas_int    lda,
+                                   double*        S,
+                                   double*        U,
+                                   rocblas_int    ldu,
+                                   double*        V,
+                                   rocblas_int    ldv,
+                                   double*        E,
+                                   rocblas_int*   info)
+{
+    return rocsolver_dgesvd(handle,
+                            left_svect,
+                            right_svect,
+                            m,
+                            n,
+                            A,
+                            lda,
+                            S,
+                            U,
+                            ldu,
+                            V,
+                            ldv,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+inline rocblas_status gesvdr_gesvd(rocblas_handle         handle,
+                                   rocblas_svect          left_svect,
+                                   rocblas_svect          right_svect,
+                                   rocblas_int            m,
+                                   rocblas_int            n,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   float*                 S,
+                                   rocblas_float_complex* U,
+                                   rocblas_int            ldu,
+                                   rocblas_float_complex* V,
+                                   rocblas_int            ldv,
+                                   float*                 E,
+                                   rocblas_int*           info)
+{
+    return rocsolver_cgesvd(handle,
+                            left_svect,
+                            right_svect,
+                            m,
+                            n,
+                            A,
+                            lda,
+                            S,
+                            U,
+                            ldu,
+                            V,
+                            ldv,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+inline rocblas_status gesvdr_gesvd(rocblas_handle          handle,
+                                   rocblas_svect           left_svect,
+                                   rocblas_svect           right_svect,
+                                   rocblas_int             m,
+                                   rocblas_int             n,
+                                   rocblas_double_complex* A,
+                                   rocblas_int             lda,
+                                   double*                 S,
+                                   rocblas_double_complex* U,
+                                   rocblas_int             ldu,
+                                   rocblas_double_complex* V,
+                                   rocblas_int             ldv,
+                                   double*                 E,
+                                   rocblas_int*            info)
+{
+    return rocsolver_zgesvd(handle,
+                            left_svect,
+                            right_svect,
+                            m,
+                            n,
+                            A,
+                            lda,
+                            S,
+                            U,
+                            ldu,
+                            V,
+                            ldv,
+                            E,
+                            rocblas_outofplace,
+                            info);
+}
+
+
+/******************** GESVDR ********************/
+// Temporary arrays used by gesvdr_template
+enum gesvdr_temp
+{
+    gesvdr_temp_Z, // n-by-l Gaussian test matrix, later the row space sample and the
+    //                right singular vectors of B
+    gesvdr_temp_Y, // m-by-l sample of the column space, later its orthonormal basis Q
+    gesvdr_temp_tau, // Householder scalars of the QR factorizations
+    gesvdr_temp_B, // l-by-n projection Q^H * A
+    gesvdr_temp_S, // singular values of B
+    gesvdr_temp_U, // l-by-l left singular vectors of B
+    gesvdr_temp_E, // superdiagonal used by rocsolver_?gesvd
+    gesvdr_num_temps
+};
+
+// Returns the size in bytes of each temporary array, where l = k + p. Z is rounded up to
+// an even number of entries, as rocRAND generates normal samples in pairs.
+template <typename T, typename S>
+std::array<size_t, gesvdr_num_temps> gesvdr_temp_sizes(rocblas_int m, rocblas_int n, rocblas_int l)
+{
+    std::array<size_t, gesvdr_num_temps> sizes;
+    sizes[gesvdr_temp_Z]   = sizeof(T) * ((size_t(n) * l + 1) / 2) * 2;
+    sizes[gesvdr_temp_Y]   = sizeof(T) * size_t(m) * l;
+    sizes[gesvdr_temp_tau] = sizeof(T) * l;
+    sizes[gesvdr_temp_B]   = sizeof(T) * size_t(l) * n;
+    sizes[gesvdr_temp_S]   = sizeof(S) * l;
+    sizes[gesvdr_temp_U]   = sizeof(T) * size_t(l) * l;
+    sizes[gesvdr_temp_E]   = sizeof(S) * l;
+    return sizes;
+}
+
+// Returns the size in bytes of a buffer holding all the temporary arrays
+inline size_t gesvdr_temp_total(const std::array<size_t, gesvdr_num_temps>& sizes)
+{
+    size_t total = 0;
+    for(size_t size : sizes)
+        total += ((size + 127) / 128) * 128;
+    return total;
+}
+
+// Points temps to consecutive 128 byte aligned regions of work, which must hold
+// gesvdr_temp_total(sizes) bytes
+inline void gesvdr_carve_temps(void*                                       work,
+                               const std::array<size_t, gesvdr_num_temps>& sizes,
+                               void**                                      temps)
+{
+    char* ptr = (char*)work;
+    for(int i = 0; i < gesvdr_num_temps; i++)
+    {
+        temps[i] = ptr;
+        ptr += ((sizes[i] + 127) / 128) * 128;
+    }
+}
+
+// Returns the rocSOLVER workspace size needed by gesvdr_template, where l = k + p
+template <typename T, typename S>
+hipsolverStatus_t gesvdr_workspace_size(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int l, size_t* size)
+{
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(gesvdr_geqrf(handle, m, l, (T*)nullptr, m, (T*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(gesvdr_orgqr(handle, m, l, l, (T*)nullptr, m, (T*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(gesvdr_geqrf(handle, n, l, (T*)nullptr, n, (T*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(gesvdr_orgqr(handle, n, l, l, (T*)nullptr, n, (T*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(gesvdr_gesvd(handle,
+                                                 rocblas_svect_singular,
+                                                 rocblas_svect_singular,
+                                                 l,
+                                                 n,
+                                                 (T*)nullptr,
+                                                 l,
+                                                 (S*)nullptr,
+                                                 (T*)nullptr,
+                                                 l,
+                                                 (T*)nullptr,
+                                                 l,
+                                                 (S*)nullptr,
+                                                 nullptr));
+    rocblas_stop_device_memory_size_query(handle, size);
+
+    return status;
+}
+
+// Returns the device workspace size needed by gesvdr: the rocSOLVER workspace plus the
+// temporary arrays
+template <typename T, typename S>
+hipsolverStatus_t gesvdr_device_size(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int l, size_t* size)
+{
+    hipsolverStatus_t status = gesvdr_workspace_size<T, S>(handle, m, n, l, size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *size += gesvdr_temp_total(gesvdr_temp_sizes<T, S>(m, n, l));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+inline hipsolverStatus_t rocrand2hip_status(rocrand_status status)
+{
+    switch(status)
+    {
+    case ROCRAND_STATUS_SUCCESS:
+        return HIPSOLVER_STATUS_SUCCESS;
+    case ROCRAND_STATUS_ALLOCATION_FAILED:
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+    case ROCRAND_STATUS_LAUNCH_FAILURE:
+        return HIPSOLVER_STATUS_EXECUTION_FAILED;
+    default:
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+}
+
+// Fills the first count entries of omega with standard normal samples, asynchronously
+// on the given stream. The generator is kept by the handle and reseeded with a fixed
+// seed on every call, so that repeated calls with the same input return the same
+// result. omega must hold an even number of real values.
+template <typename T, typename S>
+hipsolverStatus_t gesvdr_random(rocblas_handle handle, hipStream_t stream, T* omega, size_t count)
+{
+    // the real and imaginary parts of complex entries are independent samples
+    size_t nreal = ((count * (sizeof(T) / sizeof(S)) + 1) / 2) * 2;
+
+    rocrand_generator gen;
+    CHECK_HIPSOLVER_ERROR(random_prepare(handle, &gen));
+
+    CHECK_HIPSOLVER_ERROR(rocrand2hip_status(rocrand_set_stream(gen, stream)));
+    CHECK_HIPSOLVER_ERROR(rocrand2hip_status(rocrand_set_seed(gen, 0)));
+    CHECK_HIPSOLVER_ERROR(rocrand2hip_status(rocrand_set_offset(gen, 0)));
+    return rocrand2hip_status(gesvdr_normal(gen, (S*)omega, nreal));
+}
+
+// Overwrites the rows-by-l matrix X with an orthonormal basis of its range
+template <typename T>
+hipsolverStatus_t
+    gesvdr_orthonormalize(rocblas_handle handle, rocblas_int rows, rocblas_int l, T* X, T* tau)
+{
+    CHECK_ROCBLAS_ERROR(gesvdr_geqrf(handle, rows, l, X, rows, tau));
+    CHECK_ROCBLAS_ERROR(gesvdr_orgqr(handle, rows, l, l, X, rows, tau));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+hipsolverStatus_t gesvdr_compute(rocblas_handle handle,
+                                 rocblas_svect  left_svect,
+                                 rocblas_svect  right_svect,
+                                 rocblas_int    m,
+                                 rocblas_int    n,
+                                 rocblas_int    k,
+                                 rocblas_int    l,
+                                 rocblas_int    niters,
+                                 T*             A,
+                                 rocblas_int    lda,
+                                 S*             Srand,
+                                 T*             Urand,
+                                 rocblas_int    ldu,
+                                 T*             Vrand,
+                                 rocblas_int    ldv,
+                                 void* const*   temps,
+                                 rocblas_int*   info)
+{
+    T* Z   = (T*)temps[gesvdr_temp_Z];
+    T* Y   = (T*)temps[gesvdr_temp_Y];
+    T* tau = (T*)temps[gesvdr_temp_tau];
+    T* B   = (T*)temps[gesvdr_temp_B];
+    S* Sb  = (S*)temps[gesvdr_temp_S];
+    T* Ub  = (T*)temps[gesvdr_temp_U];
+    S* E   = (S*)temps[gesvdr_temp_E];
+
+    T one = 1, zero = 0;
+
+    constexpr rocblas_operation opN = rocblas_operation_none;
+    constexpr rocblas_operation opC = rocblas_operation_conjugate_transpose;
+
+    // sample the range of A: Y = A * Omega, where Omega is held in Z
+    CHECK_ROCBLAS_ERROR(gesvdr_gemm(handle, opN, opN, m, l, n, &one, A, lda, Z, n, &zero, Y, m));
+
+    // power iterations, orthonormalizing between products to preserve the small
+    // singular values of the sample
+    for(rocblas_int iter = 0; iter < niters; iter++)
+    {
+        CHECK_HIPSOLVER_ERROR(gesvdr_orthonormalize(handle, m, l, Y, tau));
+        CHECK_ROCBLAS_ERROR(
+            gesvdr_gemm(handle, opC, opN, n, l, m, &one, A, lda, Y, m, &zero, Z, n));
+        CHECK_HIPSOLVER_ERROR(gesvdr_orthonormalize(handle, n, l, Z, tau));
+        CHECK_ROCBLAS_ERROR(
+            gesvdr_gemm(handle, opN, opN, m, l, n, &one, A, lda, Z, n, &zero, Y, m));
+    }
+    CHECK_HIPSOLVER_ERROR(gesvdr_orthonormalize(handle, m, l, Y, tau));
+
+    // B = Q^H * A, and B = Ub * diag(Sb) * Vb^H with Vb^H stored in Z
+    CHECK_ROCBLAS_ERROR(gesvdr_gemm(handle, opC, opN, l, n, m, &one, Y, m, A, lda, &zero, B, l));
+    CHECK_ROCBLAS_ERROR(gesvdr_gesvd(handle,
+                                     rocblas_svect_singular,
+                                     rocblas_svect_singular,
+                                     l,
+                                     n,
+                                     B,
+                                     l,
+                                     Sb,
+                                     Ub,
+                                     l,
+                                     Z,
+                                     l,
+                                     E,
+                                     info));
+
+    // keep the leading k singular triplets: U = Q * Ub(:, 1:k) and V = (Vb^H(1:k, :))^H
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    CHECK_HIP_ERROR(hipMemcpyAsync(Srand, Sb, sizeof(S) * k, hipMemcpyDeviceToDevice, stream));
+
+    if(left_svect == rocblas_svect_singular)
+        CHECK_ROCBLAS_ERROR(
+            gesvdr_gemm(handle, opN, opN, m, k, l, &one, Y, m, Ub, l, &zero, Urand, ldu));
+    if(right_svect == rocblas_svect_singular)
+        CHECK_ROCBLAS_ERROR(
+            gesvdr_geam(handle, opC, opN, n, k, &one, Z, l, &zero, Vrand, ldv, Vrand, ldv));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Computes the k leading singular values and, optionally, the corresponding
+ *  left and right singular vectors of the m-by-n matrix A. A sample of k + p columns
+ *  of the range of A is refined with niters power iterations. A is not modified.
+ *  The temporary arrays must have the sizes returned by gesvdr_temp_sizes, and the
+ *  rocBLAS workspace the size returned by gesvdr_workspace_size.
+ */
+template <typename T, typename S>
+hipsolverStatus_t gesvdr_template(rocblas_handle handle,
+                                  rocblas_svect  left_svect,
+                                  rocblas_svect  right_svect,
+                                  rocblas_int    m,
+                                  rocblas_int    n,
+                                  rocblas_int    k,
+                                  rocblas_int    p,
+                                  rocblas_int    niters,
+                                  T*             A,
+                                  rocblas_int    lda,
+                                  S*             Srand,
+                                  T*             Urand,
+                                  rocblas_int    ldu,
+                                  T*             Vrand,
+                                  rocblas_int    ldv,
+                                  void* const*   temps,
+                                  rocblas_int*   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(left_svect != rocblas_svect_singular && left_svect != rocblas_svect_none)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(right_svect != rocblas_svect_singular && right_svect != rocblas_svect_none)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(m < 0 || n < 0 || k < 1 || p < 0 || niters < 0 || k > std::min(m, n) - p)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(lda < m || (left_svect == rocblas_svect_singular && ldu < m)
+       || (right_svect == rocblas_svect_singular && ldv < n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(!A || !Srand || !info || (left_svect == rocblas_svect_singular && !Urand)
+       || (right_svect == rocblas_svect_singular && !Vrand))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    rocblas_int l = k + p;
+    for(int i = 0; i < gesvdr_num_temps; i++)
+        if(!temps[i])
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // the Gaussian test matrix is generated into Z on the stream of the handle
+    CHECK_HIPSOLVER_ERROR(
+        gesvdr_random<T, S>(handle, stream, (T*)temps[gesvdr_temp_Z], size_t(n) * l));
+
+    // the scalars passed to rocBLAS live on the host
+    rocblas_pointer_mode mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    hipsolverStatus_t status = gesvdr_compute(handle,
+                                              left_svect,
+                                              right_svect,
+                                              m,
+                                              n,
+                                              k,
+                                              l,
+                                              niters,
+                                              A,
+                                              lda,
+                                              Srand,
+                                              Urand,
+                                              ldu,
+                                              Vrand,
+                                              ldv,
+                                              temps,
+                                              info);
+
+    rocblas_set_pointer_mode(handle, mode);
+    return status;
+}
+
+HIPSOLVER_END_NAMESPACE
@@ -0,0 +1,494 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Implementation of the registry that associates hipSOLVER state with
+ *  rocBLAS handles.
+ */
+
+#include "hipsolver_handle.hpp"
+#include "autotune.hpp"
+#include "hipsolver_conversions.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+#include "workspace_reserve.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+// hipsolverHandle_t is a rocblas_handle on the rocSOLVER side, so any additional
+// per-handle state is kept in this registry. Entries are only added and removed when
+// handles are created and destroyed, and every other access is a lookup. The registry
+// is therefore split in shards guarded by reader-writer locks, and each thread keeps
+// its last lookup, so that threads using different handles do not serialize.
+static constexpr int handle_registry_shards = 16;
+
+struct handle_registry_shard
+{
+    std::shared_mutex                                                         mutex;
+    std::unordered_map<rocblas_handle, std::unique_ptr<hipsolverHandleData>> map;
+};
+
+static handle_registry_shard& handle_registry(rocblas_handle handle)
+{
+    static handle_registry_shard shards[handle_registry_shards];
+
+    // The low bits of the address are the same for all handles
+    return shards[(reinterpret_cast<uintptr_t>(handle) >> 4) % handle_registry_shards];
+}
+
+// Incremented whenever an entry is removed, which invalidates the lookup kept by
+// each thread
+static std::atomic<uint64_t> handle_registry_generation(0);
+
+struct handle_registry_lookup
+{
+    rocblas_handle       handle;
+    hipsolverHandleData* data;
+    uint64_t             generation;
+};
+
+hipsolverHandleData* create_handle_data(rocblas_handle handle)
+{
+    std::unique_ptr<hipsolverHandleData> data(new hipsolverHandleData);
+    hipsolverHandleData*                 result = data.get();
+
+    handle_registry_shard& shard = handle_registry(handle);
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+        shard.map[handle].swap(data);
+    }
+
+    // Any data left by a handle that was not destroyed through hipSOLVER is released
+    // outside of the lock, as it may own other handles
+    if(data)
+    {
+        handle_registry_generation++;
+        data.reset();
+    }
+
+    return result;
+}
+
+hipsolverHandleData* find_handle_data(rocblas_handle handle)
+{
+    static thread_local handle_registry_lookup last = {nullptr, nullptr, 0};
+
+    uint64_t generation = handle_registry_generation.load(std::memory_order_acquire);
+    if(handle && last.handle == handle && last.generation == generation)
+        return last.data;
+
+    hipsolverHandleData*   data  = nullptr;
+    handle_registry_shard& shard = handle_registry(handle);
+    {
+        std::shared_lock<std::shared_mutex> lock(shard.mutex);
+
+        auto it = shard.map.find(handle);
+        if(it != shard.map.end())
+            data = it->second.get();
+    }
+
+    if(data)
+        last = {handle, data, generation};
+    return data;
+}
+
+void destroy_handle_data(rocblas_handle handle)
+{
+    std::unique_ptr<hipsolverHandleData> data;
+    handle_registry_shard&               shard = handle_registry(handle);
+    {
+        std::unique_lock<std::shared_mutex> lock(shard.mutex);
+
+        auto it = shard.map.find(handle);
+        if(it == shard.map.end())
+            return;
+        data = std::move(it->second);
+        shard.map.erase(it);
+    }
+    handle_registry_generation++;
+
+    // The data is released outside of the lock, as it may own other handles
+    data.reset();
+}
+
+/******************** MULTI-STREAM BATCHES ********************/
+multistream_state::~multistream_state()
+{
+    for(hipEvent_t event : events)
+        hipEventDestroy(event);
+    if(fork_event)
+        hipEventDestroy(fork_event);
+    for(rocblas_handle handle : handles)
+    {
+        destroy_handle_data(handle);
+        rocblas_destroy_handle(handle);
+    }
+    for(hipStream_t stream : streams)
+        hipStreamDestroy(stream);
+}
+
+int multistream_count(rocblas_handle handle, int batch_count)
+{
+    int streams = get_handle_data(handle)->batch_streams;
+    return std::max(std::min(streams, batch_count), 1);
+}
+
+hipsolverStatus_t multistream_prepare(rocblas_handle handle, int count, multistream_state** state)
+{
+    hipsolverHandleData* data = get_handle_data(handle);
+    if(!data->multistream)
+        data->multistream.reset(new multistream_state);
+
+    multistream_state* ms = data->multistream.get();
+    if(!ms->fork_event)
+        CHECK_HIP_ERROR(hipEventCreateWithFlags(&ms->fork_event, hipEventDisableTiming));
+
+    while((int)ms->handles.size() < count)
+    {
+        hipStream_t stream;
+        CHECK_HIP_ERROR(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking));
+        ms->streams.push_back(stream);
+
+        hipEvent_t event;
+        CHECK_HIP_ERROR(hipEventCreateWithFlags(&event, hipEventDisableTiming));
+        ms->events.push_back(event);
+
+        rocblas_handle sub_handle;
+        CHECK_ROCBLAS_ERROR(rocblas_create_handle(&sub_handle));
+        ms->handles.push_back(sub_handle);
+        create_handle_data(sub_handle);
+        CHECK_ROCBLAS_ERROR(rocblas_set_stream(sub_handle, stream));
+        if(data->budget)
+            CHECK_HIPSOLVER_ERROR(set_workspace_budget(sub_handle, data->budget));
+    }
+
+    // The internal handles follow the deterministic mode of the handle, so that the
+    // results match those of a single stream
+    rocblas_atomics_mode mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_atomics_mode(handle, &mode));
+    for(int i = 0; i < count; i++)
+        CHECK_ROCBLAS_ERROR(rocblas_set_atomics_mode(ms->handles[i], mode));
+
+    *state = ms;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** RANDOM NUMBER GENERATION ********************/
+random_state::~random_state()
+{
+    if(generator)
+        rocrand_destroy_generator(generator);
+}
+
+hipsolverStatus_t random_prepare(rocblas_handle handle, rocrand_generator* generator)
+{
+    hipsolverHandleData* data = get_handle_data(handle);
+    if(!data->random)
+        data->random.reset(new random_state);
+
+    random_state* rs = data->random.get();
+    if(!rs->generator)
+    {
+        rocrand_generator gen;
+        rocrand_status    status
+            = rocrand_create_generator(&gen, ROCRAND_RNG_PSEUDO_PHILOX4_32_10);
+        if(status == ROCRAND_STATUS_ALLOCATION_FAILED)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        if(status != ROCRAND_STATUS_SUCCESS)
+            return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        rs->generator = gen;
+    }
+
+    *generator = rs->generator;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+rocblas_status workspace_budget_charge(rocblas_handle handle, size_t size)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data || !data->budget)
+        return rocblas_status_success;
+
+    if(size > data->budget_charged)
+    {
+        if(!data->budget->reserve(size - data->budget_charged))
+            return rocblas_status_memory_error;
+    }
+    else
+        data->budget->release(data->budget_charged - size);
+
+    data->budget_charged = size;
+    return rocblas_status_success;
+}
+
+void workspace_grow_record(rocblas_handle handle, size_t size)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data)
+        return;
+
+    data->workspace_grows++;
+    data->peak_workspace_bytes = std::max(data->peak_workspace_bytes, size);
+}
+
+// The rocBLAS device memory of the handle is freed when the workspace of a plan is
+// bound, so restoring it means allocating it again. The restore is therefore deferred
+// until a function other than a plan needs the workspace, or the plan is destroyed, so
+// that executing the same plan repeatedly only rebinds its workspace.
+rocblas_status workspace_plan_bind(rocblas_handle handle, const void* plan, void* work, size_t size)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data)
+        return rocblas_status_invalid_handle;
+
+    if(!data->plan_workspace)
+    {
+        size_t saved = 0;
+        if(rocblas_is_user_managing_device_memory(handle))
+            rocblas_get_device_memory_size(handle, &saved);
+        data->plan_saved_size = saved;
+    }
+
+    rocblas_status status = rocblas_set_workspace(handle, work, size);
+    if(status == rocblas_status_success)
+        data->plan_workspace = plan;
+    return status;
+}
+
+rocblas_status workspace_plan_restore(rocblas_handle handle, const void* plan)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data || !data->plan_workspace || (plan && data->plan_workspace != plan))
+        return rocblas_status_success;
+
+    data->plan_workspace = nullptr;
+    if(data->plan_saved_size > 0)
+        return rocblas_set_device_memory_size(handle, data->plan_saved_size);
+    else
+        return rocblas_set_workspace(handle, nullptr, 0);
+}
+
+/******************** WORKSPACE RESERVATION ********************/
+// Workspace needed by an internal handle for a sub-batch of count problems of a
+// potrfBatched call split over the internal streams
+static hipsolverStatus_t potrf_batched_sub_size(rocblas_handle                sub,
+                                                const hipsolverWorkspaceOp_t& op,
+                                                int                           count,
+                                                size_t*                       size)
+{
+    switch(op.precision)
+    {
+    case HIP_R_32F:
+        return hipsolverSpotrfBatchedExt_bufferSize(
+            sub, op.uplo, op.n, nullptr, op.lda, size, count);
+    case HIP_R_64F:
+        return hipsolverDpotrfBatchedExt_bufferSize(
+            sub, op.uplo, op.n, nullptr, op.lda, size, count);
+    case HIP_C_32F:
+        return hipsolverCpotrfBatchedExt_bufferSize(
+            sub, op.uplo, op.n, nullptr, op.lda, size, count);
+    case HIP_C_64F:
+        return hipsolverZpotrfBatchedExt_bufferSize(
+            sub, op.uplo, op.n, nullptr, op.lda, size, count);
+    default:
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+}
+
+// Bytes of the real array that op takes from the memory pool when it is called without
+// a user-provided workspace (E for syevd and sygvd, rwork for gesvd)
+static size_t op_pool_size(const hipsolverWorkspaceOp_t& op)
+{
+    bool   single    = (op.precision == HIP_R_32F || op.precision == HIP_C_32F);
+    size_t real_size = single ? sizeof(float) : sizeof(double);
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GESVD:
+        return std::min(op.m, op.n) > 1 ? real_size * std::min(op.m, op.n) : 0;
+    case HIPSOLVER_ROUTINE_SYEVD:
+    case HIPSOLVER_ROUTINE_SYGVD:
+        return real_size * std::max(op.n, 0);
+    default:
+        return 0;
+    }
+}
+
+hipsolverStatus_t reserve_workspace(hipsolverHandle_t             handle,
+                                    size_t                        size,
+                                    const hipsolverWorkspaceOp_t* ops,
+                                    int                           count)
+{
+    rocblas_handle rhandle = (rocblas_handle)handle;
+    CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(rhandle, size));
+
+    for(int i = 0; i < count; i++)
+    {
+        const hipsolverWorkspaceOp_t& op = ops[i];
+
+        // A batch split over the internal streams runs on the internal handles, each of
+        // which manages its own workspace
+        int streams = 1;
+        if(op.routine == HIPSOLVER_ROUTINE_POTRF_BATCHED)
+            streams = multistream_count(rhandle, op.batch_count);
+        if(streams > 1)
+        {
+            multistream_state* state;
+            CHECK_HIPSOLVER_ERROR(multistream_prepare(rhandle, streams, &state));
+
+            for(int j = 0; j < streams; j++)
+            {
+                int    extra     = j < op.batch_count % streams ? 1 : 0;
+                int    sub_count = op.batch_count / streams + extra;
+                size_t sub_size;
+                CHECK_HIPSOLVER_ERROR(
+                    potrf_batched_sub_size(state->handles[j], op, sub_count, &sub_size));
+                CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(state->handles[j], sub_size));
+            }
+        }
+
+        // The arrays taken from the memory pool are allocated and released right away,
+        // so that the pool caches a block of the right size class for later calls
+        size_t pool_size = op_pool_size(op);
+        if(pool_size > 0)
+        {
+            pool_device_malloc mem(rhandle, pool_size);
+            if(!mem)
+                return HIPSOLVER_STATUS_ALLOC_FAILED;
+        }
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** STATISTICS ********************/
+// Each API function is given a dense slot the first time it is counted, so that
+// counting a call is an array increment. Each thread keeps the slots of the
+// functions it called in a small direct-mapped cache keyed by the address of the
+// __func__ string, and only takes the lock on a miss.
+static constexpr int call_slot_cache_size = 64;
+
+struct call_slot_registry
+{
+    std::mutex                              mutex;
+    std::unordered_map<const char*, size_t> slots;
+    std::vector<const char*>                names;
+};
+
+static call_slot_registry& call_slots()
+{
+    static call_slot_registry registry;
+    return registry;
+}
+
+struct call_slot_lookup
+{
+    const char* func;
+    size_t      slot;
+};
+
+static size_t call_slot(const char* func)
+{
+    static thread_local call_slot_lookup cache[call_slot_cache_size] = {};
+
+    call_slot_lookup& last = cache[(reinterpret_cast<uintptr_t>(func) >> 4) % call_slot_cache_size];
+    if(last.func == func)
+        return last.slot;
+
+    call_slot_registry&         registry = call_slots();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+
+    auto it = registry.slots.find(func);
+    if(it == registry.slots.end())
+    {
+        it = registry.slots.emplace(func, registry.names.size()).first;
+        registry.names.push_back(func);
+    }
+
+    last = {func, it->second};
+    return it->second;
+}
+
+const char* call_slot_name(size_t slot)
+{
+    call_slot_registry&         registry = call_slots();
+    std::lock_guard<std::mutex> lock(registry.mutex);
+    return registry.names[slot];
+}
+
+void record_call(hipsolverHandle_t handle, const char* func)
+{
+    hipsolverHandleData* data = find_handle_data((rocblas_handle)handle);
+    if(!data)
+        return;
+
+    size_t slot = call_slot(func);
+    if(slot >= data->call_counts.size())
+        data->call_counts.resize(slot + 1, 0);
+    data->call_counts[slot]++;
+}
+
+/******************** AUTOTUNING ********************/
+hipsolverStatus_t autotune_malloc(hipsolverHandle_t handle, void** ptr, size_t size)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream((rocblas_handle)handle, &stream));
+    return get_handle_data((rocblas_handle)handle)->pool->allocate(ptr, size, stream);
+}
+
+void autotune_free(hipsolverHandle_t handle, void* ptr)
+{
+    hipsolverHandleData* data = find_handle_data((rocblas_handle)handle);
+    hipStream_t          stream;
+    if(ptr && data && rocblas_get_stream((rocblas_handle)handle, &stream) == rocblas_status_success)
+        data->pool->deallocate(ptr, stream);
+}
+
+hipsolverStatus_t set_workspace_budget(hipsolverHandle_t                 handle,
+                                       std::shared_ptr<workspace_budget> budget)
+{
+    hipsolverHandleData* data = get_handle_data((rocblas_handle)handle);
+
+    if(data->budget)
+        data->budget->release(data->budget_charged);
+    data->budget         = budget;
+    data->budget_charged = 0;
+
+    // Charge any device memory the handle already holds
+    size_t size = 0;
+    if(rocblas_is_user_managing_device_memory((rocblas_handle)handle))
+        rocblas_get_device_memory_size((rocblas_handle)handle, &size);
+    if(workspace_budget_charge((rocblas_handle)handle, size) != rocblas_status_success)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    // The temporary arrays taken from the memory pool count against the same budget
+    return data->pool->set_budget(budget);
+}
+
+HIPSOLVER_END_NAMESPACE
@@ -0,0 +1,328 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief State that hipSOLVER associates with a rocBLAS handle on the
+ *  rocSOLVER side.
+ */
+
+#pragma once
+
+#include "handle_pool.hpp"
+#include "hipsolver.h"
+#include "hipsolver_memory_pool.hpp"
+#include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+#include <rocrand/rocrand.h>
+
+#include <array>
+#include <climits>
+#include <cstring>
+#include <memory>
+#include <stdint.h>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** WORKSPACE CACHE ********************/
+// Identifies a workspace size query by the bufferSize function that issued it
+// and the values of its non-pointer arguments
+struct workspace_key
+{
+    static constexpr int max_args = 16;
+
+    const char*                   func;
+    int                           nargs;
+    std::array<int64_t, max_args> args;
+
+    template <typename... Ts>
+    explicit workspace_key(const char* func, Ts... values)
+        : func(func)
+        , nargs(sizeof...(Ts))
+        , args{}
+    {
+        static_assert(sizeof...(Ts) <= max_args, "Too many arguments in workspace key");
+
+        int i = 0;
+        ((args[i++] = encode(values)), ...);
+    }
+
+    bool operator==(const workspace_key& other) const
+    {
+        return func == other.func && nargs == other.nargs && args == other.args;
+    }
+
+private:
+    template <typename T>
+    static int64_t encode(T value)
+    {
+        if constexpr(std::is_floating_point<T>::value)
+        {
+            double  dvalue = value;
+            int64_t bits;
+            std::memcpy(&bits, &dvalue, sizeof(bits));
+            return bits;
+        }
+        else
+            return static_cast<int64_t>(value);
+    }
+};
+
+struct workspace_key_hash
+{
+    size_t operator()(const workspace_key& key) const
+    {
+        size_t h = std::hash<const void*>()(key.func);
+        for(int i = 0; i < key.nargs; i++)
+            h ^= std::hash<int64_t>()(key.args[i]) + 0x9e3779b97f4a7c15 + (h << 6) + (h >> 2);
+        return h;
+    }
+};
+
+/******************** MULTI-STREAM BATCHES ********************/
+// Internal streams over which batched functions split their batch. Each stream has
+// its own rocBLAS handle, so that each sub-batch gets its own workspace.
+struct multistream_state
+{
+    std::vector<rocblas_handle> handles;
+    std::vector<hipStream_t>    streams;
+    std::vector<hipEvent_t>     events;
+    hipEvent_t                  fork_event;
+
+    multistream_state()
+        : fork_event(nullptr)
+    {
+    }
+    ~multistream_state();
+};
+
+/******************** RANDOM NUMBER GENERATION ********************/
+// Generator of the random test matrices of the randomized SVD
+struct random_state
+{
+    rocrand_generator generator;
+
+    random_state()
+        : generator(nullptr)
+    {
+    }
+    ~random_state();
+};
+
+/******************** HANDLE DATA ********************/
+struct hipsolverHandleData
+{
+    // Number of workspace sizes kept before the cache is emptied
+    static constexpr size_t workspace_cache_capacity = 1024;
+
+    std::unordered_map<workspace_key, size_t, workspace_key_hash> workspace_cache;
+    size_t                                                        workspace_cache_hits;
+    size_t                                                        workspace_cache_misses;
+
+    // Nonzero while a probe issues queries whose combined result is cached under a
+    // key of its own
+    int workspace_cache_bypass;
+
+    // Number of calls per API function, indexed by the slot of the function (see
+    // call_slot_name), and the growth of the rocBLAS device memory
+    std::vector<size_t> call_counts;
+    size_t              workspace_grows;
+    size_t              peak_workspace_bytes;
+
+    // Plan whose workspace is bound to the handle, if any, and the size of the rocBLAS
+    // device memory the handle used before, or 0 if rocBLAS managed it
+    const void* plan_workspace;
+    size_t      plan_saved_size;
+
+    // Device memory for temporaries allocated outside of the rocSOLVER workspace.
+    // Shared so that objects holding pool memory may outlive the handle data.
+    std::shared_ptr<memory_pool> pool;
+
+    // Maximum number of iterative refinement steps of the mixed-precision solvers, or 0
+    // for the default
+    int refinement_max_iters;
+
+    // Budget shared with the other handles of a handle pool, and the part of it
+    // charged for the rocBLAS device memory of this handle
+    std::shared_ptr<workspace_budget> budget;
+    size_t                            budget_charged;
+
+    // Number of streams over which batched functions split their batch, and the
+    // state of those streams, created on first use
+    int                                batch_streams;
+    std::unique_ptr<multistream_state> multistream;
+
+    // Random number generator of the randomized SVD, created on first use
+    std::unique_ptr<random_state> random;
+
+    // Constructor
+    explicit hipsolverHandleData()
+        : workspace_cache_hits(0)
+        , workspace_cache_misses(0)
+        , workspace_cache_bypass(0)
+        , workspace_grows(0)
+        , peak_workspace_bytes(0)
+        , plan_workspace(nullptr)
+        , plan_saved_size(0)
+        , pool(std::make_shared<memory_pool>())
+        , refinement_max_iters(0)
+        , budget_charged(0)
+        , batch_streams(1)
+    {
+    }
+
+    // Destructor
+    ~hipsolverHandleData()
+    {
+        if(budget)
+            budget->release(budget_charged);
+    }
+};
+
+// Associates new data with the given handle. Called by hipsolverCreate and for the
+// internal handles of split batches.
+hipsolverHandleData* create_handle_data(rocblas_handle handle);
+
+// Returns the data associated with the given handle, or nullptr if the handle was not
+// created by hipsolverCreate or was already destroyed
+hipsolverHandleData* find_handle_data(rocblas_handle handle);
+
+// Returns the data associated with the given handle. Throws
+// HIPSOLVER_STATUS_NOT_INITIALIZED if there is none.
+inline hipsolverHandleData* get_handle_data(rocblas_handle handle)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data)
+        throw HIPSOLVER_STATUS_NOT_INITIALIZED;
+    return data;
+}
+
+// Releases the data associated with the given handle
+void destroy_handle_data(rocblas_handle handle);
+
+// Returns the number of streams over which a batch of batch_count problems is split
+int multistream_count(rocblas_handle handle, int batch_count);
+
+// Returns the internal streams of the handle, creating them if there are fewer
+// than count
+hipsolverStatus_t multistream_prepare(rocblas_handle handle, int count, multistream_state** state);
+
+// Returns the random number generator of the handle, creating it on first use
+hipsolverStatus_t random_prepare(rocblas_handle handle, rocrand_generator* generator);
+
+// Charges size bytes of rocBLAS device memory against the workspace budget of the
+// handle, if any, replacing the previous charge
+rocblas_status workspace_budget_charge(rocblas_handle handle, size_t size);
+
+// Records that the rocBLAS device memory of the handle grew to size bytes
+void workspace_grow_record(rocblas_handle handle, size_t size);
+
+// Returns the name of the API function whose calls are counted in the given slot of
+// hipsolverHandleData::call_counts
+const char* call_slot_name(size_t slot);
+
+// Looks for a previously computed workspace size. Returns true on a hit.
+inline bool workspace_cache_lookup(rocblas_handle handle, const workspace_key& key, size_t& size)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data || data->workspace_cache_bypass)
+        return false;
+
+    auto it = data->workspace_cache.find(key);
+    if(it == data->workspace_cache.end())
+    {
+        data->workspace_cache_misses++;
+        return false;
+    }
+
+    data->workspace_cache_hits++;
+    size = it->second;
+    return true;
+}
+
+inline void workspace_cache_store(rocblas_handle handle, const workspace_key& key, size_t size)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data || data->workspace_cache_bypass)
+        return;
+
+    // The keys seen by a handle are usually few, so a full cache is simply emptied
+    // rather than tracking the age of its entries
+    if(data->workspace_cache.size() >= hipsolverHandleData::workspace_cache_capacity)
+        data->workspace_cache.clear();
+    data->workspace_cache[key] = size;
+}
+
+// Discards all cached workspace sizes. Must be called whenever a handle setting
+// that may affect the sizes returned by rocSOLVER changes.
+inline void workspace_cache_clear(rocblas_handle handle)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(data)
+        data->workspace_cache.clear();
+}
+
+// Keeps the queries made during its lifetime out of the workspace cache and of its
+// hit and miss counts
+class workspace_cache_bypass
+{
+public:
+    explicit workspace_cache_bypass(rocblas_handle handle)
+        : data(find_handle_data(handle))
+    {
+        if(data)
+            data->workspace_cache_bypass++;
+    }
+
+    ~workspace_cache_bypass()
+    {
+        if(data)
+            data->workspace_cache_bypass--;
+    }
+
+    workspace_cache_bypass(const workspace_cache_bypass&) = delete;
+    workspace_cache_bypass& operator=(const workspace_cache_bypass&) = delete;
+
+private:
+    hipsolverHandleData* data;
+};
+
+inline hipsolverStatus_t workspace_size_to_lwork(size_t sz, int* lwork)
+{
+    if(sz > INT_MAX)
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+
+    *lwork = (int)sz;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+inline hipsolverStatus_t workspace_size_to_lwork(size_t sz, size_t* lwork)
+{
+    *lwork = sz;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+HIPSOLVER_END_NAMESPACE
@@ -0,0 +1,759 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+/*! \file
+ *  \brief Implementation of the device kernels of the rocSOLVER backend. This source is
+ *  compiled as HIP.
+ */
+
+#include "hipsolver_kernels.hpp"
+
+#include <hip/hip_runtime.h>
+
+#include <algorithm>
+#include <cfloat>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+constexpr int kernel_block_size = 256;
+
+// Largest number of blocks launched along the y dimension; larger extents are covered
+// by striding
+constexpr int kernel_max_grid_y = 65535;
+
+/******************** DEVICE HELPERS ********************/
+// Absolute value used by the norms (|re| + |im| for complex numbers)
+__device__ inline float abs1(float x)
+{
+    return fabsf(x);
+}
+
+__device__ inline double abs1(double x)
+{
+    return fabs(x);
+}
+
+__device__ inline float abs1(rocblas_float_complex x)
+{
+    return fabsf(x.real()) + fabsf(x.imag());
+}
+
+__device__ inline double abs1(rocblas_double_complex x)
+{
+    return fabs(x.real()) + fabs(x.imag());
+}
+
+// Real part of an entry
+__device__ inline float real_part(float x)
+{
+    return x;
+}
+
+__device__ inline double real_part(double x)
+{
+    return x;
+}
+
+__device__ inline float real_part(rocblas_float_complex x)
+{
+    return x.real();
+}
+
+__device__ inline double real_part(rocblas_double_complex x)
+{
+    return x.real();
+}
+
+// Conversion of a single entry, which reports whether it is out of the range of the
+// target precision
+__device__ inline bool convert(double a, float* b)
+{
+    *b = float(a);
+    return fabs(a) > FLT_MAX;
+}
+
+__device__ inline bool convert(float a, double* b)
+{
+    *b = a;
+    return false;
+}
+
+__device__ inline bool convert(rocblas_double_complex a, rocblas_float_complex* b)
+{
+    *b = rocblas_float_complex(float(a.real()), float(a.imag()));
+    return fabs(a.real()) > FLT_MAX || fabs(a.imag()) > FLT_MAX;
+}
+
+__device__ inline bool convert(rocblas_float_complex a, rocblas_double_complex* b)
+{
+    *b = rocblas_double_complex(a.real(), a.imag());
+    return false;
+}
+
+// Maximum of non-negative floating-point numbers. Their bit patterns have the same
+// order as their values, so the integer atomicMax can be used.
+__device__ inline void atomic_max_nonneg(double* address, double value)
+{
+    atomicMax((unsigned long long*)address, (unsigned long long)__double_as_longlong(value));
+}
+
+// Sum of the values held by the threads of a block, returned to all of them. shared
+// must hold blockDim.x values.
+template <typename T>
+__device__ T block_sum(T value, T* shared)
+{
+    shared[threadIdx.x] = value;
+    __syncthreads();
+    for(int s = blockDim.x / 2; s > 0; s /= 2)
+    {
+        if(threadIdx.x < s)
+            shared[threadIdx.x] = shared[threadIdx.x] + shared[threadIdx.x + s];
+        __syncthreads();
+    }
+
+    T sum = shared[0];
+    __syncthreads();
+    return sum;
+}
+
+// Solves the 2-by-2 diagonal block [a11 a21; a21 a22] of D for (x1, x2), scaled as in
+// LAPACK's ?sytrs
+template <typename T>
+__device__ void sytrs_solve_2x2(T a11, T a21, T a22, T* x1, T* x2)
+{
+    T akm1  = a11 / a21;
+    T ak    = a22 / a21;
+    T denom = akm1 * ak - T(1);
+    T bkm1  = *x1 / a21;
+    T bk    = *x2 / a21;
+    *x1     = (ak * bkm1 - bk) / denom;
+    *x2     = (akm1 * bk - bkm1) / denom;
+}
+
+// Solves U * D * U**T * x = b for a single right-hand side. Row interchanges are folded
+// into the updates, so each step needs two barriers.
+template <typename T, typename I>
+__device__ void
+    sytrs_upper_column(rocblas_int n, const T* A, rocblas_int lda, const I* ipiv, T* x, T* shared)
+{
+    // solve U * D * y = b
+    for(rocblas_int k = n - 1; k >= 0;)
+    {
+        if(ipiv[k] > 0)
+        {
+            rocblas_int kp  = ipiv[k] - 1;
+            T           xk  = x[kp];
+            T           xkp = x[k];
+            __syncthreads();
+
+            for(rocblas_int i = threadIdx.x; i < k; i += blockDim.x)
+                x[i] = (i == kp ? xkp : x[i]) - A[i + k * size_t(lda)] * xk;
+            if(threadIdx.x == 0)
+                x[k] = xk / A[k + k * size_t(lda)];
+            __syncthreads();
+            k -= 1;
+        }
+        else
+        {
+            rocblas_int kp  = -ipiv[k] - 1;
+            T           xk1 = x[kp];
+            T           xkp = x[k - 1];
+            T           xk  = x[k];
+            __syncthreads();
+
+            for(rocblas_int i = threadIdx.x; i < k - 1; i += blockDim.x)
+                x[i] = (i == kp ? xkp : x[i]) - A[i + k * size_t(lda)] * xk
+                       - A[i + (k - 1) * size_t(lda)] * xk1;
+            if(threadIdx.x == 0)
+            {
+                sytrs_solve_2x2(A[k - 1 + (k - 1) * size_t(lda)],
+                                A[k - 1 + k * size_t(lda)],
+                                A[k + k * size_t(lda)],
+                                &xk1,
+                                &xk);
+                x[k - 1] = xk1;
+                x[k]     = xk;
+            }
+            __syncthreads();
+            k -= 2;
+        }
+    }
+
+    // solve U**T * x = y
+    for(rocblas_int k = 0; k < n;)
+    {
+        bool        pair = ipiv[k] <= 0;
+        rocblas_int kp   = pair ? -ipiv[k] - 1 : ipiv[k] - 1;
+
+        T s0 = 0, s1 = 0;
+        for(rocblas_int i = threadIdx.x; i < k; i += blockDim.x)
+        {
+            s0 = s0 + A[i + k * size_t(lda)] * x[i];
+            if(pair)
+                s1 = s1 + A[i + (k + 1) * size_t(lda)] * x[i];
+        }
+        s0 = block_sum(s0, shared);
+        if(pair)
+            s1 = block_sum(s1, shared);
+
+        if(threadIdx.x == 0)
+        {
+            x[k] = x[k] - s0;
+            if(pair)
+                x[k + 1] = x[k + 1] - s1;
+
+            T t   = x[k];
+            x[k]  = x[kp];
+            x[kp] = t;
+        }
+        __syncthreads();
+        k += pair ? 2 : 1;
+    }
+}
+
+// Solves L * D * L**T * x = b for a single right-hand side
+template <typename T, typename I>
+__device__ void
+    sytrs_lower_column(rocblas_int n, const T* A, rocblas_int lda, const I* ipiv, T* x, T* shared)
+{
+    // solve L * D * y = b
+    for(rocblas_int k = 0; k < n;)
+    {
+        if(ipiv[k] > 0)
+        {
+            rocblas_int kp  = ipiv[k] - 1;
+            T           xk  = x[kp];
+            T           xkp = x[k];
+            __syncthreads();
+
+            for(rocblas_int i = k + 1 + threadIdx.x; i < n; i += blockDim.x)
+                x[i] = (i == kp ? xkp : x[i]) - A[i + k * size_t(lda)] * xk;
+            if(threadIdx.x == 0)
+                x[k] = xk / A[k + k * size_t(lda)];
+            __syncthreads();
+            k += 1;
+        }
+        else
+        {
+            rocblas_int kp  = -ipiv[k] - 1;
+            T           xk  = x[k];
+            T           xk1 = x[kp];
+            T           xkp = x[k + 1];
+            __syncthreads();
+
+            for(rocblas_int i = k + 2 + threadIdx.x; i < n; i += blockDim.x)
+                x[i] = (i == kp ? xkp : x[i]) - A[i + k * size_t(lda)] * xk
+                       - A[i + (k + 1) * size_t(lda)] * xk1;
+            if(threadIdx.x == 0)
+            {
+                sytrs_solve_2x2(A[k + k * size_t(lda)],
+                                A[k + 1 + k * size_t(lda)],
+                                A[k + 1 + (k + 1) * size_t(lda)],
+                                &xk,
+                                &xk1);
+                x[k]     = xk;
+                x[k + 1] = xk1;
+            }
+            __syncthreads();
+            k += 2;
+        }
+    }
+
+    // solve L**T * x = y
+    for(rocblas_int k = n - 1; k >= 0;)
+    {
+        bool        pair = ipiv[k] <= 0;
+        rocblas_int kp   = pair ? -ipiv[k] - 1 : ipiv[k] - 1;
+
+        T s0 = 0, s1 = 0;
+        for(rocblas_int i = k + 1 + threadIdx.x; i < n; i += blockDim.x)
+        {
+            s0 = s0 + A[i + k * size_t(lda)] * x[i];
+            if(pair)
+                s1 = s1 + A[i + (k - 1) * size_t(lda)] * x[i];
+        }
+        s0 = block_sum(s0, shared);
+        if(pair)
+            s1 = block_sum(s1, shared);
+
+        if(threadIdx.x == 0)
+        {
+            x[k] = x[k] - s0;
+            if(pair)
+                x[k - 1] = x[k - 1] - s1;
+
+            T t   = x[k];
+            x[k]  = x[kp];
+            x[kp] = t;
+        }
+        __syncthreads();
+        k -= pair ? 2 : 1;
+    }
+}
+
+/******************** KERNELS ********************/
+template <typename Ta, typename Tb>
+__global__ void convert_matrix_kernel(rocblas_int  m,
+                                      rocblas_int  n,
+                                      const Ta*    A,
+                                      rocblas_int  lda,
+                                      Tb*          B,
+                                      rocblas_int  ldb,
+                                      rocblas_int* overflow)
+{
+    rocblas_int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if(i >= m)
+        return;
+
+    for(rocblas_int j = blockIdx.y; j < n; j += gridDim.y)
+    {
+        if(convert(A[i + size_t(lda) * j], B + i + size_t(ldb) * j) && overflow)
+            *overflow = 1;
+    }
+}
+
+// Each thread sums the absolute values of a row
+template <typename T, typename S>
+__global__ void
+    matrix_norm_inf_kernel(rocblas_int m, rocblas_int n, const T* A, rocblas_int lda, S* norm)
+{
+    rocblas_int i = blockIdx.x * blockDim.x + threadIdx.x;
+    if(i >= m)
+        return;
+
+    S sum = 0;
+    for(rocblas_int j = 0; j < n; j++)
+        sum += abs1(A[i + size_t(lda) * j]);
+
+    atomic_max_nonneg(norm, sum);
+}
+
+// Each block reduces a column of R and X
+template <typename T, typename S>
+__global__ void refine_check_kernel(rocblas_int  m,
+                                    rocblas_int  nrhs,
+                                    const T*     R,
+                                    rocblas_int  ldr,
+                                    const T*     X,
+                                    rocblas_int  ldx,
+                                    const S*     anrm,
+                                    S            tol,
+                                    rocblas_int* unconverged)
+{
+    __shared__ S rmax[kernel_block_size];
+    __shared__ S xmax[kernel_block_size];
+
+    for(rocblas_int j = blockIdx.x; j < nrhs; j += gridDim.x)
+    {
+        // fmax drops NaN operands, so NaNs are flagged separately
+        S    r = 0, x = 0;
+        bool nan = false;
+        for(rocblas_int i = threadIdx.x; i < m; i += blockDim.x)
+        {
+            S ar = abs1(R[i + size_t(ldr) * j]);
+            S ax = abs1(X[i + size_t(ldx) * j]);
+            nan  = nan || ar != ar || ax != ax;
+            r    = fmax(r, ar);
+            x    = fmax(x, ax);
+        }
+        if(nan)
+            *unconverged = 1;
+
+        rmax[threadIdx.x] = r;
+        xmax[threadIdx.x] = x;
+        __syncthreads();
+
+        for(int s = blockDim.x / 2; s > 0; s /= 2)
+        {
+            if(threadIdx.x < s)
+            {
+                rmax[threadIdx.x] = fmax(rmax[threadIdx.x], rmax[threadIdx.x + s]);
+                xmax[threadIdx.x] = fmax(xmax[threadIdx.x], xmax[threadIdx.x + s]);
+            }
+            __syncthreads();
+        }
+
+        if(threadIdx.x == 0 && !(rmax[0] <= xmax[0] * tol * (anrm ? *anrm : S(1))))
+            *unconverged = 1;
+        __syncthreads();
+    }
+}
+
+// Each block solves a right-hand side of a system of the batch
+template <typename T, typename I>
+__global__ void sytrs_kernel(rocblas_fill       uplo,
+                             rocblas_int        n,
+                             const T*           A,
+                             rocblas_int        lda,
+                             rocblas_stride     strideA,
+                             const I*           ipiv,
+                             rocblas_stride     strideP,
+                             T*                 B,
+                             rocblas_int        ldb,
+                             rocblas_stride     strideB,
+                             const rocblas_int* info,
+                             rocblas_int        batch_count)
+{
+    __shared__ T shared[kernel_block_size];
+
+    rocblas_int j = blockIdx.x;
+    for(rocblas_int b = blockIdx.y; b < batch_count; b += gridDim.y)
+    {
+        if(info && info[b] != 0)
+            continue;
+
+        const T* Ab    = A + b * strideA;
+        const I* ipivb = ipiv + b * strideP;
+        T*       x     = B + b * strideB + j * size_t(ldb);
+        if(uplo == rocblas_fill_upper)
+            sytrs_upper_column(n, Ab, lda, ipivb, x, shared);
+        else
+            sytrs_lower_column(n, Ab, lda, ipivb, x, shared);
+    }
+}
+
+// Factorizes the panel with a single block. Each thread updates its own rows, so a step
+// only waits for the shifted pivot.
+template <typename T>
+__global__ void tsqr_lu_panel_kernel(rocblas_int m, rocblas_int nb, T* A, rocblas_int lda, T* D)
+{
+    for(rocblas_int j = 0; j < nb; j++)
+    {
+        T* Aj = A + j * size_t(lda);
+        if(threadIdx.x == 0)
+        {
+            T d   = real_part(Aj[j]) >= 0 ? T(-1) : T(1);
+            D[j]  = d;
+            Aj[j] = Aj[j] - d;
+        }
+        __syncthreads();
+
+        T pivot = Aj[j];
+        for(rocblas_int i = j + 1 + threadIdx.x; i < m; i += blockDim.x)
+        {
+            T lij = Aj[i] / pivot;
+            Aj[i] = lij;
+            for(rocblas_int k = j + 1; k < nb; k++)
+                A[i + k * size_t(lda)] = A[i + k * size_t(lda)] - lij * A[j + k * size_t(lda)];
+        }
+        __syncthreads();
+    }
+}
+
+// Each block sets a column of the leading block and its Householder scalar
+template <typename T>
+__global__ void tsqr_reconstruct_kernel(rocblas_int n,
+                                        T*          A,
+                                        rocblas_int lda,
+                                        const T*    R,
+                                        rocblas_int ldr,
+                                        const T*    D,
+                                        T*          tau)
+{
+    rocblas_int j  = blockIdx.x;
+    T*          Aj = A + j * size_t(lda);
+    for(rocblas_int i = threadIdx.x; i <= j; i += blockDim.x)
+    {
+        T rij = D[i] * R[i + j * size_t(ldr)];
+        if(i == j)
+            tau[j] = -D[j] * Aj[j];
+        Aj[i] = rij;
+    }
+}
+
+/******************** LAUNCHERS ********************/
+template <typename Ta, typename Tb>
+hipsolverStatus_t convert_matrix(hipStream_t  stream,
+                                 rocblas_int  m,
+                                 rocblas_int  n,
+                                 const Ta*    A,
+                                 rocblas_int  lda,
+                                 Tb*          B,
+                                 rocblas_int  ldb,
+                                 rocblas_int* overflow)
+{
+    if(m <= 0 || n <= 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    dim3 grid((m - 1) / kernel_block_size + 1, std::min(n, kernel_max_grid_y));
+    hipLaunchKernelGGL(convert_matrix_kernel<Ta, Tb>,
+                       grid,
+                       dim3(kernel_block_size),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       B,
+                       ldb,
+                       overflow);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+hipsolverStatus_t matrix_norm_inf(
+    hipStream_t stream, rocblas_int m, rocblas_int n, const T* A, rocblas_int lda, S* norm)
+{
+    CHECK_HIP_ERROR(hipMemsetAsync(norm, 0, sizeof(S), stream));
+    if(m <= 0 || n <= 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    dim3 grid((m - 1) / kernel_block_size + 1);
+    hipLaunchKernelGGL(matrix_norm_inf_kernel<T, S>,
+                       grid,
+                       dim3(kernel_block_size),
+                       0,
+                       stream,
+                       m,
+                       n,
+                       A,
+                       lda,
+                       norm);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+hipsolverStatus_t refine_check(hipStream_t  stream,
+                               rocblas_int  m,
+                               rocblas_int  nrhs,
+                               const T*     R,
+                               rocblas_int  ldr,
+                               const T*     X,
+                               rocblas_int  ldx,
+                               const S*     anrm,
+                               S            tol,
+                               rocblas_int* unconverged)
+{
+    CHECK_HIP_ERROR(hipMemsetAsync(unconverged, 0, sizeof(rocblas_int), stream));
+    if(m <= 0 || nrhs <= 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    dim3 grid(std::min(nrhs, kernel_max_grid_y));
+    hipLaunchKernelGGL(refine_check_kernel<T, S>,
+                       grid,
+                       dim3(kernel_block_size),
+                       0,
+                       stream,
+                       m,
+                       nrhs,
+                       R,
+                       ldr,
+                       X,
+                       ldx,
+                       anrm,
+                       tol,
+                       unconverged);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename I>
+hipsolverStatus_t sytrs_solve(hipStream_t        stream,
+                              rocblas_fill       uplo,
+                              rocblas_int        n,
+                              rocblas_int        nrhs,
+                              const T*           A,
+                              rocblas_int        lda,
+                              rocblas_stride     strideA,
+                              const I*           ipiv,
+                              rocblas_stride     strideP,
+                              T*                 B,
+                              rocblas_int        ldb,
+                              rocblas_stride     strideB,
+                              const rocblas_int* info,
+                              rocblas_int        batch_count)
+{
+    if(n <= 0 || nrhs <= 0 || batch_count <= 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    dim3 grid(nrhs, std::min(batch_count, kernel_max_grid_y));
+    hipLaunchKernelGGL(sytrs_kernel<T, I>,
+                       grid,
+                       dim3(kernel_block_size),
+                       0,
+                       stream,
+                       uplo,
+                       n,
+                       A,
+                       lda,
+                       strideA,
+                       ipiv,
+                       strideP,
+                       B,
+                       ldb,
+                       strideB,
+                       info,
+                       batch_count);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t
+    tsqr_lu_panel(hipStream_t stream, rocblas_int m, rocblas_int nb, T* A, rocblas_int lda, T* D)
+{
+    if(m <= 0 || nb <= 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipLaunchKernelGGL(
+        tsqr_lu_panel_kernel<T>, dim3(1), dim3(kernel_block_size), 0, stream, m, nb, A, lda, D);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t tsqr_reconstruct(hipStream_t stream,
+                                   rocblas_int n,
+                                   T*          A,
+                                   rocblas_int lda,
+                                   const T*    R,
+                                   rocblas_int ldr,
+                                   const T*    D,
+                                   T*          tau)
+{
+    if(n <= 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipLaunchKernelGGL(tsqr_reconstruct_kernel<T>,
+                       dim3(n),
+                       dim3(kernel_block_size),
+                       0,
+                       stream,
+                       n,
+                       A,
+                       lda,
+                       R,
+                       ldr,
+                       D,
+                       tau);
+    CHECK_HIP_ERROR(hipGetLastError());
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** INSTANTIATIONS ********************/
+template hipsolverStatus_t convert_matrix(hipStream_t,
+                                          rocblas_int,
+                                          rocblas_int,
+                                          const double*,
+                                          rocblas_int,
+                                          float*,
+                                          rocblas_int,
+                                          rocblas_int*);
+template hipsolverStatus_t convert_matrix(hipStream_t,
+                                          rocblas_int,
+                                          rocblas_int,
+                                          const float*,
+                                          rocblas_int,
+                                          double*,
+                                          rocblas_int,
+                                          rocblas_int*);
+template hipsolverStatus_t convert_matrix(hipStream_t,
+                                          rocblas_int,
+                                          rocblas_int,
+                                          const rocblas_double_complex*,
+                                          rocblas_int,
+                                          rocblas_float_complex*,
+                                          rocblas_int,
+                                          rocblas_int*);
+template hipsolverStatus_t convert_matrix(hipStream_t,
+                                          rocblas_int,
+                                          rocblas_int,
+                                          const rocblas_float_complex*,
+                                          rocblas_int,
+                                          rocblas_double_complex*,
+                                          rocblas_int,
+                                          rocblas_int*);
+
+template hipsolverStatus_t matrix_norm_inf(
+    hipStream_t, rocblas_int, rocblas_int, const double*, rocblas_int, double*);
+template hipsolverStatus_t matrix_norm_inf(
+    hipStream_t, rocblas_int, rocblas_int, const rocblas_double_complex*, rocblas_int, double*);
+
+template hipsolverStatus_t refine_check(hipStream_t,
+                                        rocblas_int,
+                                        rocblas_int,
+                                        const double*,
+                                        rocblas_int,
+                                        const double*,
+                                        rocblas_int,
+                                        const double*,
+                                        double,
+                                        rocblas_int*);
+template hipsolverStatus_t refine_check(hipStream_t,
+                                        rocblas_int,
+                                        rocblas_int,
+                                        const rocblas_double_complex*,
+                                        rocblas_int,
+                                        const rocblas_double_complex*,
+                                        rocblas_int,
+                                        const double*,
+                                        double,
+                                        rocblas_int*);
+
+#define INSTANTIATE_SYTRS_SOLVE(T, I)                         \
+    template hipsolverStatus_t sytrs_solve(hipStream_t,        \
+                                           rocblas_fill,       \
+                                           rocblas_int,        \
+                                           rocblas_int,        \
+                                           const T*,           \
+                                           rocblas_int,        \
+                                           rocblas_stride,     \
+                                           const I*,           \
+                                           rocblas_stride,     \
+                                           T*,                 \
+                                           rocblas_int,        \
+                                           rocblas_stride,     \
+                                           const rocblas_int*, \
+                                           rocblas_int)
+
+INSTANTIATE_SYTRS_SOLVE(float, rocblas_int);
+INSTANTIATE_SYTRS_SOLVE(double, rocblas_int);
+INSTANTIATE_SYTRS_SOLVE(rocblas_float_complex, rocblas_int);
+INSTANTIATE_SYTRS_SOLVE(rocblas_double_complex, rocblas_int);
+INSTANTIATE_SYTRS_SOLVE(float, int64_t);
+INSTANTIATE_SYTRS_SOLVE(double, int64_t);
+INSTANTIATE_SYTRS_SOLVE(rocblas_float_complex, int64_t);
+INSTANTIATE_SYTRS_SOLVE(rocblas_double_complex, int64_t);
+
+#define INSTANTIATE_TSQR(T)                                                             \
+    template hipsolverStatus_t tsqr_lu_panel(                                           \
+        hipStream_t, rocblas_int, rocblas_int, T*, rocblas_int, T*);                    \
+    template hipsolverStatus_t tsqr_reconstruct(                                        \
+        hipStream_t, rocblas_int, T*, rocblas_int, const T*, rocblas_int, const T*, T*)
+
+INSTANTIATE_TSQR(float);
+INSTANTIATE_TSQR(double);
+INSTANTIATE_TSQR(rocblas_float_complex);
+INSTANTIATE_TSQR(rocblas_double_complex);
+
+HIPSOLVER_END_NAMESPACE
@@ -0,0 +1,138 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+/*! \file
+ *  \brief Device kernels of the rocSOLVER backend, for the few operations that neither
+ *  rocBLAS nor rocSOLVER provide. hipsolver_kernels.cpp is the only source of the
+ *  backend that is compiled as HIP, and the launchers declared here can be called from
+ *  host-only code. Each launcher is instantiated for the types listed above it.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+
+#include <stdint.h>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/*! \brief Copies the m-by-n matrix A to B, converting each entry to the precision of B.
+ *  If overflow is not null, it is set to 1 when an entry of A is out of the range of the
+ *  precision of B, and is otherwise left unchanged.
+ *
+ *  (Ta, Tb) is (double, float), (float, double), (rocblas_double_complex,
+ *  rocblas_float_complex), or (rocblas_float_complex, rocblas_double_complex).
+ */
+template <typename Ta, typename Tb>
+hipsolverStatus_t convert_matrix(hipStream_t  stream,
+                                 rocblas_int  m,
+                                 rocblas_int  n,
+                                 const Ta*    A,
+                                 rocblas_int  lda,
+                                 Tb*          B,
+                                 rocblas_int  ldb,
+                                 rocblas_int* overflow);
+
+/*! \brief Sets norm to the infinity norm of the m-by-n matrix A, the largest sum of the
+ *  absolute values of the entries of a row. For complex matrices, |re| + |im| is used as
+ *  the absolute value, as in LAPACK's ?lange.
+ *
+ *  (T, S) is (double, double) or (rocblas_double_complex, double).
+ */
+template <typename T, typename S>
+hipsolverStatus_t matrix_norm_inf(
+    hipStream_t stream, rocblas_int m, rocblas_int n, const T* A, rocblas_int lda, S* norm);
+
+/*! \brief Convergence test of iterative refinement on the m-by-nrhs matrices R and X.
+ *  Sets unconverged to 1 if, for any column j, max_i |R(i,j)| > max_i |X(i,j)| * tol *
+ *  anrm, and otherwise to 0. anrm is taken as 1 if it is null. A NaN in R or X is
+ *  reported as unconverged.
+ *
+ *  (T, S) is (double, double) or (rocblas_double_complex, double).
+ */
+template <typename T, typename S>
+hipsolverStatus_t refine_check(hipStream_t  stream,
+                               rocblas_int  m,
+                               rocblas_int  nrhs,
+                               const T*     R,
+                               rocblas_int  ldr,
+                               const T*     X,
+                               rocblas_int  ldx,
+                               const S*     anrm,
+                               S            tol,
+                               rocblas_int* unconverged);
+
+/*! \brief Solves A_b * X_b = B_b for a strided batch of symmetric matrices factorized by
+ *  rocsolver_?sytrf(_strided_batched), overwriting B_b with X_b. Each right-hand side of
+ *  each system is solved by a block of threads following the unblocked algorithm of
+ *  LAPACK's ?sytrs, so the pivot indices and the blocks of D are read on the device. If
+ *  info is not null, the systems b with info[b] != 0 are left untouched.
+ *
+ *  T is float, double, rocblas_float_complex or rocblas_double_complex, and I is
+ *  rocblas_int or int64_t.
+ */
+template <typename T, typename I>
+hipsolverStatus_t sytrs_solve(hipStream_t        stream,
+                              rocblas_fill       uplo,
+                              rocblas_int        n,
+                              rocblas_int        nrhs,
+                              const T*           A,
+                              rocblas_int        lda,
+                              rocblas_stride     strideA,
+                              const I*           ipiv,
+                              rocblas_stride     strideP,
+                              T*                 B,
+                              rocblas_int        ldb,
+                              rocblas_stride     strideB,
+                              const rocblas_int* info,
+                              rocblas_int        batch_count);
+
+/*! \brief Computes the LU factorization without pivoting of the m-by-nb panel A, m >= nb,
+ *  as in LAPACK's ?laorhr_col_getrfnp2: before column j is eliminated, D(j) =
+ *  -sign(Re(A(j, j))) is subtracted from its diagonal entry, which keeps every pivot at
+ *  least one in magnitude when A has orthonormal columns. L and U overwrite A, and the
+ *  signs are returned in D. The panel is factorized by a single block of threads.
+ */
+template <typename T>
+hipsolverStatus_t
+    tsqr_lu_panel(hipStream_t stream, rocblas_int m, rocblas_int nb, T* A, rocblas_int lda, T* D);
+
+/*! \brief Completes the Householder reconstruction of the n-by-n leading block A, which
+ *  holds the factors of Q1 - D = L * U: the entries on and above the diagonal are replaced
+ *  by those of D * R, and tau(j) = -D(j) * U(j, j).
+ */
+template <typename T>
+hipsolverStatus_t tsqr_reconstruct(hipStream_t stream,
+                                   rocblas_int n,
+                                   T*          A,
+                                   rocblas_int lda,
+                                   const T*    R,
+                                   rocblas_int ldr,
+                                   const T*    D,
+                                   T*          tau);
+
+HIPSOLVER_END_NAMESPACE
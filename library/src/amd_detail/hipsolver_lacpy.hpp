@@ -0,0 +1,337 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Copies of batches of square matrices, used by the out-of-place inversions and
+ *  by the solvers that return their results through a temporary array.
+ *  rocBLAS has no matrix copy, so C = A is computed by geam as C = 1 * A + 0 * A.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** ROCBLAS OVERLOADS ********************/
+// geam_batched
+inline rocblas_status lacpy_geam(rocblas_handle     handle,
+                                 rocblas_int        n,
+                                 const float*       alpha,
+                                 const float* const A[],
+                                 rocblas_int        lda,
+                                 const float*       beta,
+                                 float* const       C[],
+                                 rocblas_int        ldc,
+                                 rocblas_int        batch_count)
+{
+    return rocblas_sgeam_batched(handle,
+                                 rocblas_operation_none,
+                                 rocblas_operation_none,
+                                 n,
+                                 n,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 beta,
+                                 A,
+                                 lda,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+
+inline rocblas_status lacpy_geam(rocblas_handle      handle,
+                                 rocblas_int         n,
+                                 const double*       alpha,
+                                 const double* const A[],
+                                 rocblas_int         lda,
+                                 const double*       beta,
+                                 double* const       C[],
+                                 rocblas_int         ldc,
+                                 rocblas_int         batch_count)
+{
+    return rocblas_dgeam_batched(handle,
+                                 rocblas_operation_none,
+                                 rocblas_operation_none,
+                                 n,
+                                 n,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 beta,
+                                 A,
+                                 lda,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+
+inline rocblas_status lacpy_geam(rocblas_handle                     handle,
+                                 rocblas_int                        n,
+                                 const rocblas_float_complex*       alpha,
+                                 const rocblas_float_complex* const A[],
+                                 rocblas_int                        lda,
+                                 const rocblas_float_complex*       beta,
+                                 rocblas_float_complex* const       C[],
+                                 rocblas_int                        ldc,
+                                 rocblas_int                        batch_count)
+{
+    return rocblas_cgeam_batched(handle,
+                                 rocblas_operation_none,
+                                 rocblas_operation_none,
+                                 n,
+                                 n,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 beta,
+                                 A,
+                                 lda,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+
+inline rocblas_status lacpy_geam(rocblas_handle                      handle,
+                                 rocblas_int                         n,
+                                 const rocblas_double_complex*       alpha,
+                                 const rocblas_double_complex* const A[],
+                                 rocblas_int                         lda,
+                                 const rocblas_double_complex*       beta,
+                                 rocblas_double_complex* const       C[],
+                                 rocblas_int                         ldc,
+                                 rocblas_int                         batch_count)
+{
+    return rocblas_zgeam_batched(handle,
+                                 rocblas_operation_none,
+                                 rocblas_operation_none,
+                                 n,
+                                 n,
+                                 alpha,
+                                 A,
+                                 lda,
+                                 beta,
+                                 A,
+                                 lda,
+                                 C,
+                                 ldc,
+                                 batch_count);
+}
+
+// geam_strided_batched
+inline rocblas_status lacpy_geam(rocblas_handle    handle,
+                                 rocblas_operation trans,
+                                 rocblas_int       n,
+                                 const float*      alpha,
+                                 const float*      A,
+                                 rocblas_int       lda,
+                                 rocblas_stride    strideA,
+                                 const float*      beta,
+                                 float*            C,
+                                 rocblas_int       ldc,
+                                 rocblas_stride    strideC,
+                                 rocblas_int       batch_count)
+{
+    return rocblas_sgeam_strided_batched(handle,
+                                         trans,
+                                         trans,
+                                         n,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status lacpy_geam(rocblas_handle    handle,
+                                 rocblas_operation trans,
+                                 rocblas_int       n,
+                                 const double*     alpha,
+                                 const double*     A,
+                                 rocblas_int       lda,
+                                 rocblas_stride    strideA,
+                                 const double*     beta,
+                                 double*           C,
+                                 rocblas_int       ldc,
+                                 rocblas_stride    strideC,
+                                 rocblas_int       batch_count)
+{
+    return rocblas_dgeam_strided_batched(handle,
+                                         trans,
+                                         trans,
+                                         n,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status lacpy_geam(rocblas_handle               handle,
+                                 rocblas_operation            trans,
+                                 rocblas_int                  n,
+                                 const rocblas_float_complex* alpha,
+                                 const rocblas_float_complex* A,
+                                 rocblas_int                  lda,
+                                 rocblas_stride               strideA,
+                                 const rocblas_float_complex* beta,
+                                 rocblas_float_complex*       C,
+                                 rocblas_int                  ldc,
+                                 rocblas_stride               strideC,
+                                 rocblas_int                  batch_count)
+{
+    return rocblas_cgeam_strided_batched(handle,
+                                         trans,
+                                         trans,
+                                         n,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status lacpy_geam(rocblas_handle                handle,
+                                 rocblas_operation             trans,
+                                 rocblas_int                   n,
+                                 const rocblas_double_complex* alpha,
+                                 const rocblas_double_complex* A,
+                                 rocblas_int                   lda,
+                                 rocblas_stride                strideA,
+                                 const rocblas_double_complex* beta,
+                                 rocblas_double_complex*       C,
+                                 rocblas_int                   ldc,
+                                 rocblas_stride                strideC,
+                                 rocblas_int                   batch_count)
+{
+    return rocblas_zgeam_strided_batched(handle,
+                                         trans,
+                                         trans,
+                                         n,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+/******************** TEMPLATES ********************/
+/*! \brief Copies the n-by-n matrices A_b of a batch to C_b.
+ */
+template <typename T>
+hipsolverStatus_t lacpy_batched_template(rocblas_handle handle,
+                                         rocblas_int    n,
+                                         T* const       A[],
+                                         rocblas_int    lda,
+                                         T* const       C[],
+                                         rocblas_int    ldc,
+                                         rocblas_int    batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    // the scalars passed to rocBLAS live on the host
+    rocblas_pointer_mode mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    T one  = 1;
+    T zero = 0;
+
+    rocblas_status status = lacpy_geam(handle, n, &one, A, lda, &zero, C, ldc, batch_count);
+
+    rocblas_set_pointer_mode(handle, mode);
+    return rocblas2hip_status(status);
+}
+
+/*! \brief Copies the n-by-n matrices A_b of a strided batch to C_b, or their
+ *  conjugate transposes when trans is rocblas_operation_conjugate_transpose.
+ */
+template <typename T>
+hipsolverStatus_t lacpy_strided_batched_template(rocblas_handle    handle,
+                                                 rocblas_int       n,
+                                                 const T*          A,
+                                                 rocblas_int       lda,
+                                                 rocblas_stride    strideA,
+                                                 T*                C,
+                                                 rocblas_int       ldc,
+                                                 rocblas_stride    strideC,
+                                                 rocblas_int       batch_count,
+                                                 rocblas_operation trans = rocblas_operation_none)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    // the scalars passed to rocBLAS live on the host
+    rocblas_pointer_mode mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    T one  = 1;
+    T zero = 0;
+
+    rocblas_status status = lacpy_geam(
+        handle, trans, n, &one, A, lda, strideA, &zero, C, ldc, strideC, batch_count);
+
+    rocblas_set_pointer_mode(handle, mode);
+    return rocblas2hip_status(status);
+}
+
+HIPSOLVER_END_NAMESPACE
@@ -0,0 +1,348 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Implementation of the stream-ordered device memory pool.
+ */
+
+#include "hipsolver_memory_pool.hpp"
+#include "hipsolver_handle.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** MEMORY POOL ********************/
+memory_pool::~memory_pool()
+{
+    for(auto& bin : free_blocks)
+    {
+        for(block& b : bin)
+        {
+            if(b.event)
+                hipEventDestroy(b.event);
+            hipFree(b.ptr);
+        }
+    }
+
+    // blocks still handed out are owned by objects that outlive the pool only
+    // if they were leaked; release them anyway
+    for(auto& it : used_blocks)
+    {
+        if(it.second.event)
+            hipEventDestroy(it.second.event);
+        hipFree(it.second.ptr);
+    }
+
+    if(budget)
+        budget->release(stats.reserved_bytes);
+}
+
+int memory_pool::size_to_bin(size_t size)
+{
+    int    bin        = 0;
+    size_t class_size = min_block_size;
+    while(class_size < size && bin < num_bins - 1)
+    {
+        class_size <<= 1;
+        bin++;
+    }
+    return bin;
+}
+
+size_t memory_pool::bin_to_size(int bin)
+{
+    return min_block_size << bin;
+}
+
+hipsolverStatus_t memory_pool::allocate(void** ptr, size_t size, hipStream_t stream)
+{
+    auto start = std::chrono::steady_clock::now();
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    // blocks left over the bound by earlier releases may be ready to be freed by now
+    if(max_cached_bytes)
+        release_cached(max_cached_bytes, false);
+
+    hipsolverStatus_t status = allocate_block(ptr, size, stream);
+
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    num_requests++;
+    request_ms += std::chrono::duration<double, std::milli>(elapsed).count();
+    return status;
+}
+
+// Must be called with the mutex held
+hipsolverStatus_t memory_pool::allocate_block(void** ptr, size_t size, hipStream_t stream)
+{
+    int bin = size_to_bin(size);
+    if(bin_to_size(bin) < size)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    std::vector<block>& bin_blocks = free_blocks[bin];
+    if(!bin_blocks.empty())
+    {
+        // prefer a block last used on the same stream
+        auto it = std::find_if(bin_blocks.begin(), bin_blocks.end(), [stream](const block& b) {
+            return b.stream == stream;
+        });
+        if(it == bin_blocks.end())
+        {
+            it = bin_blocks.end() - 1;
+            if(hipStreamWaitEvent(stream, it->event, 0) != hipSuccess)
+                return HIPSOLVER_STATUS_INTERNAL_ERROR;
+        }
+
+        block b = *it;
+        bin_blocks.erase(it);
+
+        b.stream           = stream;
+        used_blocks[b.ptr] = b;
+        *ptr               = b.ptr;
+
+        stats.used_bytes += bin_to_size(bin);
+        stats.peak_used_bytes = std::max(stats.peak_used_bytes, stats.used_bytes);
+        stats.num_reuses++;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    // a new block is charged against the budget, after returning the released blocks
+    // that are no longer in use to the device if that makes room for it
+    if(budget && !budget->try_reserve(bin_to_size(bin)))
+    {
+        release_cached(0, false);
+        if(!budget->reserve(bin_to_size(bin)))
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+    }
+
+    block b;
+    b.bin    = bin;
+    b.stream = stream;
+    b.event  = nullptr;
+    if(hipMalloc(&b.ptr, bin_to_size(bin)) != hipSuccess)
+    {
+        if(budget)
+            budget->release(bin_to_size(bin));
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+    }
+    if(hipEventCreateWithFlags(&b.event, hipEventDisableTiming) != hipSuccess)
+    {
+        hipFree(b.ptr);
+        if(budget)
+            budget->release(bin_to_size(bin));
+        return HIPSOLVER_STATUS_INTERNAL_ERROR;
+    }
+
+    used_blocks[b.ptr] = b;
+    *ptr               = b.ptr;
+
+    stats.reserved_bytes += bin_to_size(bin);
+    stats.used_bytes += bin_to_size(bin);
+    stats.peak_reserved_bytes = std::max(stats.peak_reserved_bytes, stats.reserved_bytes);
+    stats.peak_used_bytes     = std::max(stats.peak_used_bytes, stats.used_bytes);
+    stats.num_allocations++;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+void memory_pool::deallocate(void* ptr, hipStream_t stream)
+{
+    if(!ptr)
+        return;
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    auto it = used_blocks.find(ptr);
+    if(it == used_blocks.end())
+        return;
+
+    block b = it->second;
+    used_blocks.erase(it);
+
+    // mark the point after which the block is no longer used on its stream
+    b.stream = stream;
+    hipEventRecord(b.event, stream);
+
+    free_blocks[b.bin].push_back(b);
+    stats.used_bytes -= bin_to_size(b.bin);
+
+    if(max_cached_bytes)
+        release_cached(max_cached_bytes, false);
+}
+
+// Must be called with the mutex held. Without wait, blocks that may still be in use
+// on their stream are kept.
+hipsolverStatus_t memory_pool::release_cached(size_t max_bytes, bool wait)
+{
+    for(int bin = num_bins - 1; bin >= 0; bin--)
+    {
+        std::vector<block>& bin_blocks = free_blocks[bin];
+        for(size_t i = bin_blocks.size(); i > 0; i--)
+        {
+            if(stats.reserved_bytes - stats.used_bytes <= max_bytes)
+                return HIPSOLVER_STATUS_SUCCESS;
+
+            block& b = bin_blocks[i - 1];
+            if(wait)
+            {
+                if(hipEventSynchronize(b.event) != hipSuccess)
+                    return HIPSOLVER_STATUS_INTERNAL_ERROR;
+            }
+            else if(hipEventQuery(b.event) != hipSuccess)
+                continue;
+
+            hipEventDestroy(b.event);
+            hipFree(b.ptr);
+            bin_blocks.erase(bin_blocks.begin() + (i - 1));
+
+            stats.reserved_bytes -= bin_to_size(bin);
+            stats.num_releases++;
+            if(budget)
+                budget->release(bin_to_size(bin));
+        }
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+hipsolverStatus_t memory_pool::trim(size_t max_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return release_cached(max_bytes, true);
+}
+
+hipsolverStatus_t memory_pool::set_budget(std::shared_ptr<workspace_budget> new_budget)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    if(budget)
+        budget->release(stats.reserved_bytes);
+    budget.reset();
+
+    if(new_budget && !new_budget->try_reserve(stats.reserved_bytes))
+    {
+        // only the blocks in use need to fit in the budget
+        hipsolverStatus_t status = release_cached(0, true);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+        if(!new_budget->reserve(stats.reserved_bytes))
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+    }
+
+    budget = std::move(new_budget);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+void memory_pool::set_max_cached_bytes(size_t max_bytes)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    max_cached_bytes = max_bytes;
+    if(max_cached_bytes)
+        release_cached(max_cached_bytes, false);
+}
+
+size_t memory_pool::get_max_cached_bytes()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    return max_cached_bytes;
+}
+
+void memory_pool::get_info(hipsolverMemoryPoolInfo_t* info)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    *info = stats;
+}
+
+void memory_pool::get_request_stats(size_t* requests, double* time_ms)
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    *requests = num_requests;
+    *time_ms  = request_ms;
+}
+
+void memory_pool::reset_request_stats()
+{
+    std::lock_guard<std::mutex> lock(mutex);
+
+    num_requests = 0;
+    request_ms   = 0;
+}
+
+/******************** POOL DEVICE MALLOC ********************/
+pool_device_malloc::pool_device_malloc(rocblas_handle handle)
+    : pool(get_handle_data(handle)->pool)
+    , stream(nullptr)
+    , base(nullptr)
+    , valid(false)
+{
+    rocblas_get_stream(handle, &stream);
+}
+
+pool_device_malloc::pool_device_malloc(pool_device_malloc&& other)
+    : pool(std::move(other.pool))
+    , stream(other.stream)
+    , base(other.base)
+    , valid(other.valid)
+    , ptrs(std::move(other.ptrs))
+{
+    other.base  = nullptr;
+    other.valid = false;
+}
+
+pool_device_malloc& pool_device_malloc::operator=(pool_device_malloc&& other)
+{
+    if(this != &other)
+    {
+        release();
+
+        pool   = std::move(other.pool);
+        stream = other.stream;
+        base   = other.base;
+        valid  = other.valid;
+        ptrs   = std::move(other.ptrs);
+
+        other.base  = nullptr;
+        other.valid = false;
+    }
+    return *this;
+}
+
+pool_device_malloc::~pool_device_malloc()
+{
+    release();
+}
+
+void pool_device_malloc::release()
+{
+    if(pool && base)
+        pool->deallocate(base, stream);
+    base = nullptr;
+}
+
+HIPSOLVER_END_NAMESPACE
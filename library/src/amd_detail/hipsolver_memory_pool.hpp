@@ -0,0 +1,181 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Stream-ordered device memory pool used for the temporary arrays that
+ *  hipSOLVER allocates outside of the rocSOLVER workspace.
+ */
+
+#pragma once
+
+#include "handle_pool.hpp"
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/*! \brief Device memory sub-allocator with power-of-two size classes.
+ *
+ *  Blocks released to the pool are tagged with the stream on which they were last
+ *  used. A block can be handed out again immediately for work on the same stream,
+ *  as that work is ordered after any pending use of the block. When a block is
+ *  handed out for a different stream, that stream is made to wait on an event
+ *  recorded at release time.
+ *
+ *  The bytes held in released blocks are bounded. Blocks beyond the bound are
+ *  returned to the device once the work queued on them has completed, so that
+ *  releasing a block never blocks the host.
+ *
+ *  When a workspace budget is set, every block held from the device, whether in use
+ *  or released, is charged against it.
+ */
+class memory_pool
+{
+public:
+    static constexpr size_t min_block_size           = 256;
+    static constexpr int    num_bins                 = 48;
+    static constexpr size_t default_max_cached_bytes = size_t(256) << 20;
+
+    memory_pool() = default;
+    ~memory_pool();
+
+    memory_pool(const memory_pool&) = delete;
+    memory_pool& operator=(const memory_pool&) = delete;
+
+    // Returns a block of at least size bytes that is ready to be used on stream
+    hipsolverStatus_t allocate(void** ptr, size_t size, hipStream_t stream);
+
+    // Returns a block to the pool. Work already queued on stream may still use it.
+    void deallocate(void* ptr, hipStream_t stream);
+
+    // Returns released blocks to the device, largest first, until at most max_bytes
+    // are held in them. Waits for the work queued on those blocks.
+    hipsolverStatus_t trim(size_t max_bytes);
+
+    // Charges the device memory of the pool against budget, or stops charging it if
+    // budget is null. Fails if the memory already held does not fit in the budget.
+    hipsolverStatus_t set_budget(std::shared_ptr<workspace_budget> budget);
+
+    // Bound on the bytes held in released blocks. Zero means unbounded.
+    void   set_max_cached_bytes(size_t max_bytes);
+    size_t get_max_cached_bytes();
+
+    void get_info(hipsolverMemoryPoolInfo_t* info);
+
+    // Number of calls to allocate and the host time spent in them since the last reset
+    void get_request_stats(size_t* requests, double* time_ms);
+    void reset_request_stats();
+
+private:
+    struct block
+    {
+        void*       ptr;
+        int         bin;
+        hipStream_t stream;
+        hipEvent_t  event;
+    };
+
+    std::mutex                        mutex;
+    std::vector<block>                free_blocks[num_bins];
+    std::unordered_map<void*, block>  used_blocks;
+    hipsolverMemoryPoolInfo_t         stats = {};
+    size_t                            num_requests     = 0;
+    double                            request_ms       = 0;
+    size_t                            max_cached_bytes = default_max_cached_bytes;
+    std::shared_ptr<workspace_budget> budget;
+
+    hipsolverStatus_t allocate_block(void** ptr, size_t size, hipStream_t stream);
+    hipsolverStatus_t release_cached(size_t max_bytes, bool wait);
+
+    static int    size_to_bin(size_t size);
+    static size_t bin_to_size(int bin);
+};
+
+/*! \brief Scoped allocation from the memory pool of a handle, with the same usage as
+ *  rocblas_device_malloc. The requested sizes are carved from a single block with
+ *  128 byte alignment, and the block is released on the current stream of the handle
+ *  when the object goes out of scope.
+ */
+class pool_device_malloc
+{
+public:
+    explicit pool_device_malloc(rocblas_handle handle);
+
+    template <typename... Ss>
+    pool_device_malloc(rocblas_handle handle, Ss... sizes)
+        : pool_device_malloc(handle)
+    {
+        size_t aligned[] = {align(sizes)...};
+
+        size_t total = 0;
+        for(size_t s : aligned)
+            total += s;
+        if(total > 0 && pool->allocate(&base, total, stream) != HIPSOLVER_STATUS_SUCCESS)
+            return;
+
+        char* temp = (char*)base;
+        for(size_t s : aligned)
+        {
+            ptrs.push_back(s > 0 ? temp : nullptr);
+            temp += s;
+        }
+        valid = true;
+    }
+
+    pool_device_malloc(pool_device_malloc&& other);
+    pool_device_malloc& operator=(pool_device_malloc&& other);
+    ~pool_device_malloc();
+
+    explicit operator bool() const
+    {
+        return valid;
+    }
+
+    void* operator[](size_t i) const
+    {
+        return ptrs[i];
+    }
+
+private:
+    std::shared_ptr<memory_pool> pool;
+    hipStream_t                  stream;
+    void*                        base;
+    bool                         valid;
+    std::vector<void*>           ptrs;
+
+    void release();
+
+    static size_t align(size_t size)
+    {
+        return ((size + 127) / 128) * 128;
+    }
+};
+
+HIPSOLVER_END_NAMESPACE
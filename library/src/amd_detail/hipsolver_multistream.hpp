@@ -0,0 +1,108 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Helpers that split a batched call over the internal streams of a handle.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_handle.hpp"
+#include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+// Alignment of the workspace slice given to each stream
+constexpr size_t multistream_slice_align = 256;
+
+/*! \brief Computes the workspace needed for a batch split over the internal streams
+ *  of handle. query(sub_handle, count, &size) returns the workspace needed for a
+ *  sub-batch of count problems, and each stream gets a slice large enough for the
+ *  largest sub-batch.
+ */
+template <typename F>
+hipsolverStatus_t
+    multistream_workspace_size(rocblas_handle handle, int batch_count, F query, size_t* lwork)
+{
+    int                streams = multistream_count(handle, batch_count);
+    multistream_state* state;
+    CHECK_HIPSOLVER_ERROR(multistream_prepare(handle, streams, &state));
+
+    size_t size;
+    CHECK_HIPSOLVER_ERROR(query(state->handles[0], (batch_count + streams - 1) / streams, &size));
+
+    size_t slice = (size + multistream_slice_align - 1) / multistream_slice_align
+                   * multistream_slice_align;
+    return workspace_size_to_lwork(slice * streams, lwork);
+}
+
+/*! \brief Runs a batched call as sub-batches on the internal streams of handle.
+ *  run(sub_handle, offset, count, work, lwork) solves the count problems starting at
+ *  offset on sub_handle. The internal streams wait for the work already queued on
+ *  the stream of the handle, and the stream of the handle waits for all of them.
+ *
+ *  A user-provided workspace is split in equal slices, one per stream. Otherwise,
+ *  the workspace of each internal handle is managed automatically.
+ */
+template <typename F>
+hipsolverStatus_t
+    multistream_run(rocblas_handle handle, int batch_count, void* work, size_t lwork, F run)
+{
+    int                streams = multistream_count(handle, batch_count);
+    multistream_state* state;
+    CHECK_HIPSOLVER_ERROR(multistream_prepare(handle, streams, &state));
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+    CHECK_HIP_ERROR(hipEventRecord(state->fork_event, stream));
+
+    size_t slice = 0;
+    if(work && lwork > 0)
+        slice = lwork / streams / multistream_slice_align * multistream_slice_align;
+
+    // The remaining sub-batches are still launched after a failure, so that the
+    // stream of the handle joins all of the internal streams
+    hipsolverStatus_t status = HIPSOLVER_STATUS_SUCCESS;
+    int               offset = 0;
+    for(int i = 0; i < streams; i++)
+    {
+        int   count      = batch_count / streams + (i < batch_count % streams ? 1 : 0);
+        void* slice_work = slice ? (char*)work + i * slice : nullptr;
+
+        CHECK_HIP_ERROR(hipStreamWaitEvent(state->streams[i], state->fork_event, 0));
+        hipsolverStatus_t sub_status = run(state->handles[i], offset, count, slice_work, slice);
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = sub_status;
+        CHECK_HIP_ERROR(hipEventRecord(state->events[i], state->streams[i]));
+        CHECK_HIP_ERROR(hipStreamWaitEvent(stream, state->events[i], 0));
+
+        offset += count;
+    }
+
+    return status;
+}
+
+HIPSOLVER_END_NAMESPACE
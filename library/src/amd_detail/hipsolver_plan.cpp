@@ -0,0 +1,546 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Implementation of the dense solver plans on the rocSOLVER side. All enum
+ *  conversions, the workspace size query and the allocation of the workspace and any
+ *  internal scratch happen when the plan is created, so that executing the plan only
+ *  binds the workspace to the handle and launches rocSOLVER. The handle gets back its
+ *  own workspace when another function needs it or the plan is destroyed. A plan must
+ *  not outlive its handle.
+ */
+
+#include "exceptions.hpp"
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
+#include "hipsolver_memory_pool.hpp"
+#include "lib_macros.hpp"
+#include "logging.hpp"
+#include "utility.hpp"
+
+#include "rocblas/rocblas.h"
+#include "rocsolver/rocsolver.h"
+
+#include <algorithm>
+#include <memory>
+
+/******************** PLAN FUNCTIONS ********************/
+template <typename T>
+struct plan_functions;
+
+template <>
+struct plan_functions<float>
+{
+    using S = float;
+
+    static constexpr auto getrf                      = rocsolver_sgetrf;
+    static constexpr auto getrf_strided_batched      = rocsolver_sgetrf_strided_batched;
+    static constexpr auto getrf_npvt                 = rocsolver_sgetrf_npvt;
+    static constexpr auto getrf_npvt_strided_batched = rocsolver_sgetrf_npvt_strided_batched;
+    static constexpr auto getrs                      = rocsolver_sgetrs;
+    static constexpr auto getrs_strided_batched      = rocsolver_sgetrs_strided_batched;
+    static constexpr auto potrf                      = rocsolver_spotrf;
+    static constexpr auto potrs                      = rocsolver_spotrs;
+    static constexpr auto geqrf                      = rocsolver_sgeqrf;
+    static constexpr auto syevd                      = rocsolver_ssyevd;
+};
+
+template <>
+struct plan_functions<double>
+{
+    using S = double;
+
+    static constexpr auto getrf                      = rocsolver_dgetrf;
+    static constexpr auto getrf_strided_batched      = rocsolver_dgetrf_strided_batched;
+    static constexpr auto getrf_npvt                 = rocsolver_dgetrf_npvt;
+    static constexpr auto getrf_npvt_strided_batched = rocsolver_dgetrf_npvt_strided_batched;
+    static constexpr auto getrs                      = rocsolver_dgetrs;
+    static constexpr auto getrs_strided_batched      = rocsolver_dgetrs_strided_batched;
+    static constexpr auto potrf                      = rocsolver_dpotrf;
+    static constexpr auto potrs                      = rocsolver_dpotrs;
+    static constexpr auto geqrf                      = rocsolver_dgeqrf;
+    static constexpr auto syevd                      = rocsolver_dsyevd;
+};
+
+template <>
+struct plan_functions<rocblas_float_complex>
+{
+    using S = float;
+
+    static constexpr auto getrf                      = rocsolver_cgetrf;
+    static constexpr auto getrf_strided_batched      = rocsolver_cgetrf_strided_batched;
+    static constexpr auto getrf_npvt                 = rocsolver_cgetrf_npvt;
+    static constexpr auto getrf_npvt_strided_batched = rocsolver_cgetrf_npvt_strided_batched;
+    static constexpr auto getrs                      = rocsolver_cgetrs;
+    static constexpr auto getrs_strided_batched      = rocsolver_cgetrs_strided_batched;
+    static constexpr auto potrf                      = rocsolver_cpotrf;
+    static constexpr auto potrs                      = rocsolver_cpotrs;
+    static constexpr auto geqrf                      = rocsolver_cgeqrf;
+    static constexpr auto syevd                      = rocsolver_cheevd;
+};
+
+template <>
+struct plan_functions<rocblas_double_complex>
+{
+    using S = double;
+
+    static constexpr auto getrf                      = rocsolver_zgetrf;
+    static constexpr auto getrf_strided_batched      = rocsolver_zgetrf_strided_batched;
+    static constexpr auto getrf_npvt                 = rocsolver_zgetrf_npvt;
+    static constexpr auto getrf_npvt_strided_batched = rocsolver_zgetrf_npvt_strided_batched;
+    static constexpr auto getrs                      = rocsolver_zgetrs;
+    static constexpr auto getrs_strided_batched      = rocsolver_zgetrs_strided_batched;
+    static constexpr auto potrf                      = rocsolver_zpotrf;
+    static constexpr auto potrs                      = rocsolver_zpotrs;
+    static constexpr auto geqrf                      = rocsolver_zgeqrf;
+    static constexpr auto syevd                      = rocsolver_zheevd;
+};
+
+/******************** PLAN ********************/
+struct hipsolverPlan;
+
+typedef rocblas_status (*plan_launch_t)(
+    const hipsolverPlan& plan, void* A, void* B, void* C, rocblas_int* ipiv, rocblas_int* info);
+
+struct hipsolverPlan
+{
+    rocblas_handle         handle;
+    hipsolverWorkspaceOp_t desc;
+    plan_launch_t          launch;
+
+    // rocBLAS enums and strides converted from desc
+    rocblas_operation trans;
+    rocblas_fill      uplo;
+    rocblas_evect     evect;
+    rocblas_stride    strideA, strideP, strideB;
+
+    // Number of info values to be zeroed before launching routines that do not set them
+    int zero_info;
+
+    // Device memory holding the rocSOLVER workspace followed by any internal scratch
+    size_t work_size;
+    void*  work;
+    void*  scratch;
+
+    std::shared_ptr<hipsolver::memory_pool> pool;
+    hipStream_t                             stream;
+
+    // Constructor
+    explicit hipsolverPlan()
+        : handle(nullptr)
+        , launch(nullptr)
+        , trans(rocblas_operation_none)
+        , uplo(rocblas_fill_upper)
+        , evect(rocblas_evect_none)
+        , strideA(0)
+        , strideP(0)
+        , strideB(0)
+        , zero_info(0)
+        , work_size(0)
+        , work(nullptr)
+        , scratch(nullptr)
+        , stream(nullptr)
+    {
+    }
+
+    // Destructor
+    ~hipsolverPlan()
+    {
+        if(work)
+            pool->deallocate(work, stream);
+    }
+};
+
+// Launches the planned routine. It is also used, with null pointers, to query the size
+// of the rocSOLVER workspace when the plan is created.
+template <typename T>
+static rocblas_status plan_launch(
+    const hipsolverPlan& plan, void* A, void* B, void* C, rocblas_int* ipiv, rocblas_int* info)
+{
+    using F = plan_functions<T>;
+    using S = typename F::S;
+
+    const hipsolverWorkspaceOp_t& op = plan.desc;
+
+    // As in the regular API, getrf without a pivot array is computed without pivoting.
+    // The workspace size query covers both variants.
+    bool query = rocblas_is_device_memory_size_query(plan.handle);
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GETRF:
+        if(!ipiv || query)
+        {
+            rocblas_status status = F::getrf_npvt(plan.handle, op.m, op.n, (T*)A, op.lda, info);
+            if(!query)
+                return status;
+        }
+        return F::getrf(plan.handle, op.m, op.n, (T*)A, op.lda, ipiv, info);
+    case HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED:
+        if(!ipiv || query)
+        {
+            rocblas_status status = F::getrf_npvt_strided_batched(plan.handle,
+                                                                  op.m,
+                                                                  op.n,
+                                                                  (T*)A,
+                                                                  op.lda,
+                                                                  plan.strideA,
+                                                                  info,
+                                                                  op.batch_count);
+            if(!query)
+                return status;
+        }
+        return F::getrf_strided_batched(plan.handle,
+                                        op.m,
+                                        op.n,
+                                        (T*)A,
+                                        op.lda,
+                                        plan.strideA,
+                                        ipiv,
+                                        plan.strideP,
+                                        info,
+                                        op.batch_count);
+    case HIPSOLVER_ROUTINE_GETRS:
+        return F::getrs(
+            plan.handle, plan.trans, op.n, op.nrhs, (T*)A, op.lda, ipiv, (T*)B, op.ldb);
+    case HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED:
+        return F::getrs_strided_batched(plan.handle,
+                                        plan.trans,
+                                        op.n,
+                                        op.nrhs,
+                                        (T*)A,
+                                        op.lda,
+                                        plan.strideA,
+                                        ipiv,
+                                        plan.strideP,
+                                        (T*)B,
+                                        op.ldb,
+                                        plan.strideB,
+                                        op.batch_count);
+    case HIPSOLVER_ROUTINE_POTRF:
+        return F::potrf(plan.handle, plan.uplo, op.n, (T*)A, op.lda, info);
+    case HIPSOLVER_ROUTINE_POTRS:
+        return F::potrs(plan.handle, plan.uplo, op.n, op.nrhs, (T*)A, op.lda, (T*)B, op.ldb);
+    case HIPSOLVER_ROUTINE_GEQRF:
+        return F::geqrf(plan.handle, op.m, op.n, (T*)A, op.lda, (T*)C);
+    case HIPSOLVER_ROUTINE_SYEVD:
+        return F::syevd(
+            plan.handle, plan.evect, plan.uplo, op.n, (T*)A, op.lda, (S*)C, (S*)plan.scratch, info);
+    default:
+        return rocblas_status_not_implemented;
+    }
+}
+
+// Converts the enums used by op and selects the launch function. Returns the number of
+// bytes of internal scratch required by the routine in scratch_size.
+static hipsolverStatus_t plan_setup(hipsolverPlan& plan, size_t* scratch_size)
+{
+    const hipsolverWorkspaceOp_t& op = plan.desc;
+
+    size_t real_size;
+    switch(op.precision)
+    {
+    case HIP_R_32F:
+        plan.launch = plan_launch<float>;
+        real_size   = sizeof(float);
+        break;
+    case HIP_R_64F:
+        plan.launch = plan_launch<double>;
+        real_size   = sizeof(double);
+        break;
+    case HIP_C_32F:
+        plan.launch = plan_launch<rocblas_float_complex>;
+        real_size   = sizeof(float);
+        break;
+    case HIP_C_64F:
+        plan.launch = plan_launch<rocblas_double_complex>;
+        real_size   = sizeof(double);
+        break;
+    default:
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    // Strided batches are packed
+    plan.strideA  = rocblas_stride(op.lda) * op.n;
+    plan.strideP  = std::min(op.m, op.n);
+    plan.strideB  = rocblas_stride(op.ldb) * op.nrhs;
+    *scratch_size = 0;
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GETRF:
+    case HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED:
+        break;
+    case HIPSOLVER_ROUTINE_GETRS:
+        plan.trans     = hipsolver::hip2rocblas_operation(op.trans);
+        plan.strideP   = op.n;
+        plan.zero_info = 1;
+        break;
+    case HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED:
+        plan.trans     = hipsolver::hip2rocblas_operation(op.trans);
+        plan.strideP   = op.n;
+        plan.zero_info = op.batch_count;
+        break;
+    case HIPSOLVER_ROUTINE_POTRF:
+        plan.uplo = hipsolver::hip2rocblas_fill(op.uplo);
+        break;
+    case HIPSOLVER_ROUTINE_POTRS:
+        plan.uplo      = hipsolver::hip2rocblas_fill(op.uplo);
+        plan.zero_info = 1;
+        break;
+    case HIPSOLVER_ROUTINE_GEQRF:
+        plan.zero_info = 1;
+        break;
+    case HIPSOLVER_ROUTINE_SYEVD:
+        plan.evect    = hipsolver::hip2rocblas_evect(op.jobz);
+        plan.uplo     = hipsolver::hip2rocblas_fill(op.uplo);
+        *scratch_size = real_size * std::max(op.n, 1);
+        break;
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// Returns the hipsolver-bench function that runs the routine of a plan executed with or
+// without a pivot array
+static const char* plan_bench_func(const hipsolverWorkspaceOp_t& op, bool pivots)
+{
+    bool complex = op.precision == HIP_C_32F || op.precision == HIP_C_64F;
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GETRF:
+        return pivots ? "getrf" : "getrf_npvt";
+    case HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED:
+        return pivots ? "getrf_strided_batched" : "getrf_npvt_strided_batched";
+    case HIPSOLVER_ROUTINE_GETRS:
+        return "getrs";
+    case HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED:
+        return "getrs_strided_batched";
+    case HIPSOLVER_ROUTINE_POTRF:
+        return "potrf";
+    case HIPSOLVER_ROUTINE_POTRS:
+        return "potrs";
+    case HIPSOLVER_ROUTINE_GEQRF:
+        return "geqrf";
+    case HIPSOLVER_ROUTINE_SYEVD:
+        return complex ? "heevd" : "syevd";
+    default:
+        return nullptr;
+    }
+}
+
+// Binds the workspace of the plan to its handle and launches the planned routine
+static hipsolverStatus_t
+    plan_execute(const hipsolverPlan& p, void* A, void* B, void* C, int* devIpiv, int* devInfo)
+{
+    if(p.work_size > 0)
+        CHECK_ROCBLAS_ERROR(hipsolver::workspace_plan_bind(p.handle, &p, p.work, p.work_size));
+    if(p.zero_info > 0)
+        CHECK_ROCBLAS_ERROR(hipsolverZeroInfo(p.handle, devInfo, p.zero_info));
+
+    return hipsolver::rocblas2hip_status(p.launch(p, A, B, C, devIpiv, devInfo));
+}
+
+extern "C" {
+
+hipsolverStatus_t hipsolverDnCreatePlan(hipsolverHandle_t             handle,
+                                        const hipsolverWorkspaceOp_t* desc,
+                                        hipsolverDnPlan_t*            plan)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!desc || !plan)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipsolverPlan> p(new hipsolverPlan);
+    p->handle = (rocblas_handle)handle;
+    p->desc   = *desc;
+
+    size_t scratch_size;
+    CHECK_HIPSOLVER_ERROR(plan_setup(*p, &scratch_size));
+
+    rocblas_start_device_memory_size_query(p->handle);
+    rocblas_status status = p->launch(*p, nullptr, nullptr, nullptr, nullptr, nullptr);
+    rocblas_stop_device_memory_size_query(p->handle, &p->work_size);
+    CHECK_ROCBLAS_ERROR(status);
+
+    // scratch is placed at the first 256-byte aligned offset after the workspace
+    size_t offset = ((p->work_size + 255) / 256) * 256;
+    if(offset + scratch_size > 0)
+    {
+        CHECK_ROCBLAS_ERROR(rocblas_get_stream(p->handle, &p->stream));
+        p->pool = hipsolver::get_handle_data(p->handle)->pool;
+        CHECK_HIPSOLVER_ERROR(p->pool->allocate(&p->work, offset + scratch_size, p->stream));
+        if(scratch_size > 0)
+            p->scratch = (char*)p->work + offset;
+    }
+
+    *plan = p.release();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnDestroyPlan(hipsolverDnPlan_t plan)
+try
+{
+    if(!plan)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverPlan* p = (hipsolverPlan*)plan;
+
+    // If the handle is still bound to the workspace of the plan, it gets back the
+    // workspace it used before. Nothing is done if the handle was already destroyed.
+    if(p->work_size > 0)
+        CHECK_ROCBLAS_ERROR(hipsolver::workspace_plan_restore(p->handle, p));
+
+    delete p;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnExecutePlan(
+    hipsolverDnPlan_t plan, void* A, void* B, void* C, int* devIpiv, int* devInfo)
+try
+{
+    if(!plan)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    const hipsolverPlan&          p  = *(hipsolverPlan*)plan;
+    const hipsolverWorkspaceOp_t& op = p.desc;
+
+    // The execution is logged as a call to the planned routine, with its arguments
+    char        precision  = hipsolver::log_precision(op.precision);
+    const char* bench_func = plan_bench_func(op, devIpiv != nullptr);
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GETRF:
+    case HIPSOLVER_ROUTINE_GEQRF:
+    {
+        hipsolver::api_logger logger(p.handle,
+                                     __func__,
+                                     {{"m", op.m}, {"n", op.n}, {"lda", op.lda}},
+                                     precision,
+                                     bench_func);
+        return plan_execute(p, A, B, C, devIpiv, devInfo);
+    }
+    case HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED:
+    {
+        hipsolver::api_logger logger(p.handle,
+                                     __func__,
+                                     {{"m", op.m},
+                                      {"n", op.n},
+                                      {"lda", op.lda},
+                                      {"strideA", p.strideA},
+                                      {"strideP", p.strideP},
+                                      {"batch_count", op.batch_count}},
+                                     precision,
+                                     bench_func);
+        return plan_execute(p, A, B, C, devIpiv, devInfo);
+    }
+    case HIPSOLVER_ROUTINE_GETRS:
+    {
+        hipsolver::api_logger logger(p.handle,
+                                     __func__,
+                                     {{"trans", op.trans},
+                                      {"n", op.n},
+                                      {"nrhs", op.nrhs},
+                                      {"lda", op.lda},
+                                      {"ldb", op.ldb}},
+                                     precision,
+                                     bench_func);
+        return plan_execute(p, A, B, C, devIpiv, devInfo);
+    }
+    case HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED:
+    {
+        hipsolver::api_logger logger(p.handle,
+                                     __func__,
+                                     {{"trans", op.trans},
+                                      {"n", op.n},
+                                      {"nrhs", op.nrhs},
+                                      {"lda", op.lda},
+                                      {"strideA", p.strideA},
+                                      {"strideP", p.strideP},
+                                      {"ldb", op.ldb},
+                                      {"strideB", p.strideB},
+                                      {"batch_count", op.batch_count}},
+                                     precision,
+                                     bench_func);
+        return plan_execute(p, A, B, C, devIpiv, devInfo);
+    }
+    case HIPSOLVER_ROUTINE_POTRF:
+    {
+        hipsolver::api_logger logger(p.handle,
+                                     __func__,
+                                     {{"uplo", op.uplo}, {"n", op.n}, {"lda", op.lda}},
+                                     precision,
+                                     bench_func);
+        return plan_execute(p, A, B, C, devIpiv, devInfo);
+    }
+    case HIPSOLVER_ROUTINE_POTRS:
+    {
+        hipsolver::api_logger logger(p.handle,
+                                     __func__,
+                                     {{"uplo", op.uplo},
+                                      {"n", op.n},
+                                      {"nrhs", op.nrhs},
+                                      {"lda", op.lda},
+                                      {"ldb", op.ldb}},
+                                     precision,
+                                     bench_func);
+        return plan_execute(p, A, B, C, devIpiv, devInfo);
+    }
+    case HIPSOLVER_ROUTINE_SYEVD:
+    {
+        hipsolver::api_logger logger(p.handle,
+                                     __func__,
+                                     {{"jobz", op.jobz},
+                                      {"uplo", op.uplo},
+                                      {"n", op.n},
+                                      {"lda", op.lda}},
+                                     precision,
+                                     bench_func);
+        return plan_execute(p, A, B, C, devIpiv, devInfo);
+    }
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+} //extern C
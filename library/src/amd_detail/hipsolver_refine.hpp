@@ -0,0 +1,1071 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+/*! \file
+ *  \brief Mixed-precision solvers with iterative refinement, as in LAPACK's dsgesv and
+ *  zcgesv, and their least-squares counterparts. The matrix is factorized in single
+ *  precision by rocSOLVER (LU for gesv, QR for gels), and the solution is refined in
+ *  double precision with residuals computed by rocBLAS. The conversions between
+ *  precisions and the convergence tests run in the kernels declared in
+ *  hipsolver_kernels.hpp. When the matrix cannot be represented in single precision,
+ *  its single-precision factorization fails, or refinement does not converge, the
+ *  system is solved again in double precision.
+ *
+ *  rocSOLVER has no half-precision factorization, so the variants that cuSOLVER runs
+ *  in half precision (DH and ZK) are factorized in single precision as well.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_handle.hpp"
+#include "hipsolver_kernels.hpp"
+#include "hipsolver_memory_pool.hpp"
+#include "lib_macros.hpp"
+#include "utility.hpp"
+
+#include "rocblas/rocblas.h"
+#include "rocsolver/rocsolver.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+
+extern "C" {
+
+// The following functions are not included in the public API of rocSOLVER and must be declared
+
+rocblas_status rocsolver_dgesv_outofplace(rocblas_handle    handle,
+                                          const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          double*           A,
+                                          const rocblas_int lda,
+                                          rocblas_int*      ipiv,
+                                          double*           B,
+                                          const rocblas_int ldb,
+                                          double*           X,
+                                          const rocblas_int ldx,
+                                          rocblas_int*      info);
+
+rocblas_status rocsolver_zgesv_outofplace(rocblas_handle          handle,
+                                          const rocblas_int       n,
+                                          const rocblas_int       nrhs,
+                                          rocblas_double_complex* A,
+                                          const rocblas_int       lda,
+                                          rocblas_int*            ipiv,
+                                          rocblas_double_complex* B,
+                                          const rocblas_int       ldb,
+                                          rocblas_double_complex* X,
+                                          const rocblas_int       ldx,
+                                          rocblas_int*            info);
+
+rocblas_status rocsolver_dgels_outofplace(rocblas_handle    handle,
+                                          rocblas_operation trans,
+                                          const rocblas_int m,
+                                          const rocblas_int n,
+                                          const rocblas_int nrhs,
+                                          double*           A,
+                                          const rocblas_int lda,
+                                          double*           B,
+                                          const rocblas_int ldb,
+                                          double*           X,
+                                          const rocblas_int ldx,
+                                          rocblas_int*      info);
+
+rocblas_status rocsolver_zgels_outofplace(rocblas_handle          handle,
+                                          rocblas_operation       trans,
+                                          const rocblas_int       m,
+                                          const rocblas_int       n,
+                                          const rocblas_int       nrhs,
+                                          rocblas_double_complex* A,
+                                          const rocblas_int       lda,
+                                          rocblas_double_complex* B,
+                                          const rocblas_int       ldb,
+                                          rocblas_double_complex* X,
+                                          const rocblas_int       ldx,
+                                          rocblas_int*            info);
+}
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+// Maximum number of refinement steps before falling back to double precision, as in
+// LAPACK
+constexpr rocblas_int refine_default_max_iters = 30;
+
+// Returns the maximum number of refinement steps set with hipsolverSetRefinementMaxIters,
+// or the default if none was set
+inline rocblas_int refine_max_iters(rocblas_handle handle)
+{
+    hipsolverHandleData* data = find_handle_data(handle);
+    if(!data || data->refinement_max_iters == 0)
+        return refine_default_max_iters;
+    return data->refinement_max_iters;
+}
+
+/******************** ROCBLAS/ROCSOLVER OVERLOADS ********************/
+// getrf
+inline rocblas_status refine_getrf(rocblas_handle handle,
+                                   rocblas_int    n,
+                                   float*         A,
+                                   rocblas_int    lda,
+                                   rocblas_int*   ipiv,
+                                   rocblas_int*   info)
+{
+    return rocsolver_sgetrf(handle, n, n, A, lda, ipiv, info);
+}
+
+inline rocblas_status refine_getrf(rocblas_handle         handle,
+                                   rocblas_int            n,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   rocblas_int*           ipiv,
+                                   rocblas_int*           info)
+{
+    return rocsolver_cgetrf(handle, n, n, A, lda, ipiv, info);
+}
+
+// getrs
+inline rocblas_status refine_getrs(rocblas_handle     handle,
+                                   rocblas_int        n,
+                                   rocblas_int        nrhs,
+                                   float*             A,
+                                   rocblas_int        lda,
+                                   const rocblas_int* ipiv,
+                                   float*             B,
+                                   rocblas_int        ldb)
+{
+    return rocsolver_sgetrs(handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+inline rocblas_status refine_getrs(rocblas_handle         handle,
+                                   rocblas_int            n,
+                                   rocblas_int            nrhs,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   const rocblas_int*     ipiv,
+                                   rocblas_float_complex* B,
+                                   rocblas_int            ldb)
+{
+    return rocsolver_cgetrs(handle, rocblas_operation_none, n, nrhs, A, lda, ipiv, B, ldb);
+}
+
+// gemm
+inline rocblas_status refine_gemm(rocblas_handle handle,
+                                  rocblas_int    m,
+                                  rocblas_int    n,
+                                  rocblas_int    k,
+                                  const double*  alpha,
+                                  const double*  A,
+                                  rocblas_int    lda,
+                                  const double*  B,
+                                  rocblas_int    ldb,
+                                  const double*  beta,
+                                  double*        C,
+                                  rocblas_int    ldc)
+{
+    return rocblas_dgemm(handle,
+                         rocblas_operation_none,
+                         rocblas_operation_none,
+                         m,
+                         n,
+                         k,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         beta,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status refine_gemm(rocblas_handle                handle,
+                                  rocblas_int                   m,
+                                  rocblas_int                   n,
+                                  rocblas_int                   k,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* A,
+                                  rocblas_int                   lda,
+                                  const rocblas_double_complex* B,
+                                  rocblas_int                   ldb,
+                                  const rocblas_double_complex* beta,
+                                  rocblas_double_complex*       C,
+                                  rocblas_int                   ldc)
+{
+    return rocblas_zgemm(handle,
+                         rocblas_operation_none,
+                         rocblas_operation_none,
+                         m,
+                         n,
+                         k,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb,
+                         beta,
+                         C,
+                         ldc);
+}
+
+// geam
+inline rocblas_status refine_geam(rocblas_handle handle,
+                                  rocblas_int    m,
+                                  rocblas_int    n,
+                                  const double*  alpha,
+                                  const double*  A,
+                                  rocblas_int    lda,
+                                  const double*  beta,
+                                  const double*  B,
+                                  rocblas_int    ldb,
+                                  double*        C,
+                                  rocblas_int    ldc)
+{
+    return rocblas_dgeam(handle,
+                         rocblas_operation_none,
+                         rocblas_operation_none,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         beta,
+                         B,
+                         ldb,
+                         C,
+                         ldc);
+}
+
+inline rocblas_status refine_geam(rocblas_handle                handle,
+                                  rocblas_int                   m,
+                                  rocblas_int                   n,
+                                  const rocblas_double_complex* alpha,
+                                  const rocblas_double_complex* A,
+                                  rocblas_int                   lda,
+                                  const rocblas_double_complex* beta,
+                                  const rocblas_double_complex* B,
+                                  rocblas_int                   ldb,
+                                  rocblas_double_complex*       C,
+                                  rocblas_int                   ldc)
+{
+    return rocblas_zgeam(handle,
+                         rocblas_operation_none,
+                         rocblas_operation_none,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         beta,
+                         B,
+                         ldb,
+                         C,
+                         ldc);
+}
+
+// gesv in double precision
+inline rocblas_status refine_gesv_full(rocblas_handle handle,
+                                       rocblas_int    n,
+                                       rocblas_int    nrhs,
+                                       double*        A,
+                                       rocblas_int    lda,
+                                       rocblas_int*   ipiv,
+                                       double*        B,
+                                       rocblas_int    ldb,
+                                       double*        X,
+                                       rocblas_int    ldx,
+                                       rocblas_int*   info)
+{
+    return rocsolver_dgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status refine_gesv_full(rocblas_handle          handle,
+                                       rocblas_int             n,
+                                       rocblas_int             nrhs,
+                                       rocblas_double_complex* A,
+                                       rocblas_int             lda,
+                                       rocblas_int*            ipiv,
+                                       rocblas_double_complex* B,
+                                       rocblas_int             ldb,
+                                       rocblas_double_complex* X,
+                                       rocblas_int             ldx,
+                                       rocblas_int*            info)
+{
+    return rocsolver_zgesv_outofplace(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info);
+}
+
+// geqrf
+inline rocblas_status refine_geqrf(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* tau)
+{
+    return rocsolver_sgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status refine_geqrf(rocblas_handle         handle,
+                                   rocblas_int            m,
+                                   rocblas_int            n,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   rocblas_float_complex* tau)
+{
+    return rocsolver_cgeqrf(handle, m, n, A, lda, tau);
+}
+
+// ormqr/unmqr, applying Q^H from the left
+inline rocblas_status refine_ormqr(rocblas_handle handle,
+                                   rocblas_int    m,
+                                   rocblas_int    n,
+                                   rocblas_int    k,
+                                   float*         A,
+                                   rocblas_int    lda,
+                                   float*         tau,
+                                   float*         C,
+                                   rocblas_int    ldc)
+{
+    return rocsolver_sormqr(
+        handle, rocblas_side_left, rocblas_operation_transpose, m, n, k, A, lda, tau, C, ldc);
+}
+
+inline rocblas_status refine_ormqr(rocblas_handle         handle,
+                                   rocblas_int            m,
+                                   rocblas_int            n,
+                                   rocblas_int            k,
+                                   rocblas_float_complex* A,
+                                   rocblas_int            lda,
+                                   rocblas_float_complex* tau,
+                                   rocblas_float_complex* C,
+                                   rocblas_int            ldc)
+{
+    return rocsolver_cunmqr(handle,
+                            rocblas_side_left,
+                            rocblas_operation_conjugate_transpose,
+                            m,
+                            n,
+                            k,
+                            A,
+                            lda,
+                            tau,
+                            C,
+                            ldc);
+}
+
+// trsm with the upper triangular factor from the left
+inline rocblas_status refine_trsm(rocblas_handle handle,
+                                  rocblas_int    m,
+                                  rocblas_int    n,
+                                  const float*   alpha,
+                                  const float*   A,
+                                  rocblas_int    lda,
+                                  float*         B,
+                                  rocblas_int    ldb)
+{
+    return rocblas_strsm(handle,
+                         rocblas_side_left,
+                         rocblas_fill_upper,
+                         rocblas_operation_none,
+                         rocblas_diagonal_non_unit,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb);
+}
+
+inline rocblas_status refine_trsm(rocblas_handle               handle,
+                                  rocblas_int                  m,
+                                  rocblas_int                  n,
+                                  const rocblas_float_complex* alpha,
+                                  const rocblas_float_complex* A,
+                                  rocblas_int                  lda,
+                                  rocblas_float_complex*       B,
+                                  rocblas_int                  ldb)
+{
+    return rocblas_ctrsm(handle,
+                         rocblas_side_left,
+                         rocblas_fill_upper,
+                         rocblas_operation_none,
+                         rocblas_diagonal_non_unit,
+                         m,
+                         n,
+                         alpha,
+                         A,
+                         lda,
+                         B,
+                         ldb);
+}
+
+// gels in double precision
+inline rocblas_status refine_gels_full(rocblas_handle handle,
+                                       rocblas_int    m,
+                                       rocblas_int    n,
+                                       rocblas_int    nrhs,
+                                       double*        A,
+                                       rocblas_int    lda,
+                                       double*        B,
+                                       rocblas_int    ldb,
+                                       double*        X,
+                                       rocblas_int    ldx,
+                                       rocblas_int*   info)
+{
+    return rocsolver_dgels_outofplace(
+        handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+}
+
+inline rocblas_status refine_gels_full(rocblas_handle          handle,
+                                       rocblas_int             m,
+                                       rocblas_int             n,
+                                       rocblas_int             nrhs,
+                                       rocblas_double_complex* A,
+                                       rocblas_int             lda,
+                                       rocblas_double_complex* B,
+                                       rocblas_int             ldb,
+                                       rocblas_double_complex* X,
+                                       rocblas_int             ldx,
+                                       rocblas_int*            info)
+{
+    return rocsolver_zgels_outofplace(
+        handle, rocblas_operation_none, m, n, nrhs, A, lda, B, ldb, X, ldx, info);
+}
+
+/******************** TEMPORARY ARRAYS ********************/
+// Returns the size in bytes of a buffer holding all the temporary arrays
+template <size_t N>
+size_t refine_temp_total(const std::array<size_t, N>& sizes)
+{
+    size_t total = 0;
+    for(size_t size : sizes)
+        total += ((size + 127) / 128) * 128;
+    return total;
+}
+
+// Points temps to consecutive 128 byte aligned regions of work, which must hold
+// refine_temp_total(sizes) bytes
+template <size_t N>
+void refine_carve_temps(void* work, const std::array<size_t, N>& sizes, void** temps)
+{
+    char* ptr = (char*)work;
+    for(size_t i = 0; i < N; i++)
+    {
+        temps[i] = ptr;
+        ptr += ((sizes[i] + 127) / 128) * 128;
+    }
+}
+
+// Points temps to the temporary arrays, carved from the front of the user workspace, or
+// taken from the memory pool of the handle and held by mem when no workspace is given.
+// size_work is the rocBLAS workspace needed besides the temporary arrays.
+template <size_t N>
+hipsolverStatus_t refine_setup_temps(rocblas_handle               handle,
+                                     const std::array<size_t, N>& sizes,
+                                     size_t                       size_work,
+                                     void*                        work,
+                                     size_t                       lwork,
+                                     pool_device_malloc&          mem,
+                                     void**                       temps)
+{
+    size_t size_temps = refine_temp_total(sizes);
+
+    if(work && lwork)
+    {
+        if(lwork < size_temps)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        refine_carve_temps(work, sizes, temps);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_workspace(handle, (char*)work + size_temps, lwork - size_temps));
+    }
+    else
+    {
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, size_work));
+
+        mem = pool_device_malloc(handle, size_temps);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        refine_carve_temps(mem[0], sizes, temps);
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/******************** GESV ********************/
+// Temporary arrays used by the mixed-precision gesv
+enum gesv_refine_temp
+{
+    gesv_refine_temp_SA, // single-precision LU factors of A
+    gesv_refine_temp_SX, // single-precision right-hand sides and corrections
+    gesv_refine_temp_R, // double-precision residuals and corrections
+    gesv_refine_temp_B, // copy of B, when the solution overwrites it
+    gesv_refine_temp_norm, // infinity norm of A
+    gesv_refine_temp_flags, // overflow and convergence flags
+    gesv_refine_num_temps
+};
+
+// Returns the size in bytes of each temporary array
+template <typename T, typename S>
+std::array<size_t, gesv_refine_num_temps> gesv_refine_temp_sizes(rocblas_int n, rocblas_int nrhs)
+{
+    std::array<size_t, gesv_refine_num_temps> sizes;
+    sizes[gesv_refine_temp_SA]    = sizeof(S) * n * n;
+    sizes[gesv_refine_temp_SX]    = sizeof(S) * n * nrhs;
+    sizes[gesv_refine_temp_R]     = sizeof(T) * n * nrhs;
+    sizes[gesv_refine_temp_B]     = sizeof(T) * n * nrhs;
+    sizes[gesv_refine_temp_norm]  = sizeof(double);
+    sizes[gesv_refine_temp_flags] = sizeof(rocblas_int) * 2;
+    return sizes;
+}
+
+/*! \brief Returns the rocBLAS workspace size needed by the mixed-precision gesv,
+ *  including the fallback to double precision.
+ */
+template <typename T, typename S>
+hipsolverStatus_t
+    gesv_refine_workspace_size(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, size_t* size)
+{
+    T one = 1;
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(refine_gesv_full(handle,
+                                                                   n,
+                                                                   nrhs,
+                                                                   (T*)nullptr,
+                                                                   n,
+                                                                   (rocblas_int*)nullptr,
+                                                                   (T*)nullptr,
+                                                                   n,
+                                                                   (T*)nullptr,
+                                                                   n,
+                                                                   (rocblas_int*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(
+            refine_getrf(handle, n, (S*)nullptr, n, (rocblas_int*)nullptr, (rocblas_int*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(refine_getrs(
+            handle, n, nrhs, (S*)nullptr, n, (rocblas_int*)nullptr, (S*)nullptr, n));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(refine_gemm(
+            handle, n, nrhs, n, &one, (T*)nullptr, n, (T*)nullptr, n, &one, (T*)nullptr, n));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(refine_geam(
+            handle, n, nrhs, &one, (T*)nullptr, n, &one, (T*)nullptr, n, (T*)nullptr, n));
+    rocblas_stop_device_memory_size_query(handle, size);
+
+    return status;
+}
+
+/*! \brief Returns the device workspace size needed by the mixed-precision gesv: the
+ *  rocBLAS workspace plus the temporary arrays.
+ */
+template <typename T, typename S>
+hipsolverStatus_t
+    gesv_refine_device_size(rocblas_handle handle, rocblas_int n, rocblas_int nrhs, size_t* size)
+{
+    hipsolverStatus_t status = gesv_refine_workspace_size<T, S>(handle, n, nrhs, size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *size += refine_temp_total(gesv_refine_temp_sizes<T, S>(n, nrhs));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Solves A * X = B by LU factorization in the precision of S and iterative
+ *  refinement in the precision of T. On success niters is the number of refinement
+ *  steps and A is unchanged. Otherwise, the system is solved again in the precision of
+ *  T, overwriting A with its LU factors, and niters is -2 if A or a
+ *  residual could not be represented in the precision of S, -3 if the factorization in
+ *  the precision of S failed, or -(max_iters + 1) if refinement did not converge.
+ *
+ *  The convergence test of each refinement step is read back by the host, so this
+ *  function waits for the work queued on the stream of the handle.
+ */
+template <typename T, typename S>
+hipsolverStatus_t gesv_refine_template(rocblas_handle handle,
+                                       rocblas_int    n,
+                                       rocblas_int    nrhs,
+                                       T*             A,
+                                       rocblas_int    lda,
+                                       rocblas_int*   ipiv,
+                                       T*             B,
+                                       rocblas_int    ldb,
+                                       T*             X,
+                                       rocblas_int    ldx,
+                                       rocblas_int    max_iters,
+                                       rocblas_int*   niters,
+                                       rocblas_int*   info,
+                                       void**         temps)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    S*           SA    = (S*)temps[gesv_refine_temp_SA];
+    S*           SX    = (S*)temps[gesv_refine_temp_SX];
+    T*           R     = (T*)temps[gesv_refine_temp_R];
+    double*      anrm  = (double*)temps[gesv_refine_temp_norm];
+    rocblas_int* flags = (rocblas_int*)temps[gesv_refine_temp_flags];
+
+    // B is needed by every residual, so it is copied when the solution overwrites it
+    T*          B0  = B;
+    rocblas_int ld0 = ldb;
+    if(X == B)
+    {
+        B0  = (T*)temps[gesv_refine_temp_B];
+        ld0 = n;
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(B0,
+                                         sizeof(T) * ld0,
+                                         B,
+                                         sizeof(T) * ldb,
+                                         sizeof(T) * n,
+                                         nrhs,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+    }
+
+    auto fallback = [&](rocblas_int code) {
+        if(niters)
+            *niters = code;
+        return rocblas2hip_status(
+            refine_gesv_full(handle, n, nrhs, A, lda, ipiv, B0, ld0, X, ldx, info));
+    };
+
+    // flags[0] is set when a conversion to the precision of S overflows, and flags[1]
+    // when the convergence test fails
+    rocblas_int h_flags[2];
+    rocblas_int h_info;
+
+    CHECK_HIP_ERROR(hipMemsetAsync(flags, 0, sizeof(rocblas_int), stream));
+    CHECK_HIPSOLVER_ERROR(matrix_norm_inf(stream, n, n, A, lda, anrm));
+    CHECK_HIPSOLVER_ERROR(convert_matrix(stream, n, n, A, lda, SA, n, flags));
+    CHECK_HIPSOLVER_ERROR(convert_matrix(stream, n, nrhs, B0, ld0, SX, n, flags));
+    CHECK_ROCBLAS_ERROR(refine_getrf(handle, n, SA, n, ipiv, info));
+
+    CHECK_HIP_ERROR(
+        hipMemcpyAsync(h_flags, flags, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream));
+    CHECK_HIP_ERROR(
+        hipMemcpyAsync(&h_info, info, sizeof(rocblas_int), hipMemcpyDeviceToHost, stream));
+    CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+    if(h_flags[0])
+        return fallback(-2);
+    if(h_info != 0)
+        return fallback(-3);
+
+    CHECK_ROCBLAS_ERROR(refine_getrs(handle, n, nrhs, SA, n, ipiv, SX, n));
+    CHECK_HIPSOLVER_ERROR(convert_matrix(stream, n, nrhs, SX, n, X, ldx, (rocblas_int*)nullptr));
+
+    // a residual is small enough when max|R| <= max|X| * ||A|| * eps * sqrt(n), with eps
+    // the unit roundoff
+    double tol   = std::numeric_limits<double>::epsilon() / 2 * std::sqrt(double(n));
+    T      one   = 1;
+    T      minus = -1;
+
+    for(rocblas_int iter = 0;; iter++)
+    {
+        // R = B - A * X
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(R,
+                                         sizeof(T) * n,
+                                         B0,
+                                         sizeof(T) * ld0,
+                                         sizeof(T) * n,
+                                         nrhs,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+        CHECK_ROCBLAS_ERROR(refine_gemm(handle, n, nrhs, n, &minus, A, lda, X, ldx, &one, R, n));
+        CHECK_HIPSOLVER_ERROR(refine_check(stream, n, nrhs, R, n, X, ldx, anrm, tol, flags + 1));
+
+        CHECK_HIP_ERROR(
+            hipMemcpyAsync(h_flags, flags, sizeof(h_flags), hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        if(h_flags[0])
+            return fallback(-2);
+        if(!h_flags[1])
+        {
+            if(niters)
+                *niters = iter;
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+        if(iter == max_iters)
+            return fallback(-(max_iters + 1));
+
+        // solve A * D = R in the precision of S, and X = X + D
+        CHECK_HIPSOLVER_ERROR(convert_matrix(stream, n, nrhs, R, n, SX, n, flags));
+        CHECK_ROCBLAS_ERROR(refine_getrs(handle, n, nrhs, SA, n, ipiv, SX, n));
+        CHECK_HIPSOLVER_ERROR(convert_matrix(stream, n, nrhs, SX, n, R, n, (rocblas_int*)nullptr));
+        CHECK_ROCBLAS_ERROR(refine_geam(handle, n, nrhs, &one, X, ldx, &one, R, n, X, ldx));
+    }
+}
+
+/*! \brief Runs gesv_refine_template with the workspace layout of
+ *  gesv_refine_device_size.
+ */
+template <typename T, typename S>
+hipsolverStatus_t gesv_refine_execute(rocblas_handle handle,
+                                      rocblas_int    n,
+                                      rocblas_int    nrhs,
+                                      T*             A,
+                                      rocblas_int    lda,
+                                      rocblas_int*   ipiv,
+                                      T*             B,
+                                      rocblas_int    ldb,
+                                      T*             X,
+                                      rocblas_int    ldx,
+                                      void*          work,
+                                      size_t         lwork,
+                                      rocblas_int*   niters,
+                                      rocblas_int*   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || nrhs < 0 || lda < n || ldb < n || ldx < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((n && (!A || !ipiv)) || (n * nrhs && (!B || !X)) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // quick return
+    if(n == 0 || nrhs == 0)
+    {
+        if(niters)
+            *niters = 0;
+        return rocblas2hip_status(
+            refine_gesv_full(handle, n, nrhs, A, lda, ipiv, B, ldb, X, ldx, info));
+    }
+
+    size_t size_work = 0;
+    if(!work || !lwork)
+        CHECK_HIPSOLVER_ERROR(gesv_refine_workspace_size<T, S>(handle, n, nrhs, &size_work));
+
+    pool_device_malloc mem(handle);
+    void*              temps[gesv_refine_num_temps];
+    CHECK_HIPSOLVER_ERROR(refine_setup_temps(
+        handle, gesv_refine_temp_sizes<T, S>(n, nrhs), size_work, work, lwork, mem, temps));
+
+    // the scalars passed to rocBLAS live on the host
+    rocblas_pointer_mode mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    hipsolverStatus_t status = gesv_refine_template<T, S>(handle,
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          ipiv,
+                                                          B,
+                                                          ldb,
+                                                          X,
+                                                          ldx,
+                                                          refine_default_max_iters,
+                                                          niters,
+                                                          info,
+                                                          temps);
+
+    rocblas_set_pointer_mode(handle, mode);
+    return status;
+}
+
+/******************** GELS ********************/
+// Temporary arrays used by the mixed-precision gels
+enum gels_refine_temp
+{
+    gels_refine_temp_SA, // single-precision QR factors of A
+    gels_refine_temp_tau, // single-precision Householder scalars
+    gels_refine_temp_SX, // single-precision right-hand sides and corrections
+    gels_refine_temp_R, // double-precision residuals and corrections
+    gels_refine_temp_B, // copy of B, when the solution overwrites it
+    gels_refine_temp_flags, // overflow and convergence flags
+    gels_refine_num_temps
+};
+
+// Returns the size in bytes of each temporary array
+template <typename T, typename S>
+std::array<size_t, gels_refine_num_temps>
+    gels_refine_temp_sizes(rocblas_int m, rocblas_int n, rocblas_int nrhs)
+{
+    std::array<size_t, gels_refine_num_temps> sizes;
+    sizes[gels_refine_temp_SA]    = sizeof(S) * m * n;
+    sizes[gels_refine_temp_tau]   = sizeof(S) * n;
+    sizes[gels_refine_temp_SX]    = sizeof(S) * m * nrhs;
+    sizes[gels_refine_temp_R]     = sizeof(T) * m * nrhs;
+    sizes[gels_refine_temp_B]     = sizeof(T) * m * nrhs;
+    sizes[gels_refine_temp_flags] = sizeof(rocblas_int) * 2;
+    return sizes;
+}
+
+/*! \brief Returns the rocBLAS workspace size needed by the mixed-precision gels,
+ *  including the fallback to double precision.
+ */
+template <typename T, typename S>
+hipsolverStatus_t gels_refine_workspace_size(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int nrhs, size_t* size)
+{
+    rocblas_int ldb  = std::max(m, n);
+    T           one  = 1;
+    S           sone = 1;
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status = rocblas2hip_status(refine_gels_full(handle,
+                                                                   m,
+                                                                   n,
+                                                                   nrhs,
+                                                                   (T*)nullptr,
+                                                                   m,
+                                                                   (T*)nullptr,
+                                                                   ldb,
+                                                                   (T*)nullptr,
+                                                                   n,
+                                                                   (rocblas_int*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS && m >= n)
+    {
+        status = rocblas2hip_status(refine_geqrf(handle, m, n, (S*)nullptr, m, (S*)nullptr));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = rocblas2hip_status(refine_ormqr(
+                handle, m, nrhs, n, (S*)nullptr, m, (S*)nullptr, (S*)nullptr, m));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = rocblas2hip_status(
+                refine_trsm(handle, n, nrhs, &sone, (S*)nullptr, m, (S*)nullptr, m));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = rocblas2hip_status(refine_gemm(
+                handle, m, nrhs, n, &one, (T*)nullptr, m, (T*)nullptr, n, &one, (T*)nullptr, m));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = rocblas2hip_status(refine_geam(
+                handle, n, nrhs, &one, (T*)nullptr, n, &one, (T*)nullptr, m, (T*)nullptr, n));
+    }
+    rocblas_stop_device_memory_size_query(handle, size);
+
+    return status;
+}
+
+/*! \brief Returns the device workspace size needed by the mixed-precision gels: the
+ *  rocBLAS workspace plus the temporary arrays.
+ */
+template <typename T, typename S>
+hipsolverStatus_t gels_refine_device_size(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, rocblas_int nrhs, size_t* size)
+{
+    hipsolverStatus_t status = gels_refine_workspace_size<T, S>(handle, m, n, nrhs, size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    if(m >= n)
+        *size += refine_temp_total(gels_refine_temp_sizes<T, S>(m, n, nrhs));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Solves the least-squares problem min ||B - A * X|| with m >= n by QR
+ *  factorization in the precision of S and iterative refinement in the precision of T.
+ *  Each step solves R * D = Q^H * (B - A * X) with the single-precision factors and
+ *  adds the correction D to X, until D is negligible relative to X. As with
+ *  gesv_refine_template, niters is the number of refinement steps on success, and -2
+ *  or -(max_iters + 1) when the system had to be solved again in the precision of T.
+ *
+ *  A QR factorization does not report singular matrices, so a rank-deficient A is
+ *  only detected by the lack of convergence. The convergence test of each refinement
+ *  step is read back by the host, so this function waits for the work queued on the
+ *  stream of the handle.
+ */
+template <typename T, typename S>
+hipsolverStatus_t gels_refine_template(rocblas_handle handle,
+                                       rocblas_int    m,
+                                       rocblas_int    n,
+                                       rocblas_int    nrhs,
+                                       T*             A,
+                                       rocblas_int    lda,
+                                       T*             B,
+                                       rocblas_int    ldb,
+                                       T*             X,
+                                       rocblas_int    ldx,
+                                       rocblas_int    max_iters,
+                                       rocblas_int*   niters,
+                                       rocblas_int*   info,
+                                       void**         temps)
+{
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    S*           SA    = (S*)temps[gels_refine_temp_SA];
+    S*           tau   = (S*)temps[gels_refine_temp_tau];
+    S*           SX    = (S*)temps[gels_refine_temp_SX];
+    T*           R     = (T*)temps[gels_refine_temp_R];
+    rocblas_int* flags = (rocblas_int*)temps[gels_refine_temp_flags];
+
+    // B is needed by every residual, so it is copied when the solution overwrites it
+    T*          B0  = B;
+    rocblas_int ld0 = ldb;
+    if(X == B)
+    {
+        B0  = (T*)temps[gels_refine_temp_B];
+        ld0 = m;
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(B0,
+                                         sizeof(T) * ld0,
+                                         B,
+                                         sizeof(T) * ldb,
+                                         sizeof(T) * m,
+                                         nrhs,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+    }
+
+    auto fallback = [&](rocblas_int code) {
+        if(niters)
+            *niters = code;
+        return rocblas2hip_status(
+            refine_gels_full(handle, m, n, nrhs, A, lda, B0, ld0, X, ldx, info));
+    };
+
+    // flags[0] is set when a conversion to the precision of S overflows, and flags[1]
+    // when the convergence test fails
+    rocblas_int h_flags[2];
+
+    // X = R^-1 * Q^H * B in the precision of S
+    CHECK_HIP_ERROR(hipMemsetAsync(flags, 0, sizeof(rocblas_int), stream));
+    CHECK_HIP_ERROR(hipMemsetAsync(info, 0, sizeof(rocblas_int), stream));
+    CHECK_HIPSOLVER_ERROR(convert_matrix(stream, m, n, A, lda, SA, m, flags));
+    CHECK_HIPSOLVER_ERROR(convert_matrix(stream, m, nrhs, B0, ld0, SX, m, flags));
+    CHECK_ROCBLAS_ERROR(refine_geqrf(handle, m, n, SA, m, tau));
+
+    S sone = 1;
+    CHECK_ROCBLAS_ERROR(refine_ormqr(handle, m, nrhs, n, SA, m, tau, SX, m));
+    CHECK_ROCBLAS_ERROR(refine_trsm(handle, n, nrhs, &sone, SA, m, SX, m));
+    CHECK_HIPSOLVER_ERROR(convert_matrix(stream, n, nrhs, SX, m, X, ldx, (rocblas_int*)nullptr));
+
+    // a correction is negligible when max|D| <= max|X| * eps * sqrt(n), with eps the
+    // unit roundoff
+    double tol   = std::numeric_limits<double>::epsilon() / 2 * std::sqrt(double(n));
+    T      one   = 1;
+    T      minus = -1;
+
+    for(rocblas_int iter = 1;; iter++)
+    {
+        // R = B - A * X
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(R,
+                                         sizeof(T) * m,
+                                         B0,
+                                         sizeof(T) * ld0,
+                                         sizeof(T) * m,
+                                         nrhs,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+        CHECK_ROCBLAS_ERROR(refine_gemm(handle, m, nrhs, n, &minus, A, lda, X, ldx, &one, R, m));
+
+        // D = R^-1 * Q^H * R in the precision of S, and X = X + D
+        CHECK_HIPSOLVER_ERROR(convert_matrix(stream, m, nrhs, R, m, SX, m, flags));
+        CHECK_ROCBLAS_ERROR(refine_ormqr(handle, m, nrhs, n, SA, m, tau, SX, m));
+        CHECK_ROCBLAS_ERROR(refine_trsm(handle, n, nrhs, &sone, SA, m, SX, m));
+        CHECK_HIPSOLVER_ERROR(convert_matrix(stream, n, nrhs, SX, m, R, m, (rocblas_int*)nullptr));
+        CHECK_HIPSOLVER_ERROR(
+            refine_check(stream, n, nrhs, R, m, X, ldx, (const double*)nullptr, tol, flags + 1));
+        CHECK_ROCBLAS_ERROR(refine_geam(handle, n, nrhs, &one, X, ldx, &one, R, m, X, ldx));
+
+        CHECK_HIP_ERROR(
+            hipMemcpyAsync(h_flags, flags, sizeof(h_flags), hipMemcpyDeviceToHost, stream));
+        CHECK_HIP_ERROR(hipStreamSynchronize(stream));
+        if(h_flags[0])
+            return fallback(-2);
+        if(!h_flags[1])
+        {
+            if(niters)
+                *niters = iter;
+            return HIPSOLVER_STATUS_SUCCESS;
+        }
+        if(iter >= max_iters)
+            return fallback(-(max_iters + 1));
+    }
+}
+
+/*! \brief Runs gels_refine_template with the workspace layout of
+ *  gels_refine_device_size. Underdetermined systems are solved in double precision
+ *  with niters set to -1.
+ */
+template <typename T, typename S>
+hipsolverStatus_t gels_refine_execute(rocblas_handle handle,
+                                      rocblas_int    m,
+                                      rocblas_int    n,
+                                      rocblas_int    nrhs,
+                                      T*             A,
+                                      rocblas_int    lda,
+                                      T*             B,
+                                      rocblas_int    ldb,
+                                      T*             X,
+                                      rocblas_int    ldx,
+                                      void*          work,
+                                      size_t         lwork,
+                                      rocblas_int*   niters,
+                                      rocblas_int*   info)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(m < 0 || n < 0 || nrhs < 0 || lda < m || ldb < std::max(m, n) || ldx < n)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((m * n && !A) || (std::max(m, n) * nrhs && !B) || (n * nrhs && !X) || !info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    size_t size_work = 0;
+    if(!work || !lwork)
+        CHECK_HIPSOLVER_ERROR(gels_refine_workspace_size<T, S>(handle, m, n, nrhs, &size_work));
+
+    // quick return, and underdetermined systems that are not refined
+    if(m == 0 || n == 0 || nrhs == 0 || m < n)
+    {
+        if(work && lwork)
+            CHECK_ROCBLAS_ERROR(rocblas_set_workspace(handle, work, lwork));
+        else
+            CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, size_work));
+
+        if(niters)
+            *niters = m < n ? -1 : 0;
+        return rocblas2hip_status(
+            refine_gels_full(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, info));
+    }
+
+    pool_device_malloc mem(handle);
+    void*              temps[gels_refine_num_temps];
+    CHECK_HIPSOLVER_ERROR(refine_setup_temps(
+        handle, gels_refine_temp_sizes<T, S>(m, n, nrhs), size_work, work, lwork, mem, temps));
+
+    // the scalars passed to rocBLAS live on the host
+    rocblas_pointer_mode mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    hipsolverStatus_t status = gels_refine_template<T, S>(handle,
+                                                          m,
+                                                          n,
+                                                          nrhs,
+                                                          A,
+                                                          lda,
+                                                          B,
+                                                          ldb,
+                                                          X,
+                                                          ldx,
+                                                          refine_max_iters(handle),
+                                                          niters,
+                                                          info,
+                                                          temps);
+
+    rocblas_set_pointer_mode(handle, mode);
+    return status;
+}
+
+HIPSOLVER_END_NAMESPACE
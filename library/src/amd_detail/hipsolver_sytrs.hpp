@@ -0,0 +1,106 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+
+/*! \file
+ *  \brief Solution of symmetric indefinite systems factorized by rocsolver_?sytrf.
+ *  rocSOLVER does not provide ?sytrs, so the solve runs in the sytrs_solve kernel,
+ *  which follows the unblocked algorithm of the reference LAPACK on the device.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_kernels.hpp"
+#include "lib_macros.hpp"
+
+#include "rocblas/rocblas.h"
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/*! \brief Solves A * X = B, where A has been factorized by rocsolver_?sytrf. No
+ *  workspace is needed, and the function does not synchronize.
+ */
+template <typename T, typename I>
+hipsolverStatus_t sytrs_template(rocblas_handle handle,
+                                 rocblas_fill   uplo,
+                                 rocblas_int    n,
+                                 rocblas_int    nrhs,
+                                 T*             A,
+                                 rocblas_int    lda,
+                                 const I*       ipiv,
+                                 T*             B,
+                                 rocblas_int    ldb)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || nrhs < 0 || lda < n || lda < 1 || ldb < n || ldb < 1)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if((n && (!A || !ipiv)) || (n && nrhs && !B))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    return sytrs_solve(stream, uplo, n, nrhs, A, lda, 0, ipiv, 0, B, ldb, 0, nullptr, 1);
+}
+
+/*! \brief Solves the systems A_b * X_b = B_b of a strided batch factorized by
+ *  rocsolver_?sytrf(_strided_batched), with a single kernel launch. When info is not
+ *  null, the systems whose factorization reported a singular D are left untouched.
+ */
+template <typename T, typename I>
+hipsolverStatus_t sytrs_strided_batched_template(rocblas_handle     handle,
+                                                 rocblas_fill       uplo,
+                                                 rocblas_int        n,
+                                                 rocblas_int        nrhs,
+                                                 T*                 A,
+                                                 rocblas_int        lda,
+                                                 rocblas_stride     strideA,
+                                                 const I*           ipiv,
+                                                 rocblas_stride     strideP,
+                                                 T*                 B,
+                                                 rocblas_int        ldb,
+                                                 rocblas_stride     strideB,
+                                                 const rocblas_int* info,
+                                                 rocblas_int        batch_count)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(uplo != rocblas_fill_upper && uplo != rocblas_fill_lower)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+    if(n < 0 || nrhs < 0 || lda < n || lda < 1 || ldb < n || ldb < 1 || batch_count < 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(batch_count && ((n && (!A || !ipiv)) || (n && nrhs && !B)))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    return sytrs_solve(
+        stream, uplo, n, nrhs, A, lda, strideA, ipiv, strideP, B, ldb, strideB, info, batch_count);
+}
+
+HIPSOLVER_END_NAMESPACE
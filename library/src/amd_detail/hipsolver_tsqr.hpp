@@ -0,0 +1,1320 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Tall-skinny QR factorization (TSQR) of m-by-n matrices with m >> n. The rows
+ *  of A are split into blocks that are factorized together by a strided batched
+ *  rocsolver_?geqrf, and the stacked R factors of the blocks are factorized in the same
+ *  way until they fit a single rocsolver_?geqrf. The explicit orthogonal factor built
+ *  from this reduction tree is converted back to Householder vectors (Householder
+ *  reconstruction, as in LAPACK's ?orhr_col), so that the result has the format of
+ *  rocsolver_?geqrf and can be used by ormqr/unmqr and orgqr/ungqr. All the steps run on
+ *  the device, so the factorization does not synchronize the stream.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "hipsolver_conversions.hpp"
+#include "hipsolver_kernels.hpp"
+#include "hipsolver_memory_pool.hpp"
+#include "lib_macros.hpp"
+#include "utility.hpp"
+
+#include "rocblas/rocblas.h"
+#include "rocsolver/rocsolver.h"
+
+#include <algorithm>
+#include <array>
+#include <climits>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** ROCBLAS/ROCSOLVER OVERLOADS ********************/
+// geqrf
+inline rocblas_status tsqr_geqrf(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, float* A, rocblas_int lda, float* tau)
+{
+    return rocsolver_sgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status tsqr_geqrf(
+    rocblas_handle handle, rocblas_int m, rocblas_int n, double* A, rocblas_int lda, double* tau)
+{
+    return rocsolver_dgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status tsqr_geqrf(rocblas_handle         handle,
+                                 rocblas_int            m,
+                                 rocblas_int            n,
+                                 rocblas_float_complex* A,
+                                 rocblas_int            lda,
+                                 rocblas_float_complex* tau)
+{
+    return rocsolver_cgeqrf(handle, m, n, A, lda, tau);
+}
+
+inline rocblas_status tsqr_geqrf(rocblas_handle          handle,
+                                 rocblas_int             m,
+                                 rocblas_int             n,
+                                 rocblas_double_complex* A,
+                                 rocblas_int             lda,
+                                 rocblas_double_complex* tau)
+{
+    return rocsolver_zgeqrf(handle, m, n, A, lda, tau);
+}
+
+// geqrf_strided_batched
+inline rocblas_status tsqr_geqrf_strided_batched(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 float*         A,
+                                                 rocblas_int    lda,
+                                                 rocblas_stride strideA,
+                                                 float*         tau,
+                                                 rocblas_stride strideT,
+                                                 rocblas_int    batch_count)
+{
+    return rocsolver_sgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideT, batch_count);
+}
+
+inline rocblas_status tsqr_geqrf_strided_batched(rocblas_handle handle,
+                                                 rocblas_int    m,
+                                                 rocblas_int    n,
+                                                 double*        A,
+                                                 rocblas_int    lda,
+                                                 rocblas_stride strideA,
+                                                 double*        tau,
+                                                 rocblas_stride strideT,
+                                                 rocblas_int    batch_count)
+{
+    return rocsolver_dgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideT, batch_count);
+}
+
+inline rocblas_status tsqr_geqrf_strided_batched(rocblas_handle         handle,
+                                                 rocblas_int            m,
+                                                 rocblas_int            n,
+                                                 rocblas_float_complex* A,
+                                                 rocblas_int            lda,
+                                                 rocblas_stride         strideA,
+                                                 rocblas_float_complex* tau,
+                                                 rocblas_stride         strideT,
+                                                 rocblas_int            batch_count)
+{
+    return rocsolver_cgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideT, batch_count);
+}
+
+inline rocblas_status tsqr_geqrf_strided_batched(rocblas_handle          handle,
+                                                 rocblas_int             m,
+                                                 rocblas_int             n,
+                                                 rocblas_double_complex* A,
+                                                 rocblas_int             lda,
+                                                 rocblas_stride          strideA,
+                                                 rocblas_double_complex* tau,
+                                                 rocblas_stride          strideT,
+                                                 rocblas_int             batch_count)
+{
+    return rocsolver_zgeqrf_strided_batched(
+        handle, m, n, A, lda, strideA, tau, strideT, batch_count);
+}
+
+// orgqr/ungqr
+inline rocblas_status tsqr_orgqr(rocblas_handle handle,
+                                 rocblas_int    m,
+                                 rocblas_int    n,
+                                 rocblas_int    k,
+                                 float*         A,
+                                 rocblas_int    lda,
+                                 float*         tau)
+{
+    return rocsolver_sorgqr(handle, m, n, k, A, lda, tau);
+}
+
+inline rocblas_status tsqr_orgqr(rocblas_handle handle,
+                                 rocblas_int    m,
+                                 rocblas_int    n,
+                                 rocblas_int    k,
+                                 double*        A,
+                                 rocblas_int    lda,
+                                 double*        tau)
+{
+    return rocsolver_dorgqr(handle, m, n, k, A, lda, tau);
+}
+
+inline rocblas_status tsqr_orgqr(rocblas_handle         handle,
+                                 rocblas_int            m,
+                                 rocblas_int            n,
+                                 rocblas_int            k,
+                                 rocblas_float_complex* A,
+                                 rocblas_int            lda,
+                                 rocblas_float_complex* tau)
+{
+    return rocsolver_cungqr(handle, m, n, k, A, lda, tau);
+}
+
+inline rocblas_status tsqr_orgqr(rocblas_handle          handle,
+                                 rocblas_int             m,
+                                 rocblas_int             n,
+                                 rocblas_int             k,
+                                 rocblas_double_complex* A,
+                                 rocblas_int             lda,
+                                 rocblas_double_complex* tau)
+{
+    return rocsolver_zungqr(handle, m, n, k, A, lda, tau);
+}
+
+// gemm_strided_batched
+inline rocblas_status tsqr_gemm(rocblas_handle    handle,
+                                rocblas_operation transA,
+                                rocblas_operation transB,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                rocblas_int       k,
+                                const float*      alpha,
+                                const float*      A,
+                                rocblas_int       lda,
+                                rocblas_stride    strideA,
+                                const float*      B,
+                                rocblas_int       ldb,
+                                rocblas_stride    strideB,
+                                const float*      beta,
+                                float*            C,
+                                rocblas_int       ldc,
+                                rocblas_stride    strideC,
+                                rocblas_int       batch_count)
+{
+    return rocblas_sgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_gemm(rocblas_handle    handle,
+                                rocblas_operation transA,
+                                rocblas_operation transB,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                rocblas_int       k,
+                                const double*     alpha,
+                                const double*     A,
+                                rocblas_int       lda,
+                                rocblas_stride    strideA,
+                                const double*     B,
+                                rocblas_int       ldb,
+                                rocblas_stride    strideB,
+                                const double*     beta,
+                                double*           C,
+                                rocblas_int       ldc,
+                                rocblas_stride    strideC,
+                                rocblas_int       batch_count)
+{
+    return rocblas_dgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_gemm(rocblas_handle               handle,
+                                rocblas_operation            transA,
+                                rocblas_operation            transB,
+                                rocblas_int                  m,
+                                rocblas_int                  n,
+                                rocblas_int                  k,
+                                const rocblas_float_complex* alpha,
+                                const rocblas_float_complex* A,
+                                rocblas_int                  lda,
+                                rocblas_stride               strideA,
+                                const rocblas_float_complex* B,
+                                rocblas_int                  ldb,
+                                rocblas_stride               strideB,
+                                const rocblas_float_complex* beta,
+                                rocblas_float_complex*       C,
+                                rocblas_int                  ldc,
+                                rocblas_stride               strideC,
+                                rocblas_int                  batch_count)
+{
+    return rocblas_cgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_gemm(rocblas_handle                handle,
+                                rocblas_operation             transA,
+                                rocblas_operation             transB,
+                                rocblas_int                   m,
+                                rocblas_int                   n,
+                                rocblas_int                   k,
+                                const rocblas_double_complex* alpha,
+                                const rocblas_double_complex* A,
+                                rocblas_int                   lda,
+                                rocblas_stride                strideA,
+                                const rocblas_double_complex* B,
+                                rocblas_int                   ldb,
+                                rocblas_stride                strideB,
+                                const rocblas_double_complex* beta,
+                                rocblas_double_complex*       C,
+                                rocblas_int                   ldc,
+                                rocblas_stride                strideC,
+                                rocblas_int                   batch_count)
+{
+    return rocblas_zgemm_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         k,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         beta,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+// geam_strided_batched
+inline rocblas_status tsqr_geam(rocblas_handle    handle,
+                                rocblas_operation transA,
+                                rocblas_operation transB,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                const float*      alpha,
+                                const float*      A,
+                                rocblas_int       lda,
+                                rocblas_stride    strideA,
+                                const float*      beta,
+                                const float*      B,
+                                rocblas_int       ldb,
+                                rocblas_stride    strideB,
+                                float*            C,
+                                rocblas_int       ldc,
+                                rocblas_stride    strideC,
+                                rocblas_int       batch_count)
+{
+    return rocblas_sgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_geam(rocblas_handle    handle,
+                                rocblas_operation transA,
+                                rocblas_operation transB,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                const double*     alpha,
+                                const double*     A,
+                                rocblas_int       lda,
+                                rocblas_stride    strideA,
+                                const double*     beta,
+                                const double*     B,
+                                rocblas_int       ldb,
+                                rocblas_stride    strideB,
+                                double*           C,
+                                rocblas_int       ldc,
+                                rocblas_stride    strideC,
+                                rocblas_int       batch_count)
+{
+    return rocblas_dgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_geam(rocblas_handle               handle,
+                                rocblas_operation            transA,
+                                rocblas_operation            transB,
+                                rocblas_int                  m,
+                                rocblas_int                  n,
+                                const rocblas_float_complex* alpha,
+                                const rocblas_float_complex* A,
+                                rocblas_int                  lda,
+                                rocblas_stride               strideA,
+                                const rocblas_float_complex* beta,
+                                const rocblas_float_complex* B,
+                                rocblas_int                  ldb,
+                                rocblas_stride               strideB,
+                                rocblas_float_complex*       C,
+                                rocblas_int                  ldc,
+                                rocblas_stride               strideC,
+                                rocblas_int                  batch_count)
+{
+    return rocblas_cgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_geam(rocblas_handle                handle,
+                                rocblas_operation             transA,
+                                rocblas_operation             transB,
+                                rocblas_int                   m,
+                                rocblas_int                   n,
+                                const rocblas_double_complex* alpha,
+                                const rocblas_double_complex* A,
+                                rocblas_int                   lda,
+                                rocblas_stride                strideA,
+                                const rocblas_double_complex* beta,
+                                const rocblas_double_complex* B,
+                                rocblas_int                   ldb,
+                                rocblas_stride                strideB,
+                                rocblas_double_complex*       C,
+                                rocblas_int                   ldc,
+                                rocblas_stride                strideC,
+                                rocblas_int                   batch_count)
+{
+    return rocblas_zgeam_strided_batched(handle,
+                                         transA,
+                                         transB,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         beta,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         C,
+                                         ldc,
+                                         strideC,
+                                         batch_count);
+}
+
+// dgmm_strided_batched
+inline rocblas_status tsqr_dgmm(rocblas_handle handle,
+                                rocblas_side   side,
+                                rocblas_int    m,
+                                rocblas_int    n,
+                                const float*   A,
+                                rocblas_int    lda,
+                                rocblas_stride strideA,
+                                const float*   x,
+                                rocblas_int    incx,
+                                rocblas_stride stridex,
+                                float*         C,
+                                rocblas_int    ldc,
+                                rocblas_stride strideC,
+                                rocblas_int    batch_count)
+{
+    return rocblas_sdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status tsqr_dgmm(rocblas_handle handle,
+                                rocblas_side   side,
+                                rocblas_int    m,
+                                rocblas_int    n,
+                                const double*  A,
+                                rocblas_int    lda,
+                                rocblas_stride strideA,
+                                const double*  x,
+                                rocblas_int    incx,
+                                rocblas_stride stridex,
+                                double*        C,
+                                rocblas_int    ldc,
+                                rocblas_stride strideC,
+                                rocblas_int    batch_count)
+{
+    return rocblas_ddgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status tsqr_dgmm(rocblas_handle               handle,
+                                rocblas_side                 side,
+                                rocblas_int                  m,
+                                rocblas_int                  n,
+                                const rocblas_float_complex* A,
+                                rocblas_int                  lda,
+                                rocblas_stride               strideA,
+                                const rocblas_float_complex* x,
+                                rocblas_int                  incx,
+                                rocblas_stride               stridex,
+                                rocblas_float_complex*       C,
+                                rocblas_int                  ldc,
+                                rocblas_stride               strideC,
+                                rocblas_int                  batch_count)
+{
+    return rocblas_cdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+inline rocblas_status tsqr_dgmm(rocblas_handle                handle,
+                                rocblas_side                  side,
+                                rocblas_int                   m,
+                                rocblas_int                   n,
+                                const rocblas_double_complex* A,
+                                rocblas_int                   lda,
+                                rocblas_stride                strideA,
+                                const rocblas_double_complex* x,
+                                rocblas_int                   incx,
+                                rocblas_stride                stridex,
+                                rocblas_double_complex*       C,
+                                rocblas_int                   ldc,
+                                rocblas_stride                strideC,
+                                rocblas_int                   batch_count)
+{
+    return rocblas_zdgmm_strided_batched(
+        handle, side, m, n, A, lda, strideA, x, incx, stridex, C, ldc, strideC, batch_count);
+}
+
+// trsm_strided_batched
+inline rocblas_status tsqr_trsm(rocblas_handle    handle,
+                                rocblas_side      side,
+                                rocblas_fill      uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal  diag,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                const float*      alpha,
+                                const float*      A,
+                                rocblas_int       lda,
+                                rocblas_stride    strideA,
+                                float*            B,
+                                rocblas_int       ldb,
+                                rocblas_stride    strideB,
+                                rocblas_int       batch_count)
+{
+    return rocblas_strsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_trsm(rocblas_handle    handle,
+                                rocblas_side      side,
+                                rocblas_fill      uplo,
+                                rocblas_operation transA,
+                                rocblas_diagonal  diag,
+                                rocblas_int       m,
+                                rocblas_int       n,
+                                const double*     alpha,
+                                const double*     A,
+                                rocblas_int       lda,
+                                rocblas_stride    strideA,
+                                double*           B,
+                                rocblas_int       ldb,
+                                rocblas_stride    strideB,
+                                rocblas_int       batch_count)
+{
+    return rocblas_dtrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_trsm(rocblas_handle               handle,
+                                rocblas_side                 side,
+                                rocblas_fill                 uplo,
+                                rocblas_operation            transA,
+                                rocblas_diagonal             diag,
+                                rocblas_int                  m,
+                                rocblas_int                  n,
+                                const rocblas_float_complex* alpha,
+                                const rocblas_float_complex* A,
+                                rocblas_int                  lda,
+                                rocblas_stride               strideA,
+                                rocblas_float_complex*       B,
+                                rocblas_int                  ldb,
+                                rocblas_stride               strideB,
+                                rocblas_int                  batch_count)
+{
+    return rocblas_ctrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+inline rocblas_status tsqr_trsm(rocblas_handle                handle,
+                                rocblas_side                  side,
+                                rocblas_fill                  uplo,
+                                rocblas_operation             transA,
+                                rocblas_diagonal              diag,
+                                rocblas_int                   m,
+                                rocblas_int                   n,
+                                const rocblas_double_complex* alpha,
+                                const rocblas_double_complex* A,
+                                rocblas_int                   lda,
+                                rocblas_stride                strideA,
+                                rocblas_double_complex*       B,
+                                rocblas_int                   ldb,
+                                rocblas_stride                strideB,
+                                rocblas_int                   batch_count)
+{
+    return rocblas_ztrsm_strided_batched(handle,
+                                         side,
+                                         uplo,
+                                         transA,
+                                         diag,
+                                         m,
+                                         n,
+                                         alpha,
+                                         A,
+                                         lda,
+                                         strideA,
+                                         B,
+                                         ldb,
+                                         strideB,
+                                         batch_count);
+}
+
+/******************** TSQR ********************/
+// Number of rows of the chunks in which the explicit orthogonal factor of a level of the
+// reduction tree is formed
+constexpr rocblas_int tsqr_chunk_rows = 131072;
+
+// Number of columns of the panels of the LU factorization of the Householder reconstruction
+constexpr rocblas_int tsqr_lu_block = 32;
+
+// Returns the number of rows of the blocks factorized at each level of the reduction tree,
+// so that the stacked R factors of a level have at least 8 times fewer rows than its input
+inline rocblas_int tsqr_block_rows(rocblas_int n)
+{
+    return std::max(8 * std::min(n, INT_MAX / 8), 512);
+}
+
+// Returns the number of blocks of a level processed together when its explicit orthogonal
+// factor is formed
+inline rocblas_int tsqr_chunk_blocks(rocblas_int n)
+{
+    return std::max(tsqr_chunk_rows / tsqr_block_rows(n), 1);
+}
+
+// Returns the number of rows of the input of each level of the reduction tree. Each level
+// but the last splits its input into blocks of tsqr_block_rows(n) rows, the last block
+// also taking the remaining rows, and the input of the next level stacks their R factors.
+// The input of the last level is factorized directly.
+inline std::vector<rocblas_int> tsqr_levels(rocblas_int m, rocblas_int n)
+{
+    rocblas_int              mb   = tsqr_block_rows(n);
+    std::vector<rocblas_int> rows = {m};
+    while(rows.back() / 2 >= mb)
+        rows.push_back(rows.back() / mb * n);
+    return rows;
+}
+
+// Temporary arrays used by the tall-skinny QR factorization
+enum tsqr_temp
+{
+    tsqr_temp_Y, // stacked R factors of each level, later their explicit orthogonal factors
+    tsqr_temp_tau, // Householder scalars of the blocks of each level
+    tsqr_temp_W, // chunk of the explicit orthogonal factor of a level
+    tsqr_temp_S, // n-by-n products V^H * V of the blocks of a chunk
+    tsqr_temp_Z, // n-by-n products T * V^H * [Y; 0] of the blocks of a chunk
+    tsqr_temp_R, // n-by-n triangular factor of the last level
+    tsqr_temp_D, // signs of the Householder reconstruction
+    tsqr_num_temps
+};
+
+// Returns the size in bytes of each temporary array
+template <typename T>
+std::array<size_t, tsqr_num_temps> tsqr_temp_sizes(rocblas_int m, rocblas_int n)
+{
+    std::vector<rocblas_int> rows  = tsqr_levels(m, n);
+    size_t                   mb    = tsqr_block_rows(n);
+    size_t                   chunk = tsqr_chunk_blocks(n);
+
+    // the input of level l > 0 holds the stacked R factors of level l - 1, which has
+    // one Householder scalar per row of it
+    size_t size_Y = 0, size_tau = n;
+    for(size_t l = 1; l < rows.size(); l++)
+    {
+        size_Y += size_t(rows[l]) * n;
+        size_tau += rows[l];
+    }
+
+    // the last block of a level has fewer than 2 * mb rows
+    bool   tree   = rows.size() > 1;
+    size_t rows_W = std::max(chunk, size_t(2)) * mb;
+
+    std::array<size_t, tsqr_num_temps> sizes;
+    sizes[tsqr_temp_Y]   = sizeof(T) * size_Y;
+    sizes[tsqr_temp_tau] = sizeof(T) * size_tau;
+    sizes[tsqr_temp_W]   = tree ? sizeof(T) * rows_W * n : 0;
+    sizes[tsqr_temp_S]   = tree ? sizeof(T) * chunk * n * n : 0;
+    sizes[tsqr_temp_Z]   = tree ? sizeof(T) * chunk * n * n : 0;
+    sizes[tsqr_temp_R]   = sizeof(T) * size_t(n) * n;
+    sizes[tsqr_temp_D]   = sizeof(T) * n;
+    return sizes;
+}
+
+// Returns the size in bytes of a buffer holding all the temporary arrays
+inline size_t tsqr_temp_total(const std::array<size_t, tsqr_num_temps>& sizes)
+{
+    size_t total = 0;
+    for(size_t size : sizes)
+        total += ((size + 127) / 128) * 128;
+    return total;
+}
+
+// Points temps to consecutive 128 byte aligned regions of work, which must hold
+// tsqr_temp_total(sizes) bytes
+inline void tsqr_carve_temps(void*                                     work,
+                             const std::array<size_t, tsqr_num_temps>& sizes,
+                             void**                                    temps)
+{
+    char* ptr = (char*)work;
+    for(int i = 0; i < tsqr_num_temps; i++)
+    {
+        temps[i] = ptr;
+        ptr += ((sizes[i] + 127) / 128) * 128;
+    }
+}
+
+// Returns the rocBLAS workspace size needed by the tall-skinny QR factorization
+template <typename T>
+hipsolverStatus_t
+    tsqr_workspace_size(rocblas_handle handle, rocblas_int m, rocblas_int n, size_t* size)
+{
+    std::vector<rocblas_int> rows  = tsqr_levels(m, n);
+    rocblas_int              mb    = tsqr_block_rows(n);
+    rocblas_int              chunk = tsqr_chunk_blocks(n);
+    rocblas_int              last  = rows.back();
+    rocblas_stride           nn    = rocblas_stride(n) * n;
+
+    constexpr rocblas_operation opN = rocblas_operation_none;
+
+    T one = 1;
+
+    rocblas_start_device_memory_size_query(handle);
+    hipsolverStatus_t status
+        = rocblas2hip_status(tsqr_geqrf(handle, last, n, (T*)nullptr, last, (T*)nullptr));
+    if(status == HIPSOLVER_STATUS_SUCCESS)
+        status = rocblas2hip_status(
+            tsqr_orgqr(handle, last, n, n, (T*)nullptr, last, (T*)nullptr));
+    for(size_t l = 0; l + 1 < rows.size() && status == HIPSOLVER_STATUS_SUCCESS; l++)
+    {
+        rocblas_int p     = rows[l] / mb;
+        rocblas_int mlast = rows[l] - (p - 1) * mb;
+        rocblas_int count = std::min(chunk, p - 1);
+
+        status = rocblas2hip_status(tsqr_geqrf_strided_batched(
+            handle, mb, n, (T*)nullptr, rows[l], mb, (T*)nullptr, n, p - 1));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = rocblas2hip_status(
+                tsqr_geqrf(handle, mlast, n, (T*)nullptr, rows[l], (T*)nullptr));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = rocblas2hip_status(tsqr_gemm(handle,
+                                                  opN,
+                                                  opN,
+                                                  mb,
+                                                  n,
+                                                  n,
+                                                  &one,
+                                                  (T*)nullptr,
+                                                  rows[l],
+                                                  mb,
+                                                  (T*)nullptr,
+                                                  n,
+                                                  nn,
+                                                  &one,
+                                                  (T*)nullptr,
+                                                  count * mb,
+                                                  mb,
+                                                  count));
+        if(status == HIPSOLVER_STATUS_SUCCESS)
+            status = rocblas2hip_status(tsqr_trsm(handle,
+                                                  rocblas_side_left,
+                                                  rocblas_fill_upper,
+                                                  opN,
+                                                  rocblas_diagonal_unit,
+                                                  n,
+                                                  n,
+                                                  &one,
+                                                  (T*)nullptr,
+                                                  n,
+                                                  nn,
+                                                  (T*)nullptr,
+                                                  n,
+                                                  nn,
+                                                  count));
+    }
+    if(status == HIPSOLVER_STATUS_SUCCESS && n > tsqr_lu_block)
+        status = rocblas2hip_status(tsqr_trsm(handle,
+                                              rocblas_side_left,
+                                              rocblas_fill_lower,
+                                              opN,
+                                              rocblas_diagonal_unit,
+                                              tsqr_lu_block,
+                                              n - tsqr_lu_block,
+                                              &one,
+                                              (T*)nullptr,
+                                              m,
+                                              0,
+                                              (T*)nullptr,
+                                              m,
+                                              0,
+                                              1));
+    if(status == HIPSOLVER_STATUS_SUCCESS && m > n)
+        status = rocblas2hip_status(tsqr_trsm(handle,
+                                              rocblas_side_right,
+                                              rocblas_fill_upper,
+                                              opN,
+                                              rocblas_diagonal_non_unit,
+                                              m - n,
+                                              n,
+                                              &one,
+                                              (T*)nullptr,
+                                              m,
+                                              0,
+                                              (T*)nullptr,
+                                              m,
+                                              0,
+                                              1));
+    rocblas_stop_device_memory_size_query(handle, size);
+
+    return status;
+}
+
+// Returns the device workspace size needed by the tall-skinny QR factorization: the
+// rocBLAS workspace plus the temporary arrays
+template <typename T>
+hipsolverStatus_t
+    tsqr_device_size(rocblas_handle handle, rocblas_int m, rocblas_int n, size_t* size)
+{
+    hipsolverStatus_t status = tsqr_workspace_size<T>(handle, m, n, size);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *size += tsqr_temp_total(tsqr_temp_sizes<T>(m, n));
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// Computes the LU factorization without pivoting Q1 - D = L * U of the n-by-n leading
+// block of a matrix with orthonormal columns, where D is the diagonal matrix with
+// D(j) = -sign(Re(U(j, j))) that keeps every pivot at least one in magnitude. L and U
+// overwrite Q1, and D is returned in D. As in LAPACK's ?laorhr_col_getrfnp, the signs are
+// chosen while the panels are factorized, and the trailing matrix is updated with rocBLAS.
+template <typename T>
+hipsolverStatus_t tsqr_modified_lu(
+    rocblas_handle handle, hipStream_t stream, rocblas_int n, T* A, rocblas_int lda, T* D)
+{
+    T one = 1, minus_one = -1;
+
+    constexpr rocblas_operation opN = rocblas_operation_none;
+
+    for(rocblas_int j = 0; j < n; j += tsqr_lu_block)
+    {
+        rocblas_int jb  = std::min(tsqr_lu_block, n - j);
+        rocblas_int nr  = n - j - jb;
+        T*          A11 = A + j + size_t(lda) * j;
+        T*          A12 = A11 + size_t(lda) * jb;
+
+        CHECK_HIPSOLVER_ERROR(tsqr_lu_panel(stream, n - j, jb, A11, lda, D + j));
+        if(nr > 0)
+        {
+            CHECK_ROCBLAS_ERROR(tsqr_trsm(handle,
+                                          rocblas_side_left,
+                                          rocblas_fill_lower,
+                                          opN,
+                                          rocblas_diagonal_unit,
+                                          jb,
+                                          nr,
+                                          &one,
+                                          A11,
+                                          lda,
+                                          0,
+                                          A12,
+                                          lda,
+                                          0,
+                                          1));
+            CHECK_ROCBLAS_ERROR(tsqr_gemm(handle,
+                                          opN,
+                                          opN,
+                                          nr,
+                                          nr,
+                                          jb,
+                                          &minus_one,
+                                          A11 + jb,
+                                          lda,
+                                          0,
+                                          A12,
+                                          lda,
+                                          0,
+                                          &one,
+                                          A12 + jb,
+                                          lda,
+                                          0,
+                                          1));
+        }
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// Copies the upper triangles of the n-by-n leading blocks of the p blocks of mb rows of X
+// into the p*n-by-n matrix Y, whose other entries are zeroed. The copied entries are then
+// zeroed in X, which keeps the strictly lower parts of the Householder vectors.
+template <typename T>
+hipsolverStatus_t tsqr_gather_R(
+    hipStream_t stream, rocblas_int mb, rocblas_int n, rocblas_int p, T* X, rocblas_int ldx, T* Y)
+{
+    size_t ldy = size_t(p) * n;
+
+    CHECK_HIP_ERROR(hipMemsetAsync(Y, 0, sizeof(T) * ldy * n, stream));
+    for(rocblas_int j = 0; j < n; j++)
+    {
+        T* Xj = X + size_t(ldx) * j;
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(Y + ldy * j,
+                                         sizeof(T) * n,
+                                         Xj,
+                                         sizeof(T) * mb,
+                                         sizeof(T) * (j + 1),
+                                         p,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+        CHECK_HIP_ERROR(hipMemset2DAsync(Xj, sizeof(T) * mb, 0, sizeof(T) * (j + 1), p, stream));
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// Overwrites the count blocks of mb rows of X, which hold the strictly lower parts Vs of the
+// Householder vectors of their QR factorizations, with Q * [Y_b; 0], where Q is the
+// orthogonal factor of the block and Y_b the n-by-n block of Y with the same index. Q is
+// applied in the compact WY form Q = I - V * T * V^H, with T = (I + D * N)^-1 * D, where D
+// holds the Householder scalars and N is the strictly upper triangular part of V^H * V. The
+// unit diagonal of the Householder vectors is not stored, so V = Vs + [I; 0].
+template <typename T>
+hipsolverStatus_t tsqr_apply_blocks(rocblas_handle handle,
+                                    hipStream_t    stream,
+                                    rocblas_int    mb,
+                                    rocblas_int    n,
+                                    rocblas_int    count,
+                                    T*             X,
+                                    rocblas_int    ldx,
+                                    T*             tau,
+                                    T*             Y,
+                                    rocblas_int    ldy,
+                                    void* const*   temps)
+{
+    T* W = (T*)temps[tsqr_temp_W];
+    T* S = (T*)temps[tsqr_temp_S];
+    T* Z = (T*)temps[tsqr_temp_Z];
+
+    rocblas_int    ldw = count * mb;
+    rocblas_stride nn  = rocblas_stride(n) * n;
+
+    T one = 1, zero = 0, minus_one = -1;
+
+    constexpr rocblas_operation opN = rocblas_operation_none;
+    constexpr rocblas_operation opC = rocblas_operation_conjugate_transpose;
+
+    // Z = V^H * [Y_b; 0] = Vs(1:n, :)^H * Y_b + Y_b
+    CHECK_ROCBLAS_ERROR(tsqr_gemm(
+        handle, opC, opN, n, n, n, &one, X, ldx, mb, Y, ldy, n, &zero, Z, n, nn, count));
+    CHECK_ROCBLAS_ERROR(
+        tsqr_geam(handle, opN, opN, n, n, &one, Y, ldy, n, &one, Z, n, nn, Z, n, nn, count));
+
+    // the strictly upper triangular part of V^H * V is that of Vs^H * Vs + Vs(1:n, :)^H
+    CHECK_ROCBLAS_ERROR(tsqr_gemm(
+        handle, opC, opN, n, n, mb, &one, X, ldx, mb, X, ldx, mb, &zero, S, n, nn, count));
+    CHECK_ROCBLAS_ERROR(
+        tsqr_geam(handle, opC, opN, n, n, &one, X, ldx, mb, &one, S, n, nn, S, n, nn, count));
+
+    // Z = T * Z = (I + D * N)^-1 * D * Z
+    CHECK_ROCBLAS_ERROR(
+        tsqr_dgmm(handle, rocblas_side_left, n, n, S, n, nn, tau, 1, n, S, n, nn, count));
+    CHECK_ROCBLAS_ERROR(
+        tsqr_dgmm(handle, rocblas_side_left, n, n, Z, n, nn, tau, 1, n, Z, n, nn, count));
+    CHECK_ROCBLAS_ERROR(tsqr_trsm(handle,
+                                  rocblas_side_left,
+                                  rocblas_fill_upper,
+                                  opN,
+                                  rocblas_diagonal_unit,
+                                  n,
+                                  n,
+                                  &one,
+                                  S,
+                                  n,
+                                  nn,
+                                  Z,
+                                  n,
+                                  nn,
+                                  count));
+
+    // W = [Y_b; 0] - V * Z = [Y_b - Z; 0] - Vs * Z
+    CHECK_ROCBLAS_ERROR(tsqr_gemm(
+        handle, opN, opN, mb, n, n, &minus_one, X, ldx, mb, Z, n, nn, &zero, W, ldw, mb, count));
+    CHECK_ROCBLAS_ERROR(
+        tsqr_geam(handle, opN, opN, n, n, &one, W, ldw, mb, &one, Y, ldy, n, W, ldw, mb, count));
+    CHECK_ROCBLAS_ERROR(tsqr_geam(
+        handle, opN, opN, n, n, &one, W, ldw, mb, &minus_one, Z, n, nn, W, ldw, mb, count));
+
+    CHECK_HIP_ERROR(hipMemcpy2DAsync(X,
+                                     sizeof(T) * ldx,
+                                     W,
+                                     sizeof(T) * ldw,
+                                     sizeof(T) * ldw,
+                                     n,
+                                     hipMemcpyDeviceToDevice,
+                                     stream));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+// Overwrites the rows[level]-by-n matrix X with the explicit orthogonal factor of its QR
+// factorization. The n-by-n leading block of the factorization, which holds R in its upper
+// triangle, is copied to R when the stream reaches the last level. Y and tau point to the
+// temporary arrays of this level and the following ones.
+template <typename T>
+hipsolverStatus_t tsqr_level(rocblas_handle                  handle,
+                             hipStream_t                     stream,
+                             const std::vector<rocblas_int>& rows,
+                             size_t                          level,
+                             rocblas_int                     n,
+                             T*                              X,
+                             rocblas_int                     ldx,
+                             T*                              Y,
+                             T*                              tau,
+                             T*                              R,
+                             void* const*                    temps)
+{
+    rocblas_int m = rows[level];
+
+    if(level + 1 == rows.size())
+    {
+        CHECK_ROCBLAS_ERROR(tsqr_geqrf(handle, m, n, X, ldx, tau));
+        CHECK_HIP_ERROR(hipMemcpy2DAsync(R,
+                                         sizeof(T) * n,
+                                         X,
+                                         sizeof(T) * ldx,
+                                         sizeof(T) * n,
+                                         n,
+                                         hipMemcpyDeviceToDevice,
+                                         stream));
+        CHECK_ROCBLAS_ERROR(tsqr_orgqr(handle, m, n, n, X, ldx, tau));
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    rocblas_int mb    = tsqr_block_rows(n);
+    rocblas_int chunk = tsqr_chunk_blocks(n);
+    rocblas_int p     = m / mb;
+    rocblas_int mlast = m - (p - 1) * mb;
+    rocblas_int ldy   = rows[level + 1];
+    T*          Xlast = X + size_t(p - 1) * mb;
+    T*          tlast = tau + size_t(p - 1) * n;
+
+    // QR factorizations of the blocks, the last of which takes the remaining rows
+    CHECK_ROCBLAS_ERROR(tsqr_geqrf_strided_batched(handle, mb, n, X, ldx, mb, tau, n, p - 1));
+    CHECK_ROCBLAS_ERROR(tsqr_geqrf(handle, mlast, n, Xlast, ldx, tlast));
+
+    // the explicit orthogonal factor of the stacked R factors gives the blocks of
+    // Q = diag(Q_1, ..., Q_p) * Q_Y
+    CHECK_HIPSOLVER_ERROR(tsqr_gather_R(stream, mb, n, p, X, ldx, Y));
+    CHECK_HIPSOLVER_ERROR(tsqr_level(
+        handle, stream, rows, level + 1, n, Y, ldy, Y + size_t(ldy) * n, tau + ldy, R, temps));
+
+    for(rocblas_int b = 0; b < p - 1; b += chunk)
+        CHECK_HIPSOLVER_ERROR(tsqr_apply_blocks(handle,
+                                                stream,
+                                                mb,
+                                                n,
+                                                std::min(chunk, p - 1 - b),
+                                                X + size_t(b) * mb,
+                                                ldx,
+                                                tau + size_t(b) * n,
+                                                Y + size_t(b) * n,
+                                                ldy,
+                                                temps));
+    CHECK_HIPSOLVER_ERROR(tsqr_apply_blocks(
+        handle, stream, mlast, n, 1, Xlast, ldx, tlast, Y + size_t(p - 1) * n, ldy, temps));
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T>
+hipsolverStatus_t tsqr_geqrf_compute(rocblas_handle handle,
+                                     hipStream_t    stream,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     T*             A,
+                                     rocblas_int    lda,
+                                     T*             tau,
+                                     void* const*   temps)
+{
+    T* R = (T*)temps[tsqr_temp_R];
+    T* D = (T*)temps[tsqr_temp_D];
+
+    T one = 1;
+
+    // A is overwritten with the explicit orthogonal factor Q, and R is kept aside
+    CHECK_HIPSOLVER_ERROR(tsqr_level(handle,
+                                     stream,
+                                     tsqr_levels(m, n),
+                                     0,
+                                     n,
+                                     A,
+                                     lda,
+                                     (T*)temps[tsqr_temp_Y],
+                                     (T*)temps[tsqr_temp_tau],
+                                     R,
+                                     temps));
+
+    // Householder reconstruction: Q(1:n, :) - D = L * U, and the Householder vectors are
+    // L and Q(n+1:m, :) * U^-1
+    CHECK_HIPSOLVER_ERROR(tsqr_modified_lu(handle, stream, n, A, lda, D));
+    if(m > n)
+        CHECK_ROCBLAS_ERROR(tsqr_trsm(handle,
+                                      rocblas_side_right,
+                                      rocblas_fill_upper,
+                                      rocblas_operation_none,
+                                      rocblas_diagonal_non_unit,
+                                      m - n,
+                                      n,
+                                      &one,
+                                      A,
+                                      lda,
+                                      0,
+                                      A + n,
+                                      lda,
+                                      0,
+                                      1));
+
+    // the leading block holds L below the diagonal and D * R on and above it, and the
+    // Householder scalars are -D * diag(U)
+    return tsqr_reconstruct(stream, n, A, lda, R, n, D, tau);
+}
+
+/*! \brief Computes the QR factorization of the m-by-n matrix A, m >= n, with the tall-skinny
+ *  QR factorization, and returns it in the format of rocsolver_?geqrf: R in the upper
+ *  triangle of A, and the Householder vectors below the diagonal with their scalars in tau.
+ *  The temporary arrays must have the sizes returned by tsqr_temp_sizes, and the rocBLAS
+ *  workspace the size returned by tsqr_workspace_size.
+ */
+template <typename T>
+hipsolverStatus_t tsqr_geqrf_template(rocblas_handle handle,
+                                      rocblas_int    m,
+                                      rocblas_int    n,
+                                      T*             A,
+                                      rocblas_int    lda,
+                                      T*             tau,
+                                      void* const*   temps)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(n < 0 || m < n || lda < m)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(n == 0)
+        return HIPSOLVER_STATUS_SUCCESS;
+    if(!A || !tau)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipStream_t stream;
+    CHECK_ROCBLAS_ERROR(rocblas_get_stream(handle, &stream));
+
+    // the scalars passed to rocBLAS live on the host
+    rocblas_pointer_mode mode;
+    CHECK_ROCBLAS_ERROR(rocblas_get_pointer_mode(handle, &mode));
+    CHECK_ROCBLAS_ERROR(rocblas_set_pointer_mode(handle, rocblas_pointer_mode_host));
+
+    hipsolverStatus_t status = tsqr_geqrf_compute(handle, stream, m, n, A, lda, tau, temps);
+
+    rocblas_set_pointer_mode(handle, mode);
+    return status;
+}
+
+// Points temps to the temporary arrays of the tall-skinny QR factorization, carved from the
+// front of the user workspace, or taken from the memory pool of the handle and held by mem
+// when no workspace is given.
+template <typename T>
+hipsolverStatus_t tsqr_setup_temps(rocblas_handle      handle,
+                                   rocblas_int         m,
+                                   rocblas_int         n,
+                                   void*               work,
+                                   size_t              lwork,
+                                   pool_device_malloc& mem,
+                                   void**              temps)
+{
+    auto   sizes      = tsqr_temp_sizes<T>(m, n);
+    size_t size_temps = tsqr_temp_total(sizes);
+
+    if(work && lwork)
+    {
+        if(lwork < size_temps)
+            return HIPSOLVER_STATUS_INVALID_VALUE;
+
+        tsqr_carve_temps(work, sizes, temps);
+        CHECK_ROCBLAS_ERROR(
+            rocblas_set_workspace(handle, (char*)work + size_temps, lwork - size_temps));
+    }
+    else
+    {
+        size_t size_work;
+        CHECK_HIPSOLVER_ERROR(tsqr_workspace_size<T>(handle, m, n, &size_work));
+        CHECK_ROCBLAS_ERROR(hipsolverManageWorkspace(handle, size_work));
+
+        mem = pool_device_malloc(handle, size_temps);
+        if(!mem)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        tsqr_carve_temps(mem[0], sizes, temps);
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+/*! \brief Runs tsqr_geqrf_template with the workspace layout of tsqr_device_size.
+ */
+template <typename T>
+hipsolverStatus_t tsqr_geqrf_execute(rocblas_handle handle,
+                                     rocblas_int    m,
+                                     rocblas_int    n,
+                                     T*             A,
+                                     rocblas_int    lda,
+                                     T*             tau,
+                                     void*          work,
+                                     size_t         lwork)
+{
+    pool_device_malloc mem(handle);
+    void*              temps[tsqr_num_temps];
+    CHECK_HIPSOLVER_ERROR(tsqr_setup_temps<T>(handle, m, n, work, lwork, mem, temps));
+
+    return tsqr_geqrf_template(handle, m, n, A, lda, tau, temps);
+}
+
+HIPSOLVER_END_NAMESPACE
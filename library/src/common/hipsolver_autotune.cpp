@@ -0,0 +1,925 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief hipsolver_autotune.cpp provides the autotuning mode and the generic
+ *  symmetric/Hermitian eigensolvers that dispatch to syevd, syevdx, or syevj. It only
+ *  calls hipSOLVER's regular APIs, so it is shared by both backends.
+ */
+
+#include "autotune.hpp"
+#include "exceptions.hpp"
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+#include "logging.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <tuple>
+#include <unordered_map>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** AUTOTUNE STATE ********************/
+enum class eig_solver
+{
+    syevd,
+    syevdx,
+    syevj,
+};
+
+static const char* eig_solver_name(eig_solver solver)
+{
+    switch(solver)
+    {
+    case eig_solver::syevd:
+        return "syevd";
+    case eig_solver::syevdx:
+        return "syevdx";
+    case eig_solver::syevj:
+        return "syevj";
+    }
+    return "";
+}
+
+static bool eig_solver_from_name(const std::string& name, eig_solver* solver)
+{
+    for(eig_solver s : {eig_solver::syevd, eig_solver::syevdx, eig_solver::syevj})
+    {
+        if(name == eig_solver_name(s))
+        {
+            *solver = s;
+            return true;
+        }
+    }
+    return false;
+}
+
+// Identifies a problem shape. The device name is included so that a table shared
+// between machines does not mix results from different architectures.
+struct autotune_key
+{
+    std::string device;
+    char        precision;
+    int         jobz;
+    int         range;
+    int         n;
+    int         nev;
+
+    bool operator<(const autotune_key& other) const
+    {
+        return std::tie(device, precision, jobz, range, n, nev)
+               < std::tie(other.device, other.precision, other.jobz, other.range, other.n, other.nev);
+    }
+};
+
+// Process-wide state. The table of winners is loaded lazily from the file named by
+// HIPSOLVER_AUTOTUNE_FILE, and written back whenever a new shape has been tuned.
+struct autotune_state
+{
+    std::mutex                                                     mutex;
+    std::unordered_map<hipsolverHandle_t, hipsolverAutotuneMode_t> modes;
+    std::unordered_map<int, std::string>                           device_names;
+    std::map<autotune_key, eig_solver>                             table;
+    bool                                                           loaded = false;
+};
+
+static autotune_state& autotune()
+{
+    static autotune_state state;
+    return state;
+}
+
+static const char* autotune_file()
+{
+    const char* path = std::getenv("HIPSOLVER_AUTOTUNE_FILE");
+    return path && *path ? path : nullptr;
+}
+
+// Each line of the file holds: <solver> <precision> <jobz> <range> <n> <nev> <device name>.
+// Lines that cannot be parsed are ignored.
+static void load_table(autotune_state& state)
+{
+    if(state.loaded)
+        return;
+    state.loaded = true;
+
+    const char* path = autotune_file();
+    if(!path)
+        return;
+
+    std::ifstream file(path);
+    std::string   line;
+    while(std::getline(file, line))
+    {
+        std::istringstream is(line);
+        std::string        name;
+        autotune_key       key;
+        eig_solver         solver;
+        if(!(is >> name >> key.precision >> key.jobz >> key.range >> key.n >> key.nev))
+            continue;
+        if(!std::getline(is >> std::ws, key.device) || !eig_solver_from_name(name, &solver))
+            continue;
+        state.table[key] = solver;
+    }
+}
+
+// Persisting the table is best effort. Failing to write the file does not affect the
+// results of the computation.
+static void save_table(autotune_state& state)
+{
+    const char* path = autotune_file();
+    if(!path)
+        return;
+
+    std::string   temp_path = std::string(path) + ".tmp";
+    std::ofstream file(temp_path, std::ios::trunc);
+    for(const auto& entry : state.table)
+    {
+        const autotune_key& key = entry.first;
+        file << eig_solver_name(entry.second) << ' ' << key.precision << ' ' << key.jobz << ' '
+             << key.range << ' ' << key.n << ' ' << key.nev << ' ' << key.device << '\n';
+    }
+    file.close();
+
+    if(file)
+        std::rename(temp_path.c_str(), path);
+    else
+        std::remove(temp_path.c_str());
+}
+
+static bool autotune_enabled(hipsolverHandle_t handle)
+{
+    autotune_state&             state = autotune();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto it = state.modes.find(handle);
+    return it != state.modes.end() && it->second == HIPSOLVER_AUTOTUNE_ENABLED;
+}
+
+static hipsolverStatus_t
+    make_key(char precision, int jobz, int range, int n, int nev, autotune_key* key)
+{
+    int device;
+    CHECK_HIP_ERROR(hipGetDevice(&device));
+
+    autotune_state&             state = autotune();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    auto it = state.device_names.find(device);
+    if(it == state.device_names.end())
+    {
+        hipDeviceProp_t prop;
+        CHECK_HIP_ERROR(hipGetDeviceProperties(&prop, device));
+        it = state.device_names.emplace(device, prop.name).first;
+    }
+
+    *key = {it->second, precision, jobz, range, n, nev};
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+static bool autotune_lookup(const autotune_key& key, eig_solver* solver)
+{
+    autotune_state&             state = autotune();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    load_table(state);
+    auto it = state.table.find(key);
+    if(it == state.table.end())
+        return false;
+
+    *solver = it->second;
+    return true;
+}
+
+static void autotune_record(const autotune_key& key, eig_solver solver)
+{
+    autotune_state&             state = autotune();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    load_table(state);
+    state.table[key] = solver;
+    save_table(state);
+}
+
+void autotune_release(hipsolverHandle_t handle)
+{
+    autotune_state&             state = autotune();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    state.modes.erase(handle);
+}
+
+/******************** EIGENSOLVERS ********************/
+template <typename T>
+struct eig_functions;
+
+template <>
+struct eig_functions<float>
+{
+    static constexpr char precision = 's';
+
+    static constexpr auto syevd_bufferSize  = hipsolverSsyevd_bufferSize;
+    static constexpr auto syevdx_bufferSize = hipsolverSsyevdx_bufferSize;
+    static constexpr auto syevj_bufferSize  = hipsolverSsyevj_bufferSize;
+    static constexpr auto syevd             = hipsolverSsyevd;
+    static constexpr auto syevdx            = hipsolverSsyevdx;
+    static constexpr auto syevj             = hipsolverSsyevj;
+};
+
+template <>
+struct eig_functions<double>
+{
+    static constexpr char precision = 'd';
+
+    static constexpr auto syevd_bufferSize  = hipsolverDsyevd_bufferSize;
+    static constexpr auto syevdx_bufferSize = hipsolverDsyevdx_bufferSize;
+    static constexpr auto syevj_bufferSize  = hipsolverDsyevj_bufferSize;
+    static constexpr auto syevd             = hipsolverDsyevd;
+    static constexpr auto syevdx            = hipsolverDsyevdx;
+    static constexpr auto syevj             = hipsolverDsyevj;
+};
+
+template <>
+struct eig_functions<hipFloatComplex>
+{
+    static constexpr char precision = 'c';
+
+    static constexpr auto syevd_bufferSize  = hipsolverCheevd_bufferSize;
+    static constexpr auto syevdx_bufferSize = hipsolverCheevdx_bufferSize;
+    static constexpr auto syevj_bufferSize  = hipsolverCheevj_bufferSize;
+    static constexpr auto syevd             = hipsolverCheevd;
+    static constexpr auto syevdx            = hipsolverCheevdx;
+    static constexpr auto syevj             = hipsolverCheevj;
+};
+
+template <>
+struct eig_functions<hipDoubleComplex>
+{
+    static constexpr char precision = 'z';
+
+    static constexpr auto syevd_bufferSize  = hipsolverZheevd_bufferSize;
+    static constexpr auto syevdx_bufferSize = hipsolverZheevdx_bufferSize;
+    static constexpr auto syevj_bufferSize  = hipsolverZheevj_bufferSize;
+    static constexpr auto syevd             = hipsolverZheevd;
+    static constexpr auto syevdx            = hipsolverZheevdx;
+    static constexpr auto syevj             = hipsolverZheevj;
+};
+
+// Value ranges are only supported by syevdx. The other solvers compute the full
+// spectrum, from which an index range is then extracted.
+static std::vector<eig_solver> eig_candidates(hipsolverEigRange_t range)
+{
+    if(range == HIPSOLVER_EIG_RANGE_V)
+        return {eig_solver::syevdx};
+    return {eig_solver::syevd, eig_solver::syevdx, eig_solver::syevj};
+}
+
+static eig_solver default_eig_solver(hipsolverEigRange_t range)
+{
+    return range == HIPSOLVER_EIG_RANGE_ALL ? eig_solver::syevd : eig_solver::syevdx;
+}
+
+// Moves the eigenpairs il to iu, computed as part of the full spectrum, to the front
+// of W and A. The copies are done in chunks of at most il - 1 entries so that the
+// source and destination of each copy never overlap.
+template <typename T, typename S>
+static hipsolverStatus_t select_eigenpairs(hipsolverHandle_t   handle,
+                                           hipsolverEigMode_t  jobz,
+                                           hipsolverEigRange_t range,
+                                           int                 n,
+                                           T*                  A,
+                                           int                 lda,
+                                           int                 il,
+                                           int                 iu,
+                                           int*                nev,
+                                           S*                  W)
+{
+    if(range != HIPSOLVER_EIG_RANGE_I || n == 0)
+    {
+        *nev = n;
+        return HIPSOLVER_STATUS_SUCCESS;
+    }
+
+    hipStream_t stream;
+    CHECK_HIPSOLVER_ERROR(hipsolverGetStream(handle, &stream));
+
+    int shift = il - 1;
+    *nev      = iu - il + 1;
+    for(int j = 0; shift > 0 && j < *nev; j += shift)
+    {
+        int count = std::min(shift, *nev - j);
+        CHECK_HIP_ERROR(hipMemcpyAsync(
+            W + j, W + shift + j, sizeof(S) * count, hipMemcpyDeviceToDevice, stream));
+        if(jobz == HIPSOLVER_EIG_MODE_VECTOR)
+            CHECK_HIP_ERROR(hipMemcpy2DAsync(A + size_t(lda) * j,
+                                             sizeof(T) * lda,
+                                             A + size_t(lda) * (shift + j),
+                                             sizeof(T) * lda,
+                                             sizeof(T) * n,
+                                             count,
+                                             hipMemcpyDeviceToDevice,
+                                             stream));
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t run_eig_solver(eig_solver          solver,
+                                        hipsolverHandle_t   handle,
+                                        hipsolverEigMode_t  jobz,
+                                        hipsolverEigRange_t range,
+                                        hipblasFillMode_t   uplo,
+                                        int                 n,
+                                        T*                  A,
+                                        int                 lda,
+                                        S                   vl,
+                                        S                   vu,
+                                        int                 il,
+                                        int                 iu,
+                                        int*                nev,
+                                        S*                  W,
+                                        T*                  work,
+                                        int                 lwork,
+                                        int*                devInfo)
+{
+    using F = eig_functions<T>;
+
+    if(solver == eig_solver::syevdx)
+        return F::syevdx(
+            handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+
+    if(range == HIPSOLVER_EIG_RANGE_I && n > 0 && (il < 1 || iu < il || iu > n))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    if(solver == eig_solver::syevd)
+    {
+        CHECK_HIPSOLVER_ERROR(F::syevd(handle, jobz, uplo, n, A, lda, W, work, lwork, devInfo));
+    }
+    else
+    {
+        hipsolverSyevjInfo_t params;
+        CHECK_HIPSOLVER_ERROR(hipsolverCreateSyevjInfo(&params));
+
+        hipsolverStatus_t status
+            = F::syevj(handle, jobz, uplo, n, A, lda, W, work, lwork, devInfo, params);
+        hipsolverDestroySyevjInfo(params);
+        if(status != HIPSOLVER_STATUS_SUCCESS)
+            return status;
+    }
+
+    return select_eigenpairs(handle, jobz, range, n, A, lda, il, iu, nev, W);
+}
+
+// Temporary device memory and events used while tuning, released on scope exit
+struct tuning_resources
+{
+    hipsolverHandle_t handle;
+    void*             A     = nullptr;
+    void*             W     = nullptr;
+    void*             info  = nullptr;
+    hipEvent_t        start = nullptr;
+    hipEvent_t        stop  = nullptr;
+
+    explicit tuning_resources(hipsolverHandle_t handle)
+        : handle(handle)
+    {
+    }
+
+    ~tuning_resources()
+    {
+        if(start)
+            (void)hipEventDestroy(start);
+        if(stop)
+            (void)hipEventDestroy(stop);
+        autotune_free(handle, A);
+        autotune_free(handle, W);
+        autotune_free(handle, info);
+    }
+};
+
+// Times each candidate on a copy of A, leaving the input untouched. Candidates that
+// fail or do not converge are skipped. found is set to false if none succeeded.
+template <typename T, typename S>
+static hipsolverStatus_t tune_eig_solver(hipsolverHandle_t   handle,
+                                         hipsolverEigMode_t  jobz,
+                                         hipsolverEigRange_t range,
+                                         hipblasFillMode_t   uplo,
+                                         int                 n,
+                                         const T*            A,
+                                         int                 lda,
+                                         S                   vl,
+                                         S                   vu,
+                                         int                 il,
+                                         int                 iu,
+                                         T*                  work,
+                                         int                 lwork,
+                                         eig_solver*         winner,
+                                         bool*               found)
+{
+    // The first run of each candidate absorbs one-time costs such as workspace
+    // allocation, so the fastest of several runs is kept
+    constexpr int num_runs = 2;
+
+    *found = false;
+    if(n <= 0 || lda < n || !A)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    hipStream_t stream;
+    CHECK_HIPSOLVER_ERROR(hipsolverGetStream(handle, &stream));
+
+    size_t           size_A = sizeof(T) * lda * n;
+    tuning_resources res(handle);
+    CHECK_HIPSOLVER_ERROR(autotune_malloc(handle, &res.A, size_A));
+    CHECK_HIPSOLVER_ERROR(autotune_malloc(handle, &res.W, sizeof(S) * n));
+    CHECK_HIPSOLVER_ERROR(autotune_malloc(handle, &res.info, sizeof(int)));
+    CHECK_HIP_ERROR(hipEventCreate(&res.start));
+    CHECK_HIP_ERROR(hipEventCreate(&res.stop));
+
+    float best_time = std::numeric_limits<float>::infinity();
+    for(eig_solver solver : eig_candidates(range))
+    {
+        float time   = std::numeric_limits<float>::infinity();
+        bool  failed = false;
+        for(int run = 0; run < num_runs && !failed; run++)
+        {
+            CHECK_HIP_ERROR(hipMemcpyAsync(res.A, A, size_A, hipMemcpyDeviceToDevice, stream));
+            CHECK_HIP_ERROR(hipEventRecord(res.start, stream));
+
+            int               nev;
+            hipsolverStatus_t status = run_eig_solver(solver,
+                                                      handle,
+                                                      jobz,
+                                                      range,
+                                                      uplo,
+                                                      n,
+                                                      (T*)res.A,
+                                                      lda,
+                                                      vl,
+                                                      vu,
+                                                      il,
+                                                      iu,
+                                                      &nev,
+                                                      (S*)res.W,
+                                                      work,
+                                                      lwork,
+                                                      (int*)res.info);
+            CHECK_HIP_ERROR(hipEventRecord(res.stop, stream));
+            CHECK_HIP_ERROR(hipEventSynchronize(res.stop));
+
+            int info = 0;
+            if(status == HIPSOLVER_STATUS_SUCCESS)
+                CHECK_HIP_ERROR(hipMemcpy(&info, res.info, sizeof(int), hipMemcpyDeviceToHost));
+            if(status != HIPSOLVER_STATUS_SUCCESS || info != 0)
+            {
+                failed = true;
+                break;
+            }
+
+            float elapsed;
+            CHECK_HIP_ERROR(hipEventElapsedTime(&elapsed, res.start, res.stop));
+            time = std::min(time, elapsed);
+        }
+
+        if(!failed && time < best_time)
+        {
+            best_time = time;
+            *winner   = solver;
+            *found    = true;
+        }
+    }
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t syev_auto_bufferSize(hipsolverHandle_t   handle,
+                                              hipsolverEigMode_t  jobz,
+                                              hipsolverEigRange_t range,
+                                              hipblasFillMode_t   uplo,
+                                              int                 n,
+                                              const T*            A,
+                                              int                 lda,
+                                              S                   vl,
+                                              S                   vu,
+                                              int                 il,
+                                              int                 iu,
+                                              int*                nev,
+                                              const S*            W,
+                                              int*                lwork)
+{
+    using F = eig_functions<T>;
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!lwork)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    CHECK_HIPSOLVER_ERROR(F::syevdx_bufferSize(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork));
+    if(range == HIPSOLVER_EIG_RANGE_V)
+        return HIPSOLVER_STATUS_SUCCESS;
+
+    // The workspace must also fit the solvers that compute the full spectrum
+    int size;
+    CHECK_HIPSOLVER_ERROR(
+        F::syevd_bufferSize(handle, jobz, uplo, n, (T*)A, lda, (S*)W, &size));
+    *lwork = std::max(*lwork, size);
+
+    hipsolverSyevjInfo_t params;
+    CHECK_HIPSOLVER_ERROR(hipsolverCreateSyevjInfo(&params));
+
+    hipsolverStatus_t status
+        = F::syevj_bufferSize(handle, jobz, uplo, n, (T*)A, lda, (S*)W, &size, params);
+    hipsolverDestroySyevjInfo(params);
+    if(status != HIPSOLVER_STATUS_SUCCESS)
+        return status;
+
+    *lwork = std::max(*lwork, size);
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+template <typename T, typename S>
+static hipsolverStatus_t syev_auto(hipsolverHandle_t   handle,
+                                   hipsolverEigMode_t  jobz,
+                                   hipsolverEigRange_t range,
+                                   hipblasFillMode_t   uplo,
+                                   int                 n,
+                                   T*                  A,
+                                   int                 lda,
+                                   S                   vl,
+                                   S                   vu,
+                                   int                 il,
+                                   int                 iu,
+                                   int*                nev,
+                                   S*                  W,
+                                   T*                  work,
+                                   int                 lwork,
+                                   int*                devInfo)
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!nev)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    eig_solver solver = default_eig_solver(range);
+    if(eig_candidates(range).size() > 1 && autotune_enabled(handle))
+    {
+        int          key_nev = range == HIPSOLVER_EIG_RANGE_I ? iu - il + 1 : n;
+        autotune_key key;
+        CHECK_HIPSOLVER_ERROR(
+            make_key(eig_functions<T>::precision, jobz, range, n, key_nev, &key));
+
+        if(!autotune_lookup(key, &solver))
+        {
+            bool found;
+
+            hipsolverStatus_t status = tune_eig_solver(
+                handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, work, lwork, &solver, &found);
+            if(status != HIPSOLVER_STATUS_SUCCESS)
+                return status;
+            if(found)
+                autotune_record(key, solver);
+        }
+    }
+
+    return run_eig_solver(
+        solver, handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+}
+
+HIPSOLVER_END_NAMESPACE
+
+extern "C" {
+
+/******************** AUTOTUNE MODE ********************/
+hipsolverStatus_t hipsolverSetAutotuneMode(hipsolverHandle_t handle, hipsolverAutotuneMode_t mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(mode != HIPSOLVER_AUTOTUNE_DISABLED && mode != HIPSOLVER_AUTOTUNE_ENABLED)
+        return HIPSOLVER_STATUS_INVALID_ENUM;
+
+    hipsolver::autotune_state&  state = hipsolver::autotune();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if(mode == HIPSOLVER_AUTOTUNE_ENABLED)
+        state.modes[handle] = mode;
+    else
+        state.modes.erase(handle);
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverGetAutotuneMode(hipsolverHandle_t handle, hipsolverAutotuneMode_t* mode)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!mode)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    *mode = hipsolver::autotune_enabled(handle) ? HIPSOLVER_AUTOTUNE_ENABLED
+                                                : HIPSOLVER_AUTOTUNE_DISABLED;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEV_AUTO/HEEV_AUTO ********************/
+hipsolverStatus_t hipsolverSsyevAuto_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverEigRange_t range,
+                                                hipblasFillMode_t   uplo,
+                                                int                 n,
+                                                const float*        A,
+                                                int                 lda,
+                                                float               vl,
+                                                float               vu,
+                                                int                 il,
+                                                int                 iu,
+                                                int*                nev,
+                                                const float*        W,
+                                                int*                lwork)
+try
+{
+    return hipsolver::syev_auto_bufferSize(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevAuto_bufferSize(hipsolverHandle_t   handle,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverEigRange_t range,
+                                                hipblasFillMode_t   uplo,
+                                                int                 n,
+                                                const double*       A,
+                                                int                 lda,
+                                                double              vl,
+                                                double              vu,
+                                                int                 il,
+                                                int                 iu,
+                                                int*                nev,
+                                                const double*       W,
+                                                int*                lwork)
+try
+{
+    return hipsolver::syev_auto_bufferSize(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevAuto_bufferSize(hipsolverHandle_t      handle,
+                                                hipsolverEigMode_t     jobz,
+                                                hipsolverEigRange_t    range,
+                                                hipblasFillMode_t      uplo,
+                                                int                    n,
+                                                const hipFloatComplex* A,
+                                                int                    lda,
+                                                float                  vl,
+                                                float                  vu,
+                                                int                    il,
+                                                int                    iu,
+                                                int*                   nev,
+                                                const float*           W,
+                                                int*                   lwork)
+try
+{
+    return hipsolver::syev_auto_bufferSize(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevAuto_bufferSize(hipsolverHandle_t       handle,
+                                                hipsolverEigMode_t      jobz,
+                                                hipsolverEigRange_t     range,
+                                                hipblasFillMode_t       uplo,
+                                                int                     n,
+                                                const hipDoubleComplex* A,
+                                                int                     lda,
+                                                double                  vl,
+                                                double                  vu,
+                                                int                     il,
+                                                int                     iu,
+                                                int*                    nev,
+                                                const double*           W,
+                                                int*                    lwork)
+try
+{
+    return hipsolver::syev_auto_bufferSize(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, lwork);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverSsyevAuto(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     float*              A,
+                                     int                 lda,
+                                     float               vl,
+                                     float               vu,
+                                     int                 il,
+                                     int                 iu,
+                                     int*                nev,
+                                     float*              W,
+                                     float*              work,
+                                     int                 lwork,
+                                     int*                devInfo)
+try
+{
+    // hipsolver-bench has no command for the autotuned solvers
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz},
+                                  {"range", range},
+                                  {"uplo", uplo},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"vl", vl},
+                                  {"vu", vu},
+                                  {"il", il},
+                                  {"iu", iu}},
+                                 0,
+                                 "");
+
+    return hipsolver::syev_auto(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDsyevAuto(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     double*             A,
+                                     int                 lda,
+                                     double              vl,
+                                     double              vu,
+                                     int                 il,
+                                     int                 iu,
+                                     int*                nev,
+                                     double*             W,
+                                     double*             work,
+                                     int                 lwork,
+                                     int*                devInfo)
+try
+{
+    // hipsolver-bench has no command for the autotuned solvers
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz},
+                                  {"range", range},
+                                  {"uplo", uplo},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"vl", vl},
+                                  {"vu", vu},
+                                  {"il", il},
+                                  {"iu", iu}},
+                                 0,
+                                 "");
+
+    return hipsolver::syev_auto(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverCheevAuto(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     hipFloatComplex*    A,
+                                     int                 lda,
+                                     float               vl,
+                                     float               vu,
+                                     int                 il,
+                                     int                 iu,
+                                     int*                nev,
+                                     float*              W,
+                                     hipFloatComplex*    work,
+                                     int                 lwork,
+                                     int*                devInfo)
+try
+{
+    // hipsolver-bench has no command for the autotuned solvers
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz},
+                                  {"range", range},
+                                  {"uplo", uplo},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"vl", vl},
+                                  {"vu", vu},
+                                  {"il", il},
+                                  {"iu", iu}},
+                                 0,
+                                 "");
+
+    return hipsolver::syev_auto(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverZheevAuto(hipsolverHandle_t   handle,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipblasFillMode_t   uplo,
+                                     int                 n,
+                                     hipDoubleComplex*   A,
+                                     int                 lda,
+                                     double              vl,
+                                     double              vu,
+                                     int                 il,
+                                     int                 iu,
+                                     int*                nev,
+                                     double*             W,
+                                     hipDoubleComplex*   work,
+                                     int                 lwork,
+                                     int*                devInfo)
+try
+{
+    // hipsolver-bench has no command for the autotuned solvers
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz},
+                                  {"range", range},
+                                  {"uplo", uplo},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"vl", vl},
+                                  {"vu", vu},
+                                  {"il", il},
+                                  {"iu", iu}},
+                                 0,
+                                 "");
+
+    return hipsolver::syev_auto(
+        handle, jobz, range, uplo, n, A, lda, vl, vu, il, iu, nev, W, work, lwork, devInfo);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+} //extern C
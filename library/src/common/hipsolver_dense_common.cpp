@@ -1083,6 +1083,70 @@ hipsolverStatus_t hipsolverDnZZgels_bufferSize(hipsolverHandle_t handle,
     return hipsolverZZgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
 }
 
+hipsolverStatus_t hipsolverDnDSgels_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               nrhs,
+                                               double*           A,
+                                               int               lda,
+                                               double*           B,
+                                               int               ldb,
+                                               double*           X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverDSgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+}
+
+hipsolverStatus_t hipsolverDnDHgels_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               nrhs,
+                                               double*           A,
+                                               int               lda,
+                                               double*           B,
+                                               int               ldb,
+                                               double*           X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverDHgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+}
+
+hipsolverStatus_t hipsolverDnZCgels_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               nrhs,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* B,
+                                               int               ldb,
+                                               hipDoubleComplex* X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverZCgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+}
+
+hipsolverStatus_t hipsolverDnZKgels_bufferSize(hipsolverHandle_t handle,
+                                               int               m,
+                                               int               n,
+                                               int               nrhs,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               hipDoubleComplex* B,
+                                               int               ldb,
+                                               hipDoubleComplex* X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverZKgels_bufferSize(handle, m, n, nrhs, A, lda, B, ldb, X, ldx, lwork);
+}
+
 hipsolverStatus_t hipsolverDnSSgels(hipsolverHandle_t handle,
                                     int               m,
                                     int               n,
@@ -1159,6 +1223,82 @@ hipsolverStatus_t hipsolverDnZZgels(hipsolverHandle_t handle,
         handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, devInfo);
 }
 
+hipsolverStatus_t hipsolverDnDSgels(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    int               nrhs,
+                                    double*           A,
+                                    int               lda,
+                                    double*           B,
+                                    int               ldb,
+                                    double*           X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverDSgels(
+        handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
+hipsolverStatus_t hipsolverDnDHgels(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    int               nrhs,
+                                    double*           A,
+                                    int               lda,
+                                    double*           B,
+                                    int               ldb,
+                                    double*           X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverDHgels(
+        handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
+hipsolverStatus_t hipsolverDnZCgels(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    int               nrhs,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* B,
+                                    int               ldb,
+                                    hipDoubleComplex* X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverZCgels(
+        handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
+hipsolverStatus_t hipsolverDnZKgels(hipsolverHandle_t handle,
+                                    int               m,
+                                    int               n,
+                                    int               nrhs,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    hipDoubleComplex* B,
+                                    int               ldb,
+                                    hipDoubleComplex* X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverZKgels(
+        handle, m, n, nrhs, A, lda, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
 // geqrf
 hipsolverStatus_t hipsolverDnSgeqrf_bufferSize(
     hipsolverHandle_t handle, int m, int n, float* A, int lda, int* lwork)
@@ -1301,6 +1441,70 @@ hipsolverStatus_t hipsolverDnZZgesv_bufferSize(hipsolverHandle_t handle,
     return hipsolverZZgesv_bufferSize(handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, lwork);
 }
 
+hipsolverStatus_t hipsolverDnDSgesv_bufferSize(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               double*           A,
+                                               int               lda,
+                                               int*              devIpiv,
+                                               double*           B,
+                                               int               ldb,
+                                               double*           X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverDSgesv_bufferSize(handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, lwork);
+}
+
+hipsolverStatus_t hipsolverDnDHgesv_bufferSize(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               double*           A,
+                                               int               lda,
+                                               int*              devIpiv,
+                                               double*           B,
+                                               int               ldb,
+                                               double*           X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverDHgesv_bufferSize(handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, lwork);
+}
+
+hipsolverStatus_t hipsolverDnZCgesv_bufferSize(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               int*              devIpiv,
+                                               hipDoubleComplex* B,
+                                               int               ldb,
+                                               hipDoubleComplex* X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverZCgesv_bufferSize(handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, lwork);
+}
+
+hipsolverStatus_t hipsolverDnZKgesv_bufferSize(hipsolverHandle_t handle,
+                                               int               n,
+                                               int               nrhs,
+                                               hipDoubleComplex* A,
+                                               int               lda,
+                                               int*              devIpiv,
+                                               hipDoubleComplex* B,
+                                               int               ldb,
+                                               hipDoubleComplex* X,
+                                               int               ldx,
+                                               void*             work,
+                                               size_t*           lwork)
+{
+    return hipsolverZKgesv_bufferSize(handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, lwork);
+}
+
 hipsolverStatus_t hipsolverDnSSgesv(hipsolverHandle_t handle,
                                     int               n,
                                     int               nrhs,
@@ -1377,6 +1581,82 @@ hipsolverStatus_t hipsolverDnZZgesv(hipsolverHandle_t handle,
         handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, work, lwork, niters, devInfo);
 }
 
+hipsolverStatus_t hipsolverDnDSgesv(hipsolverHandle_t handle,
+                                    int               n,
+                                    int               nrhs,
+                                    double*           A,
+                                    int               lda,
+                                    int*              devIpiv,
+                                    double*           B,
+                                    int               ldb,
+                                    double*           X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverDSgesv(
+        handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
+hipsolverStatus_t hipsolverDnDHgesv(hipsolverHandle_t handle,
+                                    int               n,
+                                    int               nrhs,
+                                    double*           A,
+                                    int               lda,
+                                    int*              devIpiv,
+                                    double*           B,
+                                    int               ldb,
+                                    double*           X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverDHgesv(
+        handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
+hipsolverStatus_t hipsolverDnZCgesv(hipsolverHandle_t handle,
+                                    int               n,
+                                    int               nrhs,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    int*              devIpiv,
+                                    hipDoubleComplex* B,
+                                    int               ldb,
+                                    hipDoubleComplex* X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverZCgesv(
+        handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
+hipsolverStatus_t hipsolverDnZKgesv(hipsolverHandle_t handle,
+                                    int               n,
+                                    int               nrhs,
+                                    hipDoubleComplex* A,
+                                    int               lda,
+                                    int*              devIpiv,
+                                    hipDoubleComplex* B,
+                                    int               ldb,
+                                    hipDoubleComplex* X,
+                                    int               ldx,
+                                    void*             work,
+                                    size_t            lwork,
+                                    int*              niters,
+                                    int*              devInfo)
+{
+    return hipsolverZKgesv(
+        handle, n, nrhs, A, lda, devIpiv, B, ldb, X, ldx, work, lwork, niters, devInfo);
+}
+
 // gesvd
 hipsolverStatus_t hipsolverDnSgesvd(hipsolverHandle_t handle,
                                     signed char       jobu,
@@ -0,0 +1,312 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief hipsolver_handle_pool.cpp provides a pool of handles that threads can check
+ *  out and return without locking while handles are available. It only calls hipSOLVER's
+ *  regular APIs and the backend hook for workspace budgets, so it is shared by both
+ *  backends.
+ */
+
+#include "exceptions.hpp"
+#include "handle_pool.hpp"
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+#include <atomic>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <stdint.h>
+#include <unordered_map>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** HANDLE POOL ********************/
+// Each handle of the pool is bound to its own stream. Free handles are kept in a
+// lock-free stack: the low 32 bits of head hold one plus the index of the first free
+// handle (zero when the stack is empty), and the high 32 bits hold a version tag that
+// is incremented on every update, so that a stale head is never mistaken for the
+// current one. Threads that find the stack empty sleep on a condition variable until
+// a handle is returned.
+struct handle_pool
+{
+    std::vector<hipsolverHandle_t>             handles;
+    std::vector<hipStream_t>                   streams;
+    std::unordered_map<hipsolverHandle_t, int> indices;
+    std::unique_ptr<std::atomic<int>[]>        next;
+    std::unique_ptr<std::atomic<bool>[]>       in_use;
+    std::atomic<uint64_t>                      head;
+    std::shared_ptr<workspace_budget>          budget;
+
+    std::mutex              waiters_mutex;
+    std::condition_variable waiters_cv;
+    std::atomic<int>        num_waiters;
+
+    std::atomic<size_t> handles_in_use;
+    std::atomic<size_t> peak_handles_in_use;
+    std::atomic<size_t> num_acquires;
+    std::atomic<size_t> num_contended_acquires;
+    std::atomic<size_t> num_retries;
+
+    handle_pool(int num_handles, size_t workspace_budget_limit)
+        : next(new std::atomic<int>[num_handles])
+        , in_use(new std::atomic<bool>[num_handles])
+        , head(0)
+        , budget(std::make_shared<workspace_budget>(workspace_budget_limit))
+        , num_waiters(0)
+        , handles_in_use(0)
+        , peak_handles_in_use(0)
+        , num_acquires(0)
+        , num_contended_acquires(0)
+        , num_retries(0)
+    {
+        handles.reserve(num_handles);
+        streams.reserve(num_handles);
+    }
+
+    ~handle_pool()
+    {
+        for(hipsolverHandle_t handle : handles)
+            hipsolverDestroy(handle);
+        for(hipStream_t stream : streams)
+            hipStreamDestroy(stream);
+    }
+
+    // Returns the index of a free handle, or -1 if all of them are checked out
+    int pop()
+    {
+        uint64_t old_head = head.load(std::memory_order_acquire);
+        while(true)
+        {
+            int index = int(old_head & 0xffffffff) - 1;
+            if(index < 0)
+                return -1;
+
+            uint64_t new_head = next_tag(old_head) | uint32_t(next[index].load() + 1);
+            if(head.compare_exchange_weak(
+                   old_head, new_head, std::memory_order_acq_rel, std::memory_order_acquire))
+                return index;
+            num_retries++;
+        }
+    }
+
+    void push(int index)
+    {
+        uint64_t old_head = head.load(std::memory_order_relaxed);
+        while(true)
+        {
+            next[index].store(int(old_head & 0xffffffff) - 1);
+
+            uint64_t new_head = next_tag(old_head) | uint32_t(index + 1);
+            if(head.compare_exchange_weak(
+                   old_head, new_head, std::memory_order_release, std::memory_order_relaxed))
+                return;
+            num_retries++;
+        }
+    }
+
+    // Blocks until a handle is free and returns its index
+    int wait_pop()
+    {
+        std::unique_lock<std::mutex> lock(waiters_mutex);
+        num_waiters++;
+
+        // Pairs with the fence in notify_waiters, so that either a push made before
+        // that fence is seen here, or the waiter is seen there
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        int index;
+        waiters_cv.wait(lock, [&]() { return (index = pop()) >= 0; });
+        num_waiters--;
+        return index;
+    }
+
+    // Wakes a thread blocked in wait_pop, if any. Called after a push.
+    void notify_waiters()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if(num_waiters.load(std::memory_order_relaxed) > 0)
+        {
+            // Taking the mutex ensures that the waiter is either before its check of
+            // the stack or already waiting, so that the notification is not lost
+            std::lock_guard<std::mutex> lock(waiters_mutex);
+            waiters_cv.notify_one();
+        }
+    }
+
+private:
+    static uint64_t next_tag(uint64_t head)
+    {
+        return ((head >> 32) + 1) << 32;
+    }
+};
+
+HIPSOLVER_END_NAMESPACE
+
+extern "C" {
+
+hipsolverStatus_t
+    hipsolverHandlePoolCreate(hipsolverHandlePool_t* pool, int num_handles, size_t workspace_budget)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    if(num_handles <= 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipsolver::handle_pool> data(
+        new hipsolver::handle_pool(num_handles, workspace_budget));
+
+    for(int i = 0; i < num_handles; i++)
+    {
+        hipStream_t stream;
+        if(hipStreamCreateWithFlags(&stream, hipStreamNonBlocking) != hipSuccess)
+            return HIPSOLVER_STATUS_ALLOC_FAILED;
+        data->streams.push_back(stream);
+
+        hipsolverHandle_t handle;
+        CHECK_HIPSOLVER_ERROR(hipsolverCreate(&handle));
+        data->handles.push_back(handle);
+
+        CHECK_HIPSOLVER_ERROR(hipsolverSetStream(handle, stream));
+        CHECK_HIPSOLVER_ERROR(hipsolver::set_workspace_budget(handle, data->budget));
+
+        data->indices[handle] = i;
+        data->in_use[i].store(false);
+        data->push(i);
+    }
+    data->num_retries = 0;
+
+    *pool = data.release();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolDestroy(hipsolverHandlePool_t pool)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver::handle_pool* data = (hipsolver::handle_pool*)pool;
+    if(data->handles_in_use > 0)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    delete data;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolAcquire(hipsolverHandlePool_t pool, hipsolverHandle_t* handle)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!handle)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver::handle_pool* data = (hipsolver::handle_pool*)pool;
+
+    int index = data->pop();
+    if(index < 0)
+    {
+        data->num_contended_acquires++;
+        index = data->wait_pop();
+    }
+    data->in_use[index].store(true);
+    data->num_acquires++;
+
+    size_t in_use = ++data->handles_in_use;
+    size_t peak   = data->peak_handles_in_use.load();
+    while(in_use > peak && !data->peak_handles_in_use.compare_exchange_weak(peak, in_use))
+        ;
+
+    *handle = data->handles[index];
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolRelease(hipsolverHandlePool_t pool, hipsolverHandle_t handle)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    hipsolver::handle_pool* data = (hipsolver::handle_pool*)pool;
+
+    // indices is not modified after the pool is created, so it can be read concurrently
+    auto it = data->indices.find(handle);
+    if(it == data->indices.end() || !data->in_use[it->second].exchange(false))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    data->handles_in_use--;
+    data->push(it->second);
+    data->notify_waiters();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverHandlePoolGetInfo(hipsolverHandlePool_t      pool,
+                                             hipsolverHandlePoolInfo_t* info)
+try
+{
+    if(!pool)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!info)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolver::handle_pool* data = (hipsolver::handle_pool*)pool;
+
+    info->num_handles               = data->handles.size();
+    info->handles_in_use            = data->handles_in_use;
+    info->peak_handles_in_use       = data->peak_handles_in_use;
+    info->num_acquires              = data->num_acquires;
+    info->num_contended_acquires    = data->num_contended_acquires;
+    info->num_retries               = data->num_retries;
+    info->workspace_budget          = data->budget->limit;
+    info->workspace_used_bytes      = data->budget->used;
+    info->peak_workspace_used_bytes = data->budget->peak_used;
+    info->num_workspace_failures    = data->budget->num_failures;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+} //extern C
@@ -0,0 +1,410 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief hipsolver_logging.cpp implements the trace, bench, and profile logging
+ *  layers selected with HIPSOLVER_LAYER. It only uses HIP and hipSOLVER's regular
+ *  APIs, so it is shared by both backends.
+ */
+
+#include "logging.hpp"
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** LOGGING STATE ********************/
+struct profile_entry
+{
+    size_t calls   = 0;
+    double time_ms = 0;
+};
+
+struct pending_timing
+{
+    profile_entry* entry;
+    hipEvent_t     start;
+    hipEvent_t     stop;
+};
+
+// Opens the file named by the environment variable env, or returns stderr
+static FILE* open_log_file(const char* env)
+{
+    const char* path = std::getenv(env);
+    if(path && *path)
+    {
+        FILE* file = std::fopen(path, "w");
+        if(file)
+            return file;
+    }
+    return stderr;
+}
+
+// Process-wide state. The device time of the timed calls is collected by flush_logs,
+// and the profile is written when the library is unloaded. The destructor makes no
+// HIP calls, as the runtime may already be torn down by then.
+struct log_state
+{
+    int   layer;
+    FILE* trace_file;
+    FILE* bench_file;
+    FILE* profile_file;
+
+    std::mutex                           mutex;
+    std::map<std::string, profile_entry> profile;
+    std::vector<pending_timing>          pending;
+    std::vector<hipEvent_t>              free_events;
+
+    log_state()
+        : layer(0)
+        , trace_file(nullptr)
+        , bench_file(nullptr)
+        , profile_file(nullptr)
+    {
+        const char* env = std::getenv("HIPSOLVER_LAYER");
+        if(env)
+            layer = std::atoi(env) & (log_layer_trace | log_layer_bench | log_layer_profile);
+
+        if(layer & log_layer_trace)
+            trace_file = open_log_file("HIPSOLVER_LOG_TRACE_PATH");
+        if(layer & log_layer_bench)
+            bench_file = open_log_file("HIPSOLVER_LOG_BENCH_PATH");
+        if(layer & log_layer_profile)
+            profile_file = open_log_file("HIPSOLVER_LOG_PROFILE_PATH");
+    }
+
+    ~log_state()
+    {
+        if(profile_file)
+        {
+            std::fprintf(profile_file, "calls,device_time_ms,command\n");
+            for(auto& it : profile)
+                std::fprintf(profile_file,
+                             "%zu,%.6f,%s\n",
+                             it.second.calls,
+                             it.second.time_ms,
+                             it.first.c_str());
+            std::fflush(profile_file);
+        }
+
+        for(FILE* file : {trace_file, bench_file, profile_file})
+            if(file && file != stderr)
+                std::fclose(file);
+    }
+
+    hipEvent_t get_event()
+    {
+        hipEvent_t event = nullptr;
+        if(!free_events.empty())
+        {
+            event = free_events.back();
+            free_events.pop_back();
+        }
+        else if(hipEventCreate(&event) != hipSuccess)
+            event = nullptr;
+        return event;
+    }
+
+    // Adds the device time of the completed calls to the profile. If wait is true,
+    // waits for all calls to complete.
+    void resolve_timings(bool wait)
+    {
+        size_t kept = 0;
+        for(pending_timing& t : pending)
+        {
+            hipError_t status = wait ? hipEventSynchronize(t.stop) : hipEventQuery(t.stop);
+            if(status == hipErrorNotReady)
+            {
+                pending[kept++] = t;
+                continue;
+            }
+
+            float ms;
+            if(status == hipSuccess && hipEventElapsedTime(&ms, t.start, t.stop) == hipSuccess)
+                t.entry->time_ms += ms;
+            free_events.push_back(t.start);
+            free_events.push_back(t.stop);
+        }
+        pending.resize(kept);
+    }
+};
+
+static log_state& logs()
+{
+    static log_state state;
+    return state;
+}
+
+int log_layer()
+{
+    static const int layer = logs().layer;
+    return layer;
+}
+
+void flush_logs()
+{
+    if(!(log_layer() & log_layer_profile))
+        return;
+
+    log_state&                  state = logs();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    state.resolve_timings(true);
+    for(hipEvent_t event : state.free_events)
+        hipEventDestroy(event);
+    state.free_events.clear();
+}
+
+/******************** FORMATTING ********************/
+static std::string format_value(const log_arg& arg)
+{
+    char buffer[32];
+    switch(arg.type)
+    {
+    case log_arg::kind::integer:
+        std::snprintf(buffer, sizeof(buffer), "%lld", (long long)arg.ivalue);
+        return buffer;
+    case log_arg::kind::real:
+        std::snprintf(buffer, sizeof(buffer), "%.17g", arg.rvalue);
+        return buffer;
+    case log_arg::kind::character:
+        return std::string(1, (char)arg.ivalue);
+    case log_arg::kind::fill:
+        return arg.ivalue == HIPSOLVER_FILL_MODE_UPPER   ? "U"
+               : arg.ivalue == HIPSOLVER_FILL_MODE_LOWER ? "L"
+                                                         : "F";
+    case log_arg::kind::evect:
+        return arg.ivalue == HIPSOLVER_EIG_MODE_VECTOR ? "V" : "N";
+    case log_arg::kind::operation:
+        return arg.ivalue == HIPSOLVER_OP_T ? "T" : arg.ivalue == HIPSOLVER_OP_C ? "C" : "N";
+    case log_arg::kind::side:
+        return arg.ivalue == HIPSOLVER_SIDE_LEFT ? "L" : "R";
+    case log_arg::kind::erange:
+        return arg.ivalue == HIPSOLVER_EIG_RANGE_V   ? "V"
+               : arg.ivalue == HIPSOLVER_EIG_RANGE_I ? "I"
+                                                     : "A";
+    case log_arg::kind::eig_type:
+        return arg.ivalue == HIPSOLVER_EIG_TYPE_2   ? "2"
+               : arg.ivalue == HIPSOLVER_EIG_TYPE_3 ? "3"
+                                                    : "1";
+    case log_arg::kind::diag:
+        return arg.ivalue == HIPBLAS_DIAG_UNIT ? "U" : "N";
+    }
+    return "";
+}
+
+// Options accepted by hipsolver-bench. Other arguments only appear in the trace.
+static bool is_bench_option(const char* name)
+{
+    static const char* options[] = {"batch_count", "k",       "m",       "n",       "nrhs",
+                                    "lda",         "ldb",     "ldc",     "ldu",     "ldv",
+                                    "ldx",         "strideA", "strideS", "strideU", "strideV",
+                                    "jobu",        "jobv",    "il",      "iu",      "range",
+                                    "rank",        "p",       "niters",  "vl",      "vu",
+                                    "econ",        "itype",   "jobz",    "diag",    "side",
+                                    "trans",       "uplo"};
+    for(const char* option : options)
+        if(std::strcmp(name, option) == 0)
+            return true;
+    return false;
+}
+
+// Builds the hipsolver-bench command line of a call. For example, hipsolverDpotrfBatched
+// becomes "-f potrf_batched -r d", and hipsolverDSgesv becomes "-f gesv_mixed -r d". A
+// non-zero precision replaces the one named by func, and bench_func, if given, is used as
+// the hipsolver-bench function instead of the name of func. Returns an empty string if
+// hipsolver-bench has no command for the function, which is the case when bench_func is
+// empty or no precision is known, as for the 64-bit API without a valid data type.
+static std::string bench_command(const char*                    func,
+                                 std::initializer_list<log_arg> args,
+                                 char                           precision,
+                                 const char*                    bench_func)
+{
+    std::string name;
+    if(bench_func)
+    {
+        if(!*bench_func)
+            return "";
+        name = bench_func;
+    }
+    else
+    {
+        const char* p = func;
+        if(std::strncmp(p, "hipsolver", 9) == 0)
+            p += 9;
+        if(std::strncmp(p, "Dn", 2) == 0)
+            p += 2;
+
+        // The first letter of the leading upper case block is the precision. The mixed
+        // precision solvers name the precision of the data and of the factorization, and
+        // the X of the 64-bit API names none.
+        const char* block = p;
+        if(!precision && *p != 'X')
+            precision = (char)std::tolower(*p);
+        while(std::isupper(*p))
+            p++;
+
+        std::string suffix;
+        if(p - block == 2 && block[0] != block[1])
+        {
+            if(std::strncmp(block, "DS", 2) != 0 && std::strncmp(block, "ZC", 2) != 0)
+                return "";
+            suffix = "_mixed";
+        }
+
+        for(; *p; p++)
+        {
+            if(std::isupper(*p))
+            {
+                name += '_';
+                name += (char)std::tolower(*p);
+            }
+            else
+                name += *p;
+        }
+
+        // The size_t variants are benchmarked with the regular functions
+        if(name.size() > 4 && name.compare(name.size() - 4, 4, "_ext") == 0)
+            name.resize(name.size() - 4);
+        name += suffix;
+    }
+
+    if(precision != 's' && precision != 'd' && precision != 'c' && precision != 'z')
+        return "";
+
+    std::string command = "hipsolver-bench -f " + name + " -r " + precision;
+    for(const log_arg& arg : args)
+    {
+        if(!is_bench_option(arg.name))
+            continue;
+        command += std::strlen(arg.name) == 1 ? " -" : " --";
+        command += arg.name;
+        command += ' ';
+        command += format_value(arg);
+    }
+    return command;
+}
+
+static std::string trace_line(const char* func, std::initializer_list<log_arg> args)
+{
+    std::string line = func;
+    for(const log_arg& arg : args)
+    {
+        line += ',';
+        line += arg.name;
+        line += '=';
+        line += format_value(arg);
+    }
+    return line;
+}
+
+/******************** API LOGGER ********************/
+void api_logger::begin(hipsolverHandle_t              handle,
+                       const char*                    func,
+                       std::initializer_list<log_arg> args,
+                       char                           precision,
+                       const char*                    bench_func)
+{
+    active = true;
+
+    int        layer = log_layer();
+    log_state& state = logs();
+
+    // Calls without a hipsolver-bench command are written as comments under their
+    // own name, so that the bench log remains a valid script
+    std::string command;
+    if(layer & (log_layer_bench | log_layer_profile))
+    {
+        command = bench_command(func, args, precision, bench_func);
+        if(command.empty())
+            command = "# " + trace_line(func, args);
+    }
+
+    if(layer & log_layer_trace)
+    {
+        std::string                 line = trace_line(func, args);
+        std::lock_guard<std::mutex> lock(state.mutex);
+        std::fprintf(state.trace_file, "%s\n", line.c_str());
+        std::fflush(state.trace_file);
+    }
+
+    if(layer & log_layer_bench)
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+        std::fprintf(state.bench_file, "%s\n", command.c_str());
+        std::fflush(state.bench_file);
+    }
+
+    if(layer & log_layer_profile)
+    {
+        std::lock_guard<std::mutex> lock(state.mutex);
+
+        profile_entry& entry = state.profile[command];
+        entry.calls++;
+
+        // The call is timed with events on the stream of the handle
+        if(handle && hipsolverGetStream(handle, &stream) == HIPSOLVER_STATUS_SUCCESS)
+        {
+            start = state.get_event();
+            stop  = state.get_event();
+            if(start && stop && hipEventRecord(start, stream) == hipSuccess)
+                key = &entry;
+            else
+            {
+                if(start)
+                    state.free_events.push_back(start);
+                if(stop)
+                    state.free_events.push_back(stop);
+            }
+        }
+    }
+}
+
+void api_logger::end()
+{
+    if(!key)
+        return;
+
+    log_state&                  state = logs();
+    std::lock_guard<std::mutex> lock(state.mutex);
+
+    if(hipEventRecord(stop, stream) == hipSuccess)
+        state.pending.push_back({(profile_entry*)key, start, stop});
+    else
+    {
+        state.free_events.push_back(start);
+        state.free_events.push_back(stop);
+    }
+    state.resolve_timings(false);
+}
+
+HIPSOLVER_END_NAMESPACE
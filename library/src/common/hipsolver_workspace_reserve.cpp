@@ -0,0 +1,342 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief hipsolver_workspace_reserve.cpp implements hipsolverReserveWorkspace. The
+ *  required sizes are obtained from hipSOLVER's size_t _bufferSize functions, so it is
+ *  shared by both backends.
+ */
+
+#include "exceptions.hpp"
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+#include "workspace_reserve.hpp"
+
+#include <algorithm>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/******************** WORKSPACE QUERIES ********************/
+template <typename T>
+struct reserve_functions;
+
+template <>
+struct reserve_functions<float>
+{
+    static constexpr auto getrf                 = hipsolverSgetrfExt_bufferSize;
+    static constexpr auto getrf_batched         = hipsolverSgetrfBatchedExt_bufferSize;
+    static constexpr auto getrf_strided_batched = hipsolverSgetrfStridedBatchedExt_bufferSize;
+    static constexpr auto getrs                 = hipsolverSgetrsExt_bufferSize;
+    static constexpr auto getrs_batched         = hipsolverSgetrsBatchedExt_bufferSize;
+    static constexpr auto getrs_strided_batched = hipsolverSgetrsStridedBatchedExt_bufferSize;
+    static constexpr auto potrf                 = hipsolverSpotrfExt_bufferSize;
+    static constexpr auto potrf_batched         = hipsolverSpotrfBatchedExt_bufferSize;
+    static constexpr auto potrs                 = hipsolverSpotrsExt_bufferSize;
+    static constexpr auto potrs_batched         = hipsolverSpotrsBatchedExt_bufferSize;
+    static constexpr auto potri                 = hipsolverSpotriExt_bufferSize;
+    static constexpr auto geqrf                 = hipsolverSgeqrfExt_bufferSize;
+    static constexpr auto gesv                  = hipsolverSSgesvExt_bufferSize;
+    static constexpr auto gels                  = hipsolverSSgelsExt_bufferSize;
+    static constexpr auto gesvd                 = hipsolverSgesvdExt_bufferSize;
+    static constexpr auto syevd                 = hipsolverSsyevdExt_bufferSize;
+    static constexpr auto sygvd                 = hipsolverSsygvdExt_bufferSize;
+    static constexpr auto sytrd                 = hipsolverSsytrdExt_bufferSize;
+    static constexpr auto sytrf                 = hipsolverSsytrfExt_bufferSize;
+};
+
+template <>
+struct reserve_functions<double>
+{
+    static constexpr auto getrf                 = hipsolverDgetrfExt_bufferSize;
+    static constexpr auto getrf_batched         = hipsolverDgetrfBatchedExt_bufferSize;
+    static constexpr auto getrf_strided_batched = hipsolverDgetrfStridedBatchedExt_bufferSize;
+    static constexpr auto getrs                 = hipsolverDgetrsExt_bufferSize;
+    static constexpr auto getrs_batched         = hipsolverDgetrsBatchedExt_bufferSize;
+    static constexpr auto getrs_strided_batched = hipsolverDgetrsStridedBatchedExt_bufferSize;
+    static constexpr auto potrf                 = hipsolverDpotrfExt_bufferSize;
+    static constexpr auto potrf_batched         = hipsolverDpotrfBatchedExt_bufferSize;
+    static constexpr auto potrs                 = hipsolverDpotrsExt_bufferSize;
+    static constexpr auto potrs_batched         = hipsolverDpotrsBatchedExt_bufferSize;
+    static constexpr auto potri                 = hipsolverDpotriExt_bufferSize;
+    static constexpr auto geqrf                 = hipsolverDgeqrfExt_bufferSize;
+    static constexpr auto gesv                  = hipsolverDDgesvExt_bufferSize;
+    static constexpr auto gels                  = hipsolverDDgelsExt_bufferSize;
+    static constexpr auto gesvd                 = hipsolverDgesvdExt_bufferSize;
+    static constexpr auto syevd                 = hipsolverDsyevdExt_bufferSize;
+    static constexpr auto sygvd                 = hipsolverDsygvdExt_bufferSize;
+    static constexpr auto sytrd                 = hipsolverDsytrdExt_bufferSize;
+    static constexpr auto sytrf                 = hipsolverDsytrfExt_bufferSize;
+};
+
+template <>
+struct reserve_functions<hipFloatComplex>
+{
+    static constexpr auto getrf                 = hipsolverCgetrfExt_bufferSize;
+    static constexpr auto getrf_batched         = hipsolverCgetrfBatchedExt_bufferSize;
+    static constexpr auto getrf_strided_batched = hipsolverCgetrfStridedBatchedExt_bufferSize;
+    static constexpr auto getrs                 = hipsolverCgetrsExt_bufferSize;
+    static constexpr auto getrs_batched         = hipsolverCgetrsBatchedExt_bufferSize;
+    static constexpr auto getrs_strided_batched = hipsolverCgetrsStridedBatchedExt_bufferSize;
+    static constexpr auto potrf                 = hipsolverCpotrfExt_bufferSize;
+    static constexpr auto potrf_batched         = hipsolverCpotrfBatchedExt_bufferSize;
+    static constexpr auto potrs                 = hipsolverCpotrsExt_bufferSize;
+    static constexpr auto potrs_batched         = hipsolverCpotrsBatchedExt_bufferSize;
+    static constexpr auto potri                 = hipsolverCpotriExt_bufferSize;
+    static constexpr auto geqrf                 = hipsolverCgeqrfExt_bufferSize;
+    static constexpr auto gesv                  = hipsolverCCgesvExt_bufferSize;
+    static constexpr auto gels                  = hipsolverCCgelsExt_bufferSize;
+    static constexpr auto gesvd                 = hipsolverCgesvdExt_bufferSize;
+    static constexpr auto syevd                 = hipsolverCheevdExt_bufferSize;
+    static constexpr auto sygvd                 = hipsolverChegvdExt_bufferSize;
+    static constexpr auto sytrd                 = hipsolverChetrdExt_bufferSize;
+    static constexpr auto sytrf                 = hipsolverCsytrfExt_bufferSize;
+};
+
+template <>
+struct reserve_functions<hipDoubleComplex>
+{
+    static constexpr auto getrf                 = hipsolverZgetrfExt_bufferSize;
+    static constexpr auto getrf_batched         = hipsolverZgetrfBatchedExt_bufferSize;
+    static constexpr auto getrf_strided_batched = hipsolverZgetrfStridedBatchedExt_bufferSize;
+    static constexpr auto getrs                 = hipsolverZgetrsExt_bufferSize;
+    static constexpr auto getrs_batched         = hipsolverZgetrsBatchedExt_bufferSize;
+    static constexpr auto getrs_strided_batched = hipsolverZgetrsStridedBatchedExt_bufferSize;
+    static constexpr auto potrf                 = hipsolverZpotrfExt_bufferSize;
+    static constexpr auto potrf_batched         = hipsolverZpotrfBatchedExt_bufferSize;
+    static constexpr auto potrs                 = hipsolverZpotrsExt_bufferSize;
+    static constexpr auto potrs_batched         = hipsolverZpotrsBatchedExt_bufferSize;
+    static constexpr auto potri                 = hipsolverZpotriExt_bufferSize;
+    static constexpr auto geqrf                 = hipsolverZgeqrfExt_bufferSize;
+    static constexpr auto gesv                  = hipsolverZZgesvExt_bufferSize;
+    static constexpr auto gels                  = hipsolverZZgelsExt_bufferSize;
+    static constexpr auto gesvd                 = hipsolverZgesvdExt_bufferSize;
+    static constexpr auto syevd                 = hipsolverZheevdExt_bufferSize;
+    static constexpr auto sygvd                 = hipsolverZhegvdExt_bufferSize;
+    static constexpr auto sytrd                 = hipsolverZhetrdExt_bufferSize;
+    static constexpr auto sytrf                 = hipsolverZsytrfExt_bufferSize;
+};
+
+// Returns the workspace size required by op. No matrices are referenced by the
+// _bufferSize functions, so null pointers are passed for all of them. Strided batches
+// are assumed to be packed.
+template <typename T>
+static hipsolverStatus_t op_workspace_size(hipsolverHandle_t             handle,
+                                           const hipsolverWorkspaceOp_t& op,
+                                           size_t*                       size)
+{
+    using F = reserve_functions<T>;
+
+    size_t lwork = 0;
+
+    int strideA = op.lda * op.n;
+    int strideP = op.n;
+    int strideB = op.ldb * op.nrhs;
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GETRF:
+        CHECK_HIPSOLVER_ERROR(F::getrf(handle, op.m, op.n, nullptr, op.lda, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_GETRF_BATCHED:
+        CHECK_HIPSOLVER_ERROR(
+            F::getrf_batched(handle, op.m, op.n, nullptr, op.lda, &lwork, op.batch_count));
+        break;
+    case HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED:
+        CHECK_HIPSOLVER_ERROR(F::getrf_strided_batched(
+            handle, op.m, op.n, nullptr, op.lda, strideA, &lwork, op.batch_count));
+        break;
+    case HIPSOLVER_ROUTINE_GETRS:
+        CHECK_HIPSOLVER_ERROR(F::getrs(
+            handle, op.trans, op.n, op.nrhs, nullptr, op.lda, nullptr, nullptr, op.ldb, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_GETRS_BATCHED:
+        CHECK_HIPSOLVER_ERROR(F::getrs_batched(handle,
+                                               op.trans,
+                                               op.n,
+                                               op.nrhs,
+                                               nullptr,
+                                               op.lda,
+                                               nullptr,
+                                               strideP,
+                                               nullptr,
+                                               op.ldb,
+                                               &lwork,
+                                               op.batch_count));
+        break;
+    case HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED:
+        CHECK_HIPSOLVER_ERROR(F::getrs_strided_batched(handle,
+                                                       op.trans,
+                                                       op.n,
+                                                       op.nrhs,
+                                                       nullptr,
+                                                       op.lda,
+                                                       strideA,
+                                                       nullptr,
+                                                       strideP,
+                                                       nullptr,
+                                                       op.ldb,
+                                                       strideB,
+                                                       &lwork,
+                                                       op.batch_count));
+        break;
+    case HIPSOLVER_ROUTINE_POTRF:
+        CHECK_HIPSOLVER_ERROR(F::potrf(handle, op.uplo, op.n, nullptr, op.lda, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_POTRF_BATCHED:
+        CHECK_HIPSOLVER_ERROR(
+            F::potrf_batched(handle, op.uplo, op.n, nullptr, op.lda, &lwork, op.batch_count));
+        break;
+    case HIPSOLVER_ROUTINE_POTRS:
+        CHECK_HIPSOLVER_ERROR(
+            F::potrs(handle, op.uplo, op.n, op.nrhs, nullptr, op.lda, nullptr, op.ldb, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_POTRS_BATCHED:
+        CHECK_HIPSOLVER_ERROR(F::potrs_batched(handle,
+                                               op.uplo,
+                                               op.n,
+                                               op.nrhs,
+                                               nullptr,
+                                               op.lda,
+                                               nullptr,
+                                               op.ldb,
+                                               &lwork,
+                                               op.batch_count));
+        break;
+    case HIPSOLVER_ROUTINE_POTRI:
+        CHECK_HIPSOLVER_ERROR(F::potri(handle, op.uplo, op.n, nullptr, op.lda, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_GEQRF:
+        CHECK_HIPSOLVER_ERROR(F::geqrf(handle, op.m, op.n, nullptr, op.lda, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_GESV:
+        CHECK_HIPSOLVER_ERROR(F::gesv(handle,
+                                      op.n,
+                                      op.nrhs,
+                                      nullptr,
+                                      op.lda,
+                                      nullptr,
+                                      nullptr,
+                                      op.ldb,
+                                      nullptr,
+                                      op.ldb,
+                                      &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_GELS:
+        CHECK_HIPSOLVER_ERROR(F::gels(handle,
+                                      op.m,
+                                      op.n,
+                                      op.nrhs,
+                                      nullptr,
+                                      op.lda,
+                                      nullptr,
+                                      op.ldb,
+                                      nullptr,
+                                      op.ldb,
+                                      &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_GESVD:
+        CHECK_HIPSOLVER_ERROR(F::gesvd(handle, op.jobu, op.jobv, op.m, op.n, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_SYEVD:
+        CHECK_HIPSOLVER_ERROR(
+            F::syevd(handle, op.jobz, op.uplo, op.n, nullptr, op.lda, nullptr, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_SYGVD:
+        CHECK_HIPSOLVER_ERROR(F::sygvd(handle,
+                                       op.itype,
+                                       op.jobz,
+                                       op.uplo,
+                                       op.n,
+                                       nullptr,
+                                       op.lda,
+                                       nullptr,
+                                       op.ldb,
+                                       nullptr,
+                                       &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_SYTRD:
+        CHECK_HIPSOLVER_ERROR(F::sytrd(
+            handle, op.uplo, op.n, nullptr, op.lda, nullptr, nullptr, nullptr, &lwork));
+        break;
+    case HIPSOLVER_ROUTINE_SYTRF:
+        CHECK_HIPSOLVER_ERROR(F::sytrf(handle, op.n, nullptr, op.lda, &lwork));
+        break;
+    default:
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+
+    *size = lwork;
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+
+static hipsolverStatus_t op_workspace_size(hipsolverHandle_t             handle,
+                                           const hipsolverWorkspaceOp_t& op,
+                                           size_t*                       size)
+{
+    switch(op.precision)
+    {
+    case HIP_R_32F:
+        return op_workspace_size<float>(handle, op, size);
+    case HIP_R_64F:
+        return op_workspace_size<double>(handle, op, size);
+    case HIP_C_32F:
+        return op_workspace_size<hipFloatComplex>(handle, op, size);
+    case HIP_C_64F:
+        return op_workspace_size<hipDoubleComplex>(handle, op, size);
+    default:
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+}
+
+HIPSOLVER_END_NAMESPACE
+
+extern "C" {
+
+hipsolverStatus_t hipsolverReserveWorkspace(hipsolverHandle_t             handle,
+                                            const hipsolverWorkspaceOp_t* ops,
+                                            int                           count)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(count < 0 || (count > 0 && !ops))
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    // All sizes are computed before anything is allocated, so that an invalid
+    // descriptor leaves the workspace unchanged
+    size_t size = 0;
+    for(int i = 0; i < count; i++)
+    {
+        size_t op_size;
+        CHECK_HIPSOLVER_ERROR(hipsolver::op_workspace_size(handle, ops[i], &op_size));
+        size = std::max(size, op_size);
+    }
+
+    return hipsolver::reserve_workspace(handle, size, ops, count);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+} //extern C
@@ -0,0 +1,45 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Autotuning state that hipSOLVER associates with a handle. Shared by both
+ *  backends.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+// Releases the autotuning state associated with the given handle
+void autotune_release(hipsolverHandle_t handle);
+
+// Allocate and free the temporary device memory used while tuning, ordered on the stream
+// of the handle. Defined by each backend: the rocSOLVER side takes the memory from the
+// memory pool of the handle, and the cuSOLVER side uses hipMalloc.
+hipsolverStatus_t autotune_malloc(hipsolverHandle_t handle, void** ptr, size_t size);
+void              autotune_free(hipsolverHandle_t handle, void* ptr);
+
+HIPSOLVER_END_NAMESPACE
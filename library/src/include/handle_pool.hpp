@@ -0,0 +1,94 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Device workspace budget shared by the handles of a hipsolverHandlePool_t.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+#include <atomic>
+#include <memory>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+/*! \brief Upper bound on the device workspace held by a group of handles. A limit of
+ *  zero means that the workspace is only accounted for, not bounded.
+ */
+struct workspace_budget
+{
+    const size_t        limit;
+    std::atomic<size_t> used;
+    std::atomic<size_t> peak_used;
+    std::atomic<size_t> num_failures;
+
+    explicit workspace_budget(size_t limit)
+        : limit(limit)
+        , used(0)
+        , peak_used(0)
+        , num_failures(0)
+    {
+    }
+
+    // Returns false, without reserving anything, if bytes would exceed the limit
+    bool reserve(size_t bytes)
+    {
+        if(try_reserve(bytes))
+            return true;
+
+        num_failures++;
+        return false;
+    }
+
+    // Same as reserve, but a refusal is not counted as a failure, for callers that
+    // can make room and try again
+    bool try_reserve(size_t bytes)
+    {
+        size_t current = used.load();
+        do
+        {
+            if(limit && bytes > limit - current)
+                return false;
+        } while(!used.compare_exchange_weak(current, current + bytes));
+
+        size_t peak = peak_used.load();
+        while(current + bytes > peak && !peak_used.compare_exchange_weak(peak, current + bytes))
+            ;
+        return true;
+    }
+
+    void release(size_t bytes)
+    {
+        used -= bytes;
+    }
+};
+
+// Makes the device workspace managed internally by hipSOLVER for the given handle
+// count against budget. Implemented by each backend.
+hipsolverStatus_t set_workspace_budget(hipsolverHandle_t                 handle,
+                                       std::shared_ptr<workspace_budget> budget);
+
+HIPSOLVER_END_NAMESPACE
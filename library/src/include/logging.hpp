@@ -0,0 +1,268 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Call-level logging of the hipSOLVER API, controlled by the environment
+ *  variable HIPSOLVER_LAYER. Shared by both backends.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+#include <initializer_list>
+#include <stdint.h>
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+// Bits of HIPSOLVER_LAYER
+enum log_layer_mode
+{
+    log_layer_trace   = 1, // log each call with its arguments
+    log_layer_bench   = 2, // log each call as a hipsolver-bench command line
+    log_layer_profile = 4, // report call counts and device time per argument list at exit
+};
+
+// Returns the logging layers enabled by HIPSOLVER_LAYER, read on first use
+int log_layer();
+
+// Waits for the timed calls that are still running and adds their device time to
+// the profile. Called when a handle is destroyed, as no HIP calls are made when the
+// library is unloaded.
+void flush_logs();
+
+// Counts a call to func in the statistics of the handle. Defined by each backend.
+void record_call(hipsolverHandle_t handle, const char* func);
+
+// Depth of nested API calls on the current thread
+inline int& api_call_depth()
+{
+    static thread_local int depth = 0;
+    return depth;
+}
+
+// A named scalar argument of a logged call
+struct log_arg
+{
+    enum class kind
+    {
+        integer,
+        real,
+        character,
+        fill,
+        evect,
+        operation,
+        side,
+        erange,
+        eig_type,
+        diag,
+    };
+
+    const char* name;
+    kind        type;
+    int64_t     ivalue;
+    double      rvalue;
+
+    log_arg(const char* name, int value)
+        : name(name)
+        , type(kind::integer)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, int64_t value)
+        : name(name)
+        , type(kind::integer)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, size_t value)
+        : name(name)
+        , type(kind::integer)
+        , ivalue(int64_t(value))
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, double value)
+        : name(name)
+        , type(kind::real)
+        , ivalue(0)
+        , rvalue(value)
+    {
+    }
+    log_arg(const char* name, float value)
+        : log_arg(name, double(value))
+    {
+    }
+    log_arg(const char* name, signed char value)
+        : name(name)
+        , type(kind::character)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, hipsolverFillMode_t value)
+        : name(name)
+        , type(kind::fill)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, hipsolverEigMode_t value)
+        : name(name)
+        , type(kind::evect)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, hipsolverOperation_t value)
+        : name(name)
+        , type(kind::operation)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, hipsolverSideMode_t value)
+        : name(name)
+        , type(kind::side)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, hipsolverEigRange_t value)
+        : name(name)
+        , type(kind::erange)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, hipsolverEigType_t value)
+        : name(name)
+        , type(kind::eig_type)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+    log_arg(const char* name, hipblasDiagType_t value)
+        : name(name)
+        , type(kind::diag)
+        , ivalue(value)
+        , rvalue(0)
+    {
+    }
+};
+
+// Returns the hipsolver-bench precision of a data type, or 0 if it has none
+inline char log_precision(hipDataType type)
+{
+    switch(type)
+    {
+    case HIP_R_32F:
+        return 's';
+    case HIP_R_64F:
+        return 'd';
+    case HIP_C_32F:
+        return 'c';
+    case HIP_C_64F:
+        return 'z';
+    default:
+        return 0;
+    }
+}
+
+// Returns the real scalar of the given data type pointed to by value, or 0 if value is
+// null or the type is not real
+inline double log_real(hipDataType type, const void* value)
+{
+    if(!value)
+        return 0;
+    if(type == HIP_R_32F)
+        return *(const float*)value;
+    if(type == HIP_R_64F)
+        return *(const double*)value;
+    return 0;
+}
+
+/*! \brief Logs an API call for the lifetime of the object. Only the outermost call
+ *  made by a thread is logged and counted in the statistics of the handle, so that
+ *  functions implemented on top of other API functions are reported once. When
+ *  HIPSOLVER_LAYER is unset, logging only checks a cached flag.
+ *
+ *  The hipsolver-bench command of the call is derived from the name of func. Functions
+ *  whose name does not give the precision pass it in precision, and functions that run
+ *  another routine pass the hipsolver-bench name of that routine in bench_func. Functions
+ *  that hipsolver-bench cannot run pass an empty bench_func, and are written to the bench
+ *  log as comments.
+ */
+class api_logger
+{
+public:
+    api_logger(hipsolverHandle_t              handle,
+               const char*                    func,
+               std::initializer_list<log_arg> args,
+               char                           precision  = 0,
+               const char*                    bench_func = nullptr)
+        : active(false)
+        , stream(nullptr)
+        , start(nullptr)
+        , stop(nullptr)
+        , key(nullptr)
+    {
+        if(api_call_depth() == 0)
+        {
+            if(handle)
+                record_call(handle, func);
+            if(log_layer())
+                begin(handle, func, args, precision, bench_func);
+        }
+        api_call_depth()++;
+    }
+
+    ~api_logger()
+    {
+        api_call_depth()--;
+        if(active)
+            end();
+    }
+
+    api_logger(const api_logger&) = delete;
+    api_logger& operator=(const api_logger&) = delete;
+
+private:
+    bool        active;
+    hipStream_t stream;
+    hipEvent_t  start;
+    hipEvent_t  stop;
+    const void* key;
+
+    void begin(hipsolverHandle_t              handle,
+               const char*                    func,
+               std::initializer_list<log_arg> args,
+               char                           precision,
+               const char*                    bench_func);
+    void end();
+};
+
+HIPSOLVER_END_NAMESPACE
@@ -24,21 +24,51 @@
 #pragma once
 
 #include "hipsolver.h"
+#include "lib_macros.hpp"
 
 #include "rocblas/rocblas.h"
 #include "rocsolver/rocsolver.h"
 
+HIPSOLVER_BEGIN_NAMESPACE
+
+// Defined in hipsolver_handle.cpp
+rocblas_status workspace_budget_charge(rocblas_handle handle, size_t size);
+void           workspace_grow_record(rocblas_handle handle, size_t size);
+rocblas_status workspace_plan_bind(rocblas_handle handle,
+                                   const void*    plan,
+                                   void*          work,
+                                   size_t         size);
+rocblas_status workspace_plan_restore(rocblas_handle handle, const void* plan);
+
+HIPSOLVER_END_NAMESPACE
+
 inline rocblas_status hipsolverManageWorkspace(rocblas_handle handle, size_t new_size)
 {
     if(new_size < 0)
         return rocblas_status_memory_error;
 
+    // The workspace of a plan executed on the handle is not used by other functions
+    rocblas_status restored = hipsolver::workspace_plan_restore(handle, nullptr);
+    if(restored != rocblas_status_success)
+        return restored;
+
     size_t current_size = 0;
     if(rocblas_is_user_managing_device_memory(handle))
         rocblas_get_device_memory_size(handle, &current_size);
 
     if(new_size > current_size)
-        return rocblas_set_device_memory_size(handle, new_size);
+    {
+        rocblas_status status = hipsolver::workspace_budget_charge(handle, new_size);
+        if(status != rocblas_status_success)
+            return status;
+
+        status = rocblas_set_device_memory_size(handle, new_size);
+        if(status != rocblas_status_success)
+            hipsolver::workspace_budget_charge(handle, current_size);
+        else
+            hipsolver::workspace_grow_record(handle, new_size);
+        return status;
+    }
     else
         return rocblas_status_success;
 }
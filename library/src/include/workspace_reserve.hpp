@@ -0,0 +1,44 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Up-front reservation of the device workspace managed internally by
+ *  hipSOLVER. Shared by both backends.
+ */
+
+#pragma once
+
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+HIPSOLVER_BEGIN_NAMESPACE
+
+// Grows the device workspace that hipSOLVER manages for the given handle to at least
+// size, in the units returned by the _bufferSize functions, along with any other memory
+// that the count operations in ops allocate on first use. Implemented by each backend.
+hipsolverStatus_t reserve_workspace(hipsolverHandle_t             handle,
+                                    size_t                        size,
+                                    const hipsolverWorkspaceOp_t* ops,
+                                    int                           count);
+
+HIPSOLVER_END_NAMESPACE
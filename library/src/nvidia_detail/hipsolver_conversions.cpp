@@ -111,6 +111,19 @@ hipsolverSideMode_t cuda2hip_side(cublasSideMode_t side)
     }
 }
 
+cublasDiagType_t hip2cuda_diag(hipblasDiagType_t diag)
+{
+    switch(diag)
+    {
+    case HIPBLAS_DIAG_NON_UNIT:
+        return CUBLAS_DIAG_NON_UNIT;
+    case HIPBLAS_DIAG_UNIT:
+        return CUBLAS_DIAG_UNIT;
+    default:
+        throw HIPSOLVER_STATUS_INVALID_ENUM;
+    }
+}
+
 cusolverEigMode_t hip2cuda_evect(hipsolverEigMode_t eig)
 {
     switch(eig)
@@ -42,6 +42,8 @@ cublasSideMode_t hip2cuda_side(hipsolverSideMode_t side);
 
 hipsolverSideMode_t cuda2hip_side(cublasSideMode_t side);
 
+cublasDiagType_t hip2cuda_diag(hipblasDiagType_t diag);
+
 cusolverEigMode_t hip2cuda_evect(hipsolverEigMode_t eig);
 
 hipsolverEigMode_t cuda2hip_evect(cusolverEigMode_t eig);
@@ -26,7 +26,9 @@
  *  to hipSOLVER on the cuSOLVER side.
  */
 
+#include "exceptions.hpp"
 #include "hipsolver.h"
+#include "logging.hpp"
 
 extern "C" {
 
@@ -60,9 +62,16 @@ hipsolverStatus_t hipsolverDnSgetrf(hipsolverHandle_t handle,
                                     float*            work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     return hipsolverSgetrf(handle, m, n, A, lda, work, 0, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnDgetrf(hipsolverHandle_t handle,
                                     int               m,
@@ -72,9 +81,16 @@ hipsolverStatus_t hipsolverDnDgetrf(hipsolverHandle_t handle,
                                     double*           work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     return hipsolverDgetrf(handle, m, n, A, lda, work, 0, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnCgetrf(hipsolverHandle_t handle,
                                     int               m,
@@ -84,9 +100,16 @@ hipsolverStatus_t hipsolverDnCgetrf(hipsolverHandle_t handle,
                                     hipFloatComplex*  work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     return hipsolverCgetrf(handle, m, n, A, lda, work, 0, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 hipsolverStatus_t hipsolverDnZgetrf(hipsolverHandle_t handle,
                                     int               m,
@@ -96,8 +119,15 @@ hipsolverStatus_t hipsolverDnZgetrf(hipsolverHandle_t handle,
                                     hipDoubleComplex* work,
                                     int*              devIpiv,
                                     int*              devInfo)
+try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"m", m}, {"n", n}, {"lda", lda}});
+
     return hipsolverZgetrf(handle, m, n, A, lda, work, 0, devIpiv, devInfo);
 }
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 
 } //extern C
@@ -29,6 +29,7 @@
 #include "exceptions.hpp"
 #include "hipsolver.h"
 #include "hipsolver_conversions.hpp"
+#include "logging.hpp"
 
 #include <cusolverDn.h>
 
@@ -68,6 +69,10 @@ try
     if(!params)
         return HIPSOLVER_STATUS_INVALID_VALUE;
 
+    // the hipSOLVER extension functions have no cuSOLVER equivalent
+    if(func >= HIPSOLVERDN_EXT_SYEVD && func <= HIPSOLVERDN_EXT_GEQRF)
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+
     return hipsolver::cuda2hip_status(cusolverDnSetAdvOptions((cusolverDnParams_t)params,
                                                               hipsolver::hip2cuda_function(func),
                                                               hipsolver::hip2cuda_algmode(alg)));
@@ -132,6 +137,12 @@ hipsolverStatus_t hipsolverDnXgeqrf(hipsolverDnHandle_t handle,
                                     int*                devInfo)
 try
 {
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"m", m}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "geqrf_64");
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -208,6 +219,12 @@ hipsolverStatus_t hipsolverDnXgetrf(hipsolverDnHandle_t handle,
                                     int*                devInfo)
 try
 {
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"m", m}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "getrf_64");
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -249,6 +266,16 @@ hipsolverStatus_t hipsolverDnXgetrs(hipsolverDnHandle_t  handle,
                                     int*                 devInfo)
 try
 {
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"trans", trans},
+                                  {"n", n},
+                                  {"nrhs", nrhs},
+                                  {"lda", lda},
+                                  {"ldb", ldb}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "getrs_64");
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -322,6 +349,8 @@ hipsolverStatus_t hipsolverDnXpotrf(hipsolverDnHandle_t handle,
                                     int*                info)
 try
 {
+    hipsolver::api_logger logger(handle, __func__, {{"uplo", uplo}, {"n", n}, {"lda", lda}});
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -361,6 +390,9 @@ hipsolverStatus_t hipsolverDnXpotrs(hipsolverDnHandle_t handle,
                                     int*                info)
 try
 {
+    hipsolver::api_logger logger(
+        handle, __func__, {{"uplo", uplo}, {"n", n}, {"nrhs", nrhs}, {"lda", lda}, {"ldb", ldb}});
+
     if(!handle)
         return HIPSOLVER_STATUS_NOT_INITIALIZED;
     if(!params)
@@ -383,4 +415,648 @@ catch(...)
 {
     return hipsolver::exception2hip_status();
 }
+
+/******************** SYEVD ********************/
+hipsolverStatus_t hipsolverDnXsyevd_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               hipsolverEigMode_t  jobz,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeW,
+                                               const void*         W,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsyevd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  (cusolverDnParams_t)params,
+                                                                  hipsolver::hip2cuda_evect(jobz),
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  dataTypeW,
+                                                                  W,
+                                                                  computeType,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevd(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    hipsolverEigMode_t  jobz,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeW,
+                                    void*               W,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz}, {"uplo", uplo}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 dataTypeA == HIP_C_32F || dataTypeA == HIP_C_64F ? "heevd_64"
+                                                                                  : "syevd_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsyevd((cusolverDnHandle_t)handle,
+                                                       (cusolverDnParams_t)params,
+                                                       hipsolver::hip2cuda_evect(jobz),
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       dataTypeW,
+                                                       W,
+                                                       computeType,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYEVDX ********************/
+hipsolverStatus_t hipsolverDnXsyevdx_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                hipsolverEigMode_t  jobz,
+                                                hipsolverEigRange_t range,
+                                                hipsolverFillMode_t uplo,
+                                                int64_t             n,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                void*               vl,
+                                                void*               vu,
+                                                int64_t             il,
+                                                int64_t             iu,
+                                                int64_t*            nev,
+                                                hipDataType         dataTypeW,
+                                                const void*         W,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(
+        cusolverDnXsyevdx_bufferSize((cusolverDnHandle_t)handle,
+                                     (cusolverDnParams_t)params,
+                                     hipsolver::hip2cuda_evect(jobz),
+                                     hipsolver::hip2cuda_erange(range),
+                                     hipsolver::hip2cuda_fill(uplo),
+                                     n,
+                                     dataTypeA,
+                                     A,
+                                     lda,
+                                     vl,
+                                     vu,
+                                     il,
+                                     iu,
+                                     nev,
+                                     dataTypeW,
+                                     W,
+                                     computeType,
+                                     lworkOnDevice,
+                                     lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsyevdx(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     hipsolverEigMode_t  jobz,
+                                     hipsolverEigRange_t range,
+                                     hipsolverFillMode_t uplo,
+                                     int64_t             n,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     void*               vl,
+                                     void*               vu,
+                                     int64_t             il,
+                                     int64_t             iu,
+                                     int64_t*            nev,
+                                     hipDataType         dataTypeW,
+                                     void*               W,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobz", jobz},
+                                  {"range", range},
+                                  {"uplo", uplo},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"vl", hipsolver::log_real(dataTypeW, vl)},
+                                  {"vu", hipsolver::log_real(dataTypeW, vu)},
+                                  {"il", il},
+                                  {"iu", iu}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 dataTypeA == HIP_C_32F || dataTypeA == HIP_C_64F ? "heevdx_64"
+                                                                                  : "syevdx_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsyevdx((cusolverDnHandle_t)handle,
+                                                        (cusolverDnParams_t)params,
+                                                        hipsolver::hip2cuda_evect(jobz),
+                                                        hipsolver::hip2cuda_erange(range),
+                                                        hipsolver::hip2cuda_fill(uplo),
+                                                        n,
+                                                        dataTypeA,
+                                                        A,
+                                                        lda,
+                                                        vl,
+                                                        vu,
+                                                        il,
+                                                        iu,
+                                                        nev,
+                                                        dataTypeW,
+                                                        W,
+                                                        computeType,
+                                                        workOnDevice,
+                                                        lworkOnDevice,
+                                                        workOnHost,
+                                                        lworkOnHost,
+                                                        info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVD ********************/
+hipsolverStatus_t hipsolverDnXgesvd_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverDnParams_t params,
+                                               signed char         jobu,
+                                               signed char         jobv,
+                                               int64_t             m,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               hipDataType         dataTypeS,
+                                               const void*         S,
+                                               hipDataType         dataTypeU,
+                                               const void*         U,
+                                               int64_t             ldu,
+                                               hipDataType         dataTypeV,
+                                               const void*         V,
+                                               int64_t             ldv,
+                                               hipDataType         computeType,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvd_bufferSize((cusolverDnHandle_t)handle,
+                                                                  (cusolverDnParams_t)params,
+                                                                  jobu,
+                                                                  jobv,
+                                                                  m,
+                                                                  n,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  dataTypeS,
+                                                                  S,
+                                                                  dataTypeU,
+                                                                  U,
+                                                                  ldu,
+                                                                  dataTypeV,
+                                                                  V,
+                                                                  ldv,
+                                                                  computeType,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvd(hipsolverDnHandle_t handle,
+                                    hipsolverDnParams_t params,
+                                    signed char         jobu,
+                                    signed char         jobv,
+                                    int64_t             m,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    hipDataType         dataTypeS,
+                                    void*               S,
+                                    hipDataType         dataTypeU,
+                                    void*               U,
+                                    int64_t             ldu,
+                                    hipDataType         dataTypeV,
+                                    void*               V,
+                                    int64_t             ldv,
+                                    hipDataType         computeType,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobu", jobu},
+                                  {"jobv", jobv},
+                                  {"m", m},
+                                  {"n", n},
+                                  {"lda", lda},
+                                  {"ldu", ldu},
+                                  {"ldv", ldv}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "gesvd_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvd((cusolverDnHandle_t)handle,
+                                                       (cusolverDnParams_t)params,
+                                                       jobu,
+                                                       jobv,
+                                                       m,
+                                                       n,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       dataTypeS,
+                                                       S,
+                                                       dataTypeU,
+                                                       U,
+                                                       ldu,
+                                                       dataTypeV,
+                                                       V,
+                                                       ldv,
+                                                       computeType,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** SYTRS ********************/
+hipsolverStatus_t hipsolverDnXsytrs_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               int64_t             n,
+                                               int64_t             nrhs,
+                                               hipDataType         dataTypeA,
+                                               const void*         A,
+                                               int64_t             lda,
+                                               const int64_t*      ipiv,
+                                               hipDataType         dataTypeB,
+                                               void*               B,
+                                               int64_t             ldb,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsytrs_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  n,
+                                                                  nrhs,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  ipiv,
+                                                                  dataTypeB,
+                                                                  B,
+                                                                  ldb,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXsytrs(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    int64_t             n,
+                                    int64_t             nrhs,
+                                    hipDataType         dataTypeA,
+                                    const void*         A,
+                                    int64_t             lda,
+                                    const int64_t*      ipiv,
+                                    hipDataType         dataTypeB,
+                                    void*               B,
+                                    int64_t             ldb,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"uplo", uplo},
+                                  {"n", n},
+                                  {"nrhs", nrhs},
+                                  {"lda", lda},
+                                  {"ldb", ldb}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "sytrs_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXsytrs((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       n,
+                                                       nrhs,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       ipiv,
+                                                       dataTypeB,
+                                                       B,
+                                                       ldb,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** TRTRI ********************/
+hipsolverStatus_t hipsolverDnXtrtri_bufferSize(hipsolverDnHandle_t handle,
+                                               hipsolverFillMode_t uplo,
+                                               hipblasDiagType_t   diag,
+                                               int64_t             n,
+                                               hipDataType         dataTypeA,
+                                               void*               A,
+                                               int64_t             lda,
+                                               size_t*             lworkOnDevice,
+                                               size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXtrtri_bufferSize((cusolverDnHandle_t)handle,
+                                                                  hipsolver::hip2cuda_fill(uplo),
+                                                                  hipsolver::hip2cuda_diag(diag),
+                                                                  n,
+                                                                  dataTypeA,
+                                                                  A,
+                                                                  lda,
+                                                                  lworkOnDevice,
+                                                                  lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXtrtri(hipsolverDnHandle_t handle,
+                                    hipsolverFillMode_t uplo,
+                                    hipblasDiagType_t   diag,
+                                    int64_t             n,
+                                    hipDataType         dataTypeA,
+                                    void*               A,
+                                    int64_t             lda,
+                                    void*               workOnDevice,
+                                    size_t              lworkOnDevice,
+                                    void*               workOnHost,
+                                    size_t              lworkOnHost,
+                                    int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"uplo", uplo}, {"diag", diag}, {"n", n}, {"lda", lda}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "trtri_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+
+    return hipsolver::cuda2hip_status(cusolverDnXtrtri((cusolverDnHandle_t)handle,
+                                                       hipsolver::hip2cuda_fill(uplo),
+                                                       hipsolver::hip2cuda_diag(diag),
+                                                       n,
+                                                       dataTypeA,
+                                                       A,
+                                                       lda,
+                                                       workOnDevice,
+                                                       lworkOnDevice,
+                                                       workOnHost,
+                                                       lworkOnHost,
+                                                       info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+/******************** GESVDR ********************/
+hipsolverStatus_t hipsolverDnXgesvdr_bufferSize(hipsolverDnHandle_t handle,
+                                                hipsolverDnParams_t params,
+                                                signed char         jobu,
+                                                signed char         jobv,
+                                                int64_t             m,
+                                                int64_t             n,
+                                                int64_t             k,
+                                                int64_t             p,
+                                                int64_t             niters,
+                                                hipDataType         dataTypeA,
+                                                const void*         A,
+                                                int64_t             lda,
+                                                hipDataType         dataTypeSrand,
+                                                const void*         Srand,
+                                                hipDataType         dataTypeUrand,
+                                                const void*         Urand,
+                                                int64_t             ldUrand,
+                                                hipDataType         dataTypeVrand,
+                                                const void*         Vrand,
+                                                int64_t             ldVrand,
+                                                hipDataType         computeType,
+                                                size_t*             lworkOnDevice,
+                                                size_t*             lworkOnHost)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdr_bufferSize((cusolverDnHandle_t)handle,
+                                                                   (cusolverDnParams_t)params,
+                                                                   jobu,
+                                                                   jobv,
+                                                                   m,
+                                                                   n,
+                                                                   k,
+                                                                   p,
+                                                                   niters,
+                                                                   dataTypeA,
+                                                                   A,
+                                                                   lda,
+                                                                   dataTypeSrand,
+                                                                   Srand,
+                                                                   dataTypeUrand,
+                                                                   Urand,
+                                                                   ldUrand,
+                                                                   dataTypeVrand,
+                                                                   Vrand,
+                                                                   ldVrand,
+                                                                   computeType,
+                                                                   lworkOnDevice,
+                                                                   lworkOnHost));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnXgesvdr(hipsolverDnHandle_t handle,
+                                     hipsolverDnParams_t params,
+                                     signed char         jobu,
+                                     signed char         jobv,
+                                     int64_t             m,
+                                     int64_t             n,
+                                     int64_t             k,
+                                     int64_t             p,
+                                     int64_t             niters,
+                                     hipDataType         dataTypeA,
+                                     void*               A,
+                                     int64_t             lda,
+                                     hipDataType         dataTypeSrand,
+                                     void*               Srand,
+                                     hipDataType         dataTypeUrand,
+                                     void*               Urand,
+                                     int64_t             ldUrand,
+                                     hipDataType         dataTypeVrand,
+                                     void*               Vrand,
+                                     int64_t             ldVrand,
+                                     hipDataType         computeType,
+                                     void*               workOnDevice,
+                                     size_t              lworkOnDevice,
+                                     void*               workOnHost,
+                                     size_t              lworkOnHost,
+                                     int*                info)
+try
+{
+    hipsolver::api_logger logger(handle,
+                                 __func__,
+                                 {{"jobu", jobu},
+                                  {"jobv", jobv},
+                                  {"m", m},
+                                  {"n", n},
+                                  {"rank", k},
+                                  {"p", p},
+                                  {"niters", niters},
+                                  {"lda", lda},
+                                  {"ldu", ldUrand},
+                                  {"ldv", ldVrand}},
+                                 hipsolver::log_precision(dataTypeA),
+                                 "gesvdr_64");
+
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!params)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    return hipsolver::cuda2hip_status(cusolverDnXgesvdr((cusolverDnHandle_t)handle,
+                                                        (cusolverDnParams_t)params,
+                                                        jobu,
+                                                        jobv,
+                                                        m,
+                                                        n,
+                                                        k,
+                                                        p,
+                                                        niters,
+                                                        dataTypeA,
+                                                        A,
+                                                        lda,
+                                                        dataTypeSrand,
+                                                        Srand,
+                                                        dataTypeUrand,
+                                                        Urand,
+                                                        ldUrand,
+                                                        dataTypeVrand,
+                                                        Vrand,
+                                                        ldVrand,
+                                                        computeType,
+                                                        workOnDevice,
+                                                        lworkOnDevice,
+                                                        workOnHost,
+                                                        lworkOnHost,
+                                                        info));
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
 } //extern C
@@ -0,0 +1,408 @@
+/* ************************************************************************
+ * Copyright (C) 2024 Advanced Micro Devices, Inc. All rights reserved.
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell cop-
+ * ies of the Software, and to permit persons to whom the Software is furnished
+ * to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all
+ * copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IM-
+ * PLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+ * FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+ * IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNE-
+ * CTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ *
+ *
+ * ************************************************************************ */
+
+/*! \file
+ *  \brief Implementation of the dense solver plans on the cuSOLVER side. The workspace
+ *  size is queried and the workspace allocated when the plan is created, so that
+ *  executing the plan skips the query and passes the workspace to cuSOLVER.
+ */
+
+#include "exceptions.hpp"
+#include "hipsolver.h"
+#include "lib_macros.hpp"
+
+#include <algorithm>
+#include <memory>
+
+/******************** PLAN FUNCTIONS ********************/
+template <typename T>
+struct plan_functions;
+
+template <>
+struct plan_functions<float>
+{
+    using S = float;
+
+    static constexpr auto getrf_bufferSize = hipsolverSgetrf_bufferSize;
+    static constexpr auto getrf_strided_batched_bufferSize
+        = hipsolverSgetrfStridedBatched_bufferSize;
+    static constexpr auto getrs_bufferSize = hipsolverSgetrs_bufferSize;
+    static constexpr auto getrs_strided_batched_bufferSize
+        = hipsolverSgetrsStridedBatched_bufferSize;
+    static constexpr auto potrf_bufferSize = hipsolverSpotrf_bufferSize;
+    static constexpr auto potrs_bufferSize = hipsolverSpotrs_bufferSize;
+    static constexpr auto geqrf_bufferSize = hipsolverSgeqrf_bufferSize;
+    static constexpr auto syevd_bufferSize = hipsolverSsyevd_bufferSize;
+
+    static constexpr auto getrf                 = hipsolverSgetrf;
+    static constexpr auto getrf_strided_batched = hipsolverSgetrfStridedBatched;
+    static constexpr auto getrs                 = hipsolverSgetrs;
+    static constexpr auto getrs_strided_batched = hipsolverSgetrsStridedBatched;
+    static constexpr auto potrf                 = hipsolverSpotrf;
+    static constexpr auto potrs                 = hipsolverSpotrs;
+    static constexpr auto geqrf                 = hipsolverSgeqrf;
+    static constexpr auto syevd                 = hipsolverSsyevd;
+};
+
+template <>
+struct plan_functions<double>
+{
+    using S = double;
+
+    static constexpr auto getrf_bufferSize = hipsolverDgetrf_bufferSize;
+    static constexpr auto getrf_strided_batched_bufferSize
+        = hipsolverDgetrfStridedBatched_bufferSize;
+    static constexpr auto getrs_bufferSize = hipsolverDgetrs_bufferSize;
+    static constexpr auto getrs_strided_batched_bufferSize
+        = hipsolverDgetrsStridedBatched_bufferSize;
+    static constexpr auto potrf_bufferSize = hipsolverDpotrf_bufferSize;
+    static constexpr auto potrs_bufferSize = hipsolverDpotrs_bufferSize;
+    static constexpr auto geqrf_bufferSize = hipsolverDgeqrf_bufferSize;
+    static constexpr auto syevd_bufferSize = hipsolverDsyevd_bufferSize;
+
+    static constexpr auto getrf                 = hipsolverDgetrf;
+    static constexpr auto getrf_strided_batched = hipsolverDgetrfStridedBatched;
+    static constexpr auto getrs                 = hipsolverDgetrs;
+    static constexpr auto getrs_strided_batched = hipsolverDgetrsStridedBatched;
+    static constexpr auto potrf                 = hipsolverDpotrf;
+    static constexpr auto potrs                 = hipsolverDpotrs;
+    static constexpr auto geqrf                 = hipsolverDgeqrf;
+    static constexpr auto syevd                 = hipsolverDsyevd;
+};
+
+template <>
+struct plan_functions<hipFloatComplex>
+{
+    using S = float;
+
+    static constexpr auto getrf_bufferSize = hipsolverCgetrf_bufferSize;
+    static constexpr auto getrf_strided_batched_bufferSize
+        = hipsolverCgetrfStridedBatched_bufferSize;
+    static constexpr auto getrs_bufferSize = hipsolverCgetrs_bufferSize;
+    static constexpr auto getrs_strided_batched_bufferSize
+        = hipsolverCgetrsStridedBatched_bufferSize;
+    static constexpr auto potrf_bufferSize = hipsolverCpotrf_bufferSize;
+    static constexpr auto potrs_bufferSize = hipsolverCpotrs_bufferSize;
+    static constexpr auto geqrf_bufferSize = hipsolverCgeqrf_bufferSize;
+    static constexpr auto syevd_bufferSize = hipsolverCheevd_bufferSize;
+
+    static constexpr auto getrf                 = hipsolverCgetrf;
+    static constexpr auto getrf_strided_batched = hipsolverCgetrfStridedBatched;
+    static constexpr auto getrs                 = hipsolverCgetrs;
+    static constexpr auto getrs_strided_batched = hipsolverCgetrsStridedBatched;
+    static constexpr auto potrf                 = hipsolverCpotrf;
+    static constexpr auto potrs                 = hipsolverCpotrs;
+    static constexpr auto geqrf                 = hipsolverCgeqrf;
+    static constexpr auto syevd                 = hipsolverCheevd;
+};
+
+template <>
+struct plan_functions<hipDoubleComplex>
+{
+    using S = double;
+
+    static constexpr auto getrf_bufferSize = hipsolverZgetrf_bufferSize;
+    static constexpr auto getrf_strided_batched_bufferSize
+        = hipsolverZgetrfStridedBatched_bufferSize;
+    static constexpr auto getrs_bufferSize = hipsolverZgetrs_bufferSize;
+    static constexpr auto getrs_strided_batched_bufferSize
+        = hipsolverZgetrsStridedBatched_bufferSize;
+    static constexpr auto potrf_bufferSize = hipsolverZpotrf_bufferSize;
+    static constexpr auto potrs_bufferSize = hipsolverZpotrs_bufferSize;
+    static constexpr auto geqrf_bufferSize = hipsolverZgeqrf_bufferSize;
+    static constexpr auto syevd_bufferSize = hipsolverZheevd_bufferSize;
+
+    static constexpr auto getrf                 = hipsolverZgetrf;
+    static constexpr auto getrf_strided_batched = hipsolverZgetrfStridedBatched;
+    static constexpr auto getrs                 = hipsolverZgetrs;
+    static constexpr auto getrs_strided_batched = hipsolverZgetrsStridedBatched;
+    static constexpr auto potrf                 = hipsolverZpotrf;
+    static constexpr auto potrs                 = hipsolverZpotrs;
+    static constexpr auto geqrf                 = hipsolverZgeqrf;
+    static constexpr auto syevd                 = hipsolverZheevd;
+};
+
+/******************** PLAN ********************/
+struct hipsolverPlan;
+
+typedef hipsolverStatus_t (*plan_launch_t)(
+    const hipsolverPlan& plan, void* A, void* B, void* C, int* ipiv, int* info);
+
+struct hipsolverPlan
+{
+    hipsolverHandle_t      handle;
+    hipsolverWorkspaceOp_t desc;
+    plan_launch_t          launch;
+
+    // Strided batches are packed
+    int strideA, strideP, strideB;
+
+    // Device workspace
+    int   lwork;
+    void* work;
+
+    // Constructor
+    explicit hipsolverPlan()
+        : handle(nullptr)
+        , launch(nullptr)
+        , strideA(0)
+        , strideP(0)
+        , strideB(0)
+        , lwork(0)
+        , work(nullptr)
+    {
+    }
+
+    // Destructor
+    ~hipsolverPlan()
+    {
+        if(work)
+            (void)hipFree(work);
+    }
+};
+
+// Returns the workspace size of the planned routine in elements of type T
+template <typename T>
+static hipsolverStatus_t plan_workspace_size(const hipsolverPlan& plan, int* lwork)
+{
+    using F = plan_functions<T>;
+
+    const hipsolverWorkspaceOp_t& op = plan.desc;
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GETRF:
+        return F::getrf_bufferSize(plan.handle, op.m, op.n, nullptr, op.lda, lwork);
+    case HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED:
+        return F::getrf_strided_batched_bufferSize(
+            plan.handle, op.m, op.n, nullptr, op.lda, plan.strideA, lwork, op.batch_count);
+    case HIPSOLVER_ROUTINE_GETRS:
+        return F::getrs_bufferSize(
+            plan.handle, op.trans, op.n, op.nrhs, nullptr, op.lda, nullptr, nullptr, op.ldb, lwork);
+    case HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED:
+        return F::getrs_strided_batched_bufferSize(plan.handle,
+                                                   op.trans,
+                                                   op.n,
+                                                   op.nrhs,
+                                                   nullptr,
+                                                   op.lda,
+                                                   plan.strideA,
+                                                   nullptr,
+                                                   plan.strideP,
+                                                   nullptr,
+                                                   op.ldb,
+                                                   plan.strideB,
+                                                   lwork,
+                                                   op.batch_count);
+    case HIPSOLVER_ROUTINE_POTRF:
+        return F::potrf_bufferSize(plan.handle, op.uplo, op.n, nullptr, op.lda, lwork);
+    case HIPSOLVER_ROUTINE_POTRS:
+        return F::potrs_bufferSize(
+            plan.handle, op.uplo, op.n, op.nrhs, nullptr, op.lda, nullptr, op.ldb, lwork);
+    case HIPSOLVER_ROUTINE_GEQRF:
+        return F::geqrf_bufferSize(plan.handle, op.m, op.n, nullptr, op.lda, lwork);
+    case HIPSOLVER_ROUTINE_SYEVD:
+        return F::syevd_bufferSize(
+            plan.handle, op.jobz, op.uplo, op.n, nullptr, op.lda, nullptr, lwork);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+template <typename T>
+static hipsolverStatus_t
+    plan_launch(const hipsolverPlan& plan, void* A, void* B, void* C, int* ipiv, int* info)
+{
+    using F = plan_functions<T>;
+    using S = typename F::S;
+
+    const hipsolverWorkspaceOp_t& op   = plan.desc;
+    T*                            work = (T*)plan.work;
+
+    switch(op.routine)
+    {
+    case HIPSOLVER_ROUTINE_GETRF:
+        return F::getrf(plan.handle, op.m, op.n, (T*)A, op.lda, work, plan.lwork, ipiv, info);
+    case HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED:
+        return F::getrf_strided_batched(plan.handle,
+                                        op.m,
+                                        op.n,
+                                        (T*)A,
+                                        op.lda,
+                                        plan.strideA,
+                                        work,
+                                        plan.lwork,
+                                        ipiv,
+                                        plan.strideP,
+                                        info,
+                                        op.batch_count);
+    case HIPSOLVER_ROUTINE_GETRS:
+        return F::getrs(plan.handle,
+                        op.trans,
+                        op.n,
+                        op.nrhs,
+                        (T*)A,
+                        op.lda,
+                        ipiv,
+                        (T*)B,
+                        op.ldb,
+                        work,
+                        plan.lwork,
+                        info);
+    case HIPSOLVER_ROUTINE_GETRS_STRIDED_BATCHED:
+        return F::getrs_strided_batched(plan.handle,
+                                        op.trans,
+                                        op.n,
+                                        op.nrhs,
+                                        (T*)A,
+                                        op.lda,
+                                        plan.strideA,
+                                        ipiv,
+                                        plan.strideP,
+                                        (T*)B,
+                                        op.ldb,
+                                        plan.strideB,
+                                        work,
+                                        plan.lwork,
+                                        info,
+                                        op.batch_count);
+    case HIPSOLVER_ROUTINE_POTRF:
+        return F::potrf(plan.handle, op.uplo, op.n, (T*)A, op.lda, work, plan.lwork, info);
+    case HIPSOLVER_ROUTINE_POTRS:
+        return F::potrs(plan.handle,
+                        op.uplo,
+                        op.n,
+                        op.nrhs,
+                        (T*)A,
+                        op.lda,
+                        (T*)B,
+                        op.ldb,
+                        work,
+                        plan.lwork,
+                        info);
+    case HIPSOLVER_ROUTINE_GEQRF:
+        return F::geqrf(plan.handle, op.m, op.n, (T*)A, op.lda, (T*)C, work, plan.lwork, info);
+    case HIPSOLVER_ROUTINE_SYEVD:
+        return F::syevd(
+            plan.handle, op.jobz, op.uplo, op.n, (T*)A, op.lda, (S*)C, work, plan.lwork, info);
+    default:
+        return HIPSOLVER_STATUS_NOT_SUPPORTED;
+    }
+}
+
+// Selects the launch function, queries the workspace size and returns the size of an
+// element of the workspace in elem_size
+static hipsolverStatus_t plan_setup(hipsolverPlan& plan, size_t* elem_size)
+{
+    const hipsolverWorkspaceOp_t& op = plan.desc;
+
+    plan.strideA = op.lda * op.n;
+    plan.strideP = op.routine == HIPSOLVER_ROUTINE_GETRF_STRIDED_BATCHED ? std::min(op.m, op.n)
+                                                                          : op.n;
+    plan.strideB = op.ldb * op.nrhs;
+
+    switch(op.precision)
+    {
+    case HIP_R_32F:
+        plan.launch = plan_launch<float>;
+        *elem_size  = sizeof(float);
+        return plan_workspace_size<float>(plan, &plan.lwork);
+    case HIP_R_64F:
+        plan.launch = plan_launch<double>;
+        *elem_size  = sizeof(double);
+        return plan_workspace_size<double>(plan, &plan.lwork);
+    case HIP_C_32F:
+        plan.launch = plan_launch<hipFloatComplex>;
+        *elem_size  = sizeof(hipFloatComplex);
+        return plan_workspace_size<hipFloatComplex>(plan, &plan.lwork);
+    case HIP_C_64F:
+        plan.launch = plan_launch<hipDoubleComplex>;
+        *elem_size  = sizeof(hipDoubleComplex);
+        return plan_workspace_size<hipDoubleComplex>(plan, &plan.lwork);
+    default:
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+    }
+}
+
+extern "C" {
+
+hipsolverStatus_t hipsolverDnCreatePlan(hipsolverHandle_t             handle,
+                                        const hipsolverWorkspaceOp_t* desc,
+                                        hipsolverDnPlan_t*            plan)
+try
+{
+    if(!handle)
+        return HIPSOLVER_STATUS_NOT_INITIALIZED;
+    if(!desc || !plan)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    std::unique_ptr<hipsolverPlan> p(new hipsolverPlan);
+    p->handle = handle;
+    p->desc   = *desc;
+
+    size_t elem_size;
+    CHECK_HIPSOLVER_ERROR(plan_setup(*p, &elem_size));
+
+    if(p->lwork > 0 && hipMalloc(&p->work, elem_size * p->lwork) != hipSuccess)
+        return HIPSOLVER_STATUS_ALLOC_FAILED;
+
+    *plan = p.release();
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnDestroyPlan(hipsolverDnPlan_t plan)
+try
+{
+    if(!plan)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    hipsolverPlan* p = (hipsolverPlan*)plan;
+    delete p;
+
+    return HIPSOLVER_STATUS_SUCCESS;
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+hipsolverStatus_t hipsolverDnExecutePlan(
+    hipsolverDnPlan_t plan, void* A, void* B, void* C, int* devIpiv, int* devInfo)
+try
+{
+    if(!plan)
+        return HIPSOLVER_STATUS_INVALID_VALUE;
+
+    const hipsolverPlan& p = *(hipsolverPlan*)plan;
+    return p.launch(p, A, B, C, devIpiv, devInfo);
+}
+catch(...)
+{
+    return hipsolver::exception2hip_status();
+}
+
+} //extern C